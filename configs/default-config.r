@@ -23,10 +23,12 @@ extensions: make map! [
     Clipboard -
     Console +
     Crypt +
+    CSV +
     Debugger +
     DNS +
     Filesystem +
     JavaScript -
+    JSON +
     Locale +
     Network +
     ODBC -
@@ -74,6 +76,17 @@ with-tcc: no
 ;
 pre-vista: no
 
+; Use computed-goto dispatch in the evaluator's main switch (GCC/Clang only,
+; see EVALUATOR_COMPUTED_GOTO in %reb-config.h)
+;
+computed-goto: no
+
+; Force always-inlining of the hottest cell and feed accessors, so the
+; evaluator's per-type cases compile to straight-line code (see
+; FORCE_HOT_INLINES in %reb-config.h).  Release builds only.
+;
+force-hot-inlines: no
+
 
 git-commit: null
 
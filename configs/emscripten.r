@@ -114,11 +114,13 @@ optimize: "s"
 extensions: make map! compose [
     Clipboard -
     Crypt -
+    CSV -
     Console +
     Debugger -
     DNS -
     Filesystem -
     JavaScript +
+    JSON -
     Locale -
     Network -
     ODBC -
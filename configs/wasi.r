@@ -101,11 +101,13 @@ optimize: if debug-wasi-extension [0] else ["s"]
 extensions: make map! compose [
     Clipboard -
     Crypt -
+    CSV -
     Console +
     Debugger -
     DNS -
     Filesystem -  ; libuv-based, see [1]
     JavaScript -  ; emscripten only (embed QuickJS? see [2])
+    JSON -
     Locale -
     Network -  ; libuv-based, see [1]
     ODBC -
@@ -59,6 +59,7 @@ depends: [
     ; BLOCK CIPHERS
     ;
     [%crypt/mbedtls/library/aes.c  #no-c++]
+    [%crypt/mbedtls/library/aesni.c  #no-c++]  ; x86-64 only, no-op elsewhere
 
     ; !!! Plain Diffie-Hellman(-Merkel) is considered weaker than the
     ; Elliptic Curve Diffie-Hellman (ECDH).  It was an easier first test case
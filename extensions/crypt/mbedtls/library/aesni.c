@@ -0,0 +1,373 @@
+/*
+ *  AES-NI support functions
+ *
+ *  Copyright The Mbed TLS Contributors
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+/*
+ * [AES-WP] https://www.intel.com/content/www/us/en/developer/articles/tool/
+ *          intel-advanced-encryption-standard-aes-instructions-set.html
+ *
+ * !!! NOTE FOR REBOL: This file replaces the upstream GNU-inline-assembly
+ * implementation with one based on the AES-NI compiler intrinsics, so that
+ * it builds with GCC, Clang, and MSVC.  See remarks in %aesni.h
+ */
+
+#include "common.h"
+
+#if defined(MBEDTLS_AESNI_C)
+
+#include "aesni.h"
+
+#if defined(MBEDTLS_HAVE_X86_64)
+
+#include <string.h>
+
+#include <wmmintrin.h>  /* AESKEYGENASSIST, AESENC, AESDEC, AESIMC... */
+
+#if defined(_MSC_VER)
+#include <intrin.h>  /* __cpuid() */
+#else
+#include <cpuid.h>  /* __get_cpuid() */
+#endif
+
+/*
+ * The intrinsics compile to AES instructions, which older compilers refuse
+ * to emit unless the whole translation unit is built with something like
+ * -maes.  Rather than require special build flags for one file, ask GCC and
+ * Clang to enable the instructions for this file only.  (Runtime dispatch
+ * via mbedtls_aesni_has_support() keeps it safe on CPUs without AES-NI.)
+ */
+#if defined(__GNUC__) && !defined(__AES__)
+#pragma GCC push_options
+#pragma GCC target("aes")
+#define AESNI_POP_TARGET_PRAGMA
+#endif
+
+/*
+ * AES-NI support detection routine, based on CPUID feature bits in ECX.
+ */
+int mbedtls_aesni_has_support( unsigned int what )
+{
+    static int done = 0;
+    static unsigned int c = 0;
+
+    if( ! done )
+    {
+#if defined(_MSC_VER)
+        int info[4] = { 0, 0, 0, 0 };
+        __cpuid( info, 1 );
+        c = (unsigned int) info[2];
+#else
+        unsigned int eax, ebx, edx;
+        if( __get_cpuid( 1, &eax, &ebx, &c, &edx ) == 0 )
+            c = 0;
+#endif
+        done = 1;
+    }
+
+    return( ( c & what ) != 0 );
+}
+
+/*
+ * AES-NI AES-ECB block en(de)cryption
+ */
+int mbedtls_aesni_crypt_ecb( mbedtls_aes_context *ctx,
+                             int mode,
+                             const unsigned char input[16],
+                             unsigned char output[16] )
+{
+    const __m128i *rk = (const __m128i *) ctx->rk;
+    unsigned nr = ctx->nr;  /* Number of remaining rounds */
+
+    /* Load round key 0 */
+    __m128i state;
+    memcpy( &state, input, 16 );
+    state = _mm_xor_si128( state, _mm_loadu_si128( rk ) );  /* state ^= *rk */
+    ++rk;
+    --nr;
+
+    if( mode == MBEDTLS_AES_DECRYPT )
+    {
+        while( nr != 0 )
+        {
+            state = _mm_aesdec_si128( state, _mm_loadu_si128( rk ) );
+            ++rk;
+            --nr;
+        }
+        state = _mm_aesdeclast_si128( state, _mm_loadu_si128( rk ) );
+    }
+    else
+    {
+        while( nr != 0 )
+        {
+            state = _mm_aesenc_si128( state, _mm_loadu_si128( rk ) );
+            ++rk;
+            --nr;
+        }
+        state = _mm_aesenclast_si128( state, _mm_loadu_si128( rk ) );
+    }
+
+    memcpy( output, &state, 16 );
+    return( 0 );
+}
+
+/*
+ * Compute decryption round keys from encryption round keys
+ */
+void mbedtls_aesni_inverse_key( unsigned char *invkey,
+                                const unsigned char *fwdkey, int nr )
+{
+    unsigned char *ik = invkey;
+    const unsigned char *fk = fwdkey + 16 * nr;
+
+    memcpy( ik, fk, 16 );
+
+    for( fk -= 16, ik += 16; fk > fwdkey; fk -= 16, ik += 16 )
+    {
+        __m128i v = _mm_aesimc_si128( _mm_loadu_si128( (const __m128i *) fk ) );
+        _mm_storeu_si128( (__m128i *) ik, v );
+    }
+
+    memcpy( ik, fk, 16 );
+}
+
+/*
+ * Key expansion, 128-bit case
+ */
+static __m128i aesni_set_rk_128( __m128i state, __m128i xword )
+{
+    /*
+     * Finish generating the next round key.
+     *
+     * On entry xword is r3:stuff:r1:stuff, the result of AESKEYGENASSIST,
+     * with r1 = rot( sub( r3 ) ) ^ RCON and r3 = sub( r3 ).
+     *
+     * On exit, xword is r7:r6:r5:r4, with
+     *   r4 = X + r1
+     *   r5 = X + r1 + Y
+     *   r6 = X + r1 + Y + Z
+     *   r7 = X + r1 + Y + Z + W
+     * where X:Y:Z:W (little-endian) is the current round key (state).
+     * These are the correct values of the next round key per [AES-WP].
+     */
+    xword = _mm_shuffle_epi32( xword, 0xff );  /* r1:r1:r1:r1 */
+    xword = _mm_xor_si128( xword, state );
+    state = _mm_slli_si128( state, 4 );
+    xword = _mm_xor_si128( xword, state );
+    state = _mm_slli_si128( state, 4 );
+    xword = _mm_xor_si128( xword, state );
+    state = _mm_slli_si128( state, 4 );
+    xword = _mm_xor_si128( xword, state );
+    return( xword );
+}
+
+static void aesni_setkey_enc_128( unsigned char *rk_bytes,
+                                  const unsigned char *key )
+{
+    /* The round key buffer is an array of uint32_t, so it cannot be assumed
+     * to have 16-byte alignment...use unaligned stores. */
+
+    __m128i *rk = (__m128i *) rk_bytes;
+    __m128i state;
+
+    memcpy( &state, key, 16 );
+    _mm_storeu_si128( rk, state );
+
+#define EXPAND_ROUND_128(n,rcon) \
+    state = aesni_set_rk_128( \
+        state, _mm_aeskeygenassist_si128( state, rcon ) ); \
+    _mm_storeu_si128( rk + n, state )
+
+    EXPAND_ROUND_128( 1, 0x01 );
+    EXPAND_ROUND_128( 2, 0x02 );
+    EXPAND_ROUND_128( 3, 0x04 );
+    EXPAND_ROUND_128( 4, 0x08 );
+    EXPAND_ROUND_128( 5, 0x10 );
+    EXPAND_ROUND_128( 6, 0x20 );
+    EXPAND_ROUND_128( 7, 0x40 );
+    EXPAND_ROUND_128( 8, 0x80 );
+    EXPAND_ROUND_128( 9, 0x1B );
+    EXPAND_ROUND_128( 10, 0x36 );
+
+#undef EXPAND_ROUND_128
+}
+
+/*
+ * Key expansion, 192-bit case
+ */
+static void aesni_set_rk_192( __m128i *state0, __m128i *state1,
+                              __m128i xword, unsigned char *rk )
+{
+    /*
+     * Generate the next 6 quarter-keys.
+     *
+     * On entry xword is stuff:stuff:r1:stuff, the result of AESKEYGENASSIST
+     * applied to the high half of the current key, with
+     * r1 = rot( sub( r3 ) ) ^ RCON.
+     *
+     * On exit, the low half of state0 followed by state1 (24 bytes) hold the
+     * next six round key words, which are also written out at rk.
+     */
+    xword = _mm_shuffle_epi32( xword, 0x55 );  /* r1:r1:r1:r1 */
+    xword = _mm_xor_si128( xword, *state0 );
+    *state0 = _mm_slli_si128( *state0, 4 );
+    xword = _mm_xor_si128( xword, *state0 );
+    *state0 = _mm_slli_si128( *state0, 4 );
+    xword = _mm_xor_si128( xword, *state0 );
+    *state0 = _mm_slli_si128( *state0, 4 );
+    xword = _mm_xor_si128( xword, *state0 );
+    *state0 = xword;
+
+    xword = _mm_shuffle_epi32( xword, 0xff );  /* high word of new state0 */
+    xword = _mm_xor_si128( xword, *state1 );
+    *state1 = _mm_slli_si128( *state1, 4 );
+    xword = _mm_xor_si128( xword, *state1 );
+    *state1 = xword;
+
+    memcpy( rk, state0, 16 );
+    memcpy( rk + 16, state1, 8 );
+}
+
+static void aesni_setkey_enc_192( unsigned char *rk,
+                                  const unsigned char *key )
+{
+    __m128i state0, state1;
+
+    memcpy( rk, key, 24 );
+
+    memcpy( &state0, rk, 16 );
+    memset( &state1, 0, sizeof( state1 ) );
+    memcpy( &state1, rk + 16, 8 );
+
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x01 ), rk + 24 * 1 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x02 ), rk + 24 * 2 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x04 ), rk + 24 * 3 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x08 ), rk + 24 * 4 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x10 ), rk + 24 * 5 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x20 ), rk + 24 * 6 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x40 ), rk + 24 * 7 );
+    aesni_set_rk_192( &state0, &state1,
+        _mm_aeskeygenassist_si128( state1, 0x80 ), rk + 24 * 8 );
+}
+
+/*
+ * Key expansion, 256-bit case
+ */
+static void aesni_set_rk_256( __m128i state0, __m128i state1, __m128i xword,
+                              __m128i *rk0, __m128i *rk1 )
+{
+    /*
+     * Generate the next two round keys.
+     *
+     * On entry xword is r3:stuff:r1:stuff, the result of AESKEYGENASSIST
+     * applied to the second-to-last round key, with
+     * r1 = rot( sub( r3 ) ) ^ RCON.
+     */
+    xword = _mm_shuffle_epi32( xword, 0xff );
+    xword = _mm_xor_si128( xword, state0 );
+    state0 = _mm_slli_si128( state0, 4 );
+    xword = _mm_xor_si128( xword, state0 );
+    state0 = _mm_slli_si128( state0, 4 );
+    xword = _mm_xor_si128( xword, state0 );
+    state0 = _mm_slli_si128( state0, 4 );
+    xword = _mm_xor_si128( xword, state0 );
+    *rk0 = xword;
+
+    /* Set xword to stuff:Y:stuff:stuff with Y = subword( r4 ), where r4 is
+     * the last word of the previous round key.  (No RCON in this step.) */
+    xword = _mm_aeskeygenassist_si128( *rk0, 0x00 );
+    xword = _mm_shuffle_epi32( xword, 0xaa );
+    xword = _mm_xor_si128( xword, state1 );
+    state1 = _mm_slli_si128( state1, 4 );
+    xword = _mm_xor_si128( xword, state1 );
+    state1 = _mm_slli_si128( state1, 4 );
+    xword = _mm_xor_si128( xword, state1 );
+    state1 = _mm_slli_si128( state1, 4 );
+    xword = _mm_xor_si128( xword, state1 );
+    *rk1 = xword;
+}
+
+static void aesni_setkey_enc_256( unsigned char *rk_bytes,
+                                  const unsigned char *key )
+{
+    __m128i *rk = (__m128i *) rk_bytes;
+    __m128i state0, state1;
+
+    memcpy( &state0, key, 16 );
+    memcpy( &state1, key + 16, 16 );
+    _mm_storeu_si128( rk, state0 );
+    _mm_storeu_si128( rk + 1, state1 );
+
+    /*
+     * Main "loop" - unrolled so the round constants are immediates, as
+     * required by the AESKEYGENASSIST instruction.
+     */
+#define EXPAND_ROUND_256(n,rcon) \
+    do { \
+        __m128i rk0, rk1; \
+        aesni_set_rk_256( state0, state1, \
+            _mm_aeskeygenassist_si128( state1, rcon ), &rk0, &rk1 ); \
+        _mm_storeu_si128( rk + n, rk0 ); \
+        _mm_storeu_si128( rk + n + 1, rk1 ); \
+        state0 = rk0; \
+        state1 = rk1; \
+    } while( 0 )
+
+    EXPAND_ROUND_256( 2, 0x01 );
+    EXPAND_ROUND_256( 4, 0x02 );
+    EXPAND_ROUND_256( 6, 0x04 );
+    EXPAND_ROUND_256( 8, 0x08 );
+    EXPAND_ROUND_256( 10, 0x10 );
+    EXPAND_ROUND_256( 12, 0x20 );
+    EXPAND_ROUND_256( 14, 0x40 );
+
+#undef EXPAND_ROUND_256
+}
+
+/*
+ * Key expansion (for encryption)
+ */
+int mbedtls_aesni_setkey_enc( unsigned char *rk,
+                              const unsigned char *key,
+                              size_t bits )
+{
+    switch( bits )
+    {
+        case 128: aesni_setkey_enc_128( rk, key ); break;
+        case 192: aesni_setkey_enc_192( rk, key ); break;
+        case 256: aesni_setkey_enc_256( rk, key ); break;
+        default : return( MBEDTLS_ERR_AES_INVALID_KEY_LENGTH );
+    }
+
+    return( 0 );
+}
+
+#if defined(AESNI_POP_TARGET_PRAGMA)
+#pragma GCC pop_options
+#undef AESNI_POP_TARGET_PRAGMA
+#endif
+
+#endif /* MBEDTLS_HAVE_X86_64 */
+
+#endif /* MBEDTLS_AESNI_C */
@@ -0,0 +1,476 @@
+//
+//  File: %mod-csv.c
+//  Summary: "CSV/TSV Codec"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2022 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/csv/README.md
+//
+// This is a native reader and writer for delimiter-separated text in the
+// RFC 4180 style: comma (or any ASCII character) between fields, CRLF or
+// LF between rows, and double-quoted fields--with "" escaping--that may
+// contain delimiters and newlines.  Ingesting tabular data through PARSE
+// rules works, but builds every field through generalized rule machinery;
+// this decoder is one C pass over the bytes, in the same style as the
+// JSON extension:
+//
+// * Each row's fields collect on the data stack and pop into an
+//   exact-sized BLOCK!, and the rows do the same.
+//
+// * Field text reuses the shared mold buffer, appended as whole spans
+//   (which is also where UTF-8 validation happens).
+//
+// * /COLUMNS projects the output: fields outside the requested columns
+//   are skipped over without materializing a TEXT! at all.
+//
+// * /INTERN shares one frozen TEXT! among identical field strings, which
+//   can collapse the memory for low-cardinality columns by orders of
+//   magnitude.  (Freezing is what makes the sharing sound--handing out
+//   the same mutable string many times would alias updates.)
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-csv.h"
+
+
+typedef struct {
+    const Byte* at;
+    const Byte* tail;
+    Byte delimiter;
+    REBMAP* interns;  // nullptr if /INTERN not in effect
+} CsvScan;
+
+// Scans one field and pushes its TEXT! to the data stack...unless `skip` is
+// set, in which case the bytes are only stepped over (how /COLUMNS avoids
+// materializing unrequested fields).
+//
+static void Scan_Csv_Field(CsvScan* cs, bool skip)
+{
+    DECLARE_MOLD (mo);
+    if (not skip)
+        Push_Mold(mo);
+
+    if (cs->at != cs->tail and *cs->at == '"') {  // quoted field
+        ++cs->at;
+        const Byte* start = cs->at;
+        while (true) {
+            if (cs->at == cs->tail)
+                fail ("Unterminated quoted field in CSV data");
+
+            if (*cs->at != '"') {
+                ++cs->at;  // delimiters and newlines are literal when quoted
+                continue;
+            }
+
+            if (not skip and cs->at != start)
+                Append_Utf8(mo->series, cs_cast(start), cs->at - start);
+            ++cs->at;
+
+            if (cs->at != cs->tail and *cs->at == '"') {  // "" gives one "
+                if (not skip)
+                    Append_Codepoint(mo->series, '"');
+                ++cs->at;
+                start = cs->at;
+                continue;
+            }
+            break;  // was the closing quote
+        }
+    }
+    else {
+        const Byte* start = cs->at;
+        while (
+            cs->at != cs->tail
+            and *cs->at != cs->delimiter
+            and *cs->at != CR and *cs->at != LF
+        ){
+            ++cs->at;
+        }
+        if (not skip and cs->at != start)
+            Append_Utf8(mo->series, cs_cast(start), cs->at - start);
+    }
+
+    if (skip)
+        return;
+
+    String(*) s = Pop_Molded_String(mo);
+    Init_Text(PUSH(), s);
+
+    if (cs->interns) {
+        const bool strict = true;
+        REBLEN n = Find_Map_Entry(  // find only (no value given)
+            cs->interns, TOP, SPECIFIED, nullptr, SPECIFIED, strict
+        );
+        if (n != 0)
+            Copy_Cell(TOP, ARR_AT(MAP_PAIRLIST(cs->interns), (n - 1) * 2));
+        else {
+            SET_SERIES_INFO(s, FROZEN_SHALLOW);  // sharing mutables aliases
+            Find_Map_Entry(
+                cs->interns, TOP, SPECIFIED, TOP, SPECIFIED, strict
+            );
+        }
+    }
+}
+
+// Consumes the row terminator (CRLF, lone LF, or lone CR) if one is present.
+// Anything else here means stray characters followed a closing quote.
+//
+static void Finish_Csv_Row(CsvScan* cs)
+{
+    if (cs->at == cs->tail)
+        return;
+    if (*cs->at == CR) {
+        ++cs->at;
+        if (cs->at != cs->tail and *cs->at == LF)
+            ++cs->at;
+        return;
+    }
+    if (*cs->at == LF) {
+        ++cs->at;
+        return;
+    }
+    fail ("Malformed CSV (data between closing quote and delimiter)");
+}
+
+// Case-insensitive ASCII comparison for matching /COLUMNS names against
+// header row fields (headers in the wild vary in capitalization).
+//
+static bool Csv_Name_Matches(Cell(const*) name, Cell(const*) field)
+{
+    Size name_size;
+    const Byte* np = cast(const Byte*, VAL_UTF8_SIZE_AT(&name_size, name));
+
+    Size field_size;
+    const Byte* fp = cast(const Byte*, VAL_UTF8_SIZE_AT(&field_size, field));
+
+    if (name_size != field_size)
+        return false;
+
+    Size i;
+    for (i = 0; i < name_size; ++i) {
+        Byte n = np[i];
+        Byte f = fp[i];
+        if (n >= 'A' and n <= 'Z')
+            n += 'a' - 'A';
+        if (f >= 'A' and f <= 'Z')
+            f += 'a' - 'A';
+        if (n != f)
+            return false;
+    }
+    return true;
+}
+
+
+//
+//  export identify-csv?: native [
+//
+//  {Codec for identifying BINARY! data for a .CSV file}
+//
+//      return: [logic?]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(identify_csv_q)
+{
+    CSV_INCLUDE_PARAMS_OF_IDENTIFY_CSV_Q;
+
+    UNUSED(ARG(data));  // almost any text is valid CSV, only suffix matters
+
+    return Init_True(OUT);
+}
+
+
+//
+//  export decode-csv: native [
+//
+//  {Decode delimiter-separated text (CSV/TSV) into a block of row blocks}
+//
+//      return: "Rows as BLOCK!s of TEXT! (skipped columns give BLANK!)"
+//          [block!]
+//      data [binary! text!]
+//      /delimiter "Field separator (default comma)"
+//          [char!]
+//      /columns "Only these columns, by 1-based index or header name"
+//          [block!]
+//      /intern "Share one frozen TEXT! among identical field strings"
+//  ]
+//
+DECLARE_NATIVE(decode_csv)
+//
+// 1. If any requested column is a name, the first row is read as a header
+//    row to resolve it...and is consumed (it does not appear in the output).
+//    An all-integer request leaves the data untouched, header and all.
+//
+// 2. The row's cells are pushed up front as BLANK! and overwritten as the
+//    requested columns are encountered, so short rows just leave blanks and
+//    requested-order is honored (e.g. /COLUMNS [3 1] swaps).
+{
+    CSV_INCLUDE_PARAMS_OF_DECODE_CSV;
+
+    Size size;
+    const Byte* bp;
+    if (IS_BINARY(ARG(data)))
+        bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    else
+        bp = cast(const Byte*, VAL_UTF8_SIZE_AT(&size, ARG(data)));
+
+    CsvScan cs;
+    cs.at = bp;
+    cs.tail = bp + size;
+
+    if (REF(delimiter)) {
+        Codepoint c = VAL_CHAR(ARG(delimiter));
+        if (c == '\0' or c > 0x7F or c == '"' or c == CR or c == LF)
+            fail (PARAM(delimiter));
+        cs.delimiter = cast(Byte, c);
+    }
+    else
+        cs.delimiter = ',';
+
+    cs.interns = nullptr;
+    if (REF(intern)) {
+        cs.interns = Make_Map(64);
+        Init_Map(ARG(intern), cs.interns);  // keep it GC-visible in frame
+    }
+
+    REBLEN n_out = 0;  // number of projected columns (0 if no /COLUMNS)
+    REBLEN *wanted = nullptr;  // 1-based source column per output slot
+
+    if (REF(columns)) {
+        Cell(const*) tail;
+        Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(columns));
+        n_out = tail - item;
+        if (n_out == 0)
+            fail (PARAM(columns));
+
+        bool any_names = false;
+        Cell(const*) check = item;
+        for (; check != tail; ++check) {
+            if (IS_INTEGER(check))
+                continue;
+            if (ANY_UTF8_KIND(CELL_HEART(check)) and not IS_QUOTED(check)) {
+                any_names = true;
+                continue;
+            }
+            fail (PARAM(columns));
+        }
+
+        StackIndex header_base = TOP_INDEX;
+        if (any_names) {  // names resolve against a header row, see [1]
+            while (true) {
+                Scan_Csv_Field(&cs, false);
+                if (cs.at != cs.tail and *cs.at == cs.delimiter) {
+                    ++cs.at;
+                    continue;
+                }
+                break;
+            }
+            Finish_Csv_Row(&cs);
+        }
+
+        wanted = rebAllocN(REBLEN, n_out);
+
+        REBLEN k = 0;
+        for (; item != tail; ++item, ++k) {
+            if (IS_INTEGER(item)) {
+                REBI64 i = VAL_INT64(item);
+                if (i <= 0 or i > INT32_MAX) {
+                    rebFree(wanted);
+                    fail (PARAM(columns));
+                }
+                wanted[k] = cast(REBLEN, i);
+                continue;
+            }
+
+            StackIndex f = header_base + 1;
+            for (; f != TOP_INDEX + 1; ++f) {
+                if (Csv_Name_Matches(item, Data_Stack_At(f)))
+                    break;
+            }
+            if (f == TOP_INDEX + 1) {
+                rebFree(wanted);
+                fail (PARAM(columns));  // no matching header field
+            }
+            wanted[k] = f - header_base;
+        }
+
+        Drop_Data_Stack_To(header_base);  // header row is consumed
+    }
+
+    StackIndex rows_base = TOP_INDEX;
+
+    while (cs.at != cs.tail) {
+        StackIndex row_base = TOP_INDEX;
+
+        if (n_out != 0) {
+            REBLEN k;
+            for (k = 0; k < n_out; ++k)
+                Init_Blank(PUSH());  // overwritten when found, see [2]
+        }
+
+        REBLEN col = 0;
+        while (true) {
+            ++col;
+
+            if (n_out == 0)
+                Scan_Csv_Field(&cs, false);
+            else {
+                bool found = false;
+                REBLEN k;
+                for (k = 0; k < n_out; ++k) {
+                    if (wanted[k] == col) {
+                        found = true;
+                        break;
+                    }
+                }
+                Scan_Csv_Field(&cs, not found);
+                if (found) {
+                    for (k = 0; k < n_out; ++k) {
+                        if (wanted[k] == col)
+                            Copy_Cell(Data_Stack_At(row_base + 1 + k), TOP);
+                    }
+                    DROP();
+                }
+            }
+
+            if (cs.at != cs.tail and *cs.at == cs.delimiter) {
+                ++cs.at;
+                continue;
+            }
+            break;
+        }
+
+        Finish_Csv_Row(&cs);
+
+        Init_Block(PUSH(), Pop_Stack_Values(row_base));
+    }
+
+    if (wanted)
+        rebFree(wanted);
+
+    return Init_Block(OUT, Pop_Stack_Values(rows_base));
+}
+
+
+static void Mold_Csv_Field(REB_MOLD* mo, Cell(const*) v, Byte delimiter)
+{
+    if (IS_BLANK(v))
+        return;  // blank field molds as nothing at all
+
+    if (CELL_HEART(v) == REB_INTEGER and not IS_QUOTED(v)) {
+        Byte buf[60];
+        REBINT len = Emit_Integer(buf, VAL_INT64(v));
+        Append_Ascii_Len(mo->series, s_cast(buf), len);
+        return;
+    }
+
+    if (CELL_HEART(v) == REB_DECIMAL and not IS_QUOTED(v)) {
+        Byte buf[60];
+        REBINT len = Emit_Decimal(buf, VAL_DECIMAL(v), 0, '.', mo->digits);
+        Append_Ascii_Len(mo->series, s_cast(buf), len);
+        return;
+    }
+
+    if (IS_QUOTED(v) or IS_QUASI(v) or not ANY_UTF8_KIND(CELL_HEART(v)))
+        fail ("CSV fields must be string-like, INTEGER!, DECIMAL!, or BLANK!");
+
+    Size size;
+    const Byte* bp = cast(const Byte*, VAL_UTF8_SIZE_AT(&size, v));
+    const Byte* tail = bp + size;
+
+    bool needs_quotes = false;
+    const Byte* scan = bp;
+    for (; scan != tail; ++scan) {
+        Byte b = *scan;
+        if (b == delimiter or b == '"' or b == CR or b == LF) {
+            needs_quotes = true;
+            break;
+        }
+    }
+
+    if (not needs_quotes) {
+        if (size != 0)
+            Append_Utf8(mo->series, cs_cast(bp), size);
+        return;
+    }
+
+    Append_Codepoint(mo->series, '"');
+    const Byte* start = bp;
+    for (scan = bp; scan != tail; ++scan) {
+        if (*scan != '"')
+            continue;
+        Append_Utf8(mo->series, cs_cast(start), scan - start + 1);
+        Append_Codepoint(mo->series, '"');  // double it
+        start = scan + 1;
+    }
+    if (scan != start)
+        Append_Utf8(mo->series, cs_cast(start), scan - start);
+    Append_Codepoint(mo->series, '"');
+}
+
+
+//
+//  export encode-csv: native [
+//
+//  {Encode a block of row blocks as delimiter-separated text}
+//
+//      return: [binary!]
+//      data "Rows as BLOCK!s of string-like, INTEGER!, DECIMAL!, or BLANK!"
+//          [block!]
+//      /delimiter "Field separator (default comma)"
+//          [char!]
+//  ]
+//
+DECLARE_NATIVE(encode_csv)
+{
+    CSV_INCLUDE_PARAMS_OF_ENCODE_CSV;
+
+    Byte delimiter;
+    if (REF(delimiter)) {
+        Codepoint c = VAL_CHAR(ARG(delimiter));
+        if (c == '\0' or c > 0x7F or c == '"' or c == CR or c == LF)
+            fail (PARAM(delimiter));
+        delimiter = cast(Byte, c);
+    }
+    else
+        delimiter = ',';
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    Cell(const*) tail;
+    Cell(const*) row = VAL_ARRAY_AT(&tail, ARG(data));
+    for (; row != tail; ++row) {
+        if (IS_QUOTED(row) or CELL_HEART(row) != REB_BLOCK)
+            fail ("CSV data must be a block of row BLOCK!s");
+
+        Cell(const*) field_tail;
+        Cell(const*) field_head = VAL_ARRAY_AT(&field_tail, row);
+        Cell(const*) field = field_head;
+        for (; field != field_tail; ++field) {
+            if (field != field_head)
+                Append_Codepoint(mo->series, delimiter);
+            Mold_Csv_Field(mo, field, delimiter);
+        }
+
+        Append_Ascii(mo->series, "\r\n");  // RFC 4180 row terminator
+    }
+
+    return Init_Binary(OUT, Pop_Molded_Binary(mo));
+}
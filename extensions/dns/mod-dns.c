@@ -29,12 +29,14 @@
 //     >> read dns://162.216.18.225
 //     == "rebol.com"
 //
-// See %extensions/dns/README.md regarding why asynchronous DNS was removed.
+// See %extensions/dns/README.md regarding the history of asynchronous DNS.
 //
 //=//// NOTES //////////////////////////////////////////////////////////////=//
 //
 // * This extension expects to be loaded alongside the networking extension,
 //   as it does not call WSAStartup() itself to start up sockets on Windows.
+//   Forward lookups are also delegated to that extension's RESOLVE-HOST, so
+//   they share its libuv-based resolution and hostname cache.
 //
 
 #include "reb-config.h"
@@ -90,7 +92,7 @@ static Bounce DNS_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         INCLUDE_PARAMS_OF_READ;
         UNUSED(PARAM(source));  // covered by `port`
 
-        if (REF(part) or REF(seek))
+        if (REF(part) or REF(seek) or REF(mmap))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
@@ -129,20 +131,20 @@ static Bounce DNS_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
                 rebRelease(tuple);
             }
 
-            char *name = rebSpell(host);
-
             // example.com => 93.184.216.34
-            HOSTENT *he = gethostbyname(name);
-
-            rebFree(name);
-            if (he != nullptr)
-                return Init_Tuple_Bytes(OUT, cast(Byte*, *he->h_addr_list), 4);
-
-            // ...else fall through to error handling...
+            //
+            // Forward lookups defer to the network extension's RESOLVE-HOST,
+            // sharing its asynchronous libuv resolution and TTL cache.  (This
+            // extension already relies on the network extension having done
+            // the socket startup, see note at top of file.)
+            //
+            return rebValue("resolve-host", host);  // null if host unknown
         }
         else
             fail (Error_On_Port(SYM_INVALID_SPEC, port, -10));
 
+        // (Reverse lookup falls through to here on failure.)
+
         switch (h_errno) {
           case HOST_NOT_FOUND:  // The specified host is unknown
           case NO_ADDRESS:  // (or NO_DATA) name is valid but has no IP
@@ -0,0 +1,15 @@
+REBOL []
+
+name: 'FFI
+source: %ffi/mod-ffi.c
+includes: [
+    %prep/extensions/ffi  ;for %tmp-mod-ffi.h
+]
+
+; dlopen()/dlsym() live in libdl on Linux (folded into libc elsewhere)
+;
+libraries: switch system-config/os-base [
+    'linux [
+        [%dl]
+    ]
+] else [null]  ; can't use null fallout in bootstrap
@@ -0,0 +1,513 @@
+//
+//  File: %mod-ffi.c
+//  Summary: "Call functions in shared libraries loaded at runtime"
+//  Section: Extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2023 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// This extension lets scripts call C functions out of shared libraries
+// without recompiling the interpreter, and without a libffi dependency.
+// See %extensions/ffi/README.md for the scope that buys and the scope it
+// costs.
+//
+// The key to making calls affordable in loops is that all the decisions are
+// made once, at FFI-ROUTINE time: the signature block is compiled into a
+// ROUTINE "marshal plan" that records each argument's C type and which
+// register-class slot it lands in.  FFI-CALL then just walks the plan,
+// converting cells straight into the call's argument slots--no intermediate
+// block is built, and nothing about the signature is re-examined.
+//
+// The call itself leans on a property shared by the two supported ABIs
+// (System V AMD64, and AAPCS64 on 64-bit ARM): integer-class and float-class
+// arguments are assigned to *separate* register sequences.  A callee
+// expecting (int, double, char*) reads the first integer register, the first
+// float register, and the second integer register...no matter how the
+// classes interleave in the prototype.  So one fixed prototype--six
+// integer-class parameters followed by eight float-class ones, all in
+// registers--can invoke any function whose arguments fit those limits, with
+// each actual argument steered to its class's next slot.  (This is why
+// Win64 is not supported: its ABI assigns both classes from one positional
+// sequence, so no fixed prototype covers the combinations.)
+//
+
+#include "reb-config.h"
+
+#if !defined(_WIN32) && (defined(__x86_64__) || defined(__aarch64__))
+    #define FFI_CALLS_SUPPORTED 1
+    #include <dlfcn.h>
+#else
+    #define FFI_CALLS_SUPPORTED 0
+#endif
+
+#include <stdlib.h>  // malloc()/free(), see cleanup_routine()
+#include <string.h>
+
+#include "sys-core.h"
+
+#include "tmp-mod-ffi.h"
+
+
+//=//// TYPES AND MARSHAL PLANS ///////////////////////////////////////////=//
+
+enum FfiValueType {
+    FFI_TYPE_VOID = 0,  // return only
+    FFI_TYPE_INT8,
+    FFI_TYPE_UINT8,
+    FFI_TYPE_INT16,
+    FFI_TYPE_UINT16,
+    FFI_TYPE_INT32,
+    FFI_TYPE_UINT32,
+    FFI_TYPE_INT64,
+    FFI_TYPE_UINT64,
+    FFI_TYPE_POINTER,  // raw address as INTEGER!, or BLANK! for NULL
+    FFI_TYPE_TEXT,  // const char* aliasing a TEXT!'s UTF-8 data
+    FFI_TYPE_BINARY,  // uint8_t* aliasing a BINARY!'s data (may be written)
+    FFI_TYPE_FLOAT,
+    FFI_TYPE_DOUBLE,
+    FFI_TYPE_MAX
+};
+
+// Both supported ABIs pass (at least) six integer-class and eight
+// float-class arguments in registers.  Staying inside the register file is
+// what lets one fixed prototype stand in for all the callee prototypes, so
+// these are hard limits--FFI-ROUTINE refuses signatures beyond them.
+//
+#define FFI_MAX_INT_ARGS 6
+#define FFI_MAX_FLOAT_ARGS 8
+#define FFI_MAX_ARGS (FFI_MAX_INT_ARGS + FFI_MAX_FLOAT_ARGS)
+
+// A ROUTINE is a compiled marshal plan: everything FFI-CALL needs to know,
+// precomputed from the signature block so calls in loops don't pay for any
+// of the deciding.  Freed by the HANDLE!'s GC cleanup function.
+//
+typedef struct {
+    void *fn;  // resolved symbol address
+    Byte ret_type;  // FfiValueType of the return value
+    Byte num_args;
+    Byte arg_type[FFI_MAX_ARGS];  // FfiValueType per argument
+    Byte arg_slot[FFI_MAX_ARGS];  // slot in its class's register sequence
+} ROUTINE;
+
+static enum FfiValueType Ffi_Type_From_Word(Cell(const*) word) {
+    if (not IS_WORD(word))
+        return FFI_TYPE_MAX;
+
+    const char *name = STR_UTF8(VAL_WORD_SYMBOL(word));
+    if (strcmp(name, "void") == 0) return FFI_TYPE_VOID;
+    if (strcmp(name, "int8") == 0) return FFI_TYPE_INT8;
+    if (strcmp(name, "uint8") == 0) return FFI_TYPE_UINT8;
+    if (strcmp(name, "int16") == 0) return FFI_TYPE_INT16;
+    if (strcmp(name, "uint16") == 0) return FFI_TYPE_UINT16;
+    if (strcmp(name, "int32") == 0) return FFI_TYPE_INT32;
+    if (strcmp(name, "uint32") == 0) return FFI_TYPE_UINT32;
+    if (strcmp(name, "int64") == 0) return FFI_TYPE_INT64;
+    if (strcmp(name, "uint64") == 0) return FFI_TYPE_UINT64;
+    if (strcmp(name, "pointer") == 0) return FFI_TYPE_POINTER;
+    if (strcmp(name, "text") == 0) return FFI_TYPE_TEXT;
+    if (strcmp(name, "binary") == 0) return FFI_TYPE_BINARY;
+    if (strcmp(name, "float") == 0) return FFI_TYPE_FLOAT;
+    if (strcmp(name, "double") == 0) return FFI_TYPE_DOUBLE;
+
+    return FFI_TYPE_MAX;
+}
+
+inline static bool Is_Float_Class(enum FfiValueType t)
+  { return t == FFI_TYPE_FLOAT or t == FFI_TYPE_DOUBLE; }
+
+
+//=//// CALL PROTOTYPES ///////////////////////////////////////////////////=//
+//
+// One prototype per return class.  The parameter lists are identical: six
+// integer-class slots then eight float-class slots, all register-assigned
+// under both supported ABIs.  Callees simply don't read the slots their
+// prototype doesn't mention.  (FLOAT32 returns need their own prototype,
+// because a float comes back in the low lane of the return register and
+// reading it as a double would reinterpret the bits.)
+//
+
+#if FFI_CALLS_SUPPORTED
+
+typedef intptr_t (*CallIntFunc)(
+    intptr_t, intptr_t, intptr_t, intptr_t, intptr_t, intptr_t,
+    double, double, double, double, double, double, double, double
+);
+typedef double (*CallDoubleFunc)(
+    intptr_t, intptr_t, intptr_t, intptr_t, intptr_t, intptr_t,
+    double, double, double, double, double, double, double, double
+);
+typedef float (*CallFloatFunc)(
+    intptr_t, intptr_t, intptr_t, intptr_t, intptr_t, intptr_t,
+    double, double, double, double, double, double, double, double
+);
+
+#endif
+
+
+//=//// HANDLE CLEANUP ////////////////////////////////////////////////////=//
+
+#if FFI_CALLS_SUPPORTED
+
+static void cleanup_library(const REBVAL *v) {
+    void *dl = VAL_HANDLE_VOID_POINTER(v);
+    if (dl != nullptr)  // already closed explicitly by FFI-CLOSE
+        dlclose(dl);
+}
+
+static void cleanup_routine(const REBVAL *v) {
+    ROUTINE *r = cast(ROUTINE*, VAL_HANDLE_VOID_POINTER(v));
+    free(r);  // not rebFree(), cleanup can run during shutdown (no API!)
+}
+
+#endif
+
+
+//
+//  export ffi-open: native [
+//
+//  {Load a shared library for calling through FFI-ROUTINE}
+//
+//      return: [handle!]
+//      path "Local text is passed to the loader verbatim (e.g. %libm.so.6)"
+//          [file! text!]
+//  ]
+//
+DECLARE_NATIVE(ffi_open)
+{
+    FFI_INCLUDE_PARAMS_OF_FFI_OPEN;
+
+  #if !FFI_CALLS_SUPPORTED
+    UNUSED(ARG(path));
+    rebJumps ("fail {FFI calls are not supported on this platform/ABI}");
+  #else
+    char *path = rebSpell(
+        "either file?", ARG(path),
+            "[file-to-local", ARG(path), "]",
+            "[copy", ARG(path), "]"
+    );
+
+    void *dl = dlopen(path, RTLD_NOW);
+    rebFree(path);
+
+    if (dl == nullptr)
+        rebJumps ("fail [{FFI cannot open library:}", rebT(dlerror()), "]");
+
+    return rebHandle(dl, 0, &cleanup_library);
+  #endif
+}
+
+
+//
+//  export ffi-close: native [
+//
+//  {Unload a shared library (outstanding routines into it become invalid!)}
+//
+//      return: <none>
+//      library [handle!]
+//  ]
+//
+DECLARE_NATIVE(ffi_close)
+{
+    FFI_INCLUDE_PARAMS_OF_FFI_CLOSE;
+
+  #if !FFI_CALLS_SUPPORTED
+    UNUSED(ARG(library));
+    rebJumps ("fail {FFI calls are not supported on this platform/ABI}");
+  #else
+    void *dl = VAL_HANDLE_VOID_POINTER(ARG(library));
+    if (dl == nullptr)
+        rebJumps ("fail {Library already closed}");
+
+    dlclose(dl);
+    SET_HANDLE_CDATA(ARG(library), nullptr);  // don't dlclose again in GC
+
+    return rebNone();
+  #endif
+}
+
+
+//
+//  export ffi-routine: native [
+//
+//  {Compile a marshal plan for a function exported by a loaded library}
+//
+//      return: [handle!]
+//      library [handle!]
+//      name "Exported symbol name" [text!]
+//      spec "Return type, then block of argument types, e.g. [int32 [text]]"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(ffi_routine)
+//
+// All signature validation happens here, once.  The resulting ROUTINE holds
+// the resolved symbol address plus each argument's type and register-class
+// slot--so FFI-CALL does no parsing, no lookup, and no class assignment.
+{
+    FFI_INCLUDE_PARAMS_OF_FFI_ROUTINE;
+
+  #if !FFI_CALLS_SUPPORTED
+    UNUSED(ARG(library));
+    UNUSED(ARG(name));
+    UNUSED(ARG(spec));
+    rebJumps ("fail {FFI calls are not supported on this platform/ABI}");
+  #else
+    void *dl = VAL_HANDLE_VOID_POINTER(ARG(library));
+    if (dl == nullptr)
+        rebJumps ("fail {Library has been closed}");
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(spec));
+
+    if (tail - item != 2 or not IS_BLOCK(item + 1))
+        rebJumps (
+            "fail {FFI spec must be a return type and an argument block}"
+        );
+
+    enum FfiValueType ret_type = Ffi_Type_From_Word(item);
+    if (ret_type == FFI_TYPE_MAX or ret_type == FFI_TYPE_BINARY)
+        rebJumps ("fail {Unknown FFI return type in spec}");
+
+    Cell(const*) args_tail;
+    Cell(const*) arg = VAL_ARRAY_AT(&args_tail, item + 1);
+
+    if (args_tail - arg > FFI_MAX_ARGS)
+        rebJumps ("fail {Too many arguments in FFI spec}");
+
+    ROUTINE *r = cast(ROUTINE*, malloc(sizeof(ROUTINE)));
+    if (r == nullptr)
+        rebJumps ("fail {Could not allocate FFI routine}");
+
+    r->ret_type = ret_type;
+    r->num_args = args_tail - arg;
+
+    Byte num_ints = 0;
+    Byte num_floats = 0;
+
+    REBLEN i = 0;
+    for (; arg != args_tail; ++arg, ++i) {
+        enum FfiValueType t = Ffi_Type_From_Word(arg);
+        if (t == FFI_TYPE_MAX or t == FFI_TYPE_VOID) {
+            free(r);
+            rebJumps (
+                "fail [{Unknown FFI type for argument}", rebI(i + 1), "]"
+            );
+        }
+
+        r->arg_type[i] = t;
+        r->arg_slot[i] = Is_Float_Class(t) ? num_floats++ : num_ints++;
+    }
+
+    if (num_ints > FFI_MAX_INT_ARGS or num_floats > FFI_MAX_FLOAT_ARGS) {
+        free(r);
+        rebJumps ("fail {Too many FFI arguments of one register class}");
+    }
+
+    char *name = rebSpell(ARG(name));
+    r->fn = dlsym(dl, name);
+    rebFree(name);
+
+    if (r->fn == nullptr) {
+        free(r);
+        rebJumps (
+            "fail [{FFI cannot find symbol}", ARG(name), "{in library}]"
+        );
+    }
+
+    return rebHandle(r, sizeof(ROUTINE), &cleanup_routine);
+  #endif
+}
+
+
+//
+//  export ffi-call: native [
+//
+//  {Call a routine made by FFI-ROUTINE, converting arguments per its plan}
+//
+//      return: "NULL for a null text return, none for void"
+//          [<opt> any-value!]
+//      routine [handle!]
+//      args "One value per argument in the routine's spec"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(ffi_call)
+//
+// Arguments convert straight out of their cells into the call's register
+// slots.  TEXT! and BINARY! pass a pointer to their actual UTF-8/byte data
+// ("pinned" costs nothing here: series data never moves underneath a native
+// that isn't resizing it, so no copy is made--the callee writes BINARY!
+// bytes in place, and must treat TEXT! data as const).
+{
+    FFI_INCLUDE_PARAMS_OF_FFI_CALL;
+
+  #if !FFI_CALLS_SUPPORTED
+    UNUSED(ARG(routine));
+    UNUSED(ARG(args));
+    rebJumps ("fail {FFI calls are not supported on this platform/ABI}");
+  #else
+    ROUTINE *r = cast(ROUTINE*, VAL_HANDLE_VOID_POINTER(ARG(routine)));
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(args));
+
+    if (tail - item != r->num_args)
+        rebJumps ("fail {Wrong number of arguments for FFI routine}");
+
+    intptr_t ints[FFI_MAX_INT_ARGS] = {0, 0, 0, 0, 0, 0};
+    double floats[FFI_MAX_FLOAT_ARGS] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+    REBLEN i = 0;
+    for (; item != tail; ++item, ++i) {
+        enum FfiValueType t = cast(enum FfiValueType, r->arg_type[i]);
+        Byte slot = r->arg_slot[i];
+
+        switch (t) {
+          case FFI_TYPE_INT8:
+          case FFI_TYPE_UINT8:
+          case FFI_TYPE_INT16:
+          case FFI_TYPE_UINT16:
+          case FFI_TYPE_INT32:
+          case FFI_TYPE_UINT32:
+          case FFI_TYPE_INT64:
+          case FFI_TYPE_UINT64:
+            if (not IS_INTEGER(item))
+                goto bad_arg;
+            ints[slot] = cast(intptr_t, VAL_INT64(item));
+            break;
+
+          case FFI_TYPE_POINTER:
+            if (IS_BLANK(item))
+                ints[slot] = 0;  // NULL pointer
+            else if (IS_INTEGER(item))  // raw address (e.g. from a return)
+                ints[slot] = cast(intptr_t, VAL_INT64(item));
+            else if (IS_BINARY(item))
+                ints[slot] = cast(intptr_t, VAL_BINARY_AT(item));
+            else if (IS_TEXT(item))
+                ints[slot] = cast(intptr_t, cast(const void*, VAL_UTF8_AT(item)));
+            else
+                goto bad_arg;
+            break;
+
+          case FFI_TYPE_TEXT:
+            if (IS_BLANK(item))
+                ints[slot] = 0;
+            else if (IS_TEXT(item))  // interpreter strings are 0-terminated
+                ints[slot] = cast(intptr_t, cast(const void*, VAL_UTF8_AT(item)));
+            else
+                goto bad_arg;
+            break;
+
+          case FFI_TYPE_BINARY:
+            if (IS_BLANK(item))
+                ints[slot] = 0;
+            else if (IS_BINARY(item)) {  // callee may write the bytes
+                ints[slot] = cast(
+                    intptr_t, VAL_BINARY_AT_ENSURE_MUTABLE(item)
+                );
+            }
+            else
+                goto bad_arg;
+            break;
+
+          case FFI_TYPE_FLOAT:
+          case FFI_TYPE_DOUBLE:
+            if (IS_DECIMAL(item))
+                floats[slot] = VAL_DECIMAL(item);
+            else if (IS_INTEGER(item))
+                floats[slot] = cast(double, VAL_INT64(item));
+            else
+                goto bad_arg;
+            break;
+
+          default:
+            assert(false);
+
+          bad_arg:
+            rebJumps (
+                "fail [{FFI argument}", rebI(i + 1),
+                    "{does not match its declared type}]"
+            );
+        }
+    }
+
+    // Float arguments wouldn't survive a (...) varargs call--this passes
+    // them through fixed float-class parameters instead.  See the notes on
+    // the prototypes above for why the unused slots are harmless.
+
+    if (r->ret_type == FFI_TYPE_DOUBLE or r->ret_type == FFI_TYPE_FLOAT) {
+        double d;
+        if (r->ret_type == FFI_TYPE_DOUBLE)
+            d = (cast(CallDoubleFunc, r->fn))(
+                ints[0], ints[1], ints[2], ints[3], ints[4], ints[5],
+                floats[0], floats[1], floats[2], floats[3],
+                floats[4], floats[5], floats[6], floats[7]
+            );
+        else
+            d = (cast(CallFloatFunc, r->fn))(
+                ints[0], ints[1], ints[2], ints[3], ints[4], ints[5],
+                floats[0], floats[1], floats[2], floats[3],
+                floats[4], floats[5], floats[6], floats[7]
+            );
+        return rebDecimal(d);
+    }
+
+    intptr_t n = (cast(CallIntFunc, r->fn))(
+        ints[0], ints[1], ints[2], ints[3], ints[4], ints[5],
+        floats[0], floats[1], floats[2], floats[3],
+        floats[4], floats[5], floats[6], floats[7]
+    );
+
+    switch (cast(enum FfiValueType, r->ret_type)) {
+      case FFI_TYPE_VOID:
+        return rebNone();
+
+      case FFI_TYPE_INT8:
+        return rebInteger(cast(int8_t, n));
+
+      case FFI_TYPE_UINT8:
+        return rebInteger(cast(uint8_t, n));
+
+      case FFI_TYPE_INT16:
+        return rebInteger(cast(int16_t, n));
+
+      case FFI_TYPE_UINT16:
+        return rebInteger(cast(uint16_t, n));
+
+      case FFI_TYPE_INT32:
+        return rebInteger(cast(int32_t, n));
+
+      case FFI_TYPE_UINT32:
+        return rebInteger(cast(uint32_t, n));
+
+      case FFI_TYPE_INT64:
+      case FFI_TYPE_UINT64:  // comes back as INTEGER!, caller reinterprets
+      case FFI_TYPE_POINTER:  // raw address (feed back in, or 0 = NULL)
+        return rebInteger(n);
+
+      case FFI_TYPE_TEXT:
+        if (n == 0)
+            return nullptr;  // NULL char* comes back as NULL, not ""
+        return rebText(cast(const char*, n));  // copies out of C memory
+
+      default:
+        assert(false);
+    }
+
+    return rebNone();  // unreachable, but compilers want a return
+  #endif
+}
@@ -39,9 +39,10 @@
 // abstraction layer that looks a lot like the POSIX interface, but with the
 // benefit of adding asynchronous (overlapped) IO.
 //
-// (At time of writing, this is passing in `nullptr` for the callback in all
-// operations, which means they are running synchronously.  But asynchronous
-// features are there to be taken advantage of when needed.)
+// (Most operations here pass `nullptr` for the callback, which means they
+// run synchronously.  Large reads and writes are the exception: they give a
+// callback so libuv performs the transfer on its threadpool, and the main
+// thread pumps the loop--see OVERLAPPED_RW_THRESHOLD.)
 
 #include "reb-config.h"
 
@@ -64,6 +65,135 @@
 #endif
 
 
+// On POSIX systems a libuv file handle is just the file descriptor, and the
+// uv_fs_read()/uv_fs_write() calls made here with a null callback are
+// synchronous pread()/pwrite() wrapped in request setup and teardown.  Going
+// straight to the syscall trims that bookkeeping from the hot path of
+// small-file ingestion loops.
+//
+// (io_uring was considered for this.  But the port actor performs one
+// synchronous operation at a time, so there is no batch of submissions to
+// amortize a ring across...and a single-op submit-and-wait costs more than
+// the plain syscall.  If the actor ever grows a way to have several requests
+// in flight, that's the time to revisit.)
+//
+#if TO_WINDOWS
+    #define DIRECT_SYSCALL_RW 0
+#else
+    #define DIRECT_SYSCALL_RW 1
+    #include <unistd.h>
+    #include <errno.h>
+    #include <sys/mman.h>  // mmap()/munmap() for READ/MMAP
+#endif
+
+
+// Transfers at least this large are submitted with a callback, which makes
+// libuv carry them out on its threadpool.  The main thread pumps the default
+// loop until the completion lands...the same request-and-pump pattern the
+// network extension's wait logic uses.  The disk transfer thus overlaps with
+// any network callbacks and timers that come due, instead of the whole
+// interpreter sitting in a blocked syscall for the duration.
+//
+// Small transfers stay on the synchronous path: the latency of a cached
+// pread() is far below the cost of a threadpool round trip.
+//
+#define OVERLAPPED_RW_THRESHOLD (256 * 1024)
+
+struct OverlappedRw {
+    bool finished;
+    ssize_t result;
+};
+
+static void Overlapped_Rw_Callback(uv_fs_t *req) {
+    struct OverlappedRw *state = cast(struct OverlappedRw*, req->data);
+    state->result = req->result;
+    state->finished = true;
+    uv_fs_req_cleanup(req);
+}
+
+static ssize_t Read_File_Overlapped(
+    FILEREQ *file,
+    char *buffer,
+    size_t length
+){
+    ssize_t total = 0;
+    while (cast(size_t, total) < length) {
+        uv_buf_t buf;
+        buf.base = buffer + total;
+        buf.len = length - total;
+
+        struct OverlappedRw state;
+        state.finished = false;
+
+        uv_fs_t req;
+        req.data = &state;
+
+        int result = uv_fs_read(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            1,  // number of buffers
+            file->offset + total,
+            &Overlapped_Rw_Callback
+        );
+        if (result < 0)
+            return result;
+
+        while (not state.finished)  // other loop callbacks run meanwhile
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+        if (state.result < 0)
+            return state.result;
+        if (state.result == 0)
+            break;  // end of file (a /PART is allowed to come up short)
+        total += state.result;
+    }
+    return total;
+}
+
+static ssize_t Write_File_Overlapped(
+    FILEREQ *file,
+    const Byte* data,
+    size_t size
+){
+    ssize_t total = 0;
+    while (cast(size_t, total) < size) {
+        uv_buf_t buf;
+        buf.base = m_cast(char*, cs_cast(data + total));  // doesn't mutate
+        buf.len = size - total;
+
+        struct OverlappedRw state;
+        state.finished = false;
+
+        uv_fs_t req;
+        req.data = &state;
+
+        int result = uv_fs_write(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            1,  // number of buffers
+            file->offset + total,
+            &Overlapped_Rw_Callback
+        );
+        if (result < 0)
+            return result;
+
+        while (not state.finished)
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+        if (state.result < 0)
+            return state.result;
+        if (state.result == 0)
+            break;  // only when a zero length write was requested
+        total += state.result;
+    }
+    return total;
+}
+
+
 //
 //  rebError_UV: C
 //
@@ -303,23 +433,52 @@ REBVAL *Read_File(const REBVAL *port, size_t length)
     //
     char *buffer = rebAllocN(char, length);
 
-    const unsigned int num_bufs = 1;  // can read many buffers but we just do 1
-    uv_buf_t buf;
-    buf.base = buffer;
-    buf.len = length;
+    ssize_t num_bytes_read;
 
-    uv_fs_t req;
-    ssize_t num_bytes_read = uv_fs_read(
-        uv_default_loop(),
-        &req,
-        file->id,
-        &buf,
-        num_bufs,
-        file->offset,
-        nullptr  // no callback, synchronous
-    );
-    if (num_bytes_read < 0)
-        return rebError_UV(num_bytes_read);
+    if (length >= OVERLAPPED_RW_THRESHOLD) {  // threadpool does the transfer
+        num_bytes_read = Read_File_Overlapped(file, buffer, length);
+        if (num_bytes_read < 0)
+            return rebError_UV(num_bytes_read);
+    }
+    else {
+  #if DIRECT_SYSCALL_RW
+        num_bytes_read = 0;
+        while (cast(size_t, num_bytes_read) < length) {
+            ssize_t chunk = pread(
+                file->id,
+                buffer + num_bytes_read,
+                length - num_bytes_read,
+                file->offset + num_bytes_read
+            );
+            if (chunk < 0) {
+                if (errno == EINTR)
+                    continue;
+                return rebError_UV(uv_translate_sys_error(errno));
+            }
+            if (chunk == 0)
+                break;  // end of file (a /PART is allowed to come up short)
+            num_bytes_read += chunk;
+        }
+  #else
+        const unsigned int num_bufs = 1;  // could read many buffers, just do 1
+        uv_buf_t buf;
+        buf.base = buffer;
+        buf.len = length;
+
+        uv_fs_t req;
+        num_bytes_read = uv_fs_read(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            num_bufs,
+            file->offset,
+            nullptr  // no callback, synchronous
+        );
+        if (num_bytes_read < 0)
+            return rebError_UV(num_bytes_read);
+  #endif
+    }
 
     file->offset += num_bytes_read;
 
@@ -332,23 +491,84 @@ REBVAL *Read_File(const REBVAL *port, size_t length)
 }
 
 
+#if not TO_WINDOWS
 //
-//  Write_File: C
+// GC finalizer for the HANDLE! standing in for a file mapping's lifetime:
+// the mapping lives exactly as long as some BINARY! view can still see it.
 //
-REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
+static void cleanup_file_mapping(const REBVAL *v) {
+    munmap(VAL_HANDLE_VOID_POINTER(v), VAL_HANDLE_LEN(v));
+}
+#endif
+
+
+//
+//  Mmap_File: C
+//
+// READ/MMAP: instead of copying the file's bytes into a freshly allocated
+// BINARY!, map the file into the address space and give back a frozen view
+// over the mapping (see Make_Binary_View_Foreign()).  Only the pages that
+// scanning code like PARSE or FIND actually touches get faulted in, and the
+// OS can evict them under memory pressure...so a file much larger than RAM
+// costs no more than its page cache footprint.
+//
+// The mapping is read-only and private, and is released when the GC notices
+// no views into it are left.  Note the mapping always starts at the head of
+// the file, since mmap() offsets must be page-aligned; a nonzero port
+// offset is handled by aiming the view into the middle of the mapping.
+//
+REBVAL *Mmap_File(const REBVAL *port, size_t length)
 {
+  #if TO_WINDOWS
+    UNUSED(port);
+    UNUSED(length);
+    return rebValue(
+        "make error! {READ/MMAP not implemented on Windows, use plain READ}"
+    );
+  #else
     FILEREQ *file = File_Of_Port(port);
 
+    assert(not file->is_dir);  // directory reads don't honor /MMAP
     assert(file->id != FILEHANDLE_NONE);
 
-    if (limit == 0) {
-        //
-        // !!! While it may seem like writing a length of 0 could be shortcut
-        // here, it is actually the case that 0 byte writes can have meaning
-        // to some receivers of pipes.  Use cases should be studied before
-        // doing a shortcut here.
-    }
+    size_t span = file->offset + length;  // page alignment, map from head
 
+    if (span == 0)  // zero-length mappings are an error (EINVAL)
+        return rebValue("copy #{}");
+
+    void *map = mmap(nullptr, span, PROT_READ, MAP_PRIVATE, file->id, 0);
+    if (map == MAP_FAILED)
+        return rebError_UV(uv_translate_sys_error(errno));
+
+    DECLARE_LOCAL (handle);
+    Init_Handle_Cdata_Managed(handle, map, span, &cleanup_file_mapping);
+    PUSH_GC_GUARD(handle);
+
+    Binary(*) bin = Make_Binary_View_Foreign(
+        VAL_HANDLE_SINGULAR(handle),
+        cast(Byte*, map) + file->offset,
+        length
+    );
+
+    DROP_GC_GUARD(handle);
+
+    file->offset += length;  // mirror what a copying read does to the port
+
+    return Init_Binary(Alloc_Value(), bin);
+  #endif
+}
+
+
+// Extract the raw bytes that a WRITE wants to put in a file, with the CR
+// purity check that applies to text.  Returns an error, or nullptr with the
+// data pointer and size filled.
+//
+static REBVAL *Extract_Write_Bytes(
+    const Byte** data_out,
+    size_t *size_out,
+    const REBVAL *value,
+    REBLEN limit
+){
     const Byte* data;
     size_t size;
 
@@ -381,21 +601,88 @@ REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
         size = limit;
     }
 
+    *data_out = data;
+    *size_out = size;
+    return nullptr;
+}
+
+
+//
+//  Write_File: C
+//
+REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
+{
+    FILEREQ *file = File_Of_Port(port);
+
+    assert(file->id != FILEHANDLE_NONE);
+
+    if (limit == 0) {
+        //
+        // !!! While it may seem like writing a length of 0 could be shortcut
+        // here, it is actually the case that 0 byte writes can have meaning
+        // to some receivers of pipes.  Use cases should be studied before
+        // doing a shortcut here.
+    }
+
+    const Byte* data;
+    size_t size;
+    REBVAL *extract_error = Extract_Write_Bytes(&data, &size, value, limit);
+    if (extract_error)
+        return extract_error;
+
     assert(file->offset != FILEOFFSET_UNKNOWN);
 
-    const int num_bufs = 1;
-    uv_buf_t buf;
-    buf.base = m_cast(char*, cs_cast(data));  // doesn't mutate
-    buf.len = size;
+    ssize_t num_bytes_written;
 
-    uv_fs_t req;
-    ssize_t num_bytes_written = uv_fs_write(
-        uv_default_loop(), &req, file->id, &buf, num_bufs, file->offset, nullptr
-    );
+    if (size >= OVERLAPPED_RW_THRESHOLD) {  // threadpool does the transfer
+        num_bytes_written = Write_File_Overlapped(file, data, size);
+        if (num_bytes_written < 0) {
+            file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
+            return rebError_UV(num_bytes_written);
+        }
+    }
+    else {
+  #if DIRECT_SYSCALL_RW
+        num_bytes_written = 0;
+        do {
+            ssize_t chunk = pwrite(
+                file->id,
+                data + num_bytes_written,
+                size - num_bytes_written,
+                file->offset + num_bytes_written
+            );
+            if (chunk < 0) {
+                if (errno == EINTR)
+                    continue;
+                file->size_cache = FILESIZE_UNKNOWN;  // unsure what fail did
+                return rebError_UV(uv_translate_sys_error(errno));
+            }
+            if (chunk == 0)
+                break;  // only when a zero length write was requested
+            num_bytes_written += chunk;
+        } while (cast(size_t, num_bytes_written) < size);
+  #else
+        const int num_bufs = 1;
+        uv_buf_t buf;
+        buf.base = m_cast(char*, cs_cast(data));  // doesn't mutate
+        buf.len = size;
 
-    if (num_bytes_written < 0) {
-        file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
-        return rebError_UV(num_bytes_written);
+        uv_fs_t req;
+        num_bytes_written = uv_fs_write(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            num_bufs,
+            file->offset,
+            nullptr  // no callback, synchronous
+        );
+
+        if (num_bytes_written < 0) {
+            file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
+            return rebError_UV(num_bytes_written);
+        }
+  #endif
     }
 
     assert(num_bytes_written == cast(ssize_t, size));
@@ -418,6 +705,177 @@ REBVAL *Write_File(const REBVAL *port, const REBVAL *value, REBLEN limit)
 }
 
 
+//
+//  Flush_File_Buffer: C
+//
+// Push any coalesced WRITEs held by an OPEN/BUFFERED port down to the OS.
+// Clean readahead contents need no I/O and are left alone.
+//
+REBVAL *Flush_File_Buffer(const REBVAL *port)
+{
+    FILEREQ *file = File_Of_Port(port);
+    assert(file->buffer != nullptr);
+
+    if (not file->buffer_dirty)
+        return nullptr;
+
+    assert(file->id != FILEHANDLE_NONE);
+
+    size_t total = 0;
+    while (total < file->buffer_used) {
+        uv_buf_t buf;
+        buf.base = s_cast(file->buffer + total);
+        buf.len = file->buffer_used - total;
+
+        uv_fs_t req;
+        ssize_t chunk = uv_fs_write(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            1,
+            file->buffer_offset + total,
+            nullptr  // no callback, synchronous
+        );
+        if (chunk < 0) {
+            file->size_cache = FILESIZE_UNKNOWN;  // don't know what fail did
+            return rebError_UV(chunk);
+        }
+        total += chunk;
+    }
+
+    file->buffer_used = 0;
+    file->buffer_dirty = false;
+    file->size_cache = FILESIZE_UNKNOWN;  // re-fstat lazily when asked
+    return nullptr;
+}
+
+
+//
+//  Read_File_Buffered: C
+//
+// Serve a READ out of the port's userspace buffer, refilling it with a full
+// buffer-sized readahead whenever the request walks off the end.  Sequential
+// small READ/PARTs thus cost a memcpy most of the time instead of a syscall
+// each.  Requests as large as the buffer gain nothing from the extra copy,
+// so they invalidate it and take the plain path.
+//
+// The caller is responsible for flushing coalesced writes first, so that
+// reads observe them (the File_Actor does this before size bounding).
+//
+REBVAL *Read_File_Buffered(const REBVAL *port, size_t length)
+{
+    FILEREQ *file = File_Of_Port(port);
+    assert(file->buffer != nullptr);
+    assert(not file->buffer_dirty);
+
+    if (length >= file->buffer_size) {
+        file->buffer_used = 0;  // readahead doesn't cover a request this big
+        return Read_File(port, length);
+    }
+
+    char *data = rebAllocN(char, length);
+
+    size_t got = 0;
+    while (got < length) {
+        if (
+            file->offset >= file->buffer_offset
+            and file->offset < file->buffer_offset + file->buffer_used
+        ){
+            size_t skip = file->offset - file->buffer_offset;
+            size_t avail = file->buffer_used - skip;
+            size_t chunk = length - got < avail ? length - got : avail;
+            memcpy(data + got, file->buffer + skip, chunk);
+            got += chunk;
+            file->offset += chunk;
+            continue;
+        }
+
+        uv_buf_t buf;
+        buf.base = s_cast(file->buffer);
+        buf.len = file->buffer_size;
+
+        uv_fs_t req;
+        ssize_t num = uv_fs_read(
+            uv_default_loop(),
+            &req,
+            file->id,
+            &buf,
+            1,
+            file->offset,
+            nullptr  // no callback, synchronous
+        );
+        if (num < 0) {
+            rebFree(data);
+            return rebError_UV(num);
+        }
+        if (num == 0)
+            break;  // end of file (a /PART is allowed to come up short)
+
+        file->buffer_offset = file->offset;
+        file->buffer_used = num;
+    }
+
+    return rebRepossess(data, got);
+}
+
+
+//
+//  Write_File_Coalesced: C
+//
+// WRITE through an OPEN/BUFFERED port.  Contiguous small writes accumulate
+// in the buffer, and only hit the OS when it fills up, when a READ needs to
+// observe them, or on an explicit FLUSH.  Non-contiguous or buffer-sized
+// writes flush whatever is pending and take the plain path.
+//
+REBVAL *Write_File_Coalesced(
+    const REBVAL *port,
+    const REBVAL *value,
+    REBLEN limit
+){
+    FILEREQ *file = File_Of_Port(port);
+    assert(file->buffer != nullptr);
+
+    const Byte* data;
+    size_t size;
+    REBVAL *error = Extract_Write_Bytes(&data, &size, value, limit);
+    if (error)
+        return error;
+
+    if (size >= file->buffer_size) {
+        error = Flush_File_Buffer(port);
+        if (error)
+            return error;
+        file->buffer_used = 0;  // readahead bytes would go stale
+        return Write_File(port, value, limit);
+    }
+
+    if (
+        file->buffer_dirty
+        and (
+            file->offset != file->buffer_offset + file->buffer_used
+            or file->buffer_used + size > file->buffer_size
+        )
+    ){
+        error = Flush_File_Buffer(port);
+        if (error)
+            return error;
+    }
+
+    if (not file->buffer_dirty) {  // any readahead contents are discarded
+        file->buffer_offset = file->offset;
+        file->buffer_used = 0;
+        file->buffer_dirty = true;
+    }
+
+    memcpy(file->buffer + file->buffer_used, data, size);
+    file->buffer_used += size;
+    file->offset += size;
+    file->size_cache = FILESIZE_UNKNOWN;  // bytes aren't on disk yet
+    return nullptr;
+}
+
+
 //
 //  Truncate_File: C
 //
@@ -105,6 +105,18 @@ struct Reb_File_Port_State {
     uint64_t size_cache;  // may be FILESIZE_UNKNOWN, use accessors
 
     uint64_t offset;
+
+    // OPEN/BUFFERED puts a userspace buffer between the port and the OS.
+    // When clean it holds readahead bytes for sequential READs; when dirty
+    // it holds coalesced WRITEs that have not hit the OS yet, and must be
+    // pushed down by Flush_File_Buffer() before anything can observe them.
+    // Null on unbuffered ports; freed when the port is closed.
+    //
+    Byte *buffer;
+    size_t buffer_size;
+    uint64_t buffer_offset;  // file position that buffer[0] corresponds to
+    size_t buffer_used;  // valid readahead bytes, or pending write bytes
+    bool buffer_dirty;  // true if buffer holds writes needing a flush
 };
 
 typedef struct Reb_File_Port_State FILEREQ;
@@ -372,6 +372,7 @@ depends: compose [
     ;
     [%filesystem/p-file.c <msc:/wd5220>]
     [%filesystem/p-dir.c <msc:/wd5220>]
+    [%filesystem/p-watch.c <msc:/wd5220>]
     [%filesystem/file-posix.c <msc:/wd5220>]
 
     (spread uv-depends)
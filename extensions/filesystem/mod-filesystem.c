@@ -40,6 +40,10 @@
 
 extern Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
 extern Bounce Dir_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
+extern Bounce Watch_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb);
+
+extern void Startup_Watch(void);
+extern void Shutdown_Watch(void);
 
 
 #if TO_WINDOWS
@@ -61,6 +65,8 @@ DECLARE_NATIVE(startup_p)
 {
     FILESYSTEM_INCLUDE_PARAMS_OF_STARTUP_P;
 
+    Startup_Watch();  // halt-polling timer used while waiting on WATCH ports
+
     return rebNone();
 }
 
@@ -92,6 +98,8 @@ DECLARE_NATIVE(shutdown_p)
 {
     FILESYSTEM_INCLUDE_PARAMS_OF_SHUTDOWN_P;
 
+    Shutdown_Watch();
+
     return rebNone();
 }
 
@@ -111,6 +119,21 @@ DECLARE_NATIVE(get_dir_actor_handle)
 }
 
 
+//
+//  get-watch-actor-handle: native [
+//
+//  {Retrieve handle to the native actor for filesystem change watching}
+//
+//      return: [handle!]
+//  ]
+//
+DECLARE_NATIVE(get_watch_actor_handle)
+{
+    Make_Port_Actor_Handle(OUT, &Watch_Actor);
+    return OUT;
+}
+
+
 // Options for To_REBOL_Path
 enum {
     PATH_OPT_SRC_IS_DIR = 1 << 0
@@ -161,7 +161,7 @@ Bounce Dir_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
 
         UNUSED(PARAM(source));
 
-        if (REF(part) or REF(seek) or REF(string) or REF(lines))
+        if (REF(part) or REF(seek) or REF(string) or REF(lines) or REF(mmap))
             fail (Error_Bad_Refines_Raw());
 
         StackIndex base = TOP_INDEX;
@@ -77,12 +77,17 @@ extern REBVAL *Get_File_Size_Cacheable(uint64_t *size, const REBVAL *port);
 extern REBVAL *Open_File(const REBVAL *port, int flags);
 extern REBVAL *Close_File(const REBVAL *port);
 extern REBVAL *Read_File(const REBVAL *port, size_t length);
+extern REBVAL *Mmap_File(const REBVAL *port, size_t length);
 extern REBVAL *Write_File(const REBVAL *port, const REBVAL *data, REBLEN length);
 extern REBVAL *Query_File_Or_Directory(const REBVAL *port);
 extern REBVAL *Create_File(const REBVAL *port);
 extern REBVAL *Delete_File_Or_Directory(const REBVAL *port);
 extern REBVAL *Rename_File_Or_Directory(const REBVAL *port, const REBVAL *to);
 extern REBVAL *Truncate_File(const REBVAL *port);
+extern REBVAL *Flush_File_Buffer(const REBVAL *port);
+extern REBVAL *Read_File_Buffered(const REBVAL *port, size_t length);
+extern REBVAL *Write_File_Coalesced(
+    const REBVAL *port, const REBVAL *data, REBLEN limit);
 
 
 inline static uint64_t File_Size_Cacheable_May_Fail(const REBVAL *port)
@@ -91,6 +96,16 @@ inline static uint64_t File_Size_Cacheable_May_Fail(const REBVAL *port)
     REBVAL *error = Get_File_Size_Cacheable(&size, port);
     if (error)
         fail (error);
+
+    // Coalesced writes on an OPEN/BUFFERED port may extend the file past
+    // what the OS knows about until they are flushed.
+    //
+    FILEREQ *file = File_Of_Port(port);
+    if (file->buffer and file->buffer_dirty) {
+        uint64_t pending = file->buffer_offset + file->buffer_used;
+        if (pending > size)
+            size = pending;
+    }
     return size;
 }
 
@@ -161,6 +176,11 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         file->is_dir = false;  // would be dispatching to Dir_Actor if dir
         file->size_cache = FILESIZE_UNKNOWN;
         file->offset = FILEOFFSET_UNKNOWN;
+        file->buffer = nullptr;  // only made if OPEN/BUFFERED requests one
+        file->buffer_size = 0;
+        file->buffer_offset = 0;
+        file->buffer_used = 0;
+        file->buffer_dirty = false;
 
         // Generally speaking, you don't want to store REBVAL* or REBSER* in
         // something like this struct-embedded-in-a-BINARY! as it will be
@@ -229,6 +249,13 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         UNUSED(PARAM(string)); // handled in dispatcher
         UNUSED(PARAM(lines)); // handled in dispatcher
 
+        // The point of READ/MMAP is avoiding the copy, but /STRING and
+        // /LINES have to materialize new series anyway...so the combination
+        // is more likely a misunderstanding than a request.
+        //
+        if (REF(mmap) and (REF(string) or REF(lines)))
+            fail (Error_Bad_Refines_Raw());
+
         // Handle the READ %file shortcut case, where the FILE! has been
         // converted into a PORT! but has not been opened yet.
 
@@ -243,6 +270,15 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
             opened_temporarily = true;
         }
 
+        // Reads (and the size bounding below) have to observe any writes
+        // that are still coalesced in a buffered port's userspace buffer.
+        //
+        if (file->buffer) {
+            REBVAL *flush_error = Flush_File_Buffer(port);
+            if (flush_error)
+                fail (flush_error);
+        }
+
         REBVAL *result;
 
      blockscope {
@@ -300,7 +336,12 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
                 len = limit;
         }
 
-        result = Read_File(port, len);
+        if (REF(mmap))
+            result = Mmap_File(port, len);
+        else if (file->buffer)
+            result = Read_File_Buffered(port, len);
+        else
+            result = Read_File(port, len);
      }
 
      cleanup_read:
@@ -454,7 +495,10 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
             len = VAL_LEN_HEAD(data);
         }
 
-        result = Write_File(port, data, len);
+        if (file->buffer)
+            result = Write_File_Coalesced(port, data, len);
+        else
+            result = Write_File(port, data, len);
       }
 
       cleanup_write:
@@ -516,6 +560,34 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         if (error != nullptr)
             fail (Error_Cannot_Open_Raw(file->path, error));
 
+        if (REF(buffered)) {
+            int64_t buffer_size = VAL_INT64(ARG(buffered));
+            if (buffer_size <= 0)
+                fail (PARAM(buffered));
+
+            file->buffer = TRY_ALLOC_N(Byte, buffer_size);
+            if (file->buffer == nullptr)
+                fail (Error_No_Memory(buffer_size));
+
+            file->buffer_size = buffer_size;
+            file->buffer_offset = 0;
+            file->buffer_used = 0;
+            file->buffer_dirty = false;
+        }
+
+        return COPY(port); }
+
+    //=//// FLUSH //////////////////////////////////////////////////////////=//
+    //
+    // Pushes writes coalesced by OPEN/BUFFERED down to the operating system.
+    // Harmless on ports that aren't buffered or have nothing pending.
+
+      case SYM_FLUSH: {
+        if (file->buffer) {
+            REBVAL *flush_error = Flush_File_Buffer(port);
+            if (flush_error)
+                fail (flush_error);
+        }
         return COPY(port); }
 
     //=//// COPY ///////////////////////////////////////////////////////////=//
@@ -548,8 +620,21 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
             // a good idea or should it raise an error?
         }
         else {
+            REBVAL *flush_error = nullptr;
+            if (file->buffer)
+                flush_error = Flush_File_Buffer(port);
+
             REBVAL *error = Close_File(port);
             assert(file->id == FILEHANDLE_NONE);
+
+            if (file->buffer) {
+                FREE_N(Byte, file->buffer_size, file->buffer);
+                file->buffer = nullptr;
+                file->buffer_size = 0;
+            }
+
+            if (flush_error)
+                fail (flush_error);
             if (error)
                 fail (error);
         }
@@ -564,6 +649,13 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         INCLUDE_PARAMS_OF_DELETE;
         UNUSED(PARAM(port));
 
+        if (file->buffer) {  // no flush: pending bytes are being deleted
+            FREE_N(Byte, file->buffer_size, file->buffer);
+            file->buffer = nullptr;
+            file->buffer_size = 0;
+            file->buffer_dirty = false;
+        }
+
         if (file->id != FILEHANDLE_NONE) {
             REBVAL *error = Close_File(port);
             if (error)
@@ -598,6 +690,13 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
             flags = file->flags;
             index = file->offset;
 
+            if (file->buffer) {
+                REBVAL *flush_error = Flush_File_Buffer(port);
+                if (flush_error)
+                    fail (flush_error);
+                file->buffer_used = 0;  // stale across the close/reopen
+            }
+
             REBVAL *close_error = Close_File(port);
             if (close_error)
                 fail (close_error);
@@ -712,6 +811,12 @@ Bounce File_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
 
             opened_temporarily = true;
         }
+        else if (file->buffer) {
+            REBVAL *flush_error = Flush_File_Buffer(port);
+            if (flush_error)
+                fail (flush_error);
+            file->buffer_used = 0;  // truncation invalidates readahead
+        }
 
         REBVAL *truncate_error = Truncate_File(port);
 
@@ -0,0 +1,469 @@
+//
+//  File: %p-watch.c
+//  Summary: "file change watching port interface"
+//  Section: ports
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2021 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// WATCH ports report changes to a file or directory using the operating
+// system's own notification facilities (inotify on Linux, FSEvents on macOS,
+// ReadDirectoryChangesW on Windows)...as abstracted by libuv's uv_fs_event_t.
+// That replaces the pattern of polling by re-READing a file periodically to
+// see if it changed, which wastes work when nothing is happening and reacts
+// late when something is.
+//
+//     port: open [scheme: 'watch path: %config/]
+//     for-each [file action] read port [  ; blocks until something changes
+//         print [action "->" file]
+//     ]
+//     close port
+//
+// READ returns a BLOCK! of FILE!/WORD! pairs, where the word is CHANGED or
+// RENAMED.  (Renames cover creation and deletion as well--the OS facilities
+// don't reliably distinguish them, so no attempt is made to.)
+//
+//=//// NOTES //////////////////////////////////////////////////////////////=//
+//
+// * Kernel notifications tend to arrive in bursts: a single "save" in an
+//   editor may produce several change events, and a build touching many
+//   files produces a storm of them.  So delivery is *debounced*: the first
+//   event opens a coalescing window (default 100 msec, configurable with a
+//   DEBOUNCE field in the spec), and the batch is only handed to READ once
+//   the window has passed without further events.  Duplicate back-to-back
+//   events for the same file are folded into one entry.
+//
+// * The event callback runs in the middle of uv_run() pumps, so it must not
+//   call into the evaluator.  Like the network extension's callbacks, it
+//   only records raw C data (a malloc'd copy of the filename and the event
+//   mask); the conversion to Rebol values happens in the actor's READ.
+//
+
+#include "reb-config.h"
+
+#include "uv.h"  // includes windows.h
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows.h defines, contentious with IS_ERROR in Ren-C
+    #undef OUT  // %minwindef.h defines this, we have a better use for it
+    #undef VOID  // %winnt.h defines this, we have a better use for it
+#endif
+
+#include "sys-core.h"
+
+extern REBVAL *rebError_UV(int err);
+
+#define DEBOUNCE_MSEC_DEFAULT 100
+
+
+// Raw record of one coalesced filesystem event, kept in a singly-linked
+// list in arrival order until a READ converts the batch to Rebol values.
+//
+struct WatchEvent {
+    char *filename;  // local format, relative to watched path (may be null)
+    int events;  // mask of UV_RENAME and UV_CHANGE
+    struct WatchEvent *next;
+};
+
+struct Reb_Watch_Port_State {
+    uv_fs_event_t handle;  // kernel-level notification handle
+    uv_timer_t debounce;  // quiet-window timer, restarted on each event
+    bool active;  // handle is started (OPEN? state)
+    bool batch_ready;  // window elapsed with no further events
+    int error_status;  // nonzero if the watcher itself reported an error
+    uint64_t window_msec;  // 0 means deliver each event immediately
+
+    struct WatchEvent *head;  // pending events, oldest first
+    struct WatchEvent *tail;
+
+    // See notes in FILEREQ about storing this pointer: it aims into the port
+    // spec, which is assumed good for the lifetime of the port.
+    //
+    REBVAL *path;
+};
+
+typedef struct Reb_Watch_Port_State WATCHREQ;
+
+inline static WATCHREQ *Watch_Of_Port(const REBVAL *port)
+{
+    REBVAL *state = CTX_VAR(VAL_CONTEXT(port), STD_PORT_STATE);
+    return cast(WATCHREQ*, VAL_BINARY_AT_ENSURE_MUTABLE(state));
+}
+
+
+static void Free_Watch_Events(WATCHREQ *watch)
+{
+    struct WatchEvent *ev = watch->head;
+    while (ev != nullptr) {
+        struct WatchEvent *next = ev->next;
+        if (ev->filename)
+            FREE_N(char, strsize(ev->filename) + 1, ev->filename);
+        FREE(struct WatchEvent, ev);
+        ev = next;
+    }
+    watch->head = nullptr;
+    watch->tail = nullptr;
+    watch->batch_ready = false;
+}
+
+
+static void on_debounce_window_closed(uv_timer_t *timer)
+{
+    WATCHREQ *watch = cast(WATCHREQ*, timer->data);
+    watch->batch_ready = true;  // breaks the UV_RUN_ONCE loop in READ
+}
+
+
+// Called by libuv when the kernel reports a change.  Only records raw data;
+// see file header for why no evaluator calls can be made from here.
+//
+static void on_watch_event(
+    uv_fs_event_t *handle,
+    const char *filename,
+    int events,
+    int status
+){
+    WATCHREQ *watch = cast(WATCHREQ*, handle->data);
+
+    if (status < 0) {  // watcher itself failed (e.g. watched dir deleted)
+        watch->error_status = status;
+        watch->batch_ready = true;
+        return;
+    }
+
+    if (
+        watch->tail != nullptr
+        and watch->tail->events == events
+        and (watch->tail->filename == nullptr) == (filename == nullptr)
+        and (
+            filename == nullptr
+            or strcmp(watch->tail->filename, filename) == 0
+        )
+    ){
+        // Duplicate of the most recent pending event; just let the restart
+        // of the debounce timer below extend the coalescing window.
+    }
+    else {
+        struct WatchEvent *ev = TRY_ALLOC(struct WatchEvent);
+        if (ev == nullptr)
+            return;  // can't fail() from a libuv callback; drop the event
+
+        if (filename == nullptr)
+            ev->filename = nullptr;
+        else {
+            size_t size = strsize(filename) + 1;
+            ev->filename = TRY_ALLOC_N(char, size);
+            if (ev->filename == nullptr) {
+                FREE(struct WatchEvent, ev);
+                return;
+            }
+            memcpy(ev->filename, filename, size);
+        }
+        ev->events = events;
+        ev->next = nullptr;
+
+        if (watch->tail)
+            watch->tail->next = ev;
+        else
+            watch->head = ev;
+        watch->tail = ev;
+    }
+
+    if (watch->window_msec == 0)
+        watch->batch_ready = true;
+    else {
+        uv_timer_start(  // restarts the window if it was already running
+            &watch->debounce,
+            &on_debounce_window_closed,
+            watch->window_msec,
+            0  // no repeat
+        );
+    }
+}
+
+
+static void on_watch_handle_closed(uv_handle_t *handle)
+{
+    int *count = cast(int*, handle->data);
+    ++(*count);
+}
+
+
+static void Close_Watch_If_Needed(WATCHREQ *watch)
+{
+    if (not watch->active)
+        return;
+
+    uv_fs_event_stop(&watch->handle);
+    uv_timer_stop(&watch->debounce);
+
+    int closed = 0;
+    watch->handle.data = &closed;
+    watch->debounce.data = &closed;
+    uv_close(cast(uv_handle_t*, &watch->handle), &on_watch_handle_closed);
+    uv_close(cast(uv_handle_t*, &watch->debounce), &on_watch_handle_closed);
+
+    while (closed != 2)
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+    Free_Watch_Events(watch);
+    watch->active = false;
+    watch->error_status = 0;
+}
+
+
+// Waiting on a watch port can be indefinite, and UV_RUN_ONCE blocks until
+// some event fires...which would wedge the interpreter un-interruptibly.
+// If a signal wakeup hook is registered (the network extension backs it
+// with a uv_async_t on this same default loop), a halt pokes the loop
+// itself and the wait can block fully, with no idle wakeups.  When built
+// without such a hook, a periodic timer breaks the loop the old way so
+// halt signals still get seen.  (Initialized by STARTUP*, closed by
+// SHUTDOWN*.)
+//
+static uv_timer_t watch_halt_poll_timer;
+
+static void watch_halt_poll_callback(uv_timer_t *handle) {
+    UNUSED(handle);  // just breaks the UV_RUN_ONCE loop
+}
+
+
+//
+//  Startup_Watch: C
+//
+void Startup_Watch(void)
+{
+    uv_timer_init(uv_default_loop(), &watch_halt_poll_timer);
+}
+
+
+//
+//  Shutdown_Watch: C
+//
+void Shutdown_Watch(void)
+{
+    uv_close(cast(uv_handle_t*, &watch_halt_poll_timer), nullptr);
+}
+
+
+//
+//  Watch_Actor: C
+//
+// Internal port handler for filesystem change watching.
+//
+Bounce Watch_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
+{
+    Context(*) ctx = VAL_CONTEXT(port);
+
+    REBVAL *state = CTX_VAR(ctx, STD_PORT_STATE);
+    WATCHREQ *watch;
+    if (IS_BINARY(state)) {
+        watch = Watch_Of_Port(port);
+    }
+    else {
+        assert(Is_Nulled(state));
+
+        REBVAL *spec = CTX_VAR(ctx, STD_PORT_SPEC);
+        if (not IS_OBJECT(spec))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        REBVAL *path = Obj_Value(spec, STD_PORT_SPEC_HEAD_REF);
+        if (path == NULL or IS_URL(path))
+            path = Obj_Value(spec, STD_PORT_SPEC_HEAD_PATH);
+        if (path == NULL or not IS_FILE(path))
+            fail (Error_Invalid_Spec_Raw(spec));
+
+        Binary(*) bin = Make_Binary(sizeof(WATCHREQ));
+        Init_Binary(state, bin);
+        TERM_BIN_LEN(bin, sizeof(WATCHREQ));
+
+        watch = Watch_Of_Port(port);
+        watch->active = false;
+        watch->batch_ready = false;
+        watch->error_status = 0;
+        watch->window_msec = DEBOUNCE_MSEC_DEFAULT;
+        watch->head = nullptr;
+        watch->tail = nullptr;
+        watch->path = path;
+    }
+
+    switch (ID_OF_SYMBOL(verb)) {
+
+    //=//// REFLECT ////////////////////////////////////////////////////////=//
+
+      case SYM_REFLECT: {
+        INCLUDE_PARAMS_OF_REFLECT;
+
+        UNUSED(ARG(value));  // implicitly comes from `port`
+        option(SymId) property = VAL_WORD_ID(ARG(property));
+
+        switch (property) {
+          case SYM_LENGTH: {  // events pending delivery (without blocking)
+            REBLEN count = 0;
+            struct WatchEvent *ev = watch->head;
+            for (; ev != nullptr; ev = ev->next)
+                ++count;
+            return Init_Integer(OUT, count); }
+
+          case SYM_OPEN_Q:
+            return Init_Logic(OUT, watch->active);
+
+          default:
+            break;
+        }
+
+        break; }
+
+    //=//// OPEN ///////////////////////////////////////////////////////////=//
+
+      case SYM_OPEN: {
+        INCLUDE_PARAMS_OF_OPEN;
+        UNUSED(PARAM(spec));
+
+        if (REF(read) or REF(write) or REF(new))
+            fail (Error_Bad_Refines_Raw());
+
+        if (watch->active)
+            return COPY(port);  // already watching
+
+        REBVAL *spec = CTX_VAR(ctx, STD_PORT_SPEC);
+
+        int64_t debounce = rebUnboxInteger(
+            "any [select", spec, "'debounce", rebI(DEBOUNCE_MSEC_DEFAULT), "]"
+        );
+        if (debounce < 0)
+            fail ("DEBOUNCE field of WATCH port spec can't be negative");
+        watch->window_msec = debounce;
+
+        unsigned int flags = 0;
+        if (rebDid("select", spec, "'recursive"))
+            flags |= UV_FS_EVENT_RECURSIVE;  // only works on some platforms
+
+        uv_fs_event_init(uv_default_loop(), &watch->handle);
+        uv_timer_init(uv_default_loop(), &watch->debounce);
+        watch->handle.data = watch;
+        watch->debounce.data = watch;
+
+        char *path_utf8 = rebSpell(
+            "file-to-local/full/no-tail-slash", watch->path
+        );
+        int result = uv_fs_event_start(
+            &watch->handle, &on_watch_event, path_utf8, flags
+        );
+        rebFree(path_utf8);
+
+        if (result < 0) {
+            int closed = 0;
+            watch->handle.data = &closed;
+            watch->debounce.data = &closed;
+            uv_close(
+                cast(uv_handle_t*, &watch->handle), &on_watch_handle_closed
+            );
+            uv_close(
+                cast(uv_handle_t*, &watch->debounce), &on_watch_handle_closed
+            );
+            while (closed != 2)
+                uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+            fail (Error_Cannot_Open_Raw(watch->path, rebError_UV(result)));
+        }
+
+        watch->active = true;
+        return COPY(port); }
+
+    //=//// READ ///////////////////////////////////////////////////////////=//
+    //
+    // Blocks until a debounced batch of changes is available, then returns
+    // it as a BLOCK! of FILE!/WORD! pairs.  The files are as the OS reports
+    // them: relative to the watched path.
+
+      case SYM_READ: {
+        INCLUDE_PARAMS_OF_READ;
+
+        UNUSED(PARAM(source));
+
+        if (
+            REF(part) or REF(seek) or REF(string) or REF(lines) or REF(mmap)
+        ){
+            fail (Error_Bad_Refines_Raw());
+        }
+
+        if (not watch->active)
+            fail (Error_Not_Open_Raw(watch->path));
+
+        if (PG_Signal_Wakeup_Hook == nullptr) {  // no wakeup; poll for halts
+            uv_timer_start(
+                &watch_halt_poll_timer, &watch_halt_poll_callback, 500, 500
+            );
+        }
+
+        while (not watch->batch_ready and not GET_SIGNAL(SIG_HALT))
+            uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+        if (PG_Signal_Wakeup_Hook == nullptr)
+            uv_timer_stop(&watch_halt_poll_timer);
+
+        if (GET_SIGNAL(SIG_HALT)) {
+            //
+            // The trampoline processes the halt as soon as the actor
+            // returns; just abandon the request (events stay pending).
+            //
+            return nullptr;
+        }
+
+        if (watch->error_status != 0) {
+            int status = watch->error_status;
+            Free_Watch_Events(watch);
+            watch->error_status = 0;
+            return RAISE(rebError_UV(status));
+        }
+
+        REBVAL *batch = rebValue("copy []");
+
+        struct WatchEvent *ev = watch->head;
+        for (; ev != nullptr; ev = ev->next) {
+            REBVAL *file;
+            if (ev->filename == nullptr)
+                file = rebValue("copy", watch->path);  // OS gave no name
+            else
+                file = rebValue("local-to-file", rebT(ev->filename));
+
+            rebElide(
+                "append", batch, rebR(file),
+                "append", batch,
+                    (ev->events & UV_RENAME) ? "'renamed" : "'changed"
+            );
+        }
+
+        Free_Watch_Events(watch);  // also clears batch_ready
+
+        return batch; }
+
+    //=//// CLOSE //////////////////////////////////////////////////////////=//
+
+      case SYM_CLOSE: {
+        INCLUDE_PARAMS_OF_CLOSE;
+        UNUSED(PARAM(port));
+
+        Close_Watch_If_Needed(watch);
+        return COPY(port); }
+
+      default:
+        break;
+    }
+
+    fail (UNHANDLED);
+}
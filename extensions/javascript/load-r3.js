@@ -143,7 +143,20 @@ const default_config = {
     info: console_in.info,
     error: console_in.error,
     warn: console_in.warn,
-    tracing_on: false
+    tracing_on: false,
+
+    // Running the Rebol boot code (symbols, base, sys, mezzanine...) takes
+    // seconds on low-end devices.  Since booting is deterministic for a
+    // given build, the post-boot heap can be snapshotted and stashed in the
+    // browser's cache...so later visits just copy bytes into the WASM heap
+    // instead of interpreting all the boot code again.
+    //
+    // `null` means "automatic": snapshot only when the build is versioned
+    // (a git commit hash in the URL), since an unversioned %libr3.wasm can
+    // be rebuilt without its URL changing--and restoring a stale heap image
+    // into a different binary would corrupt it.  Use true/false to force.
+    //
+    snapshot_boot: null
 }
 
 let console = undefined;  // force use e.g. of config.log(), not console.log()
@@ -335,6 +348,8 @@ for (let i = 0; i < js_args.length; i++) {
             base_dir = "https://metaeducation.s3.amazonaws.com/travis-builds/"
         } else if (a[0] == 'tracing_on') {
             config.tracing_on = true
+        } else if (a[0] == 'no_snapshot') {
+            config.snapshot_boot = false
         } else
             reb_args += a[0] + ": true "  // look like being set to true
     }
@@ -564,6 +579,86 @@ let prefetch_worker_js_promiser = () => new Promise(
 )
 
 
+//=//// POST-BOOT HEAP SNAPSHOT ///////////////////////////////////////////=//
+//
+// The WASM heap after boot is a pure function of the build products and the
+// environment snapshotted in preRun() (e.g. tracing variables).  At the
+// snapshot moment there are no WASM frames on the stack, no file handles,
+// and no JS-side tables referring into the heap--besides the reb.END signal
+// byte allocated by reb.Startup(), whose address is saved with the image.
+// So restoring is just copying the bytes back over a freshly instantiated
+// module's heap (which must be the same length--heap growth is not enabled
+// in the emscripten config) and reinstating reb.END.
+//
+// Anything environment-specific (system.options.args, the current directory
+// from the URL bar, user <script> tags) is applied *after* the snapshot
+// point on both paths, so it is never baked into the image.
+//
+// The Cache API is used for storage since it handles large binary bodies
+// well.  Any failure--no `caches` on insecure origins, quota, mismatched
+// sizes--just falls back to running the boot code normally.
+
+let snapshot_cache_name = "r3-boot-snapshots"
+
+let snapshot_enabled = () => {
+    if (config.snapshot_boot !== null)
+        return config.snapshot_boot && (typeof caches != "undefined")
+    return !!git_commit && (typeof caches != "undefined")  // auto, see config
+}
+
+let snapshot_key = () => {
+    //
+    // Include everything that changes the post-boot heap image: the exact
+    // wasm component URL (has the commit hash when versioned), and boot
+    // flags that preRun() bakes into the emscripten ENV.
+    //
+    return libRebolComponentURL(".wasm")
+        + "?boot-snapshot&tracing=" + (config.tracing_on ? "1" : "0")
+}
+
+let try_restore_snapshot_promiser = () => {
+    if (!snapshot_enabled())
+        return Promise.resolve(false)
+
+    return caches.open(snapshot_cache_name)
+      .then((cache) => cache.match(snapshot_key()))
+      .then((response) => {
+        if (!response)
+            return false
+        return response.arrayBuffer().then((buffer) => {
+            let end_addr = new DataView(buffer).getUint32(0, true)
+            let image = new Uint8Array(buffer, 4)
+            if (image.length != reb.m.HEAPU8.length) {
+                config.warn("Boot snapshot doesn't match heap size, ignoring")
+                return false
+            }
+            reb.m.HEAPU8.set(image)
+            reb.END = end_addr  // reb.Startup() not run, set it ourselves
+            return true
+        })
+      })
+      .catch((e) => {
+        config.warn("Boot snapshot restore failed: " + e)
+        return false
+      })
+}
+
+let store_snapshot_promiser = () => {
+    if (!snapshot_enabled())
+        return Promise.resolve()
+
+    let heap = reb.m.HEAPU8
+    let buffer = new ArrayBuffer(4 + heap.length)
+    new DataView(buffer).setUint32(0, reb.END, true)
+    new Uint8Array(buffer, 4).set(heap)
+
+    return caches.open(snapshot_cache_name)
+      .then((cache) => cache.put(snapshot_key(), new Response(buffer)))
+      .then(() => config.log("Stored post-boot heap snapshot"))
+      .catch((e) => config.warn("Boot snapshot store failed: " + e))
+}
+
+
 //=// CONVERTING CALLBACKS TO PROMISES /////////////////////////////////////=//
 //
 // https://stackoverflow.com/a/22519785
@@ -677,10 +772,41 @@ return assign_git_commit_promiser(os_id)  // sets git_commit
 
     reb.m = module  // overwrite the defaults with the instantiated module
 
+    return try_restore_snapshot_promiser()
+
+  }).then(restored => {
+
+    if (restored) {
+        config.info('Restored post-boot heap snapshot, skipping boot code')
+        return Promise.resolve()
+    }
+
     config.info('Executing Rebol boot code...')
 
     reb.Startup()  // Sets up memory pools, symbols, base, sys, mezzanine...
 
+    // There is currently no method to dynamically load extensions with
+    // r3.js, so the only extensions you can load are those that are picked
+    // to be built-in while compiling the lib.  The "JavaScript extension" is
+    // essential--it contains JS-NATIVE and JS-AWAITER.
+    //
+    // (Note: extension initialization is deterministic given the build, and
+    // consults none of the URL-specific state set up below...so it's part of
+    // the snapshotted image.)
+    //
+    config.info('Initializing extensions')
+    reb.Elide(
+        "for-each collation builtin-extensions",
+            "[load-extension collation]"
+    )
+
+    return store_snapshot_promiser()
+
+  }).then(() => {
+
+    // Everything below here depends on the page's URL, so it must be applied
+    // on every load--snapshot or not--and never baked into the heap image.
+
     // Take the `?foo=bar&baz` style of options passed in the URL that the
     // loader didn't use and pass them as system.options.args
     //
@@ -708,16 +834,6 @@ return assign_git_commit_promiser(os_id)  // sets git_commit
     //
     reb.Elide("change-dir as url!", reb.T(base_url))
 
-    // There is currently no method to dynamically load extensions with
-    // r3.js, so the only extensions you can load are those that are picked
-    // to be built-in while compiling the lib.  The "JavaScript extension" is
-    // essential--it contains JS-NATIVE and JS-AWAITER.
-    //
-    config.info('Initializing extensions')
-    reb.Elide(
-        "for-each collation builtin-extensions",
-            "[load-extension collation]"
-    )
   }).then(() => load_rebol_scripts(false))
   .then(dom_content_loaded_promise)
   .then(() => load_rebol_scripts(true))
@@ -401,6 +401,36 @@ EXTERN_C intptr_t RL_rebPromise(void *p, va_list *vaptr)
 }
 
 
+//=//// BATCHED API CALLS /////////////////////////////////////////////////=//
+//
+// Every reb.Xxx() call crosses the JS/WASM boundary individually, and on
+// chatty workloads (thousands of API calls per animation frame) the crossing
+// overhead adds up to more than the evaluations themselves.  reb.Batch()
+// packs the argument arrays for several rebValue()-style calls into one
+// region and crosses once.  Each descriptor slot starts out pointing at a
+// packed `const void*` array (same END-terminated format the single-call
+// wrappers use with a null va_list), and gets overwritten with the REBVAL*
+// result for that call--which the JavaScript side reads back out.
+//
+// Note a fail() in one of the calls behaves just as it would have for the
+// equivalent individual reb.Value()...calls after it in the batch simply
+// never run.
+//
+EXTERN_C void RL_rebBatch_internal(intptr_t descs_addr, int num_calls)
+{
+    TRACE("rebBatch_internal() called with %d calls", num_calls);
+
+    heapaddr_t *descs = cast(heapaddr_t*, Pointer_From_Heapaddr(descs_addr));
+
+    int i;
+    for (i = 0; i < num_calls; ++i) {
+        const void *packed = Pointer_From_Heapaddr(descs[i]);
+        REBVAL *result = RL_rebValue(packed, nullptr);  // null vaptr => array
+        descs[i] = result ? Heapaddr_From_Pointer(result) : 0;
+    }
+}
+
+
 // 1. Cooperative suspension is when there are no "stackful" invocations of
 //    the trampoline.  This is the preferred method.  Pre-emptive suspension
 //    is when the stack is not able to be unwound, and tricky code in
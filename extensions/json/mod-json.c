@@ -0,0 +1,545 @@
+//
+//  File: %mod-json.c
+//  Summary: "JSON Codec"
+//  Section: extension
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2012-2022 Ren-C Open Source Contributors
+// REBOL is a trademark of REBOL Technologies
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// See %extensions/json/README.md
+//
+// This is a native JSON decoder and encoder.  It could be written as a
+// mezzanine on top of PARSE or the Rebol scanner, but neither is shaped
+// for JSON's grammar...and JSON tends to arrive in bulk.  So the decoder
+// makes a single pass over the UTF-8 bytes, constructing values directly:
+//
+// * Nested arrays and objects collect their contents on the data stack,
+//   which pops into exact-sized arrays (no guessed capacities, no trailing
+//   waste, and everything in flight is GC-visible).
+//
+// * Strings reuse the shared mold buffer, with clean spans bulk-appended
+//   (UTF-8 validation happens on the span, not codepoint-by-codepoint).
+//
+// * Numbers go through the same Scan_Integer()/Scan_Decimal() fast paths
+//   the Rebol scanner uses.
+//
+// The mapping is OBJECT => MAP! (TEXT! keys, last duplicate wins), ARRAY =>
+// BLOCK!, STRING => TEXT!, NUMBER => INTEGER! or DECIMAL!.  JSON's true,
+// false, and null become the quasi-words ~true~, ~false~, and ~null~...the
+// storable "reified" forms of the isotopic states (see REIFY), since the
+// isotopes themselves can't be put into blocks or maps.
+//
+
+#include "sys-core.h"
+
+#include "tmp-mod-json.h"
+
+
+typedef struct {
+    const Byte* at;
+    const Byte* tail;
+    const Byte* head;  // only used to report byte offsets in errors
+} JsonScan;
+
+ATTRIBUTE_NO_RETURN static void Fail_Json(JsonScan* js, const char* error)
+{
+    rebJumps("fail [", rebT(error), "{at byte}", rebI(js->at - js->head), "]");
+}
+
+static void Skip_Json_Whitespace(JsonScan* js)
+{
+    while (js->at != js->tail) {
+        Byte b = *js->at;
+        if (b != ' ' and b != '\t' and b != '\n' and b != '\r')
+            break;
+        ++js->at;
+    }
+}
+
+static Codepoint Scan_Json_Hex4(JsonScan* js)
+{
+    if (js->tail - js->at < 4)
+        Fail_Json(js, "truncated unicode escape in JSON string");
+
+    Codepoint c = 0;
+    int i;
+    for (i = 0; i < 4; ++i) {
+        Byte b = *js->at;
+        c <<= 4;
+        if (b >= '0' and b <= '9')
+            c += b - '0';
+        else if (b >= 'A' and b <= 'F')
+            c += b - 'A' + 10;
+        else if (b >= 'a' and b <= 'f')
+            c += b - 'a' + 10;
+        else
+            Fail_Json(js, "invalid unicode escape in JSON string");
+        ++js->at;
+    }
+    return c;
+}
+
+// Scans the bytes between quotes into the mold buffer, and pushes the popped
+// TEXT! to the data stack.  Runs of ordinary characters are appended as whole
+// spans--Append_Utf8() validates the encoding--so only escapes are handled a
+// codepoint at a time.
+//
+static void Scan_Json_String_Onto_Stack(JsonScan* js)
+{
+    assert(*js->at == '"');
+    ++js->at;
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    const Byte* start = js->at;  // start of current clean span
+
+    while (true) {
+        if (js->at == js->tail)
+            Fail_Json(js, "unterminated JSON string");
+
+        Byte b = *js->at;
+
+        if (b >= 0x20 and b != '"' and b != '\\') {
+            ++js->at;  // covers UTF-8 continuation bytes too (all >= 0x80)
+            continue;
+        }
+
+        if (js->at != start)
+            Append_Utf8(mo->series, cs_cast(start), js->at - start);
+
+        if (b == '"')
+            break;
+
+        if (b != '\\')
+            Fail_Json(js, "unescaped control character in JSON string");
+
+        ++js->at;  // step past the backslash
+        if (js->at == js->tail)
+            Fail_Json(js, "unterminated JSON string");
+
+        Codepoint c;
+        switch (*js->at) {
+          case '"': c = '"'; goto simple_escape;
+          case '\\': c = '\\'; goto simple_escape;
+          case '/': c = '/'; goto simple_escape;
+          case 'b': c = 0x08; goto simple_escape;
+          case 'f': c = 0x0C; goto simple_escape;
+          case 'n': c = LF; goto simple_escape;
+          case 'r': c = CR; goto simple_escape;
+          case 't': c = '\t'; goto simple_escape;
+
+          case 'u':
+            ++js->at;
+            c = Scan_Json_Hex4(js);
+            if (c >= 0xD800 and c <= 0xDBFF) {  // high surrogate
+                if (
+                    js->tail - js->at < 6
+                    or js->at[0] != '\\' or js->at[1] != 'u'
+                ){
+                    Fail_Json(js, "missing low surrogate in JSON string");
+                }
+                js->at += 2;
+                Codepoint low = Scan_Json_Hex4(js);
+                if (low < 0xDC00 or low > 0xDFFF)
+                    Fail_Json(js, "invalid low surrogate in JSON string");
+                c = 0x10000 + ((c - 0xD800) << 10) + (low - 0xDC00);
+            }
+            else if (c >= 0xDC00 and c <= 0xDFFF)
+                Fail_Json(js, "unexpected low surrogate in JSON string");
+
+            if (c == '\0')  // Rebol strings cannot hold codepoint 0
+                Fail_Json(js, "\\u0000 not representable in a TEXT!");
+            goto escape_scanned;
+
+          default:
+            Fail_Json(js, "invalid escape in JSON string");
+        }
+
+      simple_escape:
+        ++js->at;
+
+      escape_scanned:
+        Append_Codepoint(mo->series, c);
+        start = js->at;
+    }
+
+    ++js->at;  // step past the closing quote
+
+    Init_Text(PUSH(), Pop_Molded_String(mo));
+}
+
+static void Scan_Json_Number_Onto_Stack(JsonScan* js)
+{
+    const Byte* bp = js->at;
+    const Byte* ep = bp;
+
+    bool integral = true;
+    while (ep != js->tail) {
+        Byte b = *ep;
+        if (b == '.' or b == 'e' or b == 'E')
+            integral = false;
+        else if (not ((b >= '0' and b <= '9') or b == '-' or b == '+'))
+            break;
+        ++ep;
+    }
+
+    REBLEN len = ep - bp;
+
+    if (integral) {
+        if (Scan_Integer(PUSH(), bp, len)) {
+            js->at = ep;
+            return;
+        }
+        DROP();  // out of INTEGER! range; fall through to DECIMAL!
+    }
+
+    if (not Scan_Decimal(PUSH(), bp, len, true))
+        Fail_Json(js, "invalid JSON number");
+
+    js->at = ep;
+}
+
+// Scans one JSON value and leaves it as the top of the data stack.  (The
+// stack is used instead of output cell pointers because nested pushes can
+// expand the stack and move its cells--and it makes everything in a deep
+// structure visible to the GC with no guarding needed.)
+//
+static void Scan_Json_Value_Onto_Stack(JsonScan* js)
+{
+    Skip_Json_Whitespace(js);
+    if (js->at == js->tail)
+        Fail_Json(js, "end of input where JSON value was expected");
+
+    switch (*js->at) {
+      case '{': {
+        ++js->at;
+        StackIndex base = TOP_INDEX;
+
+        Skip_Json_Whitespace(js);
+        if (js->at != js->tail and *js->at == '}')
+            ++js->at;
+        else while (true) {
+            Skip_Json_Whitespace(js);
+            if (js->at == js->tail or *js->at != '"')
+                Fail_Json(js, "string key expected in JSON object");
+            Scan_Json_String_Onto_Stack(js);
+
+            Skip_Json_Whitespace(js);
+            if (js->at == js->tail or *js->at != ':')
+                Fail_Json(js, "colon expected in JSON object");
+            ++js->at;
+
+            Scan_Json_Value_Onto_Stack(js);
+
+            Skip_Json_Whitespace(js);
+            if (js->at == js->tail)
+                Fail_Json(js, "unterminated JSON object");
+            if (*js->at == ',') {
+                ++js->at;
+                continue;
+            }
+            if (*js->at == '}') {
+                ++js->at;
+                break;
+            }
+            Fail_Json(js, "comma or } expected in JSON object");
+        }
+
+        REBMAP* map = Make_Map((TOP_INDEX - base) / 2);  // exact capacity
+
+        StackIndex i;
+        for (i = base + 1; i != TOP_INDEX + 1; i += 2) {
+            const bool strict = true;
+            Find_Map_Entry(  // duplicate keys: the last one wins
+                map,
+                Data_Stack_At(i),
+                SPECIFIED,
+                Data_Stack_At(i + 1),
+                SPECIFIED,
+                strict
+            );
+        }
+        Drop_Data_Stack_To(base);
+
+        Init_Map(PUSH(), map);
+        break; }
+
+      case '[': {
+        ++js->at;
+        StackIndex base = TOP_INDEX;
+
+        Skip_Json_Whitespace(js);
+        if (js->at != js->tail and *js->at == ']')
+            ++js->at;
+        else while (true) {
+            Scan_Json_Value_Onto_Stack(js);
+
+            Skip_Json_Whitespace(js);
+            if (js->at == js->tail)
+                Fail_Json(js, "unterminated JSON array");
+            if (*js->at == ',') {
+                ++js->at;
+                continue;
+            }
+            if (*js->at == ']') {
+                ++js->at;
+                break;
+            }
+            Fail_Json(js, "comma or ] expected in JSON array");
+        }
+
+        Init_Block(PUSH(), Pop_Stack_Values(base));
+        break; }
+
+      case '"':
+        Scan_Json_String_Onto_Stack(js);
+        break;
+
+      case 't':
+        if (js->tail - js->at < 4 or 0 != memcmp(js->at, "true", 4))
+            Fail_Json(js, "invalid JSON value");
+        js->at += 4;
+        Init_Quasi_Word(PUSH(), Canon(TRUE));
+        break;
+
+      case 'f':
+        if (js->tail - js->at < 5 or 0 != memcmp(js->at, "false", 5))
+            Fail_Json(js, "invalid JSON value");
+        js->at += 5;
+        Init_Quasi_Word(PUSH(), Canon(FALSE));
+        break;
+
+      case 'n':
+        if (js->tail - js->at < 4 or 0 != memcmp(js->at, "null", 4))
+            Fail_Json(js, "invalid JSON value");
+        js->at += 4;
+        Init_Quasi_Null(PUSH());
+        break;
+
+      default:
+        if (*js->at == '-' or (*js->at >= '0' and *js->at <= '9')) {
+            Scan_Json_Number_Onto_Stack(js);
+            break;
+        }
+        Fail_Json(js, "invalid JSON value");
+    }
+}
+
+
+//
+//  export identify-json?: native [
+//
+//  {Codec for identifying BINARY! data for a .JSON file}
+//
+//      return: [logic?]
+//      data [binary!]
+//  ]
+//
+DECLARE_NATIVE(identify_json_q)
+{
+    JSON_INCLUDE_PARAMS_OF_IDENTIFY_JSON_Q;
+
+    UNUSED(ARG(data));  // JSON can't be detected reliably short of parsing
+
+    return Init_True(OUT);
+}
+
+
+//
+//  export decode-json: native [
+//
+//  {Decode JSON data into a Rebol value}
+//
+//      return: "MAP! for objects, BLOCK! for arrays, ~null~ etc. quasi"
+//          [element?]
+//      data [binary! text!]
+//  ]
+//
+DECLARE_NATIVE(decode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_DECODE_JSON;
+
+    Size size;
+    const Byte* bp;
+    if (IS_BINARY(ARG(data)))
+        bp = VAL_BINARY_SIZE_AT(&size, ARG(data));
+    else
+        bp = cast(const Byte*, VAL_UTF8_SIZE_AT(&size, ARG(data)));
+
+    JsonScan js;
+    js.at = bp;
+    js.tail = bp + size;
+    js.head = bp;
+
+    if (size >= 3 and bp[0] == 0xEF and bp[1] == 0xBB and bp[2] == 0xBF)
+        js.at += 3;  // tolerate (and skip) a UTF-8 byte order mark
+
+    Scan_Json_Value_Onto_Stack(&js);
+
+    Skip_Json_Whitespace(&js);
+    if (js.at != js.tail)
+        Fail_Json(&js, "extra content after JSON value");
+
+    Copy_Cell(OUT, TOP);
+    DROP();
+    return OUT;
+}
+
+
+static void Mold_Json_Value(REB_MOLD* mo, Cell(const*) v);
+
+static void Mold_Json_String(REB_MOLD* mo, Cell(const*) v)
+{
+    Append_Codepoint(mo->series, '"');
+
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&size, v);
+
+    const Byte* bp = cast(const Byte*, utf8);
+    const Byte* tail = bp + size;
+    const Byte* start = bp;
+
+    for (; bp != tail; ++bp) {
+        Byte b = *bp;
+        if (b >= 0x20 and b != '"' and b != '\\')
+            continue;  // multibyte UTF-8 passes through unescaped
+
+        if (bp != start)
+            Append_Utf8(mo->series, cs_cast(start), bp - start);
+
+        switch (b) {
+          case '"': Append_Ascii(mo->series, "\\\""); break;
+          case '\\': Append_Ascii(mo->series, "\\\\"); break;
+          case 0x08: Append_Ascii(mo->series, "\\b"); break;
+          case 0x0C: Append_Ascii(mo->series, "\\f"); break;
+          case LF: Append_Ascii(mo->series, "\\n"); break;
+          case CR: Append_Ascii(mo->series, "\\r"); break;
+          case '\t': Append_Ascii(mo->series, "\\t"); break;
+          default: {
+            Byte esc[6];
+            esc[0] = '\\';
+            esc[1] = 'u';
+            esc[2] = '0';
+            esc[3] = '0';
+            esc[4] = Hex_Digits[(b >> 4) & 0xF];
+            esc[5] = Hex_Digits[b & 0xF];
+            Append_Ascii_Len(mo->series, s_cast(esc), 6);
+            break; }
+        }
+        start = bp + 1;
+    }
+
+    if (bp != start)
+        Append_Utf8(mo->series, cs_cast(start), bp - start);
+
+    Append_Codepoint(mo->series, '"');
+}
+
+static void Mold_Json_Value(REB_MOLD* mo, Cell(const*) v)
+{
+    if (IS_QUASI(v) and CELL_HEART(v) == REB_WORD) {
+        switch (VAL_WORD_ID(v)) {
+          case SYM_TRUE: Append_Ascii(mo->series, "true"); return;
+          case SYM_FALSE: Append_Ascii(mo->series, "false"); return;
+          case SYM_NULL: Append_Ascii(mo->series, "null"); return;
+          default:
+            break;
+        }
+    }
+
+    if (IS_QUOTED(v) or IS_QUASI(v))
+        fail ("Value cannot be encoded as JSON");
+
+    switch (CELL_HEART(v)) {
+      case REB_INTEGER: {
+        Byte buf[60];
+        REBINT len = Emit_Integer(buf, VAL_INT64(v));
+        Append_Ascii_Len(mo->series, s_cast(buf), len);
+        break; }
+
+      case REB_DECIMAL: {
+        Byte buf[60];
+        REBINT len = Emit_Decimal(buf, VAL_DECIMAL(v), 0, '.', mo->digits);
+        Append_Ascii_Len(mo->series, s_cast(buf), len);
+        break; }
+
+      case REB_BLOCK: {
+        Append_Codepoint(mo->series, '[');
+        Cell(const*) tail;
+        Cell(const*) head = VAL_ARRAY_AT(&tail, v);
+        Cell(const*) item = head;
+        for (; item != tail; ++item) {
+            if (item != head)
+                Append_Codepoint(mo->series, ',');
+            Mold_Json_Value(mo, item);
+        }
+        Append_Codepoint(mo->series, ']');
+        break; }
+
+      case REB_MAP: {
+        Append_Codepoint(mo->series, '{');
+        const REBMAP* map = VAL_MAP(v);
+        Cell(const*) tail = ARR_TAIL(MAP_PAIRLIST(map));
+        Cell(const*) key = ARR_HEAD(MAP_PAIRLIST(map));
+        bool first = true;
+        for (; key != tail; key += 2) {
+            if (Is_Void(key + 1))
+                continue;  // key was removed
+            if (not ANY_UTF8_KIND(CELL_HEART(key)))
+                fail ("JSON object keys must be string-like");
+            if (not first)
+                Append_Codepoint(mo->series, ',');
+            first = false;
+            Mold_Json_String(mo, key);
+            Append_Codepoint(mo->series, ':');
+            Mold_Json_Value(mo, key + 1);
+        }
+        Append_Codepoint(mo->series, '}');
+        break; }
+
+      default:
+        if (ANY_UTF8_KIND(CELL_HEART(v))) {  // TEXT!, also WORD!, ISSUE!...
+            Mold_Json_String(mo, v);
+            break;
+        }
+        fail ("Value cannot be encoded as JSON");
+    }
+}
+
+
+//
+//  export encode-json: native [
+//
+//  {Encode a Rebol value as JSON data}
+//
+//      return: [binary!]
+//      value "MAP!, BLOCK!, TEXT!, number, or ~true~/~false~/~null~"
+//          [element?]
+//  ]
+//
+DECLARE_NATIVE(encode_json)
+{
+    JSON_INCLUDE_PARAMS_OF_ENCODE_JSON;
+
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+
+    Mold_Json_Value(mo, ARG(value));
+
+    return Init_Binary(OUT, Pop_Molded_Binary(mo));
+}
@@ -147,6 +147,197 @@ static void cleanup_sockreq(const REBVAL *v) {
 }
 
 
+// When this extension's loop is parked in UV_RUN_ONCE, nothing would break
+// the block for a Ctrl-C until some unrelated I/O fired.  This used to be
+// papered over with 500msec polling timers, waking the process twice a
+// second even when completely idle.  Instead, a uv_async_t (an eventfd or
+// self-pipe underneath) is registered as the core's signal wakeup hook:
+// SET_SIGNAL() pokes it, the loop wakes, and the wait loops re-check their
+// signals--so blocking waits are *fully* blocking, with zero idle wakeups.
+//
+// (uv_async_send() is thread-safe, and is a flag store plus a pipe write,
+// which is tolerable from the OS signal handlers that deliver Ctrl-C.)
+
+uv_async_t signal_wakeup_async;  // initialized in STARTUP*, see above
+
+static void signal_wakeup_callback(uv_async_t* handle) {
+    UNUSED(handle);  // the send already broke the UV_RUN_ONCE block
+}
+
+static void Wake_Network_Event_Loop(void) {
+    uv_async_send(&signal_wakeup_async);  // coalesces repeated sends
+}
+
+// While a wait is in progress the async is referenced, so UV_RUN_ONCE has a
+// handle to block on even if the loop has nothing else pending--otherwise
+// uv_run would return immediately and the wait loops would spin.  Waits can
+// nest (a READ actor can run inside WAIT's pump), and uv_ref()/uv_unref()
+// are flags rather than counters, so the depth is counted here.
+//
+static int blocking_depth = 0;
+
+static void Ref_Wakeup_For_Blocking(void) {
+    if (blocking_depth == 0)
+        uv_ref(cast(uv_handle_t*, &signal_wakeup_async));
+    ++blocking_depth;
+}
+
+static void Unref_Wakeup_After_Blocking(void) {
+    --blocking_depth;
+    if (blocking_depth == 0)
+        uv_unref(cast(uv_handle_t*, &signal_wakeup_async));
+}
+
+
+// Ready list: ports that a libuv callback observed activity on while a
+// WAIT* was blocking on them.  WAIT* drains this to decide which port to
+// return, rather than re-scanning its ports after every wakeup.  Only
+// watched ports get queued (see the `waited` flag in %reb-net.h), and the
+// list is cleared when the WAIT* that marked them unwinds--so it can't
+// accumulate entries across waits.
+//
+// An API handle is used for the block so that queued ports are protected
+// from garbage collection for as long as they sit in the queue.
+//
+static REBVAL *Ready_Ports = nullptr;  // lives from STARTUP* to SHUTDOWN*
+
+static void Queue_Port_Awoke(Context(*) port_ctx) {
+    if (Ready_Ports == nullptr)
+        return;  // networking is shutting down
+    SOCKREQ *sock = Sock_Of_Port(CTX_ARCHETYPE(port_ctx));
+    if (not sock->waited)
+        return;  // no WAIT* wants to hear about it (event was still serviced)
+    rebElide("append", Ready_Ports, CTX_ARCHETYPE(port_ctx));
+}
+
+// Flag (or unflag) the sockets of the ports WAIT* is blocking on.  Entries
+// that aren't open ports can never wake, and are skipped.
+//
+static void Mark_Ports_Waited(const REBVAL *ports, bool waited) {
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ports);
+    for (; item != tail; ++item) {
+        if (not IS_PORT(item))
+            continue;
+        REBVAL *state = CTX_VAR(VAL_CONTEXT(item), STD_PORT_STATE);
+        if (not IS_HANDLE(state))
+            continue;  // port was never opened, socket state not allocated
+        VAL_HANDLE_POINTER(SOCKREQ, state)->waited = waited;
+    }
+}
+
+
+// Pump the default libuv event loop until an asynchronous request fills in
+// its result...or until a HALT is requested (e.g. Ctrl-C).
+//
+// All I/O pending on the loop makes progress while any one request is being
+// waited on: reads on other ports keep accruing into their buffers, and a
+// listening socket still accepts connections.  What is *not* yet possible is
+// for the Rebol code which issued this READ or WRITE to run something else
+// in the meantime.  Requests that suspend their frame and resume when the
+// completion callback fires are the direction (see forum link at the top of
+// this file)--but that needs a scheduler which owns the loop, as opposed to
+// these nested blocking pumps.
+//
+// UV_RUN_ONCE blocks until some event fires; a halt on a hung socket gets
+// noticed because SET_SIGNAL() pokes signal_wakeup_async, ending the block
+// so the loop condition re-checks the signal.
+//
+// Returns true if the wait was interrupted by a halt.  SIG_HALT is left set:
+// the trampoline processes it as soon as the actor returns, so the caller
+// just needs to abandon its request and return something inert.
+//
+static bool Pump_Event_Loop_Until_Result_Or_Halt(REBVAL **result)
+{
+    Ref_Wakeup_For_Blocking();
+
+    while (*result == nullptr and not GET_SIGNAL(SIG_HALT))
+        uv_run(uv_default_loop(), UV_RUN_ONCE);
+
+    Unref_Wakeup_After_Blocking();
+
+    return *result == nullptr;  // halted before completion
+}
+
+
+//=//// PER-OPERATION DEADLINES ///////////////////////////////////////////=//
+//
+// A port spec may carry a TIMEOUT field (INTEGER!/DECIMAL! seconds or a
+// TIME!), giving READ and WRITE on that port a deadline.  A one-shot libuv
+// timer is armed alongside the request; if it fires before the completion
+// callback has delivered a result, it stores a UV_ETIMEDOUT error in the
+// result slot--which ends the pump loop just like a completion would.
+// (libuv keeps its timers in a heap, so 5000 armed deadlines cost one
+// O(log n) insert and removal each, not a scan.)
+//
+// The timer is heap-allocated because uv_close() is asynchronous: the
+// handle must stay valid until the close callback runs on a later loop
+// turn, which can be after the actor's frame is gone.
+
+typedef struct {
+    uv_timer_t timer;  // make first member of struct so we can cast the address
+
+    REBVAL **result;  // the request's result slot, filled if still empty
+    bool fired;  // true only if the timeout actually delivered the error
+} Reb_Deadline;
+
+static void deadline_timer_callback(uv_timer_t *handle)
+{
+    Reb_Deadline *deadline = cast(Reb_Deadline*, handle);
+
+    if (*deadline->result != nullptr)
+        return;  // completion beat the deadline in this same loop turn
+
+    *deadline->result = rebError_UV(UV_ETIMEDOUT);
+    deadline->fired = true;
+}
+
+static void free_deadline_on_close(uv_handle_t *handle)
+{
+    rebFree(cast(Reb_Deadline*, handle));
+}
+
+// Returns nullptr if the port's spec has no timeout configured.
+//
+static Reb_Deadline *Start_Deadline_If_Requested(
+    const REBVAL *port,
+    REBVAL **result
+){
+    REBVAL *spec = CTX_VAR(VAL_CONTEXT(port), STD_PORT_SPEC);
+    REBVAL *timeout = Obj_Value(spec, STD_PORT_SPEC_NET_TIMEOUT);
+    if (Is_Nulled(timeout))
+        return nullptr;
+
+    REBLEN msec = Milliseconds_From_Value(timeout);
+
+    Reb_Deadline *deadline = rebAlloc(Reb_Deadline);
+    deadline->result = result;
+    deadline->fired = false;
+
+    uv_timer_init(uv_default_loop(), &deadline->timer);
+    uv_timer_start(&deadline->timer, &deadline_timer_callback, msec, 0);
+
+    return deadline;
+}
+
+// Tolerates nullptr (no deadline was requested).  Returns true if the
+// deadline fired, in which case the result slot holds the timeout error.
+// Must be called before the request the result slot lives in is freed.
+//
+static bool Finish_Deadline(Reb_Deadline *deadline)
+{
+    if (deadline == nullptr)
+        return false;
+
+    bool fired = deadline->fired;
+
+    uv_timer_stop(&deadline->timer);
+    uv_close(cast(uv_handle_t*, &deadline->timer), &free_deadline_on_close);
+
+    return fired;
+}
+
+
 //
 //  Close_Socket: C
 //
@@ -163,27 +354,180 @@ REBVAL *Close_Socket(const REBVAL *port)
 }
 
 
+//=//// DNS LOOKUP CACHE //////////////////////////////////////////////////=//
 //
-//  Lookup_Socket_Synchronously: C
+// Successful hostname resolutions are remembered for a little while, so the
+// common pattern of opening many short-lived connections to the same hosts
+// doesn't pay for a resolver round trip each time.
 //
-// !!! R3-Alpha would use asynchronous DNS API on Windows, but that API
-// was not supported by IPv6, and developers are encouraged to use normal
-// socket APIs with their own threads.  Now that we use libuv, there is again
-// the ability to specify a callback and do asynchronous lookup.  But this
-// would have to be fit in with a client understanding for how to request a
-// LOOKUP event, and when it had to be waited on.  For now it's synchronous.
+// getaddrinfo() does not surface the record's actual time-to-live (that
+// would take speaking DNS directly, as a library like c-ares does).  So a
+// short fixed lifetime is used--long enough to absorb bursts of connections,
+// short enough that a changed record is picked up promptly.
+
+#define DNS_CACHE_TTL_MSEC (60 * 1000)
+
+#define DNS_CACHE_MAX 64  // entries; oldest are evicted past this
+
+typedef struct DNSCacheEntryStruct DNSCacheEntry;
+
+struct DNSCacheEntryStruct {
+    char *hostname;  // stored lowercased (hostnames are case-insensitive)
+    uint32_t ip;
+    uint64_t expires_msec;  // uv_now() time at which the answer goes stale
+    DNSCacheEntry *next;
+};
+
+static DNSCacheEntry *dns_cache = nullptr;  // most recent insertion first
+
+static bool Hostname_Matches(const char *cached, const char *lookup)
+{
+    for (; *cached; ++cached, ++lookup) {
+        int c = *lookup;
+        if (c >= 'A' and c <= 'Z')
+            c += 'a' - 'A';
+        if (*cached != c)
+            return false;
+    }
+    return *lookup == '\0';
+}
+
+// Drops expired entries as a side effect of searching, so the cache never
+// hands back a stale answer and doesn't need a separate sweep.
 //
-REBVAL *Lookup_Socket_Synchronously(
-    const REBVAL *port,
-    const REBVAL *hostname
+static DNSCacheEntry *Find_DNS_Cache_Entry(const char *hostname_utf8)
+{
+    uint64_t now = uv_now(uv_default_loop());
+
+    DNSCacheEntry **link = &dns_cache;
+    while (*link) {
+        DNSCacheEntry *entry = *link;
+        if (entry->expires_msec <= now) {
+            *link = entry->next;
+            FREE_N(char, strsize(entry->hostname) + 1, entry->hostname);
+            FREE(DNSCacheEntry, entry);
+            continue;
+        }
+        if (Hostname_Matches(entry->hostname, hostname_utf8))
+            return entry;
+        link = &entry->next;
+    }
+    return nullptr;
+}
+
+static void Add_DNS_Cache_Entry(const char *hostname_utf8, uint32_t ip)
+{
+    REBLEN count = 0;
+    DNSCacheEntry **link = &dns_cache;
+    while (*link) {
+        ++count;
+        if (count >= DNS_CACHE_MAX) {  // drop oldest entries past the cap
+            DNSCacheEntry *entry = *link;
+            *link = entry->next;
+            FREE_N(char, strsize(entry->hostname) + 1, entry->hostname);
+            FREE(DNSCacheEntry, entry);
+            continue;
+        }
+        link = &(*link)->next;
+    }
+
+    size_t size = strsize(hostname_utf8);
+    DNSCacheEntry *entry = TRY_ALLOC(DNSCacheEntry);
+    if (entry == nullptr)
+        return;  // cache is an optimization; no memory, no entry
+    entry->hostname = TRY_ALLOC_N(char, size + 1);
+    if (entry->hostname == nullptr) {
+        FREE(DNSCacheEntry, entry);
+        return;
+    }
+
+    size_t i;
+    for (i = 0; i <= size; ++i) {  // includes terminator
+        int c = hostname_utf8[i];
+        if (c >= 'A' and c <= 'Z')
+            c += 'a' - 'A';
+        entry->hostname[i] = c;
+    }
+
+    entry->ip = ip;
+    entry->expires_msec = uv_now(uv_default_loop()) + DNS_CACHE_TTL_MSEC;
+    entry->next = dns_cache;
+    dns_cache = entry;
+}
+
+static void Clear_DNS_Cache(void)
+{
+    while (dns_cache) {
+        DNSCacheEntry *entry = dns_cache;
+        dns_cache = entry->next;
+        FREE_N(char, strsize(entry->hostname) + 1, entry->hostname);
+        FREE(DNSCacheEntry, entry);
+    }
+}
+
+
+// This libuv callback is triggered when a Lookup_Host() resolution finishes
+// (or errors out).  Like the other request callbacks, it only runs while the
+// libuv event loop is being pumped.
+//
+static void on_getaddrinfo(
+    uv_getaddrinfo_t *req,
+    int status,
+    struct addrinfo *res
 ){
-    SOCKREQ *sock = Sock_Of_Port(port);
+    Reb_Lookup_Request *rebreq = cast(Reb_Lookup_Request*, req);
 
-    assert(IS_TEXT(hostname));
-    const char *hostname_utf8 = cs_cast(VAL_UTF8_AT(hostname));
-    char *port_number_utf8 = rebSpell(
-        Canon(FORM), rebI(sock->remote_port_number)
-    );
+    if (rebreq->abandoned) {  // requester halted; no one is waiting
+        if (res)
+            uv_freeaddrinfo(res);
+        rebFree(rebreq);
+        return;
+    }
+
+    if (status == UV_EAI_NONAME or status == UV_EAI_NODATA) {
+        rebreq->ip = 0;  // host (or its A record) doesn't exist: not an error
+        rebreq->result = rebBlank();
+    }
+    else if (status < 0) {
+        rebreq->result = rebError_UV(status);
+    }
+    else {
+        struct sockaddr_in *sa = cast(struct sockaddr_in*, res->ai_addr);
+
+        // https://stackoverflow.com/q/31343855/
+        //
+        assert(res->ai_addrlen == 16);
+        assert(sizeof(sa->sin_addr) == 4);
+        memcpy(&rebreq->ip, &sa->sin_addr, 4);
+
+        rebreq->result = rebBlank();
+    }
+
+    if (res)
+        uv_freeaddrinfo(res);  // have to free it
+}
+
+
+//
+//  Lookup_Host: C
+//
+// Resolve a hostname to an IPv4 address, through the cache when possible.
+// The calling frame blocks until the resolution completes, but the lookup
+// itself goes through libuv's asynchronous getaddrinfo()...so other pending
+// I/O keeps making progress and a hung resolver can be halted out of (the
+// old synchronous version wedged the interpreter un-interruptibly).
+//
+// Returns an ERROR! value on failure, nullptr otherwise.  *ip_out is the
+// resolved address--or 0 if the name simply didn't resolve, which callers
+// may treat as less severe than a resolver breakdown.
+//
+REBVAL *Lookup_Host(const char *hostname_utf8, uint32_t *ip_out)
+{
+    DNSCacheEntry *cached = Find_DNS_Cache_Entry(hostname_utf8);
+    if (cached) {
+        *ip_out = cached->ip;
+        return nullptr;
+    }
 
     // !!! You can leave the "hints" argument as nullptr.  But this is what
     // Julia said for hints, which didn't prescribe an ai_family of PF_INET,
@@ -210,37 +554,43 @@ REBVAL *Lookup_Socket_Synchronously(
     //
     //     HOSTENT *host = gethostbyname(cs_cast(hostname_utf8));
     //
-    uv_getaddrinfo_t req;
+    Reb_Lookup_Request *rebreq = rebAlloc(Reb_Lookup_Request);
+    rebreq->ip = 0;
+    rebreq->result = nullptr;
+    rebreq->abandoned = false;
+
     int r = uv_getaddrinfo(
         uv_default_loop(),
-        &req,
-        nullptr,  // callback
+        &rebreq->req,
+        on_getaddrinfo,
         hostname_utf8,  // called "node" in libuv, but "hostname" in POSIX
-        port_number_utf8,  // "service" string or port (e.g. "echo", "80")
+        nullptr,  // "service" string or port; irrelevant to address lookup
         &hints  // "hints" (which is a const struct addrinfo*)
     );
 
-    rebFree(port_number_utf8);
-
-    if (r != 0)
+    if (r != 0) {  // the *request* failed (resolution never started)
+        rebFree(rebreq);
         return rebError_UV(r);
+    }
 
-    // Synchronously fill in the port's remote_ip with the answer to looking
-    // up the hostname.
-    //
-    // This is a replacement for:
-    //
-    //      memcpy(&sock->remote_ip, *host->h_addr_list, 4);
-    //
-    struct sockaddr_in *sa = cast(struct sockaddr_in*, req.addrinfo->ai_addr);
+    if (Pump_Event_Loop_Until_Result_Or_Halt(&rebreq->result)) {
+        rebreq->abandoned = true;  // on_getaddrinfo() frees it when it fires
+        *ip_out = 0;
+        return nullptr;  // SIG_HALT still set, trampoline throws it promptly
+    }
 
-    // https://stackoverflow.com/q/31343855/
-    //
-    assert(req.addrinfo->ai_addrlen == 16);
-    assert(sizeof(sa->sin_addr) == 4);
-    memcpy(&sock->remote_ip, &sa->sin_addr, 4);
+    if (not IS_BLANK(rebreq->result)) {
+        REBVAL *error = rebreq->result;
+        rebFree(rebreq);
+        return error;
+    }
+    rebRelease(rebreq->result);
+
+    *ip_out = rebreq->ip;
+    if (rebreq->ip != 0)
+        Add_DNS_Cache_Entry(hostname_utf8, rebreq->ip);
 
-    uv_freeaddrinfo(req.addrinfo);  // have to free it
+    rebFree(rebreq);
 
     // !!! Theoretically this is where we'd know whether it's an IPv6 address
     // or an IPv4 address.  This is still transitional IPv4 code, though.
@@ -249,6 +599,39 @@ REBVAL *Lookup_Socket_Synchronously(
 }
 
 
+//
+//  Lookup_Socket: C
+//
+// Fill in a port's remote_ip from the hostname in its spec, via the caching
+// asynchronous Lookup_Host().  (This was once a blocking uv_getaddrinfo()
+// with no callback, hence "synchronous"...the request now pumps the event
+// loop, so other I/O progresses and Ctrl-C works during slow resolutions.)
+//
+REBVAL *Lookup_Socket(
+    const REBVAL *port,
+    const REBVAL *hostname
+){
+    SOCKREQ *sock = Sock_Of_Port(port);
+
+    assert(IS_TEXT(hostname));
+    const char *hostname_utf8 = cs_cast(VAL_UTF8_AT(hostname));
+
+    uint32_t ip;
+    REBVAL *error = Lookup_Host(hostname_utf8, &ip);
+    if (error)
+        return error;
+
+    if (ip == 0 and GET_SIGNAL(SIG_HALT))
+        return nullptr;  // abandoned mid-lookup, caller returns inert value
+
+    if (ip == 0)
+        return rebError_UV(UV_EAI_NONAME);  // OPEN of unknown host is an error
+
+    memcpy(&sock->remote_ip, &ip, 4);
+    return nullptr;
+}
+
+
 // This libuv callback is triggered when a Request_Connect_Socket()
 // connection has been made...or an error is raised.
 //
@@ -256,6 +639,12 @@ REBVAL *Lookup_Socket_Synchronously(
 //
 static void on_connect(uv_connect_t *req, int status) {
     Reb_Connect_Request *rebreq = cast(Reb_Connect_Request*, req);
+
+    if (rebreq->abandoned) {  // requester halted; no one is waiting
+        rebFree(rebreq);  // socket (open or not) gets cleaned up by CLOSE
+        return;
+    }
+
     const REBVAL *port = CTX_ARCHETYPE(rebreq->port_ctx);
     SOCKREQ *sock = Sock_Of_Port(port);
 
@@ -299,6 +688,7 @@ REBVAL *Request_Connect_Socket(const REBVAL *port)
     Reb_Connect_Request *rebreq = rebAlloc(Reb_Connect_Request);
     rebreq->port_ctx = VAL_CONTEXT(port);  // !!! keepalive as API handle?
     rebreq->result = nullptr;
+    rebreq->abandoned = false;
 
     int r = uv_tcp_connect(
         &rebreq->req, &sock->tcp, cast(struct sockaddr *, &sa), on_connect
@@ -309,9 +699,10 @@ REBVAL *Request_Connect_Socket(const REBVAL *port)
         return rebError_UV(r);
     }
 
-    do {
-        uv_run(uv_default_loop(), UV_RUN_ONCE);
-    } while (rebreq->result == nullptr);
+    if (Pump_Event_Loop_Until_Result_Or_Halt(&rebreq->result)) {
+        rebreq->abandoned = true;  // on_connect() frees it when it fires
+        return nullptr;  // SIG_HALT still set, trampoline throws it promptly
+    }
 
     if (not IS_BLANK(rebreq->result))
         fail (rebreq->result);
@@ -375,6 +766,8 @@ void on_new_connection(uv_stream_t *server, int status) {
     DROP_GC_GUARD(client);
 
     rebElide("(", listening_port, ").spec.accept", CTX_ARCHETYPE(client));
+
+    Queue_Port_Awoke(listener_port_ctx);  // if a WAIT* watches the listener
 }
 
 
@@ -457,6 +850,15 @@ REBVAL *Start_Listening_On_Socket(const REBVAL *port)
 // the `data` field of the port as a BINARY!.  This adds up over successive
 // reads until the port clears it.
 //
+// Note that this is already a zero-copy receive path: the buffer handed to
+// libuv *is* the tail of the port's binary, so bytes land in their final
+// resting place with no intermediate buffer.  Whether the allocation gets
+// reused across READs is up to the protocol: CLEAR the port data and the
+// capacity is recycled here by Extend_Series_If_Necessary(); set it to null
+// (to steal the accrued binary by reference, as %prot-http.r does) and the
+// next READ has to allocate fresh--the C code can't know who else is holding
+// onto a stolen series.
+//
 void on_read_alloc(uv_handle_t *handle, size_t suggested_size, uv_buf_t *buf)
 {
     UNUSED(suggested_size);
@@ -643,17 +1045,22 @@ void on_write_finished(uv_write_t *req, int status)
 {
     Reb_Write_Request *rebreq = cast(Reb_Write_Request*, req);
 
+    // !!! We could more proactively free memory early for the GC here if
+    // we wanted to, presuming we weren't reusing locked data.
+    //
+    rebRelease(rebreq->binary);
+
+    if (rebreq->abandoned) {  // requester was halted out of its wait
+        rebFree(rebreq);
+        return;
+    }
+
     if (status < 0) {
         rebreq->result = rebError_UV(status);
     }
     else {
         rebreq->result = rebBlank();
     }
-
-    // !!! We could more proactively free memory early for the GC here if
-    // we wanted to, presuming we weren't reusing locked data.
-    //
-    rebRelease(rebreq->binary);
 }
 
 
@@ -704,8 +1111,8 @@ static Bounce Transport_Actor(
         sock->transport = transport;
         sock->stream = nullptr;
 
-        // !!! There is no way to customize the timeout.  Where should this
-        // setting be configured?
+        // Note: per-operation deadlines for READ and WRITE come from the
+        // TIMEOUT field of the port spec, see Start_Deadline_If_Requested()
     }
 
     if (sock->stream == nullptr) {
@@ -759,7 +1166,7 @@ static Bounce Transport_Actor(
 
                 // Note: sets remote_ip field
                 //
-                REBVAL *lookup_error = Lookup_Socket_Synchronously(port, arg);
+                REBVAL *lookup_error = Lookup_Socket(port, arg);
                 if (lookup_error)
                     fail (lookup_error);
             }
@@ -834,7 +1241,7 @@ static Bounce Transport_Actor(
 
         UNUSED(PARAM(source));
 
-        if (REF(seek))
+        if (REF(seek) or REF(mmap))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
@@ -872,9 +1279,26 @@ static Bounce Transport_Actor(
         if (r < 0)
             return RAISE(rebError_UV(r));  // e.g. "broken pipe" ?
 
-        do {
-            uv_run(uv_default_loop(), UV_RUN_ONCE);
-        } while (rebreq->result == nullptr);
+        Reb_Deadline *deadline =
+            Start_Deadline_If_Requested(port, &rebreq->result);
+
+        bool halted = Pump_Event_Loop_Until_Result_Or_Halt(&rebreq->result);
+        bool timed_out = Finish_Deadline(deadline);
+
+        if (halted) {
+            uv_read_stop(sock->stream);  // synchronous, no more callbacks
+            sock->tcp.data = nullptr;
+            rebFree(rebreq);
+            return COPY(port);  // SIG_HALT still set, discards this result
+        }
+
+        if (timed_out) {  // result is the timeout error, read still active
+            uv_read_stop(sock->stream);  // synchronous, no more callbacks
+            sock->tcp.data = nullptr;
+            REBVAL *error = rebreq->result;
+            rebFree(rebreq);
+            return RAISE(error);
+        }
 
         if (not IS_BLANK(rebreq->result))
             return RAISE(rebreq->result);  // e.g. "broken pipe" ?
@@ -910,6 +1334,7 @@ static Bounce Transport_Actor(
         Reb_Write_Request *rebreq = rebAlloc(Reb_Write_Request);
         rebreq->port_ctx = VAL_CONTEXT(port);  // API handle for GC safety?
         rebreq->result = nullptr;
+        rebreq->abandoned = false;
 
         // Make a copy of the BINARY! to put in the request, so that you can
         // say things like:
@@ -926,24 +1351,119 @@ static Bounce Transport_Actor(
         // We also want to make sure the /PART is handled correctly, so by
         // delegating to COPY/PART we get that for free.
         //
-        // !!! If you FREEZE the data then a copy is not necessary, review
-        // this as an angle on efficiency.
+        // But if the BINARY! has been frozen then no one can change the bytes
+        // while the write is in flight, and the copy is unnecessary.  This is
+        // the lever for sustained streaming: protocols that push large
+        // volumes can FREEZE their buffers and WRITE becomes zero-copy.
         //
-        rebreq->binary = rebValue(
-            "as binary! copy/part", data, rebQ(ARG(part))
-        );
-        rebUnmanage(rebreq->binary);  // otherwise would be seen as a leak
+        uv_buf_t onebuf;
+        uv_buf_t *bufs;
+        unsigned int num_bufs;
+
+        if (IS_BLOCK(data)) {
+            //
+            // Vectored ("scatter/gather") write: a BLOCK! of fragments is
+            // lowered to a single uv_write() with one buffer per fragment,
+            // so callers don't have to JOIN the pieces into one big series
+            // and pay for the concatenation.  Frozen BINARY! fragments are
+            // used in place; others get the same defensive copy that a
+            // single-series WRITE would.
+            //
+            if (REF(part))  // which fragment would a /PART cut?
+                fail (Error_Bad_Refines_Raw());
+
+            Cell(const*) tail;
+            Cell(const*) item = VAL_ARRAY_AT(&tail, data);
+            REBLEN count = tail - item;
+
+            if (count == 0) {  // nothing to send, don't bother libuv
+                rebFree(rebreq);
+                return COPY(port);
+            }
 
-        uv_buf_t buf;
-        buf.base = s_cast(m_cast(Byte*, VAL_BINARY_AT(rebreq->binary)));
-        buf.len = VAL_LEN_AT(rebreq->binary);
-        int r = uv_write(&rebreq->req, sock->stream, &buf, 1, on_write_finished);
+            Array(*) holder = Make_Array_Core(count, NODE_FLAG_MANAGED);
+            PUSH_GC_GUARD(holder);
+
+            REBLEN n;
+            for (n = 0; n != count; ++n, ++item) {
+                if (IS_BINARY(item) and Is_Series_Frozen(VAL_SERIES(item))) {
+                    Derelativize(
+                        Alloc_Tail_Array(holder), item, VAL_SPECIFIER(data)
+                    );
+                }
+                else if (IS_BINARY(item) or IS_TEXT(item) or IS_ISSUE(item)) {
+                    DECLARE_LOCAL (fragment);
+                    Derelativize(fragment, item, VAL_SPECIFIER(data));
+                    REBVAL *copy = rebValue("as binary! copy @", fragment);
+                    Copy_Cell(Alloc_Tail_Array(holder), copy);
+                    rebRelease(copy);
+                }
+                else
+                    fail ("WRITE fragments must be BINARY!, TEXT!, or ISSUE!");
+            }
+            DROP_GC_GUARD(holder);
+
+            rebreq->binary = Init_Block(Alloc_Value(), holder);
+            rebUnmanage(rebreq->binary);  // otherwise would be seen as a leak
+
+            num_bufs = count;
+            bufs = rebAllocN(uv_buf_t, num_bufs);
+            Cell(const*) frag = ARR_HEAD(holder);
+            for (n = 0; n != count; ++n, ++frag) {
+                bufs[n].base = s_cast(m_cast(Byte*, VAL_BINARY_AT(frag)));
+                bufs[n].len = VAL_LEN_AT(frag);
+            }
+        }
+        else {
+            if (
+                IS_BINARY(data)
+                and not REF(part)
+                and Is_Series_Frozen(VAL_SERIES(data))
+            ){
+                rebreq->binary = rebValue("@", data);
+            }
+            else
+                rebreq->binary = rebValue(
+                    "as binary! copy/part", data, rebQ(ARG(part))
+                );
+            rebUnmanage(rebreq->binary);  // otherwise would be seen as a leak
+
+            onebuf.base = s_cast(m_cast(Byte*, VAL_BINARY_AT(rebreq->binary)));
+            onebuf.len = VAL_LEN_AT(rebreq->binary);
+            bufs = &onebuf;
+            num_bufs = 1;
+        }
+
+        int r = uv_write(
+            &rebreq->req, sock->stream, bufs, num_bufs, on_write_finished
+        );
+        if (bufs != &onebuf)
+            rebFree(bufs);  // libuv copies the buffer descriptors on submit
         if (r < 0)
             return RAISE(rebError_UV(r));  // e.g. "broken pipe" ?
 
-        do {
-            uv_run(uv_default_loop(), UV_RUN_ONCE);
-        } while (rebreq->result == nullptr);
+        Reb_Deadline *deadline =
+            Start_Deadline_If_Requested(port, &rebreq->result);
+
+        bool halted = Pump_Event_Loop_Until_Result_Or_Halt(&rebreq->result);
+        bool timed_out = Finish_Deadline(deadline);
+
+        if (halted) {
+            rebreq->abandoned = true;  // on_write_finished() frees it
+            return COPY(port);  // SIG_HALT still set, discards this result
+        }
+
+        if (timed_out) {
+            //
+            // A submitted uv_write() can't be cancelled, so as with a halt
+            // the completion callback takes over freeing the request.  The
+            // timeout error is pulled out of the result slot first (the
+            // callback won't touch it once the request is abandoned).
+            //
+            REBVAL *error = rebreq->result;
+            rebreq->abandoned = true;  // on_write_finished() frees it
+            return RAISE(error);
+        }
 
         if (not IS_BLANK(rebreq->result))
             return RAISE(rebreq->result);  // e.g. "broken pipe" ?
@@ -1033,6 +1553,216 @@ static Bounce UDP_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
 }
 
 
+//
+//  export resolve-host: native [
+//
+//  {Look up the IPv4 address of a hostname (asynchronously, with caching)}
+//
+//      return: "Null if the host is not found"
+//          [<opt> tuple!]
+//      hostname [text!]
+//  ]
+//
+DECLARE_NATIVE(resolve_host)
+//
+// Lookups wait on libuv's getaddrinfo and go through the TTL cache, so this
+// is the programmatic way to get the same answers OPEN gets for a TCP spec.
+// The DNS extension's forward lookups (e.g. READ DNS://EXAMPLE.COM) are
+// defined in terms of this native.
+{
+    NETWORK_INCLUDE_PARAMS_OF_RESOLVE_HOST;
+
+    const char *hostname_utf8 = cs_cast(VAL_UTF8_AT(ARG(hostname)));
+
+    uint32_t ip;
+    REBVAL *error = Lookup_Host(hostname_utf8, &ip);
+    if (error)
+        fail (error);
+
+    if (ip == 0)
+        return nullptr;  // unknown host (or halted; trampoline handles it)
+
+    Byte ip_bytes[4];
+    memcpy(ip_bytes, &ip, 4);
+    return Init_Tuple_Bytes(OUT, ip_bytes, 4);
+}
+
+
+//=//// WEBSOCKET FRAMING /////////////////////////////////////////////////=//
+//
+// WebSocket (RFC 6455) is normally layered over TCP ports in usermode.  The
+// framing itself is simple, but doing it in mezzanine code means the mask is
+// removed with a copy, fragments are reassembled with another copy, and the
+// payload is delivered with a third.  These natives do the byte-level work:
+// unmasking happens in place in the buffer that was read from the socket,
+// and the payload is "delivered" as a position into that same buffer plus a
+// length--no copies.  Handshakes, fragmentation policy, and control frame
+// responses remain usermode concerns, built on top of these.
+//
+
+//
+//  export decode-ws-frame: native [
+//
+//  {Decode one WebSocket frame, unmasking any masked payload in place}
+//
+//      return: "Payload position in DATA, or null if the frame is incomplete"
+//          [<opt> binary!]
+//      @length "Payload size in bytes (payload runs from RETURN to this)"
+//          [integer!]
+//      @opcode "0 continuation, 1 text, 2 binary, 8 close, 9 ping, 10 pong"
+//          [integer!]
+//      @final "Whether the FIN bit was set (false means fragment)"
+//          [logic!]
+//      data "Buffer positioned at the head of a frame (modified: unmasked)"
+//          [binary!]
+//  ]
+//
+DECLARE_NATIVE(decode_ws_frame)
+//
+// Note the unmasking is destructive: decoding the same masked frame twice
+// would XOR the payload back into garbage.  Protocol code consumes a buffer
+// of frames left to right exactly once, so this doesn't come up in practice.
+{
+    NETWORK_INCLUDE_PARAMS_OF_DECODE_WS_FRAME;
+
+    REBVAL *data = ARG(data);
+
+    Size size;
+    Byte* at = VAL_BINARY_SIZE_AT_ENSURE_MUTABLE(&size, data);
+
+    if (size < 2)
+        return nullptr;  // not enough for even the smallest header
+
+    bool final = (at[0] & 0x80) != 0;
+    if ((at[0] & 0x70) != 0)
+        fail ("WebSocket frame has reserved RSV bits set (no extensions)");
+    REBI64 opcode = at[0] & 0x0F;
+
+    bool masked = (at[1] & 0x80) != 0;
+    uint64_t len = at[1] & 0x7F;
+
+    Size header = 2;
+    if (len == 126) {
+        if (size < 4)
+            return nullptr;
+        len = (cast(uint64_t, at[2]) << 8) | at[3];
+        header = 4;
+    }
+    else if (len == 127) {
+        if (size < 10)
+            return nullptr;
+        len = 0;
+        int i;
+        for (i = 0; i < 8; ++i)
+            len = (len << 8) | at[2 + i];
+        header = 10;
+    }
+
+    Byte mask_key[4];
+    if (masked) {
+        if (cast(uint64_t, size) < cast(uint64_t, header) + 4)
+            return nullptr;
+        memcpy(mask_key, at + header, 4);
+        header += 4;
+    }
+
+    if (cast(uint64_t, size) < header + len)
+        return nullptr;  // payload not fully buffered yet, read more
+
+    if (masked) {
+        Byte* p = at + header;
+
+        uint32_t key32;  // XOR a word at a time, key repeats every 4 bytes
+        memcpy(&key32, mask_key, 4);
+
+        uint64_t i = 0;
+        for (; i + 4 <= len; i += 4) {
+            uint32_t chunk;
+            memcpy(&chunk, p + i, 4);
+            chunk ^= key32;
+            memcpy(p + i, &chunk, 4);
+        }
+        for (; i < len; ++i)
+            p[i] ^= mask_key[i & 3];
+    }
+
+    Init_Integer(ARG(length), len);
+    Init_Integer(ARG(opcode), opcode);
+    Init_Logic(ARG(final), final);
+
+    Copy_Cell(OUT, data);
+    VAL_INDEX_UNBOUNDED(OUT) += header;  // position at start of payload
+
+    return Proxy_Multi_Returns(frame_);
+}
+
+
+//
+//  export encode-ws-frame: native [
+//
+//  {Encode a WebSocket frame with the given payload}
+//
+//      return: "Header followed by payload (masked if /MASK)"
+//          [binary!]
+//      payload "TEXT! is encoded as its UTF-8 bytes"
+//          [binary! text!]
+//      opcode "0 continuation, 1 text, 2 binary, 8 close, 9 ping, 10 pong"
+//          [integer!]
+//      /mask "Mask with a random key (required for client-to-server frames)"
+//      /continued "Don't set the FIN bit (fragment, more frames follow)"
+//  ]
+//
+DECLARE_NATIVE(encode_ws_frame)
+{
+    NETWORK_INCLUDE_PARAMS_OF_ENCODE_WS_FRAME;
+
+    REBI64 opcode = VAL_INT64(ARG(opcode));
+    if (opcode < 0 or opcode > 15)
+        fail ("WebSocket opcode must be between 0 and 15");
+
+    Size size;
+    const Byte* payload = VAL_BYTES_AT(&size, ARG(payload));
+
+    Binary(*) bin = Make_Binary(14 + size);  // 14 is the largest header
+    Byte* out = BIN_HEAD(bin);
+
+    *out++ = (REF(continued) ? 0x00 : 0x80) | cast(Byte, opcode);
+
+    Byte mask_bit = REF(mask) ? 0x80 : 0x00;
+    if (size < 126)
+        *out++ = mask_bit | cast(Byte, size);
+    else if (size <= 0xFFFF) {
+        *out++ = mask_bit | 126;
+        *out++ = cast(Byte, size >> 8);
+        *out++ = cast(Byte, size);
+    }
+    else {
+        *out++ = mask_bit | 127;
+        int i;
+        for (i = 7; i >= 0; --i)
+            *out++ = cast(Byte, cast(uint64_t, size) >> (8 * i));
+    }
+
+    if (REF(mask)) {
+        uint32_t key32 = cast(uint32_t, Random_Int(false));
+        Byte mask_key[4];
+        memcpy(mask_key, &key32, 4);
+        memcpy(out, mask_key, 4);
+        out += 4;
+
+        Size i;
+        for (i = 0; i < size; ++i)
+            out[i] = payload[i] ^ mask_key[i & 3];
+    }
+    else
+        memcpy(out, payload, size);
+
+    TERM_BIN_LEN(bin, (out - BIN_HEAD(bin)) + size);
+
+    return Init_Binary(OUT, bin);
+}
+
+
 //
 //  export get-tcp-actor-handle: native [
 //
@@ -1077,24 +1807,6 @@ void wait_timer_callback(uv_timer_t* handle) {
 }
 
 
-uv_timer_t halt_poll_timer;
-
-void halt_poll_timer_callback(uv_timer_t* handle) {
-    //
-    // Doesn't actually do anything, just breaks the UV_RUN_ONCE loop
-    // every half a second.  Theoretically we could do this with uv_signal_t
-    // for SIGINT and a callback like:
-    //
-    //     void signal_callback(uv_signal_t* handle, int signum) {
-    //         SET_SIGNAL(SIG_HALT);
-    //     }
-    //
-    // But that seems to only work on Linux and not Windows.
-    //
-    UNUSED(handle);
-}
-
-
 //
 //  startup*: native [  ; Note: DO NOT EXPORT!
 //
@@ -1133,7 +1845,18 @@ DECLARE_NATIVE(startup_p)
 
     uv_timer_init(uv_default_loop(), &wait_timer);
 
-    uv_timer_init(uv_default_loop(), &halt_poll_timer);
+    // The wakeup must not hold the loop "alive" on its own--uv_run should
+    // still return when no real work is pending--so it is unreferenced.
+    // An unreferenced async still wakes the loop when sent.
+    //
+    uv_async_init(
+        uv_default_loop(), &signal_wakeup_async, &signal_wakeup_callback
+    );
+    uv_unref(cast(uv_handle_t*, &signal_wakeup_async));
+
+    PG_Signal_Wakeup_Hook = &Wake_Network_Event_Loop;
+
+    Ready_Ports = rebValue("copy []");
 
     return rebNone();
 }
@@ -1155,8 +1878,15 @@ DECLARE_NATIVE(shutdown_p)
     WSACleanup();  // have to call as libuv does not
   #endif
 
+    Clear_DNS_Cache();
+
+    rebRelease(Ready_Ports);
+    Ready_Ports = nullptr;
+
+    PG_Signal_Wakeup_Hook = nullptr;  // before the async backing it closes
+
     uv_close(cast(uv_handle_t*, &wait_timer), nullptr);  // no close callback
-    uv_close(cast(uv_handle_t*, &halt_poll_timer), nullptr);
+    uv_close(cast(uv_handle_t*, &signal_wakeup_async), nullptr);
 
     return rebNone();
 }
@@ -1240,23 +1970,46 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
         uv_timer_start(&wait_timer, &wait_timer_callback, timeout, repeat_ms);
     }
 
-    // !!! See halt_poll_timer_callback() on why not uv_signal_t for SIGINT
-    //
-    uv_timer_start(&halt_poll_timer, &halt_poll_timer_callback, 500, 500);
+    if (ports != nullptr)
+        Mark_Ports_Waited(ports, true);  // callbacks queue these if they wake
 
     // Let any pending device I/O have a chance to run.  UV_RUN_ONCE means it
     // will block until *something* happens (could be the timer timing out,
     // or could be something like an incoming network connection being made).
+    // The block is total--an idle WAIT makes no wakeups--because a halt (or
+    // any signal) pokes signal_wakeup_async and re-checks here.
     //
-    while (
-        (timeout == ALL_BITS or wait_timer.data != nullptr)
-        and not GET_SIGNAL(SIG_HALT)
-    ){
+    Ref_Wakeup_For_Blocking();  // so an empty loop blocks instead of spinning
+
+    Context(*) awoke = nullptr;
+    while (true) {
+        if (ports != nullptr and VAL_LEN_AT(Ready_Ports) != 0) {
+            //
+            // A callback saw activity on a port this WAIT* is watching.
+            // (Events on unwatched ports never land in the ready list, so
+            // the head of the queue is the winner--no scanning.)
+            //
+            Cell(const*) tail;
+            awoke = VAL_CONTEXT(VAL_ARRAY_AT(&tail, Ready_Ports));
+            break;
+        }
+        if (timeout != ALL_BITS and wait_timer.data == nullptr)
+            break;  // the timeout expired
+        if (GET_SIGNAL(SIG_HALT))
+            break;
+
         int callbacks_left = uv_run(uv_default_loop(), UV_RUN_ONCE);
         UNUSED(callbacks_left);
     }
 
-    uv_timer_stop(&halt_poll_timer);
+    Unref_Wakeup_After_Blocking();
+
+    if (ports != nullptr) {
+        Mark_Ports_Waited(ports, false);
+        if (awoke != nullptr)
+            Init_Port(OUT, awoke);  // before clearing list's GC protection
+        rebElide("clear", Ready_Ports);
+    }
 
     if (timeout != ALL_BITS) {
         uv_timer_stop(&wait_timer);
@@ -1278,5 +2031,8 @@ DECLARE_NATIVE(wait_p)  // See wrapping function WAIT in usermode code
         fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
     }
 
-    return nullptr;
+    if (awoke != nullptr)
+        return OUT;  // the PORT! whose activity ended the wait
+
+    return nullptr;  // timeout
 }
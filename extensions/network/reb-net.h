@@ -61,6 +61,15 @@ struct Reb_Sock_Port_State {
 
     uint32_t modes;  // RSM_XXX flags
 
+    // WAIT* marks the sockets it is blocking on, so libuv callbacks that
+    // notice activity on a port (e.g. a connection accepted on a listener)
+    // can queue just that port for WAIT* to return.  An event finds its port
+    // through the uv handle's data pointer and this one flag--never a scan
+    // of the open ports--so a process with thousands of quiet ports pays
+    // nothing extra per event.  See Queue_Port_Awoke() in %mod-network.c.
+    //
+    bool waited;
+
     uint32_t local_ip;
     uint32_t local_port_number;
     uint32_t remote_ip;
@@ -82,6 +91,12 @@ typedef struct {
     Context(*) port_ctx;
     REBVAL *binary;
     REBVAL *result;
+
+    // Set if the requester was halted out of its wait; writes can't be
+    // cancelled once submitted to libuv, so the completion callback takes
+    // over responsibility for freeing the request.
+    //
+    bool abandoned;
 } Reb_Write_Request;
 
 
@@ -93,9 +108,19 @@ typedef struct {
 
     Context(*) port_ctx;
     REBVAL *result;
+    bool abandoned;  // see remarks in Reb_Write_Request
 } Reb_Connect_Request;
 
 
+typedef struct {
+    uv_getaddrinfo_t req;  // make first member of struct so we can cast it
+
+    uint32_t ip;  // IPv4 address filled in on success (0 if host not found)
+    REBVAL *result;
+    bool abandoned;  // see remarks in Reb_Write_Request
+} Reb_Lookup_Request;
+
+
 typedef struct {
     Context(*) port_ctx;
 
@@ -499,7 +499,15 @@ DECLARE_NATIVE(open_statement)
 
     REBVAL *hstmt_value = rebHandle(hstmt, sizeof(hstmt), nullptr);
 
-    rebElide("poke", ARG(statement), "'hstmt", rebR(hstmt_value));
+    // The base handle is what catalog queries run on, so that they never
+    // disturb a prepared query in the cache.  'hstmt starts out pointing at
+    // it, and INSERT-ODBC repoints 'hstmt at whichever handle ran last.
+    //
+    rebElide(
+        "poke", ARG(statement), "'hstmt", hstmt_value,
+        "poke", ARG(statement), "'base-hstmt", rebR(hstmt_value),
+        "poke", ARG(statement), "'cache copy []"
+    );
 
     return rebLogic(true);
 }
@@ -1161,6 +1169,31 @@ void ODBC_DescribeResults(
 }
 
 
+// Put the fetch-related statement attributes back to their defaults, undoing
+// any column-wise batch binding left behind by COPY-ODBC (including pointers
+// into buffers that may have been freed if a fetch failed partway).
+//
+static void ODBC_Reset_Fetch_Attributes(SQLHSTMT hstmt) {
+    SQLFreeStmt(hstmt, SQL_UNBIND);  // !!! check rc?
+    SQLSetStmtAttr(
+        hstmt,
+        SQL_ATTR_ROW_ARRAY_SIZE,
+        cast(SQLPOINTER, cast(uintptr_t, 1)),
+        0
+    );
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+    SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+}
+
+
+// How many prepared statement handles a statement object keeps around, in
+// addition to the 'base-hstmt used by catalog queries.  Preparation cost is
+// only worth dodging for a modest working set of queries, and each handle
+// holds driver-side resources...so keep the list short.
+//
+#define PREPARED_CACHE_MAX 8
+
+
 //
 //  export insert-odbc: native [
 //
@@ -1178,17 +1211,9 @@ DECLARE_NATIVE(insert_odbc)
     ODBC_INCLUDE_PARAMS_OF_INSERT_ODBC;
 
     REBVAL *statement = ARG(statement);
-    REBVAL *hstmt_value = rebValue(
-        "ensure handle! pick", statement, "'hstmt"
-    );
-    SQLHSTMT hstmt = VAL_HANDLE_POINTER(SQLHSTMT, hstmt_value);
-    rebRelease(hstmt_value);
 
     SQLRETURN rc;
 
-    rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
-    rc = SQLCloseCursor(hstmt);  // !!! check rc?
-
     //=//// MAKE SQL REQUEST FROM DIALECTED SQL BLOCK /////////////////////=//
     //
     // The block passed in is used to form a query.
@@ -1207,16 +1232,40 @@ DECLARE_NATIVE(insert_odbc)
         "]"
     );
 
+    SQLHSTMT hstmt;
+
     if (get_catalog) {
+        //
+        // Catalog queries run on the statement's base handle, so that they
+        // don't clobber the preparation of a handle in the prepared cache.
+        //
+        REBVAL *hstmt_value = rebValue(
+            "ensure handle! pick", statement, "'base-hstmt"
+        );
+        hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(hstmt_value));
+        rebRelease(hstmt_value);
+
+        rebElide(  // COPY-ODBC fetches from whatever 'hstmt points to
+            "poke", statement, "'hstmt",
+                "pick", statement, "'base-hstmt"
+        );
+
+        ODBC_Reset_Fetch_Attributes(hstmt);
+        rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+        rc = SQLCloseCursor(hstmt);  // !!! check rc?
+
         rc = ODBC_GetCatalog(hstmt, ARG(sql));
     }
     else {
         // Prepare/Execute statement, when first element in the block is a
-        // (statement) string
-
-        // Compare with previously prepared statement, and if not the same,
-        // then prepare a new statement.
+        // (statement) string.
         //
+        // Statements are prepared once per distinct query text and kept in
+        // a most-recently-used list of [text handle ...] pairs on the
+        // statement object, so alternating between a working set of queries
+        // (each with different parameters) doesn't re-prepare on each swap.
+        // The LRU entry past PREPARED_CACHE_MAX is evicted and freed.
+
         use_cache = rebUnboxLogic(
             "strict-equal? first", ARG(sql),
                 "ensure [<opt> text!] pick", statement, "'string"
@@ -1224,29 +1273,98 @@ DECLARE_NATIVE(insert_odbc)
 
         REBLEN sql_index = 1;
 
-        if (not use_cache) {
-            SQLWCHAR *sql_string = rebSpellWide("first", ARG(sql));
-
-            rc = SQLPrepareW(
-                hstmt,
-                sql_string,
-                SQL_NTS  // Null-Terminated String
+        if (use_cache) {  // same query as last time, 'hstmt already right
+            REBVAL *hstmt_value = rebValue(
+                "ensure handle! pick", statement, "'hstmt"
+            );
+            hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(hstmt_value));
+            rebRelease(hstmt_value);
+        }
+        else {
+            REBVAL *cached = rebValue(  // hit moves pair to front of list
+                "let cache: ensure block! pick", statement, "'cache",
+                "let pos: find/case cache first", ARG(sql),
+                "if pos [",
+                    "let pair: copy/part pos 2",
+                    "remove/part pos 2",
+                    "insert cache pair",
+                    "ensure handle! second pair",
+                "]"
             );
-            if (not SQL_SUCCEEDED(rc))
-                rebJumps ("fail", Error_ODBC_Stmt(hstmt));
 
-            rebFree(sql_string);
+            if (cached) {
+                hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(cached));
+                rebRelease(cached);
+            }
+            else {
+                REBVAL *hdbc_value = rebValue(
+                    "ensure handle! pick",
+                        "(pick", statement, "'database) 'hdbc"
+                );
+                CONNECTION *conn
+                    = VAL_HANDLE_POINTER(CONNECTION, hdbc_value);
+                SQLHDBC hdbc = conn->hdbc;
+                rebRelease(hdbc_value);
 
-            // Remember statement string handle, but keep a copy since it
-            // may be mutated by the user.
-            //
-            // !!! Could re-use value with existing series if read only
-            //
-            rebElide(
-                "poke", statement, "'string", "(copy first", ARG(sql), ")"
+                rc = SQLAllocHandle(SQL_HANDLE_STMT, hdbc, &hstmt);
+                if (not SQL_SUCCEEDED(rc))
+                    rebJumps ("fail", Error_ODBC_Dbc(hdbc));
+
+                SQLWCHAR *sql_string = rebSpellWide("first", ARG(sql));
+
+                rc = SQLPrepareW(
+                    hstmt,
+                    sql_string,
+                    SQL_NTS  // Null-Terminated String
+                );
+                if (not SQL_SUCCEEDED(rc)) {
+                    REBVAL *error = Error_ODBC_Stmt(hstmt);
+                    SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+                    rebJumps ("fail", error);
+                }
+
+                rebFree(sql_string);
+
+                // The cache key is a copy of the query text, since the one
+                // passed in may be mutated by the user.
+                //
+                REBVAL *hstmt_value = rebHandle(
+                    hstmt, sizeof(hstmt), nullptr
+                );
+                rebElide(
+                    "let cache: ensure block! pick", statement, "'cache",
+                    "insert cache reduce [",
+                        "copy first", ARG(sql), rebR(hstmt_value),
+                    "]"
+                );
+
+                REBVAL *evicted = rebValue(
+                    "let cache: ensure block! pick", statement, "'cache",
+                    "if", rebI(2 * PREPARED_CACHE_MAX), "< length of cache [",
+                        "let h: ensure handle! last cache",
+                        "clear skip tail cache -2",
+                        "h",
+                    "]"
+                );
+                if (evicted) {
+                    SQLHSTMT loser
+                        = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(evicted));
+                    SQLFreeHandle(SQL_HANDLE_STMT, loser);
+                    rebRelease(evicted);
+                }
+            }
+
+            rebElide(  // front cache entry is the handle now in use
+                "let cache: ensure block! pick", statement, "'cache",
+                "poke", statement, "'hstmt second cache",
+                "poke", statement, "'string first cache"
             );
         }
 
+        ODBC_Reset_Fetch_Attributes(hstmt);
+        rc = SQLFreeStmt(hstmt, SQL_RESET_PARAMS);  // !!! check rc?
+        rc = SQLCloseCursor(hstmt);  // !!! check rc?
+
         // The SQL string may contain ? characters, which indicates that it is
         // a parameterized query.  The separation of the parameters into a
         // different quarantined part of the query is to protect against SQL
@@ -1407,13 +1525,17 @@ DECLARE_NATIVE(insert_odbc)
 
 
 //
-// A query will fill a column's buffer with data.  This data can be
-// reinterpreted as a Rebol value.  Successive queries for records reuse the
-// buffer for a column.
+// A query will fill a buffer with data for a column.  This data can be
+// reinterpreted as a Rebol value.  The buffer and length are passed in
+// explicitly (not just read out of the COLUMN) so that the bulk fetch path
+// can convert individual rows out of a column-wise bound array.
 //
-REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
-{
-    if (col->length == SQL_NULL_DATA)
+REBVAL *ODBC_Column_To_Rebol_Value(
+    COLUMN *col,
+    SQLPOINTER buffer,
+    SQLLEN length
+){
+    if (length == SQL_NULL_DATA)
         return rebBlank();
 
     switch (col->c_type) {
@@ -1426,7 +1548,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
         if (col->column_size != 1)
             rebJumps("fail {BIT(n) fields are only supported for n = 1}");
 
-        if (*cast(unsigned char*, col->buffer))
+        if (*cast(unsigned char*, buffer))
             return rebValue("'~true~");  // can't append isotope to block :-(
         return rebValue("'~false~");
 
@@ -1435,10 +1557,10 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // in the sql_type (not the c_type)
 
       case SQL_C_SLONG:  // signed: -32,768..32,767
-        return rebInteger(*cast(SQLINTEGER*, col->buffer));
+        return rebInteger(*cast(SQLINTEGER*, buffer));
 
       case SQL_C_ULONG:  // signed: -2[31]..2[31] - 1
-        return rebInteger(*cast(SQLUINTEGER*, col->buffer));
+        return rebInteger(*cast(SQLUINTEGER*, buffer));
 
     // Special exception made for big integers, where seemingly MySQL
     // would not properly map smaller types into big integers if all
@@ -1447,22 +1569,22 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // !!! Review: bug may not exist if SQLGetData() is used.
 
       case SQL_C_SBIGINT:  // signed: -2[63]..2[63]-1
-        return rebInteger(*cast(SQLBIGINT*, col->buffer));
+        return rebInteger(*cast(SQLBIGINT*, buffer));
 
       case SQL_C_UBIGINT:  // unsigned: 0..2[64] - 1
-        if (*cast(REBU64*, col->buffer) > INT64_MAX)
+        if (*cast(REBU64*, buffer) > INT64_MAX)
             rebJumps ("fail {INTEGER! can't hold some unsigned 64-bit values}");
 
-        return rebInteger(*cast(SQLUBIGINT*, col->buffer));
+        return rebInteger(*cast(SQLUBIGINT*, buffer));
 
     // ODBC was asked at column binding time to give back all floating
     // point types as SQL_C_DOUBLE, regardless of actual size.
 
       case SQL_C_DOUBLE:
-        return rebDecimal(*cast(SQLDOUBLE*, col->buffer));
+        return rebDecimal(*cast(SQLDOUBLE*, buffer));
 
       case SQL_C_TYPE_DATE: {
-        DATE_STRUCT *date = cast(DATE_STRUCT*, col->buffer);
+        DATE_STRUCT *date = cast(DATE_STRUCT*, buffer);
         return rebValue(
             "make date! [",
                 rebI(date->year), rebI(date->month), rebI(date->day),
@@ -1475,7 +1597,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
         // component.  Hence a TIME(7) might be able to store 17:32:19.123457
         // but when it is retrieved it will just be 17:32:19
         //
-        TIME_STRUCT *time = cast(TIME_STRUCT*, col->buffer);
+        TIME_STRUCT *time = cast(TIME_STRUCT*, buffer);
         return rebValue(
             "make time! [",
                 rebI(time->hour), rebI(time->minute), rebI(time->second),
@@ -1488,7 +1610,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // try and figure this out in the future if they are so inclined.
 
       case SQL_C_TYPE_TIMESTAMP: {
-        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, col->buffer);
+        TIMESTAMP_STRUCT *stamp = cast(TIMESTAMP_STRUCT*, buffer);
 
         // !!! The fraction is generally 0, even if you wrote a nonzero value
         // in the timestamp:
@@ -1517,7 +1639,7 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
     // as SQL_C_BINARY.
 
       case SQL_C_BINARY:
-        return rebSizedBinary(col->buffer, col->length);
+        return rebSizedBinary(buffer, length);
 
     // There's no guarantee that CHAR fields contain valid UTF-8, but we
     // currently only support that.
@@ -1529,8 +1651,8 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
         switch (char_column_encoding) {
           case CHAR_COL_UTF8:
             return rebSizedText(
-                cast(char*, col->buffer),  // unixodbc SQLCHAR is unsigned
-                col->length
+                cast(char*, buffer),  // unixodbc SQLCHAR is unsigned
+                length
             );
 
           case CHAR_COL_UTF16:
@@ -1544,21 +1666,21 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
             // (Should there be rebSizedTextLatin1() ?)
             //
             REBVAL *binary = rebSizedBinary(
-                cast(unsigned char*, col->buffer),
-                col->length
+                cast(unsigned char*, buffer),
+                length
             );
             return rebValue(
-                "append make text!", rebI(col->length),
+                "append make text!", rebI(length),
                     "map-each byte", rebR(binary), "[codepoint-to-char byte]"
             ); }
         }
         break; }
 
       case SQL_C_WCHAR:
-        assert(col->length % 2 == 0);
+        assert(length % 2 == 0);
         return rebLengthedTextWide(
-            cast(SQLWCHAR*, col->buffer),
-            col->length / 2
+            cast(SQLWCHAR*, buffer),
+            length / 2
         );
 
       default:
@@ -1572,6 +1694,36 @@ REBVAL *ODBC_Column_To_Rebol_Value(COLUMN *col)
 }
 
 
+// Fixed-width C types can be bound column-wise and fetched a rowset at a
+// time.  The variable-sized ones (strings, binaries) have to keep going
+// through SQLGetData(), so their buffers can be grown upon truncation.
+//
+static bool ODBC_Column_Is_Fixed_Width(const COLUMN *col) {
+    switch (col->c_type) {
+      case SQL_C_BIT:
+      case SQL_C_SLONG:
+      case SQL_C_ULONG:
+      case SQL_C_SBIGINT:
+      case SQL_C_UBIGINT:
+      case SQL_C_DOUBLE:
+      case SQL_C_TYPE_DATE:
+      case SQL_C_TYPE_TIME:
+      case SQL_C_TYPE_TIMESTAMP:
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+
+// How many rows to ask SQLFetchScroll() for in one driver round-trip when
+// all the result columns can be bound column-wise.  Big enough to amortize
+// the per-call overhead, small enough to keep the transient buffers modest.
+//
+#define ODBC_ROWSET_SIZE 256
+
+
 //
 //  export copy-odbc: native [
 //
@@ -1618,6 +1770,136 @@ DECLARE_NATIVE(copy_odbc)
     );
 
     SQLLEN row = 0;
+
+    //=//// BULK FETCH WHEN ALL COLUMNS ARE FIXED WIDTH ///////////////////=//
+    //
+    // Analytics-style result sets (numbers, dates, times) can be pulled a
+    // rowset at a time: bind each column to an array of its fixed-size type
+    // and let SQLFetchScroll() fill whole batches in one driver round-trip,
+    // instead of paying for an SQLFetch() plus per-column SQLGetData() calls
+    // on every row.  Any variable-width column (strings, binaries) falls
+    // through to the SQLGetData() loop below, which can grow its buffers on
+    // truncation--something array binding can't do.
+
+    bool all_fixed_width = true;
+  blockscope {
+    SQLSMALLINT i;
+    for (i = 0; i < num_columns; ++i) {
+        if (not ODBC_Column_Is_Fixed_Width(&columns[i])) {
+            all_fixed_width = false;
+            break;
+        }
+    }
+  }
+
+    if (all_fixed_width and (num_rows == -1 or num_rows > 1)) {
+        SQLULEN rowset = ODBC_ROWSET_SIZE;
+        if (num_rows != -1 and cast(SQLLEN, rowset) > num_rows)
+            rowset = num_rows;
+
+        SQLUSMALLINT *statuses = rebAllocN(SQLUSMALLINT, rowset);
+        SQLULEN num_fetched = 0;
+
+        SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_BIND_TYPE,
+            cast(SQLPOINTER, cast(uintptr_t, SQL_BIND_BY_COLUMN)),
+            0
+        );
+        SQLSetStmtAttr(
+            hstmt,
+            SQL_ATTR_ROW_ARRAY_SIZE,
+            cast(SQLPOINTER, cast(uintptr_t, rowset)),
+            0
+        );
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROWS_FETCHED_PTR, &num_fetched, 0);
+        SQLSetStmtAttr(hstmt, SQL_ATTR_ROW_STATUS_PTR, statuses, 0);
+
+        // Note: rebAlloc()'d memory is automatically freed on fail(), so an
+        // Error_ODBC_Stmt() jump mid-fetch doesn't leak these.  (The stale
+        // attribute pointers get cleared by ODBC_Reset_Fetch_Attributes()
+        // before the statement handle's next use.)
+        //
+        SQLPOINTER *bufs = rebAllocN(SQLPOINTER, num_columns);
+        SQLLEN **lens = rebAllocN(SQLLEN*, num_columns);
+
+        SQLSMALLINT i;
+        for (i = 0; i < num_columns; ++i) {
+            COLUMN *col = &columns[i];
+            bufs[i] = rebAllocN(char, col->buffer_size * rowset);
+            lens[i] = rebAllocN(SQLLEN, rowset);
+
+            rc = SQLBindCol(
+                hstmt,  // StatementHandle
+                i + 1,  // ColumnNumber
+                col->c_type,  // TargetType
+                bufs[i],  // TargetValuePtr (array, one element per row)
+                col->buffer_size,  // BufferLength (the column-wise stride)
+                lens[i]  // StrLen_or_IndPtr (also an array)
+            );
+            if (not SQL_SUCCEEDED(rc))
+                rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+        }
+
+        while (row != num_rows) {
+            if (num_rows != -1 and num_rows - row < cast(SQLLEN, rowset)) {
+                rowset = num_rows - row;  // don't overshoot a /PART limit
+                SQLSetStmtAttr(
+                    hstmt,
+                    SQL_ATTR_ROW_ARRAY_SIZE,
+                    cast(SQLPOINTER, cast(uintptr_t, rowset)),
+                    0
+                );
+            }
+
+            rc = SQLFetchScroll(hstmt, SQL_FETCH_NEXT, 0);
+            if (rc == SQL_NO_DATA)
+                break;
+            if (not SQL_SUCCEEDED(rc))
+                rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+
+            SQLULEN r;
+            for (r = 0; r < num_fetched; ++r) {
+                if (statuses[r] == SQL_ROW_NOROW)
+                    break;
+                if (
+                    statuses[r] != SQL_ROW_SUCCESS
+                    and statuses[r] != SQL_ROW_SUCCESS_WITH_INFO
+                ){
+                    rebJumps ("fail", Error_ODBC_Stmt(hstmt));
+                }
+
+                REBVAL *record = rebValue("make block!", rebI(num_columns));
+
+                for (i = 0; i < num_columns; ++i) {
+                    COLUMN *col = &columns[i];
+                    REBVAL *temp = ODBC_Column_To_Rebol_Value(
+                        col,
+                        cast(char*, bufs[i]) + col->buffer_size * r,
+                        lens[i][r]
+                    );
+                    rebElide("append", record, rebQ(temp));  // blank => NULL
+                    rebRelease(temp);
+                }
+
+                rebElide("append", results, rebR(record));
+                ++row;
+            }
+        }
+
+        ODBC_Reset_Fetch_Attributes(hstmt);  // restore SQLGetData() usability
+
+        for (i = 0; i < num_columns; ++i) {
+            rebFree(bufs[i]);
+            rebFree(lens[i]);
+        }
+        rebFree(bufs);
+        rebFree(lens);
+        rebFree(statuses);
+
+        return results;
+    }
+
     while (row != num_rows) {
 
         // This SQLFetch operation "fetches" the next row.  If we were using
@@ -1728,7 +2010,11 @@ DECLARE_NATIVE(copy_odbc)
                 rebJumps ("fail", Error_ODBC_Stmt(hstmt));
             }
 
-            REBVAL *temp = ODBC_Column_To_Rebol_Value(col);
+            REBVAL *temp = ODBC_Column_To_Rebol_Value(
+                col,
+                col->buffer,
+                col->length
+            );
             rebElide("append", record, rebQ(temp));  // Q because blank => NULL
             rebRelease(temp);
         }
@@ -1822,20 +2108,46 @@ DECLARE_NATIVE(close_statement)
         rebRelease(columns_value);
     }
 
-    REBVAL *hstmt_value = rebValue(
-        "ensure [<opt> handle!] pick", statement, "'hstmt"
+    // Every handle the statement owns lives in the cache or as 'base-hstmt.
+    // The 'hstmt field only aliases one of those, so it is nulled out but
+    // not freed here (doing both would be a double free).
+    //
+    REBVAL *cache_value = rebValue(
+        "ensure [<opt> block!] pick", statement, "'cache"
     );
-    if (hstmt_value) {
-        SQLHSTMT hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(hstmt_value));
+    if (cache_value) {
+        while (0 != rebUnbox("length of", cache_value)) {
+            REBVAL *cached = rebValue(
+                "ensure handle! take/last", cache_value,
+                "elide take/last", cache_value  // the query text
+            );
+            SQLHSTMT hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(cached));
+            if (hstmt != SQL_NULL_HANDLE) {
+                SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
+                SET_HANDLE_CDATA(cached, SQL_NULL_HANDLE);  // avoid GC cleanup
+            }
+            rebRelease(cached);
+        }
+        rebElide("poke", statement, "'cache", "null");
+        rebRelease(cache_value);
+    }
+
+    REBVAL *base_value = rebValue(
+        "ensure [<opt> handle!] pick", statement, "'base-hstmt"
+    );
+    if (base_value) {
+        SQLHSTMT hstmt = cast(SQLHSTMT, VAL_HANDLE_VOID_POINTER(base_value));
         assert(hstmt);
 
         SQLFreeHandle(SQL_HANDLE_STMT, hstmt);
-        SET_HANDLE_CDATA(hstmt_value, SQL_NULL_HANDLE);  // avoid GC cleanup
-        rebElide("poke", statement, "'hstmt", "null");
+        SET_HANDLE_CDATA(base_value, SQL_NULL_HANDLE);  // avoid GC cleanup
+        rebElide("poke", statement, "'base-hstmt", "null");
 
-        rebRelease(hstmt_value);
+        rebRelease(base_value);
     }
 
+    rebElide("poke", statement, "'hstmt", "null");
+
     return rebLogic(true);
 }
 
@@ -50,6 +50,24 @@
 #include <signal.h>
 #include <sys/stat.h>
 #include <sys/wait.h>
+
+#ifdef USE_POSIX_SPAWN_NOT_FORK
+    //
+    // fork() must duplicate the page tables of the calling process, and for
+    // an interpreter with a large heap that copying dwarfs the cost of the
+    // exec itself when spawning many short-lived tools.  posix_spawn() is
+    // done with vfork()-style cloning on the libcs this flag targets, which
+    // borrows the parent's address space until the exec...so the per-CALL
+    // overhead is roughly an order of magnitude lower.
+    //
+    // The flag also assumes a libc where posix_spawn() reports a failure of
+    // the internal exec in its return value (glibc 2.26+, musl, Apple's
+    // syscall-based version).  Older implementations would surface such
+    // failures as a child exiting with code 127, the way a shell does.
+    //
+    #include <spawn.h>
+    extern char **environ;  // redundant under TO_OSX etc., which is harmless
+#endif
 #if !defined(WIFCONTINUED) && TO_ANDROID
 // old version of bionic doesn't define WIFCONTINUED
 // https://android.googlesource.com/platform/bionic/+/c6043f6b27dc8961890fed12ddb5d99622204d6d%5E%21/#F0
@@ -345,6 +363,11 @@ Bounce Call_Core(Frame(*) frame_) {
 
     pid_t forked_pid = -1;
 
+  #ifdef USE_POSIX_SPAWN_NOT_FORK
+    posix_spawn_file_actions_t file_actions;  // POD, gotos may skip past
+    bool file_actions_used = false;  // need posix_spawn_file_actions_destroy
+  #endif
+
     if (IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))) {
         if (Open_Pipe_Fails(stdin_pipe))
             goto stdin_pipe_err;
@@ -360,6 +383,118 @@ Bounce Call_Core(Frame(*) frame_) {
             goto stdout_pipe_err;
     }
 
+  #ifdef USE_POSIX_SPAWN_NOT_FORK
+
+    //=//// POSIX_SPAWN() FAST PATH //////////////////////////////////////=//
+
+    // All the redirections that the fork() branch performs in the child are
+    // expressed here as "file actions" carried out by the spawn machinery.
+    // Note that FILE! paths must be converted in the parent--the child
+    // branch of a fork should not really be calling the interpreter anyway,
+    // as another thread could have been mid-malloc() at the moment of fork.
+    //
+    // The "info pipe" that the fork() path uses to get the errno of a failed
+    // exec() out of the child is not opened at all on this path, since
+    // posix_spawn() reports that failure in its return value.  The parent
+    // polling loop below tolerates the unopened descriptors.
+
+    ret = posix_spawn_file_actions_init(&file_actions);
+    if (ret != 0)
+        goto error;
+    file_actions_used = true;
+
+    if (not REF(input)) {
+        // inherited from parent by default
+    }
+    else if (IS_TEXT(ARG(input)) or IS_BINARY(ARG(input))) {
+        ret = posix_spawn_file_actions_adddup2(
+            &file_actions, stdin_pipe[R], STDIN_FILENO
+        );
+    }
+    else if (IS_FILE(ARG(input))) {
+        char *local_utf8 = rebSpell("file-to-local", ARG(input));
+        ret = posix_spawn_file_actions_addopen(
+            &file_actions, STDIN_FILENO, local_utf8, O_RDONLY, 0
+        );
+        rebFree(local_utf8);  // addopen() copies the path
+    }
+    else if (IS_LOGIC(ARG(input))) {
+        if (not VAL_LOGIC(ARG(input)))
+            ret = posix_spawn_file_actions_addopen(
+                &file_actions, STDIN_FILENO, "/dev/null", O_RDONLY, 0
+            );
+    }
+    else
+        panic (ARG(input));
+
+    if (ret != 0)
+        goto error;
+
+    if (not REF(output)) {
+        // inherited from parent by default
+    }
+    else if (IS_TEXT(ARG(output)) or IS_BINARY(ARG(output))) {
+        ret = posix_spawn_file_actions_adddup2(
+            &file_actions, stdout_pipe[W], STDOUT_FILENO
+        );
+    }
+    else if (IS_FILE(ARG(output))) {
+        char *local_utf8 = rebSpell("file-to-local", ARG(output));
+        ret = posix_spawn_file_actions_addopen(
+            &file_actions, STDOUT_FILENO, local_utf8, O_CREAT | O_WRONLY, 0666
+        );
+        rebFree(local_utf8);
+    }
+    else if (IS_LOGIC(ARG(output))) {
+        if (not VAL_LOGIC(ARG(output)))
+            ret = posix_spawn_file_actions_addopen(
+                &file_actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0
+            );
+    }
+
+    if (ret != 0)
+        goto error;
+
+    if (not REF(error)) {
+        // inherited from parent by default
+    }
+    else if (IS_TEXT(ARG(error)) or IS_BINARY(ARG(error))) {
+        ret = posix_spawn_file_actions_adddup2(
+            &file_actions, stderr_pipe[W], STDERR_FILENO
+        );
+    }
+    else if (IS_FILE(ARG(error))) {
+        char *local_utf8 = rebSpell("file-to-local", ARG(error));
+        ret = posix_spawn_file_actions_addopen(
+            &file_actions, STDERR_FILENO, local_utf8, O_CREAT | O_WRONLY, 0666
+        );
+        rebFree(local_utf8);
+    }
+    else if (IS_LOGIC(ARG(error))) {
+        if (not VAL_LOGIC(ARG(error)))
+            ret = posix_spawn_file_actions_addopen(
+                &file_actions, STDERR_FILENO, "/dev/null", O_WRONLY, 0
+            );
+    }
+
+    if (ret != 0)
+        goto error;
+
+    // posix_spawnp() searches the PATH the way execvp() does.  All the
+    // parent's ends of the pipes (and the Rebol data structure fds, etc.)
+    // are marked FD_CLOEXEC, so they close automatically in the child at
+    // the moment of the exec--no addclose() bookkeeping is needed.
+    //
+    ret = posix_spawnp(
+        &forked_pid, argv[0], &file_actions, nullptr, argv, environ
+    );
+    if (ret != 0) {
+        forked_pid = -1;  // not spawned, nothing to kill or wait on
+        goto error;
+    }
+
+  #else
+
     if (Open_Pipe_Fails(info_pipe))
         goto info_pipe_err;
 
@@ -527,14 +662,17 @@ Bounce Call_Core(Frame(*) frame_) {
         }
         exit(EXIT_FAILURE);  // get here only when exec fails
     }
-    else {
 
-    //=//// PARENT BRANCH OF FORK() ///////////////////////////////////////=//
+  #endif  // fork() branch of USE_POSIX_SPAWN_NOT_FORK
+
+    {
+
+    //=//// PARENT BRANCH (OF FORK(), OR AFTER POSIX_SPAWN()) /////////////=//
 
         // The parent branch is the Rebol making the CALL.  It may or may not
-        // /WAIT on the child fork branch, based on /WAIT.  Even if you are
-        // not using /WAIT, it will use the info pipe to make sure the process
-        // did actually start.
+        // /WAIT on the child branch, based on /WAIT.  Even if you are not
+        // using /WAIT, the fork()-based path will use the info pipe to make
+        // sure the process did actually start.
 
         nfds_t nfds = 0;
         struct pollfd pfds[4];
@@ -830,6 +968,11 @@ Bounce Call_Core(Frame(*) frame_) {
 
   cleanup:
 
+  #ifdef USE_POSIX_SPAWN_NOT_FORK
+    if (file_actions_used)
+        posix_spawn_file_actions_destroy(&file_actions);
+  #endif
+
     if (info_pipe[R] > 0)
         close(info_pipe[R]);
 
@@ -867,6 +1010,10 @@ Bounce Call_Core(Frame(*) frame_) {
     if (infobuf != nullptr)
         rebFree(infobuf);
 
+  #ifdef USE_POSIX_SPAWN_NOT_FORK
+    goto info_pipe_err;  // spawn path never jumps to it, avoid unused warning
+  #endif
+
   info_pipe_err:
 
     if (stderr_pipe[R] > 0)
@@ -333,15 +333,41 @@ DECLARE_NATIVE(terminate)
 }
 
 
+//=//// ENVIRONMENT SNAPSHOT CACHE ////////////////////////////////////////=//
+//
+// getenv() calls and the fresh TEXT! they each allocate add up when config
+// resolution probes the environment thousands of times at startup.  Since
+// the environment only changes under this process's control via SET-ENV,
+// GET-ENV serves reads from a snapshot MAP! built on first use: values are
+// frozen, so every caller shares one string per variable (COPY to mutate).
+// SET-ENV throws the snapshot away; the next read rebuilds it.
+//
+// The cache can't see changes made behind the interpreter's back (C code
+// calling setenv() directly)--GET-ENV/FRESH bypasses it for that case, and
+// gives a mutable string in the bargain.
+
+static REBVAL *Env_Snapshot = nullptr;  // MAP! of name -> frozen TEXT!
+
+static void Invalidate_Env_Snapshot(void) {
+    if (Env_Snapshot != nullptr) {
+        rebRelease(Env_Snapshot);
+        Env_Snapshot = nullptr;
+    }
+}
+
+static REBVAL *Make_Environment_Map(void);  // shared with LIST-ENV, below
+
+
 //
 //  export get-env: native [
 //
 //  {Returns the value of an OS environment variable (for current process).}
 //
-//      return: "String the variable was set to, or null if not set"
+//      return: "Frozen string the variable is set to (COPY to mutate)"
 //          [<opt> text!]
 //      variable "Name of variable to get (case-insensitive in Windows)"
 //          [<maybe> text! word!]
+//      /fresh "Bypass the snapshot cache (sees setenv() by foreign C code)"
 //  ]
 //
 DECLARE_NATIVE(get_env)
@@ -360,6 +386,23 @@ DECLARE_NATIVE(get_env)
 
     REBVAL *variable = ARG(variable);
 
+    // Cached path: one SELECT against the shared snapshot, whose frozen
+    // value is returned without copying.  (Windows environment lookup is
+    // case-insensitive, which plain SELECT against a MAP! matches; the
+    // POSIX environment is case-sensitive, hence SELECT/CASE.)
+    //
+    if (not REF(fresh)) {
+        if (Env_Snapshot == nullptr) {
+            Env_Snapshot = Make_Environment_Map();
+            rebElide("for-each [key val]", Env_Snapshot, "[freeze val]");
+        }
+      #if TO_WINDOWS
+        return rebValue("select", Env_Snapshot, "as text! @", variable);
+      #else
+        return rebValue("select/case", Env_Snapshot, "as text! @", variable);
+      #endif
+    }
+
     REBVAL *error = nullptr;
 
   #if TO_WINDOWS
@@ -543,6 +586,8 @@ DECLARE_NATIVE(set_env)
     rebFree(key_utf8);
   #endif
 
+    Invalidate_Env_Snapshot();  // next GET-ENV rebuilds and sees this change
+
     return COPY(ARG(value));
 }
 
@@ -559,6 +604,22 @@ DECLARE_NATIVE(list_env)
 {
     PROCESS_INCLUDE_PARAMS_OF_LIST_ENV;
 
+    // A valid snapshot already holds the whole environment; a shallow copy
+    // shares its frozen value strings, so this is one pass over the map
+    // instead of one over the OS environment block.
+    //
+    if (Env_Snapshot != nullptr)
+        return rebValue("copy", Env_Snapshot);
+
+    return Make_Environment_Map();
+}
+
+
+// Read the whole OS environment into a MAP! in a single pass.  Factored out
+// of LIST-ENV so the GET-ENV snapshot cache (above) can use it too.
+//
+static REBVAL *Make_Environment_Map(void)
+{
     REBVAL *map = rebValue("make map! []");
 
   #if TO_WINDOWS
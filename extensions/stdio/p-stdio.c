@@ -320,7 +320,7 @@ Bounce Console_Actor(Frame(*) frame_, REBVAL *port, Symbol(const*) verb)
         if (REF(part))
             fail (Error_Bad_Refines_Raw());
 
-        if (REF(seek))
+        if (REF(seek) or REF(mmap))
             fail (Error_Bad_Refines_Raw());
 
         UNUSED(PARAM(string)); // handled in dispatcher
@@ -86,6 +86,14 @@ struct Reb_Terminal_Struct {
     //
     REBVAL *e_pending;
 
+    // Bytes the evaluator-checkpoint pump collected while a computation had
+    // control (see Pump_Stdio_Typeahead() in %stdio-posix.c).  These are
+    // consumed ahead of any fresh read() of stdin.
+    //
+    unsigned char *typeahead;
+    size_t typeahead_used;
+    size_t typeahead_cap;
+
     struct termios original_attrs;
 };
 
@@ -147,6 +155,10 @@ STD_TERM *Init_Terminal(void)
 
     t->e_pending = nullptr;
 
+    t->typeahead = nullptr;  // allocated on first pump delivery
+    t->typeahead_used = 0;
+    t->typeahead_cap = 0;
+
     t->original_attrs = attrs;  // cache, to restore upon shutdown
 
     // Local modes.
@@ -202,6 +214,9 @@ STD_TERM *Init_Terminal(void)
     tcsetattr(STDIN_FILENO, TCSADRAIN, &attrs);
 
     Term_Initialized = true;
+
+    Arm_Stdio_Pump();  // keep typeahead live while evaluations run
+
     return t;
 }
 
@@ -241,9 +256,12 @@ void Quit_Terminal(STD_TERM *t)
 {
     assert(Term_Initialized);
 
+    Disarm_Stdio_Pump();
+
     tcsetattr(0, TCSADRAIN, &t->original_attrs);
 
     rebRelease(t->buffer);
+    free(t->typeahead);
     free(t);
 
     rebRelease(Line_History);
@@ -281,6 +299,25 @@ static bool Read_Bytes_Interruptible(
 
     *interrupted = false;  // default to saying it wasn't interrupted
 
+    // Anything the checkpoint pump captured while an evaluation was running
+    // gets consumed first--those keystrokes arrived before whatever is still
+    // sitting unread in the OS buffer.
+    //
+    if (t->typeahead_used > 0) {
+        size_t take = t->typeahead_used;
+        if (take > READ_BUF_LEN - 1)  // -1, room for \0
+            take = READ_BUF_LEN - 1;
+        memcpy(t->buf, t->typeahead, take);
+        t->buf[take] = '\0';
+        t->cp = t->buf;
+        t->typeahead_used -= take;
+        if (t->typeahead_used > 0)
+            memmove(t->typeahead, t->typeahead + take, t->typeahead_used);
+        return true;
+    }
+
+    Disarm_Stdio_Pump();  // console owns stdin until this routine returns
+
     // !!! @giuliolunati specifically requested the ability to do a timeout
     // on POSIX/Android when doing READ-CHAR.  This feature was hacked in as
     // there was a description of how to do it:
@@ -302,6 +339,7 @@ static bool Read_Bytes_Interruptible(
         FD_SET(STDIN_FILENO, &selectset);
         int ret = select(STDIN_FILENO + 1, &selectset, NULL, NULL, &timeout_tv);
         if (ret == 0) {  // timeout
+            Arm_Stdio_Pump();
             return false;
         }
         else if (ret == -1) {
@@ -329,6 +367,7 @@ static bool Read_Bytes_Interruptible(
     t->buf[len] = '\0';
     t->cp = t->buf;
 
+    Arm_Stdio_Pump();
     return true;  // success (note we could return `len` if needed)
   }
 
@@ -341,10 +380,61 @@ static bool Read_Bytes_Interruptible(
     t->cp = t->buf;
     t->buf[0] = '\0';
     *interrupted = true;
+    Arm_Stdio_Pump();
     return false;
 }
 
 
+//
+//  Term_Enqueue_Typeahead: C
+//
+// Called from the evaluator-checkpoint pump (see %stdio-posix.c) with bytes
+// that were typed while a computation had control.  They are appended to a
+// queue that Read_Bytes_Interruptible() consumes before blocking on stdin,
+// and the printable ones are echoed immediately so typing doesn't appear
+// dead during long evaluations.
+//
+// The line editor doesn't know about this echo, so when the queue drains at
+// the next prompt the characters are rendered again--same cosmetic wart as
+// the "[rebuffering]" case in Init_Terminal(), and accepted for now.
+//
+void Term_Enqueue_Typeahead(
+    STD_TERM *t,
+    const unsigned char *data,
+    size_t size
+){
+    if (t->typeahead_used + size > t->typeahead_cap) {
+        size_t cap = t->typeahead_cap == 0 ? 256 : t->typeahead_cap;
+        while (t->typeahead_used + size > cap)
+            cap *= 2;
+        unsigned char *grown = cast(unsigned char*,
+            realloc(t->typeahead, cap)
+        );
+        if (grown == nullptr)
+            return;  // drop bytes rather than crash mid-evaluation
+        t->typeahead = grown;
+        t->typeahead_cap = cap;
+    }
+    memcpy(t->typeahead + t->typeahead_used, data, size);
+    t->typeahead_used += size;
+
+    size_t i;
+    for (i = 0; i < size; ++i) {
+        unsigned char c = data[i];
+        if (c == ESC)
+            break;  // queue but don't render sequences (arrow keys, etc.)
+        if (c == CR or c == LF) {
+            unsigned char nl = '\n';
+            WRITE_UTF8(&nl, 1);  // ONLCR is off in raw mode
+            continue;
+        }
+        if (c >= 32 and c != DEL)  // includes UTF-8 continuation bytes
+            WRITE_UTF8(&c, 1);
+        // other control characters are queued silently
+    }
+}
+
+
 //
 //  Write_Char: C
 //
@@ -118,4 +118,23 @@ extern STD_TERM *Term_IO;
 
 extern REBVAL *Read_Line(STD_TERM *t);  // defined in %p-stdio.c for now
 
+// Keystrokes gathered by the evaluator-checkpoint pump while a computation
+// is running get queued here, and are consumed by the terminal before it
+// blocks on any fresh read of stdin.  (POSIX only, at time of writing.)
+//
+extern void Term_Enqueue_Typeahead(
+    STD_TERM *t,
+    const unsigned char *data,
+    size_t size
+);
+
+// Defined in the per-OS stdio device code, which (unlike the line editor)
+// can see the core's signal machinery.  The terminal arms the pump whenever
+// it hands stdin back to the evaluator, and disarms it around its own
+// blocking reads--so an idle session parked at the prompt makes no timer
+// wakeups at all.
+//
+extern void Arm_Stdio_Pump(void);
+extern void Disarm_Stdio_Pump(void);
+
 #endif  // end smart console branch
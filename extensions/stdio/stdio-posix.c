@@ -37,6 +37,7 @@
 #include <errno.h>
 #include <unistd.h>
 #include <signal.h>
+#include <sys/select.h>
 
 #include "readline.h"
 
@@ -94,6 +95,68 @@ bool Read_Stdin_Byte_Interrupted(bool *eof, Byte* out) {
 }
 
 
+#if defined(REBOL_SMART_CONSOLE)
+
+//=//// EVALUATION-TIME TYPEAHEAD PUMP ////////////////////////////////////=//
+//
+// With the terminal in raw mode (no kernel echo), anything typed while a
+// long computation runs just sits invisibly in the OS buffer until the next
+// prompt--multi-second keystroke lag, from the user's point of view.  This
+// pump runs at the evaluator's signal checkpoints (see PG_IO_Pump_Hook in
+// %c-signal.c): it polls stdin without blocking, moves any waiting bytes
+// into the terminal's typeahead queue, and echoes what's echoable so the
+// console feels live mid-job.  Ctrl-C needs no help here--it arrives as
+// SIGINT, not as a byte.
+//
+
+static void Pump_Stdio_Typeahead(void)
+{
+    if (Term_IO == nullptr)
+        return;
+
+    while (true) {
+        fd_set selectset;
+        struct timeval poll_tv;  // zeroed out: poll, don't wait
+        poll_tv.tv_sec = 0;
+        poll_tv.tv_usec = 0;
+        FD_ZERO(&selectset);
+        FD_SET(STDIN_FILENO, &selectset);
+        int ret = select(STDIN_FILENO + 1, &selectset, NULL, NULL, &poll_tv);
+        if (ret <= 0)
+            return;  // nothing waiting (leave EINTR for the real readers)
+
+        unsigned char buf[64];
+        long len = read(STDIN_FILENO, buf, sizeof(buf));
+        if (len <= 0)
+            return;  // EOF or error; the blocking read path will report it
+
+        Term_Enqueue_Typeahead(Term_IO, buf, len);
+    }
+}
+
+
+//
+//  Arm_Stdio_Pump: C
+//
+void Arm_Stdio_Pump(void)
+{
+    PG_IO_Pump_Hook = &Pump_Stdio_Typeahead;
+    Update_Signal_Timer_Demand();
+}
+
+
+//
+//  Disarm_Stdio_Pump: C
+//
+void Disarm_Stdio_Pump(void)
+{
+    PG_IO_Pump_Hook = nullptr;
+    Update_Signal_Timer_Demand();
+}
+
+#endif  // defined(REBOL_SMART_CONSOLE)
+
+
 //
 //  Write_IO: C
 //
@@ -29,6 +29,30 @@
 
 
 extern REBVAL *Get_Current_Datetime_Value(void);
+extern REBI64 Get_Monotonic_Nanoseconds(void);
+
+
+//
+//  export monotonic-ticks: native [
+//
+//  {Nanoseconds from the OS monotonic clock (arbitrary epoch)}
+//
+//      return: "Meaningful only as a difference between two readings"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(monotonic_ticks)
+//
+// NOW/PRECISE answers "what time is it", with civil-time and timezone
+// derivation to pay for--even with caching, that's the wrong tool for
+// timestamping millions of trace events.  This is the cheap tool: one
+// clock read into an INTEGER!, no allocation, immune to wall-clock
+// adjustments (NTP slew, manual changes) that would corrupt intervals.
+{
+    TIME_INCLUDE_PARAMS_OF_MONOTONIC_TICKS;
+
+    return Init_Integer(OUT, Get_Monotonic_Nanoseconds());
+}
 
 //
 //  export now: native [
@@ -130,28 +130,68 @@ REBVAL *Get_Current_Datetime_Value(void)
     //
     time_t stime = tv.tv_sec;
 
-    // gmtime() is badly named.  It's utc time.  Note we have to be careful as
-    // it returns a system static buffer, so we have to copy the result
-    // via dereference to avoid calls to localtime() inside Get_Timezone
-    // from corrupting the buffer before it gets used.
+    // The civil-time conversion (gmtime() plus the localtime()/mktime()
+    // gymnastics in Get_Timezone) costs far more than reading the clock, and
+    // its inputs only change when the second rolls over.  Timestamp-heavy
+    // code calls NOW/PRECISE many times within one second, so the derived
+    // pieces are kept and reused until stime moves on.
     //
-    // !!! Consider usage of the thread-safe variants, though they are not
-    // available on all older systems.
-    //
-    struct tm utc_tm = *gmtime(&stime);
-
-    int zone = Get_Timezone(&utc_tm);
+    static time_t cached_stime = -1;
+    static struct tm cached_utc_tm;
+    static int cached_zone;
+
+    if (stime != cached_stime) {
+        //
+        // gmtime() is badly named.  It's utc time.  Note we have to be
+        // careful as it returns a system static buffer, so we have to copy
+        // the result via dereference to avoid calls to localtime() inside
+        // Get_Timezone from corrupting the buffer before it gets used.
+        //
+        // !!! Consider usage of the thread-safe variants, though they are
+        // not available on all older systems.
+        //
+        cached_utc_tm = *gmtime(&stime);
+        cached_zone = Get_Timezone(&cached_utc_tm);
+        cached_stime = stime;
+    }
 
     return rebValue("ensure date! (make-date-ymdsnz",
-        rebI(utc_tm.tm_year + 1900),  // year
-        rebI(utc_tm.tm_mon + 1),  // month
-        rebI(utc_tm.tm_mday),  // day
+        rebI(cached_utc_tm.tm_year + 1900),  // year
+        rebI(cached_utc_tm.tm_mon + 1),  // month
+        rebI(cached_utc_tm.tm_mday),  // day
         rebI(
-            utc_tm.tm_hour * 3600
-            + utc_tm.tm_min * 60
-            + utc_tm.tm_sec
+            cached_utc_tm.tm_hour * 3600
+            + cached_utc_tm.tm_min * 60
+            + cached_utc_tm.tm_sec
         ),  // secs
         rebI(tv.tv_usec * 1000),  // nano
-        rebI(zone),  // zone
+        rebI(cached_zone),  // zone
     ")");
 }
+
+
+//
+//  Get_Monotonic_Nanoseconds: C
+//
+// Raw reading of the monotonic clock, for cheap relative timestamps: no
+// civil-time conversion, no timezone derivation.  The epoch is arbitrary
+// (typically boot time)--only differences between two readings mean
+// anything.
+//
+REBI64 Get_Monotonic_Nanoseconds(void)
+{
+  #if defined(CLOCK_MONOTONIC)
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        rebJumps("fail {clock_gettime(CLOCK_MONOTONIC) failed}");
+
+    return cast(REBI64, ts.tv_sec) * 1000000000 + ts.tv_nsec;
+  #else
+    struct timeval tv;  // not monotonic, but the best this system offers
+    if (gettimeofday(&tv, NULL) != 0)
+        rebJumps("fail {gettimeofday() returned 0}");
+
+    return cast(REBI64, tv.tv_sec) * 1000000000
+        + cast(REBI64, tv.tv_usec) * 1000;
+  #endif
+}
@@ -60,3 +60,28 @@ REBVAL *Get_Current_Datetime_Value(void)
         rebI(-tzone.Bias),  // zone
     ")");
 }
+
+
+//
+//  Get_Monotonic_Nanoseconds: C
+//
+// Raw reading of the monotonic clock, for cheap relative timestamps: no
+// civil-time conversion, no timezone derivation.  The epoch is arbitrary
+// (boot time)--only differences between two readings mean anything.
+//
+REBI64 Get_Monotonic_Nanoseconds(void)
+{
+    static LARGE_INTEGER freq;  // constant after boot, query it just once
+    if (freq.QuadPart == 0)
+        QueryPerformanceFrequency(&freq);
+
+    LARGE_INTEGER count;
+    QueryPerformanceCounter(&count);
+
+    // Naively scaling by 10^9 before the divide overflows 64 bits in a few
+    // hours of typical 10MHz counter ticks; split whole seconds from the
+    // remainder so both products stay in range.
+    //
+    return (count.QuadPart / freq.QuadPart) * 1000000000
+        + ((count.QuadPart % freq.QuadPart) * 1000000000) / freq.QuadPart;
+}
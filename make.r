@@ -922,6 +922,21 @@ targets: [
             ]
         ]
     ]
+    'benchmark [
+        ; Run the tracked microbenchmark suite against the executable from a
+        ; prior build in this directory (e.g. `make.r target=r3`).  Results
+        ; are written to %benchmarks.json beside the executable, for diffing
+        ; across commits.
+        ;
+        let exe: join app/output maybe rebmake/target-platform/exe-suffix
+        if 'file <> exists? join output-dir exe [
+            fail "benchmark target needs a built executable (try target=r3)"
+        ]
+        call/wait reduce [
+            file-to-local join output-dir exe
+            file-to-local join repo-dir %tests/run-benchmarks.r
+        ]
+    ]
     'makefile [
         rebmake/makefile/generate %makefile solution
     ]
@@ -1324,6 +1339,35 @@ append app-config/definitions maybe spread switch user-config/pre-vista [
     fail ["PRE-VISTA [yes no \logic!\] not" (user-config/pre-vista)]
 ]
 
+append app-config/definitions maybe spread switch user-config/computed-goto [
+    ~true~ 'yes 'on 'true [
+        compose [
+            "EVALUATOR_COMPUTED_GOTO=1"
+        ]
+    ]
+    ~false~ 'no 'off 'false [
+        []  ; empty for spread
+    ]
+
+    fail ["COMPUTED-GOTO [yes no \logic!\] not" (user-config/computed-goto)]
+]
+
+append app-config/definitions maybe spread switch user-config/force-hot-inlines [
+    ~true~ 'yes 'on 'true [
+        compose [
+            "FORCE_HOT_INLINES=1"
+        ]
+    ]
+    ~false~ 'no 'off 'false [
+        []  ; empty for spread
+    ]
+
+    fail [
+        "FORCE-HOT-INLINES [yes no \logic!\] not"
+            (user-config/force-hot-inlines)
+    ]
+]
+
 
 append app-config/ldflags maybe spread switch user-config/static [
     ~false~ 'no 'off 'false [
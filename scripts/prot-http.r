@@ -229,6 +229,20 @@ check-response: function [
             info.date: try attempt [idate-to-date headers.last-modified]
         ]
         remove/part conn.data d2
+
+        ; Decide now--while the raw headers are in hand--whether the
+        ; connection can go back in the keep-alive pool after this response
+        ; is fully consumed.  HTTP/1.0 closes by default, and either side
+        ; can opt out with `Connection: close`.
+        ;
+        state.reusable: did all [
+            find line "HTTP/1.1"
+            not all [
+                in headers 'Connection
+                find headers.connection "close"
+            ]
+        ]
+
         state.mode: <reading-data>
     ]
 
@@ -390,6 +404,64 @@ http-response-headers: context [
     Last-Modified: null
 ]
 
+
+; === KEEP-ALIVE CONNECTION POOL ===
+;
+; Opening a TCP connection (and especially performing a TLS handshake) can
+; dwarf the cost of the HTTP exchange itself when many requests go to the
+; same host.  HTTP/1.1 connections default to keep-alive, so when a port is
+; closed after a cleanly-consumed response the underlying TCP or TLS
+; connection is parked here instead of being closed, and the next OPEN to
+; the same scheme/host/port picks it up.
+;
+; A connection is only reusable if the framing let us know where the body
+; ended (Content-Length or chunked encoding), the response was HTTP/1.1,
+; and the server didn't send `Connection: close`.  CHECK-RESPONSE records
+; that verdict in STATE.REUSABLE when it parses the headers.
+;
+; The pool is a flat block of [key connection ...] pairs.  A parked
+; connection can be closed by the server while it sits idle; TAKE-POOLED-
+; CONNECTION filters those out with OPEN?, but a server close that races
+; with reuse will surface as an ordinary connection error on the request.
+
+connection-pool: []
+
+pool-max: 8  ; parked connections beyond this evict the oldest
+
+pool-key: lambda [spec [object!]] [
+    as url! unspaced [spec.scheme "://" spec.host ":" spec.port-id]
+]
+
+take-pooled-connection: func [
+    {Take a parked keep-alive connection matching SPEC out of the pool}
+    return: [<opt> port!]
+    spec [object!]
+][
+    let key: pool-key spec
+    let pos
+    while [pos: find/skip connection-pool key 2] [
+        let conn: second pos
+        remove/part pos 2
+        if open? conn [return conn]  ; else dropped while idle, keep looking
+    ]
+    return null
+]
+
+park-connection: func [
+    {Park a still-open connection in the pool for later reuse}
+    return: <none>
+    key [url!]
+    conn [port!]
+][
+    if (length of connection-pool) = (2 * pool-max) [
+        close second connection-pool  ; evict the oldest parked connection
+        remove/part connection-pool 2
+    ]
+    if conn.data [clear conn.data]  ; don't hold onto response leftovers
+    append connection-pool spread reduce [key conn]
+]
+
+
 do-redirect: func [
     return: <none>
     port [port!]
@@ -690,19 +762,29 @@ sys.util.make-scheme [
             port.state: make object! [
                 mode: ~inited~  ; original http confusingly called this "state"
                 connection: ~
+                reusable: false  ; set per-response, see CHECK-RESPONSE
                 info: make port.scheme.info [type: 'file]
             ]
-            port.state.connection: conn: make port! compose [
-                scheme: (
-                    either port.spec.scheme = 'http [the 'tcp][the 'tls]
-                )
-                host: port.spec.host
-                port-id: port.spec.port-id
-                ref: join tcp:// spread reduce [host ":" port-id]
+            if conn: take-pooled-connection port.spec [
+                ;
+                ; Reusing a parked keep-alive connection skips the TCP
+                ; connect (and TLS handshake) entirely.
+                ;
+                port.state.connection: conn
+                conn.locals: port
+            ] else [
+                port.state.connection: conn: make port! compose [
+                    scheme: (
+                        either port.spec.scheme = 'http [the 'tcp][the 'tls]
+                    )
+                    host: port.spec.host
+                    port-id: port.spec.port-id
+                    ref: join tcp:// spread reduce [host ":" port-id]
+                ]
+                conn.locals: port
+                open conn
+                connect conn
             ]
-            conn.locals: port
-            open conn
-            connect conn
             port.state.mode: <ready>
 
             return port
@@ -744,7 +826,15 @@ sys.util.make-scheme [
                 ]
             ]
 
-            close state.connection
+            all [
+                state.mode = <ready>  ; response was consumed down to its end
+                state.reusable  ; HTTP/1.1 and no `Connection: close`
+                open? state.connection
+            ] then [
+                park-connection (pool-key port.spec) state.connection
+            ] else [
+                close state.connection
+            ]
             port.state: null
             return port
         ]
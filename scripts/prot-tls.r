@@ -65,7 +65,6 @@ REBOL [
         https://tools.ietf.org/html/rfc7568
     }
     Todo: {
-        - cached sessions
         - automagic cert data lookup
         - add more cipher suites
         - server role support
@@ -192,6 +191,23 @@ debug: (comment [runs :print] blank)
 random-secure: lambda [range [integer!]] [random range]
 
 
+; Completed sessions are remembered here by "host:port", so that later
+; connections to the same endpoint can offer the session ID back to the
+; server in their ClientHello.  If the server still has the session cached
+; too, the certificate exchange and (expensive) public key operations are
+; skipped entirely--the cached master secret is reused with fresh randoms.
+; This "abbreviated handshake" also saves a network round trip:
+;
+; https://tools.ietf.org/html/rfc5246#appendix-F.1.4
+;
+; Entries hold the keying material of connections, so a long-running server
+; process might want a way to flush them.  But they're capped in number and
+; only usable to someone who can already read this process's memory.
+;
+session-cache: make map! 8
+session-cache-max: 32
+
+
 version-to-bytes: [
     1.0 #{03 01}
     1.1 #{03 02}
@@ -435,7 +451,7 @@ make-state-updater: func [
 
 update-read-state: make-state-updater 'read [
     <client-hello>          -> <server-hello>
-    <server-hello>          -> <certificate>
+    <server-hello>          -> [<certificate> <change-cipher-spec>]  ; resume
     <certificate>           -> [#server-hello-done <server-key-exchange>]
     <server-key-exchange>   -> #server-hello-done
     <finished>              -> [<change-cipher-spec> #alert]
@@ -450,7 +466,7 @@ update-write-state: make-state-updater 'write [
     #server-hello-done      -> <client-key-exchange>
     <client-key-exchange>   -> <change-cipher-spec>
     <change-cipher-spec>    -> <finished>
-    #encrypted-handshake    -> #application
+    #encrypted-handshake    -> [#application <change-cipher-spec>]  ; resume
     #application            -> [#application #alert]
     #alert                  -> <close-notify>
     <close-notify>          -> []
@@ -516,11 +532,20 @@ client-hello: func [
         maybe match binary! item
     ]
 
+    ; If a previous connection to this endpoint completed a handshake, offer
+    ; its session ID back to the server...it may let us resume (see notes on
+    ; SESSION-CACHE).  An empty ID means a full handshake is required.
+    ;
+    ctx.resuming?: false
+    ctx.session: select session-cache ctx.session-key
+    let session-id-bytes: either ctx.session [ctx.session.id] [#{}]
+
     emit ctx [
       ClientHello:  ; https://tools.ietf.org/html/rfc5246#section-7.4.1.2
         max-ver-bytes               ; max supported version by client
         ctx.client-random           ; 4 bytes gmt unix time + 28 random bytes
-        #{00}                       ; session ID length
+        to-1bin length of session-id-bytes  ; session ID length
+        session-id-bytes            ; cached session to resume (if any)
         to-2bin length of cs-data   ; cipher suites length
         cs-data                     ; cipher suites list
 
@@ -748,6 +773,18 @@ client-key-exchange: func [
     ;
     make-master-secret ctx ctx.pre-master-secret
 
+    make-connection-keys ctx
+
+    append ctx.handshake-messages ssl-record
+]
+
+
+make-connection-keys: func [
+    {Derive the record protection keys for a connection from MASTER-SECRET}
+
+    return: <none>
+    ctx [object!]
+][
     make-key-block ctx
 
     ; update keys
@@ -773,8 +810,6 @@ client-key-exchange: func [
             ctx.client-iv: ctx.server-iv: ~per-message~
         ]
     ]
-
-    append ctx.handshake-messages ssl-record
 ]
 
 
@@ -1222,8 +1257,43 @@ parse-messages: func [
                                 (mold suite)
                             ]
                         ]
+                        ctx.suite-id: msg-obj.suite-id
 
                         ctx.server-random: msg-obj.server-random
+
+                        either all [
+                            ctx.session
+                            ctx.session.id = msg-obj.session-id
+                        ][
+                            ; The server echoed back the session ID we
+                            ; offered, agreeing to resume.  No key exchange
+                            ; will happen: both sides regenerate the key
+                            ; block from the cached master secret and the
+                            ; fresh randoms, and skip ahead to the
+                            ; ChangeCipherSpec/Finished exchange.
+                            ;
+                            ; The RFC requires a resumed session to keep the
+                            ; version and cipher suite it was created with.
+                            ;
+                            if ctx.version <> ctx.session.version [
+                                fail "Resumed session with changed version"
+                            ]
+                            if msg-obj.suite-id <> ctx.session.suite-id [
+                                fail "Resumed session with changed suite"
+                            ]
+                            ctx.resuming?: true
+                            ctx.master-secret: copy ctx.session.master-secret
+                            make-connection-keys ctx
+                        ][
+                            ; Full handshake...remember the ID the server
+                            ; issued (if any) so the session can be cached
+                            ; once the Finished messages check out.
+                            ;
+                            ctx.session-id: all [
+                                not empty? msg-obj.session-id
+                                copy msg-obj.session-id
+                            ]
+                        ]
                         msg-obj
                     ]
 
@@ -1432,6 +1502,28 @@ parse-messages: func [
 
                         debug "FINISHED MAC verify: OK"
 
+                        ; The server's Finished checking out means the full
+                        ; handshake succeeded...cache the session so later
+                        ; connections to this endpoint can offer to resume
+                        ; it.  (Abbreviated handshakes land here too, but
+                        ; they only revalidate what is already cached.)
+                        ;
+                        all [
+                            not ctx.server?
+                            not ctx.resuming?
+                            ctx.session-id
+                        ] then [
+                            if session-cache-max <= length of session-cache [
+                                clear session-cache  ; crude, but bounded
+                            ]
+                            session-cache.(ctx.session-key): context [
+                                id: ctx.session-id
+                                version: ctx.version
+                                suite-id: ctx.suite-id
+                                master-secret: ctx.master-secret
+                            ]
+                        ]
+
                         context [
                             type: msg-type
                             length: len
@@ -1672,6 +1764,18 @@ do-commands: func [
         #application [
             return none  ; at one point returned FALSE, wasn't used
         ]
+        <finished> [
+            if ctx.resuming? [
+                ;
+                ; In an abbreviated handshake the client speaks last (the
+                ; server's ChangeCipherSpec and Finished were read along
+                ; with its hello).  Nothing further to read...ready for
+                ; application data now.
+                ;
+                ctx.mode: #encrypted-handshake
+                return none
+            ]
+        ]
         ; Note: Even if state is <finished>, it seems to still want to READ.
     ]
     perform-read tls-port
@@ -1879,7 +1983,18 @@ sys.util.make-scheme [
 
                 mode: null
 
+                ; TLS 1.2 session resumption state (see notes on the
+                ; SESSION-CACHE map for how these are used)
+                ;
+                session-key: join (to text! port.spec.host) spread reduce [
+                    ":" port.spec.port-id
+                ]
+                session: null  ; cache entry offered in our ClientHello
+                session-id: null  ; ID the server issued for this session
+                resuming?: false
+
                 suite: null
+                suite-id: null  ; the two identifying bytes of SUITE
 
                 cipher-suite: does [first find suite matches word!]
 
@@ -1990,10 +2105,17 @@ sys.util.make-scheme [
             do-commands port [<client-hello>]
 
             if port.state.resp.1.type = #handshake [
-                do-commands port [
-                    <client-key-exchange>
-                    <change-cipher-spec>
-                    <finished>
+                either port.state.resuming? [
+                    do-commands port [  ; abbreviated, key exchange skipped
+                        <change-cipher-spec>
+                        <finished>
+                    ]
+                ][
+                    do-commands port [
+                        <client-key-exchange>
+                        <change-cipher-spec>
+                        <finished>
+                    ]
                 ]
             ]
             return port
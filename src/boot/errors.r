@@ -58,6 +58,11 @@ Internal: [
 
     debug-only:         {Feature available only in DEBUG builds}
 
+    eval-budget:        {evaluation time budget exceeded (see WITH-EVAL-BUDGET)}
+    alloc-budget:       {allocation budget exceeded (see WITH-EVAL-BUDGET/MEMORY)}
+
+    cancelled:          {evaluation was cancelled (see WITH-CANCELLATION)}
+
     invalid-exit:       {Frame does not exist on the stack to EXIT from}
 ]
 
@@ -506,6 +506,8 @@ swap: generic [
     return: [any-series!]
     series1 [any-series!] {At position (modified)}
     series2 [any-series!] {At position (modified)}
+    /part "Swap a run of elements rather than just one (arrays only)"
+        [any-number! any-series!]
 ]
 
 reverse: generic [
@@ -557,6 +559,14 @@ open: generic [
     /new "Create new file - if it exists, reset it (truncate)"
     /read "Open for read access"
     /write "Open for write access"
+    /buffered "Buffer reads (readahead) and coalesce writes, see FLUSH"
+        [integer!]  ; buffer size in bytes
+]
+
+flush: generic [
+    {Push any writes a buffered port has coalesced down to its device}
+    return: [port!]
+    port [port!]
 ]
 
 connect: generic [
@@ -589,6 +599,7 @@ read: generic [
         [any-number!]
     /string "Convert UTF and line terminators to standard text string"
     /lines "Convert to block of strings (implies /string)"
+    /mmap "Read-only view onto a memory mapping of the source, if supported"
 ]
 
 write: generic [
@@ -129,3 +129,7 @@ dummy6
 dummy7
 dummy8
 dummy9
+
+; Instruction word understood by MEMORY-TALLY, alongside ON and OFF.
+;
+reset
@@ -98,6 +98,7 @@ y
 *
 unsigned
 code        ; error field
+user        ; error type of id-only failures (RAISE of a WORD!)
 
 eval
 memory
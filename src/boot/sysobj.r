@@ -340,6 +340,12 @@ standard: make object! [
         ; sockets...it will be called when a new connection is made.
         ;
         accept: null
+
+        ; Optional deadline for each READ or WRITE on the port, as seconds
+        ; (INTEGER! or DECIMAL!) or a TIME!.  If an operation doesn't finish
+        ; in that span it raises a timeout error.  NULL waits indefinitely.
+        ;
+        timeout: null
     ]
 
     port-spec-signal: make port-spec-head [
@@ -410,6 +410,90 @@ void RL_rebShutdown(bool clean)
 }
 
 
+//=//// ISOLATES //////////////////////////////////////////////////////////=//
+//
+// An "isolate" is an independent interpreter instance that communicates
+// with its host (and eventually with other isolates) only by passing UTF-8
+// text--no cells or series cross the boundary.  That restriction is the
+// point: it's what would permit isolates to run on their own threads, since
+// nothing in one isolate's pools can be referenced from another.
+//
+// What blocks multiple isolates today is that interpreter state is a flat
+// collection of process globals (the PG_XXX and TG_XXX variables declared
+// in %sys-globals.h, and the pools from Startup_Pools()).  Until those are
+// gathered into an instance structure, only one isolate can exist at a
+// time...so rebIsolateCreate() returns null for a second concurrent one.
+//
+// The API contract is designed to survive that upgrade unchanged: handles
+// are opaque, and the text-only messaging imposes no sharing.  Embedders
+// who code against it can parallelize across processes now and get threads
+// later without a rewrite.
+//
+
+static bool PG_Isolate_In_Use = false;
+
+
+//
+//  rebIsolateCreate: RL_API
+//
+// Create an isolate, starting up the interpreter if it isn't running.
+// Returns null if no isolate can be created (currently: if one exists).
+//
+void *RL_rebIsolateCreate(void)
+{
+    if (PG_Isolate_In_Use)
+        return nullptr;  // only one isolate until globals are instanced
+
+    if (not PG_Api_Initialized)
+        RL_rebStartup();
+
+    PG_Isolate_In_Use = true;
+    return &PG_Isolate_In_Use;  // opaque non-null handle
+}
+
+
+//
+//  rebIsolateSend: RL_API
+//
+// Send a message--UTF-8 source code--to an isolate for evaluation.  The
+// reply is the molded META of the result (so a reply of "'10" means the
+// code evaluated to the integer 10) in a rebMalloc()'d string the caller
+// must rebFree().  Errors in the evaluation are not caught here; use a
+// TRAP or similar in the sent code if the message may fail.
+//
+// Today's implementation evaluates synchronously on the calling thread.
+// The messaging interface leaves room for that to become a queue serviced
+// by the isolate's own thread.
+//
+char *RL_rebIsolateSend(void *isolate, const char *utf8)
+{
+    ENTER_API;
+
+    assert(isolate == &PG_Isolate_In_Use);
+    UNUSED(isolate);
+
+    return rebSpell("mold meta do", rebR(rebText(utf8)));
+}
+
+
+//
+//  rebIsolateDestroy: RL_API
+//
+// Destroy an isolate made with rebIsolateCreate(), releasing its claim (and
+// with it, currently, the interpreter itself).
+//
+void RL_rebIsolateDestroy(void *isolate)
+{
+    ENTER_API;
+
+    assert(isolate == &PG_Isolate_In_Use);
+    UNUSED(isolate);
+
+    PG_Isolate_In_Use = false;
+    RL_rebShutdown(true);
+}
+
+
 //
 //  rebTick: RL_API
 //
@@ -428,6 +512,29 @@ uintptr_t RL_rebTick(void)
 }
 
 
+//
+//  rebMemoryLimit: RL_API
+//
+// Set the hard cap on the interpreter's allocations in bytes (0 for no
+// cap), returning the previous cap.  Allocations that would push usage past
+// the cap fail with a trappable out-of-memory error, instead of waiting for
+// the operating system--or a container's OOM killer--to act.  Embedders
+// running under cgroup or job-object memory limits should set this somewhat
+// below that limit, so the failure is one the script can TRAP.
+//
+// The MEMORY-LIMIT native exposes this to script code, along with a soft
+// watermark that runs a callback before the cap is reached.
+//
+uint64_t RL_rebMemoryLimit(uint64_t bytes)
+{
+    ENTER_API;
+
+    uint64_t old = PG_Mem_Limit;
+    PG_Mem_Limit = bytes;
+    return old;
+}
+
+
 //=//// VALUE CONSTRUCTORS ////////////////////////////////////////////////=//
 //
 // These routines are for constructing Rebol values from C primitive types.
@@ -1076,6 +1183,36 @@ REBVAL *RL_rebTranscodeInto(
 }
 
 
+//
+//  rebPrecompile: RL_API
+//
+// When the same template string is run over and over (e.g. a service calling
+// `rebValue("update-record", id)` millions of times), the UTF-8 scan and
+// word binding of the fixed material is paid on every call.  This scans and
+// binds it just once, giving back an API BLOCK! handle whose contents can be
+// spliced into later calls with rebINLINE()--so only the variable values are
+// processed per call:
+//
+//     REBVAL *update = rebPrecompile("update-record");
+//     for (...)
+//         rebElide(rebINLINE(update), rebI(id));
+//     rebRelease(update);
+//
+// The block is frozen deeply, since many calls (and whatever they execute)
+// will be reading from it--the handle is a template, not a workspace.
+//
+REBVAL *RL_rebPrecompile(const void *p, va_list *vaptr)
+{
+    ENTER_API;
+
+    REBVAL *block = Alloc_Value();
+    RL_rebTranscodeInto(block, p, vaptr);  // core "RL_" call, not the macro
+
+    Force_Value_Frozen_Deep(block);
+    return block;  // caller must rebRelease() when done with the template
+}
+
+
 //
 //  rebPushContinuation: RL_API
 //
@@ -1576,6 +1713,98 @@ char *RL_rebSpell(const void *p, va_list *vaptr) {
 }
 
 
+//
+//  rebSpellPinned: RL_API
+//
+// Strings are stored as UTF-8 in their series data ("UTF-8 Everywhere"), so
+// no re-encoding is needed to extract them...yet rebSpell() still copies
+// into a rebMalloc() buffer so the pointer it gives out can't be invalidated.
+// When large strings get shuttled to C parsers at high rates, that copy is
+// pure overhead.  This returns a pointer directly into the series data,
+// "pinned" so the pointer stays good:
+//
+//     REBVAL *pin;
+//     size_t size;
+//     const char *utf8 = rebSpellPinned(&pin, &size, "huge-string");
+//     ...hand utf8 and size to the parser, no copying...
+//     rebUnpin(pin);  // pointer must not be used after this
+//
+// The pin is an API handle of indefinite lifetime (as if rebUnmanage()'d)
+// which keeps the series from being garbage collected, combined with the
+// SERIES_INFO_HOLD temporary lock the evaluator uses on running code--which
+// stops any mutation that could reallocate the data out from under the
+// pointer.  Immutable UTF-8 types (words, and tokens that fit in a cell)
+// only need the handle.
+//
+// Note the data is *not* null terminated past the extracted size if the
+// value was a position partway into a string--always use the size.
+//
+const char *RL_rebSpellPinned(
+    REBVAL **pin_out,
+    size_t *size_out,
+    const void *p, va_list *vaptr
+){
+    ENTER_API;
+
+    DECLARE_LOCAL (v);
+    Run_Va_Decay_May_Fail_Calls_Va_End(v, p, vaptr);
+
+    if (not ANY_UTF8(v))
+        fail ("rebSpellPinned() requires UTF-8 types (strings, words, tokens)");
+
+    REBVAL *pin = Copy_Cell(Alloc_Value(), v);
+
+    Array(*) a = Singular_From_Cell(pin);  // indefinite lifetime, see
+    CLEAR_SERIES_FLAG(a, MANAGED);  // rebUnmanage() for why this is okay
+    Unlink_Api_Handle_From_Frame(a);
+    TRASH_POINTER_IF_DEBUG(a->link.trash);
+    TRASH_POINTER_IF_DEBUG(a->misc.trash);
+
+    if (ANY_STRING(v)) {  // mutable, so the data must be locked in place too
+        const REBSER *s = VAL_SERIES(v);
+        if (not GET_SERIES_INFO(s, HOLD)) {
+            SET_SERIES_INFO(m_cast(REBSER*, s), HOLD);
+            Set_Subclass_Flag(API, a, TOOK_HOLD);  // only lift what we took
+        }
+    }
+
+    Size size;
+    Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&size, pin);  // pin, not v...token
+    *size_out = size;                      // data may live in the pin's cell
+    *pin_out = pin;
+    return c_cast(char*, utf8);
+}
+
+
+//
+//  rebUnpin: RL_API
+//
+// Releases a pin made by rebSpellPinned(), lifting the mutation hold if the
+// pin was responsible for it.  The UTF-8 pointer that came with the pin must
+// not be used after this call.
+//
+void RL_rebUnpin(REBVAL *pin)
+{
+    ENTER_API;
+
+    if (pin == nullptr or not Is_Api_Value(pin))
+        fail ("rebUnpin() requires a pin from rebSpellPinned()");
+
+    Array(*) a = Singular_From_Cell(pin);
+    if (GET_SERIES_FLAG(a, MANAGED))
+        fail ("rebUnpin() requires a pin from rebSpellPinned()");
+
+    if (Get_Subclass_Flag(API, a, TOOK_HOLD)) {
+        const REBSER *s = VAL_SERIES(pin);
+        assert(GET_SERIES_INFO(s, HOLD));
+        CLEAR_SERIES_INFO(m_cast(REBSER*, s), HOLD);
+        Clear_Subclass_Flag(API, a, TOOK_HOLD);
+    }
+
+    rebRelease(pin);
+}
+
+
 // Helper function for `rebSpellIntoWide()` and `rebSpellWide()`
 //
 static unsigned int Spell_Into_Wide(
@@ -2317,6 +2546,58 @@ void RL_rebRelease(const REBVAL *v)
 }
 
 
+//
+//  rebMarkValues: RL_API
+//
+// Captures a position in the active frame's list of API handles, to pass to
+// rebReleaseAll().  This gives a scoped way of cleaning up the handles made
+// by a burst of API calls without naming each one:
+//
+//     const void *mark = rebMarkValues();
+//     ...any number of rebValue() etc. calls...
+//     rebReleaseAll(mark);  // releases every handle made since the mark
+//
+// Handles are linked onto the topmost frame at allocation time, newest at
+// the head--so the mark is just the head of that list.
+//
+const void *RL_rebMarkValues(void)
+{
+    ENTER_API;
+
+    return TOP_FRAME->alloc_value_list;
+}
+
+
+//
+//  rebReleaseAll: RL_API
+//
+// Releases every API handle allocated on the active frame since the matching
+// rebMarkValues().  See notes there.
+//
+void RL_rebReleaseAll(const void *mark)
+{
+    ENTER_API;
+
+    if (mark == nullptr)
+        fail ("rebReleaseAll() requires a mark from rebMarkValues()");
+
+    Frame(*) f = TOP_FRAME;
+    Node* node = f->alloc_value_list;
+    while (node != mark) {
+        //
+        // The list is terminated by the frame itself, which (unlike the
+        // API stubs in the list) carries the cell flavoring in its header.
+        //
+        if (*c_cast(Byte*, node) & NODE_BYTEMASK_0x01_CELL)
+            fail ("rebReleaseAll() mark not in the active frame's handles");
+
+        Array(*) a = ARR(node);
+        node = LINK(ApiNext, a);
+        Free_Value(SPECIFIC(ARR_SINGLE(a)));  // unlinks from frame's list
+    }
+}
+
+
 //
 //  rebZdeflateAlloc: RL_API
 //
@@ -2334,7 +2615,15 @@ void *RL_rebZdeflateAlloc(
 ){
     ENTER_API;
 
-    return Compress_Alloc_Core(out_len, input, in_len, SYM_ZLIB);
+    return Compress_Alloc_Core(
+        out_len,
+        input,
+        in_len,
+        SYM_ZLIB,
+        -1,  // Z_DEFAULT_COMPRESSION
+        nullptr,  // no preset dictionary
+        0
+    );
 }
 
 
@@ -2356,7 +2645,15 @@ void *RL_rebZinflateAlloc(
 ){
     ENTER_API;
 
-    return Decompress_Alloc_Core(len_out, input, len_in, max, SYM_ZLIB);
+    return Decompress_Alloc_Core(
+        len_out,
+        input,
+        len_in,
+        max,
+        SYM_ZLIB,
+        nullptr,  // no preset dictionary
+        0
+    );
 }
 
 
@@ -52,7 +52,15 @@
 
 #include "sys-core.h"
 
-#define EVAL_DOSE 10000
+// How many milliseconds pass between arms of Eval_Signal_Pending by the
+// periodic timer (see %c-signal.c).  This only paces duties that want
+// callouts with no event to hang them on--incremental sweep slices and
+// profiler samples--so it can be coarse; 10msec gives the sampling profiler
+// a classic 100Hz rate.  Overridable with the R3_SIGNAL_PERIOD environment
+// variable, as boot switches are done with environment variables (see the
+// NOTES section above).
+//
+#define SIGNAL_PERIOD_MSEC 10
 
 
 //
@@ -674,20 +682,33 @@ void Startup_Signals(void)
     Trace_Level = 0;
     TG_Jump_List = nullptr;
 
-  #if !defined(NDEBUG)
-    Total_Eval_Cycles_Doublecheck = 0;
-  #endif
-
-    Total_Eval_Cycles = 0;
-    Eval_Dose = EVAL_DOSE;
-    Eval_Countdown = Eval_Dose;
+    Total_Eval_Cycles = 0;  // both totals only ever count upward
+    Total_Alloc_Bytes = 0;
     Eval_Signals = 0;
+    Eval_Signal_Pending = 0;
     Eval_Sigmask = ALL_BITS;
     Eval_Limit = 0;
 
+    Eval_Timer_Ticks = 0;
+    Eval_Slice_Deadline = 0;
+    Eval_Cycles_Deadline = 0;
+    Alloc_Bytes_Deadline = 0;
+
+    PG_Signal_Wakeup_Hook = nullptr;
+
+    Eval_Signal_Period = SIGNAL_PERIOD_MSEC;
+    const char *env_signal_period = getenv("R3_SIGNAL_PERIOD");
+    if (env_signal_period and atoi(env_signal_period) > 0)
+        Eval_Signal_Period = atoi(env_signal_period);
+
+    Startup_Signal_Timer();
+
     TG_Ballast = MEM_BALLAST; // or overwritten by debug build below...
     TG_Max_Ballast = MEM_BALLAST;
 
+    TG_GC_Growth_Pct = 0;  // fixed ballast until RECYCLE/ADAPTIVE is used
+    TG_GC_Max_Heap = 0;
+
   #ifndef NDEBUG
     const char *env_recycle_torture = getenv("R3_RECYCLE_TORTURE");
     if (env_recycle_torture and atoi(env_recycle_torture) != 0)
@@ -800,8 +821,32 @@ void Startup_Core(void)
     // Globals
     PG_Boot_Phase = BOOT_START;
     PG_Boot_Level = BOOT_LEVEL_FULL;
+
+    // CGI-style embedders that launch many short-lived interpreters can
+    // skip evaluating the interpreted portions of the boot (the mezzanine,
+    // and optionally SYS.UTIL) when all they need is natives and generics.
+    // Most of the time spent in Startup_Core() is in those evaluations, so
+    // lower levels bring cold boot down to milliseconds.  See Boot_Levels.
+    //
+  blockscope {
+    const char *env_boot_level = getenv("R3_BOOT_LEVEL");
+    if (env_boot_level != nullptr) {
+        if (strcmp(env_boot_level, "base") == 0)
+            PG_Boot_Level = BOOT_LEVEL_BASE;
+        else if (strcmp(env_boot_level, "sys") == 0)
+            PG_Boot_Level = BOOT_LEVEL_SYS;
+        else if (strcmp(env_boot_level, "mods") == 0)
+            PG_Boot_Level = BOOT_LEVEL_MODS;
+    }
+  }
     PG_Mem_Usage = 0;
     PG_Mem_Limit = 0;
+    PG_Mem_Soft_Limit = 0;
+    PG_Mem_Watermark_Armed = false;
+    PG_Mem_Watermark_Hook = nullptr;
+    PG_IO_Pump_Hook = nullptr;
+    PG_Protect_Epochs = 0;
+    PG_Epoch_Protect_Mask = 0;
     Reb_Opts = TRY_ALLOC(REB_OPTS);
     memset(Reb_Opts, 0, sizeof(REB_OPTS));
     TG_Jump_List = nullptr;
@@ -816,6 +861,7 @@ void Startup_Core(void)
     Startup_GC();
 
     Startup_Raw_Print();
+    Startup_Profiler();
     Startup_Scanner();
     Startup_String();
 
@@ -837,7 +883,18 @@ void Startup_Core(void)
     Startup_Collector();
     Startup_Mold(MIN_COMMON / 4);
 
-    Startup_Data_Stack(STACK_MIN / 4);
+    // Latency-sensitive embedders can pre-size the data stack to its peak
+    // working set (in cells), avoiding expansion hiccups mid-evaluation.
+    //
+  blockscope {
+    REBLEN data_stack_capacity = STACK_MIN / 4;
+    const char *env_stack_size = getenv("R3_STACK_SIZE");
+    if (env_stack_size and atoi(env_stack_size) > 0)
+        data_stack_capacity = atoi(env_stack_size);
+    if (data_stack_capacity > STACK_LIMIT / 2)  // fail() not ready at boot
+        data_stack_capacity = STACK_LIMIT / 2;
+    Startup_Data_Stack(data_stack_capacity);
+  }
     Startup_Frame_Stack(); // uses Canon() in FRM_FILE() currently
 
     Startup_Api();
@@ -882,7 +939,9 @@ void Startup_Core(void)
         Boot_Block_Compressed,
         Boot_Block_Compressed_Size,
         max,
-        SYM_GZIP
+        SYM_GZIP,
+        nullptr,  // no preset dictionary
+        0
     );
 
     // The boot code contains portions that are supposed to be interned to the
@@ -1040,28 +1099,31 @@ void Startup_Core(void)
     Init_Context_Cell(Sys_Util_Module, REB_MODULE, util);
     ensureNullptr(Sys_Context) = VAL_CONTEXT(Sys_Util_Module);
 
-    rebElide(
-        //
-        // The scan of the boot block interned everything to Lib_Context, but
-        // we want to overwrite that with the Sys_Context here.
-        //
-        "sys.util:", Sys_Util_Module,
+    if (PG_Boot_Level >= BOOT_LEVEL_SYS) {
+        rebElide(
+            //
+            // The scan of the boot block interned everything to Lib_Context,
+            // but we want to overwrite that with the Sys_Context here.
+            //
+            "sys.util:", Sys_Util_Module,
 
-        "intern* sys.util", &boot->system_util,
+            "intern* sys.util", &boot->system_util,
 
-        "bind/only/set", &boot->system_util, Sys_Util_Module,
-        "if not equal? '~done~ ^ do", &boot->system_util, "[fail {sys.util}]",
+            "bind/only/set", &boot->system_util, Sys_Util_Module,
+            "if not equal? '~done~ ^ do", &boot->system_util,
+                "[fail {sys.util}]",
 
-        // SYS contains the implementation of the module machinery itself, so
-        // we don't have MODULE or EXPORT available.  Do the exports manually,
-        // and then import the results to lib.
-        //
-        "set-meta sys.util make object! [",
-            "Name: 'System",  // this is MAKE OBJECT!, not MODULE, must quote
-            "Exports: [module load load-value decode encode encoding-of]",
-        "]",
-        "sys.util.import*", Lib_Context_Value, Sys_Util_Module
-    );
+            // SYS contains the implementation of the module machinery itself,
+            // so we don't have MODULE or EXPORT available.  Do the exports
+            // manually, and then import the results to lib.
+            //
+            "set-meta sys.util make object! [",
+                "Name: 'System",  // MAKE OBJECT!, not MODULE, must quote
+                "Exports: [module load load-value decode encode encoding-of]",
+            "]",
+            "sys.util.import*", Lib_Context_Value, Sys_Util_Module
+        );
+    }
 
     // !!! It was a stated goal at one point that it should be possible to
     // protect the entire system object and still run the interpreter.  That
@@ -1071,21 +1133,27 @@ void Startup_Core(void)
 
   //=//// MEZZ STARTUP /////////////////////////////////////////////////////=//
 
-    rebElide(
-        //
-        // The code is already bound non-specifically to the Lib_Context during
-        // scanning.
-        //
-        // (It's not necessarily the greatest idea to have LIB be this
-        // flexible.  But as it's not hardened from mutations altogether then
-        // prohibiting it doesn't offer any real security...and only causes
-        // headaches when trying to do something weird.)
+    // (BOOT_LEVEL_MODS and BOOT_LEVEL_FULL are currently equivalent, since
+    // extensions aren't loaded by the core startup--the API client picks
+    // which builtin extensions to load, and in what order.)
 
-        // Create actual variables for top-level SET-WORD!s only, and run.
-        //
-        "bind/only/set", SPECIFIC(&boot->mezz), Lib_Context_Value,
-        "do", SPECIFIC(&boot->mezz)
-    );
+    if (PG_Boot_Level >= BOOT_LEVEL_MODS) {
+        rebElide(
+            //
+            // The code is already bound non-specifically to the Lib_Context
+            // during scanning.
+            //
+            // (It's not necessarily the greatest idea to have LIB be this
+            // flexible.  But as it's not hardened from mutations altogether
+            // then prohibiting it doesn't offer any real security...and only
+            // causes headaches when trying to do something weird.)
+
+            // Create actual variables for top-level SET-WORD!s only, and run.
+            //
+            "bind/only/set", SPECIFIC(&boot->mezz), Lib_Context_Value,
+            "do", SPECIFIC(&boot->mezz)
+        );
+    }
 
   //=//// MAKE USER CONTEXT ////////////////////////////////////////////////=//
 
@@ -1098,9 +1166,21 @@ void Startup_Core(void)
     // Doing this as a proper module creation gives us IMPORT and INTERN (as
     // well as EXPORT...?  When do you export from the user context?)
     //
-    rebElide(
-        "system.contexts.user: module [Name: User] []"
-    );
+    if (PG_Boot_Level >= BOOT_LEVEL_SYS) {
+        rebElide(
+            "system.contexts.user: module [Name: User] []"
+        );
+    }
+    else {
+        // MODULE is implemented by SYS.UTIL code that didn't run at this
+        // boot level, so make a plain (meta-less) module the way the
+        // SYS.UTIL context itself was made above.
+        //
+        Context(*) user = Alloc_Context_Core(REB_MODULE, 1, NODE_FLAG_MANAGED);
+        Init_Context_Cell(
+            Get_System(SYS_CONTEXTS, CTX_USER), REB_MODULE, user
+        );
+    }
 
     ensureNullptr(User_Context_Value) = Copy_Cell(
         Alloc_Value(),
@@ -1160,6 +1240,12 @@ void Shutdown_Core(bool clean)
     //
     Shutdown_Extension_Loader();
 
+    // The periodic timer's callback only stores to Eval_Signal_Pending, but
+    // it must stop before the code it lives in could be unloaded...and so a
+    // later Startup_Core() starts from a balanced state.
+    //
+    Shutdown_Signal_Timer();
+
   #if !defined(NDEBUG)
     Check_Memory_Debug(); // old R3-Alpha check, call here to keep it working
   #endif
@@ -1175,9 +1261,23 @@ void Shutdown_Core(bool clean)
     //
     PG_Boot_Phase = BOOT_START;
 
+    Discard_Action_Counts();  // PROFILE-ACTIONS root block would "leak"
+    Discard_Branch_Counts();  // ...and likewise PROFILE-BRANCHES's
+    Discard_Switch_Tables();  // ...and the pins on compiled SWITCH blocks
+    Discard_Literal_Pool();  // ...and POOL-LITERALS' pins on shared arrays
+    Discard_Interpreted_Body_Cache();  // pins prototype FUNCs via handles
+    Discard_Shared_Roots();  // SHARE'd data must rejoin the GC to be freed
+    Discard_Mutation_Journal();  // SNAPSHOT's root block would "leak"
+
+    if (PG_Mem_Watermark_Hook) {  // MEMORY-LIMIT's hook handle would "leak"
+        rebRelease(PG_Mem_Watermark_Hook);
+        PG_Mem_Watermark_Hook = nullptr;
+    }
+
     Shutdown_Data_Stack();
 
     Shutdown_Stackoverflow();
+    Shutdown_Errors();
     Shutdown_Typesets();
 
     Shutdown_Natives();
@@ -1210,6 +1310,7 @@ void Shutdown_Core(bool clean)
 
     Shutdown_Mold();
     Shutdown_Collector();
+    Shutdown_Profiler();
     Shutdown_Raw_Print();
     Shutdown_CRC();
     Shutdown_String();
@@ -29,6 +29,51 @@
 #include "sys-core.h"
 
 
+//
+//  Expand_Binder: C
+//
+// A binder's hash table starts out in a fixed-size buffer inside the struct
+// itself (see BINDER_INLINE_SLOTS), which covers typical function specs and
+// object bodies.  Large binds--module loads bind tens of thousands of
+// words--spill into a heap table here, doubling each time the load factor
+// crosses half.  Rebuilding also reclaims the slots of removed mappings,
+// which Remove_Binder_Index() leaves claimed to keep probe chains intact.
+//
+void Expand_Binder(struct Reb_Binder *binder)
+{
+    REBLEN capacity_old = binder->capacity;
+    struct Reb_Binder_Slot *slots_old = binder->slots;
+
+    binder->capacity = capacity_old * 2;
+    binder->slots = TRY_ALLOC_N(struct Reb_Binder_Slot, binder->capacity);
+    if (binder->slots == nullptr)
+        fail (Error_No_Memory(
+            binder->capacity * sizeof(struct Reb_Binder_Slot)
+        ));
+    memset(
+        binder->slots,
+        0,
+        binder->capacity * sizeof(struct Reb_Binder_Slot)
+    );
+
+    binder->occupied = 0;
+
+    REBLEN i;
+    for (i = 0; i < capacity_old; ++i) {
+        if (slots_old[i].symbol == nullptr or slots_old[i].index == 0)
+            continue;  // empty, or a mapping that was removed
+
+        struct Reb_Binder_Slot *slot
+            = Find_Binder_Slot(binder, slots_old[i].symbol);
+        *slot = slots_old[i];
+        ++binder->occupied;
+    }
+
+    if (slots_old != binder->inline_slots)
+        FREE_N(struct Reb_Binder_Slot, capacity_old, slots_old);
+}
+
+
 //
 //  Bind_Values_Inner_Loop: C
 //
@@ -197,19 +197,22 @@ static REBVAR* Append_Context_Core(
             | SERIES_FLAG_INFO_NODE_NEEDS_MARK  // mark context through cache
         );
 
-        // We circularly link the variable into the list of hitches so that you
-        // can find the spelling again.
-
-        // skip over binding-related hitches
+        // We circularly link the variable into the list of hitches so that
+        // you can find the spelling again.  (The chain holds only module
+        // variable patches--binders keep their state in their own tables.)
         //
         REBSER *updating = m_cast(Raw_Symbol*, symbol);
-        while (GET_SERIES_FLAG(SER(node_MISC(Hitch, updating)), BLACK))
-            updating = SER(node_MISC(Hitch, updating));
 
         node_MISC(Hitch, patch) = node_MISC(Hitch, updating);
         mutable_INODE(PatchContext, patch) = context;
         node_MISC(Hitch, updating) = patch;
 
+        // A module variable coming into existence may override what code
+        // attached to that module had been inheriting (e.g. from Lib), so
+        // cached inheritances can no longer be trusted.
+        //
+        Invalidate_Module_Inherit_Cache();
+
         if (any_word) {  // bind word while we're at it
             INIT_VAL_WORD_BINDING(unwrap(any_word), patch);
             INIT_VAL_WORD_INDEX(unwrap(any_word), INDEX_ATTACHED);
@@ -230,6 +233,33 @@ static REBVAR* Append_Context_Core(
     EXPAND_SERIES_TAIL(keylist, 1);  // updates the used count
     Init_Key(SER_LAST(REBKEY, keylist), symbol);
 
+    // If the keylist had built a hash index for lookups, keep it in sync.
+    // Once the load factor degrades past 2/3 the index is dropped instead,
+    // and the next Find_Symbol_In_Context() rebuilds it at the larger size.
+    //
+    if (GET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK)) {
+        REBSER *hashlist = MISC(Hashlist, keylist);
+        REBLEN num_slots = SER_USED(hashlist);
+        REBLEN len = SER_USED(keylist);
+
+        if (len * 3 >= num_slots * 2)
+            CLEAR_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK);  // rebuild later
+        else {
+            struct Reb_Hashlist_Entry *entries
+                = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
+
+            uint32_t hash = Hash_String(symbol);
+            REBLEN slot = hash % num_slots;
+            while (entries[slot].index != 0) {
+                ++slot;
+                if (slot == num_slots)
+                    slot = 0;
+            }
+            entries[slot].index = len;  // the key we just appended
+            entries[slot].hash = hash;
+        }
+    }
+
     // Add a slot to the var list
     //
     EXPAND_SERIES_TAIL(CTX_VARLIST(context), 1);
@@ -587,6 +617,140 @@ void Rebind_Context_Deep(
 }
 
 
+//=//// SPEC KEYLIST CACHE ////////////////////////////////////////////////=//
+//
+// Code that mass-produces objects tends to run MAKE OBJECT! on the same
+// spec block over and over--and the spec's keylist comes out the same every
+// time, while the collect-words pass to derive it (binder setup, data stack
+// pushes, series allocation) is repaid on every single MAKE.  This small
+// direct-mapped cache remembers the keylist last derived from a spec,
+// keyed on the spec block's identity, so repeat construction skips the
+// collection entirely: one varlist allocation plus initializing the cells.
+//
+// Only frozen spec arrays are cached.  A frozen array can never acquire or
+// lose a SET-WORD!, making the cached keylist valid for as long as the
+// array exists--the same invalidation-free bargain SWITCH's literal
+// dispatch tables strike.  (Freezing the spec is the mass-producer's
+// opt-in, and costs nothing for source blocks that were never mutated.)
+//
+// Nothing is pinned: entries hold bare node pointers, and cached keylists
+// may have no other references.  Both are only safe until a sweep can
+// recycle node addresses or free the keylist, so the garbage collector
+// wipes the cache each run--the same lifetime reasoning as the virtual
+// bind cache.
+//
+// Cached keylists get their SHARED flag set up front.  Any context that
+// later expands (e.g. a variable APPENDed to an object) copies the keylist
+// on write, so the cached one can't be mutated out from under future MAKEs.
+
+#define SPEC_KEYLIST_CACHE_SLOTS 64  // must be a power of two
+
+struct Spec_Keylist_Cache_Entry {
+    Array(const*) array;  // the frozen spec block's array (key)
+    REBLEN index;  // index of the spec value into that array (key)
+    Keylist(*) keylist;  // keylist derived from the spec's set-words
+};
+
+static struct Spec_Keylist_Cache_Entry
+    Spec_Keylist_Cache[SPEC_KEYLIST_CACHE_SLOTS];
+
+
+//
+//  Invalidate_Spec_Keylist_Cache: C
+//
+// The cache keys on node addresses and may hold otherwise-unreferenced
+// keylists; neither survives a garbage collection's sweep, so Recycle_Core()
+// wipes the cache alongside the binding lookup caches.
+//
+void Invalidate_Spec_Keylist_Cache(void)
+{
+    memset(Spec_Keylist_Cache, 0, sizeof(Spec_Keylist_Cache));
+}
+
+
+//
+//  Make_Context_For_Spec_Managed: C
+//
+// MAKE OBJECT! entry point for BLOCK! specs.  Equivalent to calling
+// Make_Context_Detect_Managed() on the spec's contents, but when the spec
+// array is frozen its derived keylist is remembered (and reused) through
+// the cache above.
+//
+Context(*) Make_Context_For_Spec_Managed(
+    enum Reb_Kind kind,
+    Cell(const*) spec,  // any-array value, kept at its index
+    option(Context(*)) parent
+){
+    assert(kind != REB_MODULE);
+
+    Cell(const*) tail;
+    Cell(const*) at = VAL_ARRAY_AT(&tail, spec);
+
+    // A parent contributes keys of its own, so the spec identity alone
+    // wouldn't be a sufficient cache key; that path is left uncached.
+    //
+    if (parent or not Is_Series_Frozen(VAL_ARRAY(spec)))
+        return Make_Context_Detect_Managed(kind, at, tail, parent);
+
+    Array(const*) array = VAL_ARRAY(spec);
+
+    struct Spec_Keylist_Cache_Entry *entry = &Spec_Keylist_Cache[
+        (cast(uintptr_t, cast(const void*, array)) >> 4)
+            % SPEC_KEYLIST_CACHE_SLOTS
+    ];
+
+    if (entry->array != array or entry->index != VAL_INDEX(spec)) {
+        //
+        // Miss: derive the context the ordinary way, then remember its
+        // keylist (evicting whatever spec hashed here before).  The SHARED
+        // flag makes this context--and every later one--copy on expansion
+        // rather than mutate the cached keylist.
+        //
+        Context(*) context = Make_Context_Detect_Managed(
+            kind, at, tail, nullptr
+        );
+        entry->array = array;
+        entry->index = VAL_INDEX(spec);
+        entry->keylist = CTX_KEYLIST(context);
+        Set_Subclass_Flag(KEYLIST, entry->keylist, SHARED);
+        return context;
+    }
+
+    // Hit: no collection at all, just a varlist against the shared keylist.
+
+    Keylist(*) keylist = entry->keylist;
+    REBLEN len = SER_USED(keylist);
+
+    Array(*) varlist = Make_Array_Core(
+        1 + len,  // needs room for rootvar
+        SERIES_MASK_VARLIST
+            | NODE_FLAG_MANAGED
+    );
+    SET_SERIES_LEN(varlist, 1 + len);
+    mutable_MISC(VarlistMeta, varlist) = nullptr;
+    mutable_LINK(Patches, varlist) = nullptr;  // start w/no virtual binds
+
+    Context(*) context = CTX(varlist);
+    INIT_CTX_KEYLIST_SHARED(context, keylist);
+
+    Value(*) var = VAL(ARR_HEAD(varlist));
+    INIT_VAL_CONTEXT_ROOTVAR(var, kind, varlist);
+
+    ++var;
+
+    for (; len > 0; --len, ++var)  // [0] is rootvar (context), already done
+        Init_None(var);
+
+    ASSERT_CONTEXT(context);
+
+  #if DEBUG_COLLECT_STATS
+    PG_Reb_Stats->Objects++;
+  #endif
+
+    return context;
+}
+
+
 //
 //  Make_Context_Detect_Managed: C
 //
@@ -685,6 +849,66 @@ Context(*) Make_Context_Detect_Managed(
 }
 
 
+//
+//  Derive_Context_Shared_Managed: C
+//
+// Create an instance of a prototype context which shares the prototype's
+// keylist *and* its field values, instead of deep-copying every field the
+// way Make_Context_Detect_Managed() does.  Mass-produced entities carrying
+// dozens of mostly-default fields pay only for their (dense) varlist, not
+// for clones of blocks and strings they may never touch.
+//
+// The copied cells are marked CELL_FLAG_CONST so that series mutation
+// through the instance cannot corrupt the prototype--an instance field
+// "materializes" by being SET to a new value (which simply overwrites the
+// slot cell, const bit and all).  Note this means field values keep the
+// bindings they had in the prototype; nothing is rebound, since rebinding
+// would have to write into the shared arrays.
+//
+// (The varlist itself cannot be elided or shared: bound words cache an
+// index into it, so every instance needs its own dense slot array.)
+//
+Context(*) Derive_Context_Shared_Managed(Context(*) parent)
+{
+    assert(CTX_TYPE(parent) != REB_MODULE);  // modules don't use dense slots
+    assert(CTX_TYPE(parent) != REB_FRAME);  // keylist would be a paramlist
+
+    Keylist(*) keylist = CTX_KEYLIST(parent);
+    REBLEN len = CTX_LEN(parent);
+
+    Array(*) varlist = Make_Array_Core(
+        1 + len,  // needs room for rootvar
+        SERIES_MASK_VARLIST
+            | NODE_FLAG_MANAGED
+    );
+    SET_SERIES_LEN(varlist, 1 + len);
+    mutable_MISC(VarlistMeta, varlist) = nullptr;
+    mutable_LINK(Patches, varlist) = nullptr;  // start w/no virtual binds
+
+    Context(*) context = CTX(varlist);
+    INIT_CTX_KEYLIST_SHARED(context, keylist);  // ancestor link left as-is
+
+    Value(*) rootvar = VAL(ARR_HEAD(varlist));
+    INIT_VAL_CONTEXT_ROOTVAR(rootvar, CTX_TYPE(parent), varlist);
+
+    REBVAL *dest = CTX_VARS_HEAD(context);
+    const REBVAR *src_tail;
+    REBVAL *src = CTX_VARS(&src_tail, parent);
+    for (; src != src_tail; ++dest, ++src) {
+        Copy_Cell(dest, src);
+        Constify(dest);  // shared with the prototype until SET
+    }
+
+    ASSERT_CONTEXT(context);
+
+  #if DEBUG_COLLECT_STATS
+    PG_Reb_Stats->Objects++;
+  #endif
+
+    return context;
+}
+
+
 //
 //  Construct_Context_Managed: C
 //
@@ -805,6 +1029,157 @@ Array(*) Context_To_Array(Cell(const*) context, REBINT mode)
 }
 
 
+// Number of keys at which a keylist gets a hash index built for it, rather
+// than doing linear scans of the keys on each lookup.  Small contexts stay
+// index-free; the scan over a few keys is as fast as hashing would be.
+//
+#define KEYLIST_HASH_THRESHOLD 32
+
+
+// Build a hash index over a keylist's symbols, hung off the keylist's MISC
+// slot.  Since keylists can be shared between contexts, all the contexts
+// using one benefit from a single index.  Slots hold 1-based key indices
+// (0 if the slot is free), plus the symbol's hash for cheap rejection of
+// collisions while probing--the same scheme MAP! uses in Find_Key_Hashed().
+//
+// Note Hash_String() on symbols is caseless, so synonyms land in the same
+// probe chain and both strict and non-strict lookups can use the index.
+//
+static REBSER *Build_Keylist_Hashlist(Keylist(*) keylist)
+{
+    REBLEN len = SER_USED(keylist);
+    REBSER *hashlist = Make_Hash_Series(len);  // zeroed, prime > 2 * len
+    Force_Series_Managed(hashlist);  // keylist's reference must GC mark it
+
+    struct Reb_Hashlist_Entry *entries
+        = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
+    REBLEN num_slots = SER_USED(hashlist);
+
+    const REBKEY *key = SER_HEAD(const REBKEY, keylist);
+    REBLEN n;
+    for (n = 1; n <= len; ++n, ++key) {
+        uint32_t hash = Hash_String(KEY_SYMBOL(key));
+        REBLEN slot = hash % num_slots;
+        while (entries[slot].index != 0) {
+            ++slot;
+            if (slot == num_slots)
+                slot = 0;
+        }
+        entries[slot].index = n;
+        entries[slot].hash = hash;
+    }
+
+    mutable_MISC(Hashlist, keylist) = hashlist;
+    SET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK);  // means "has index"
+    return hashlist;
+}
+
+
+//
+//  Find_Exact_Symbol_In_Keylist: C
+//
+// Return the lowest 1-based key index greater than `after` whose symbol is
+// pointer-equal to `symbol`, or 0 if there is none.  Goes through the
+// keylist's lazily built hash index when it has one (see above), which is
+// how refinement fulfillment in Action_Executor() resolves callsite
+// refinements in constant time on actions with big parameter lists--while
+// small keylists stay index-free and scan, same as field lookup.
+//
+// Pointer equality (not Are_Synonyms()) is deliberate: a refinement at a
+// callsite must match the parameter's exact spelling, which is the test the
+// fulfillment loop has always used.
+//
+// The `after` parameter supports keylists with duplicate spellings (e.g.
+// relabeled or augmented frames): a caller that rejects the returned key can
+// resume the search just past it.  Entries for the same symbol sit along the
+// hash probe chain in insertion order, so probing finds them by ascending
+// index.
+//
+REBLEN Find_Exact_Symbol_In_Keylist(
+    Keylist(*) keylist,
+    Symbol(const*) symbol,
+    REBLEN after
+){
+    REBLEN len = SER_USED(keylist);
+
+    if (len >= KEYLIST_HASH_THRESHOLD) {
+        REBSER *hashlist;
+        if (GET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK))
+            hashlist = MISC(Hashlist, keylist);
+        else
+            hashlist = Build_Keylist_Hashlist(keylist);
+
+        struct Reb_Hashlist_Entry *entries
+            = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
+        REBLEN num_slots = SER_USED(hashlist);
+
+        uint32_t hash = Hash_String(symbol);
+        REBLEN slot = hash % num_slots;
+        REBLEN n;
+        while ((n = entries[slot].index) != 0) {
+            if (
+                entries[slot].hash == hash
+                and n > after
+                and KEY_SYMBOL(SER_AT(const REBKEY, keylist, n - 1)) == symbol
+            ){
+                return n;
+            }
+            ++slot;
+            if (slot == num_slots)
+                slot = 0;
+        }
+        return 0;
+    }
+
+    const REBKEY *key = SER_AT(const REBKEY, keylist, after);
+    REBLEN n;
+    for (n = after + 1; n <= len; ++n, ++key) {
+        if (KEY_SYMBOL(key) == symbol)
+            return n;
+    }
+    return 0;
+}
+
+
+//=//// METHOD CACHE //////////////////////////////////////////////////////=//
+//
+// Method-style dispatch (obj.method args) resolves the same symbol in the
+// same shape of object over and over.  Since contexts of the same shape
+// share a keylist, a small direct-mapped cache of (keylist, symbol) pairs
+// to slot indices makes a repeat lookup one compare-and-verify...whether
+// the call site sees one shape or many (the keylist is part of the key, so
+// "megamorphic" sites just occupy more slots instead of thrashing one).
+//
+// The cache is a pure hint: a hit is only trusted after checking that the
+// key at the cached index in the *current* context actually matches the
+// symbol (and isn't hidden).  So the cached pointers are compared but never
+// dereferenced--entries going stale via GC (or even surviving a shutdown
+// and reboot of the interpreter) cause misses, not misbehavior.  No
+// invalidation hooks are needed anywhere.
+//
+// FRAME!s are excluded: which of their keys is visible depends on the
+// frame's phase, so an index can't be validated by spelling alone.
+// MODULE!s don't come through here at all (variables hang off the symbol
+// itself, which is already a direct lookup).
+
+#define METHOD_CACHE_SLOTS 512  // must be a power of 2
+
+static struct Reb_Method_Cache_Entry {
+    Keylist(*) keylist;  // compared, never dereferenced (may be stale)
+    Symbol(const*) symbol;  // exact symbol pointer from the lookup
+    REBLEN index;  // 1-based slot index (never 0)
+} Method_Cache[METHOD_CACHE_SLOTS];
+
+inline static struct Reb_Method_Cache_Entry *Method_Cache_Entry(
+    Keylist(*) keylist,
+    Symbol(const*) symbol
+){
+    uintptr_t h =
+        (cast(uintptr_t, keylist) >> 4) ^ (cast(uintptr_t, symbol) >> 4);
+    return &Method_Cache[h & (METHOD_CACHE_SLOTS - 1)];
+}
+
+
 //
 //  Find_Symbol_In_Context: C
 //
@@ -828,6 +1203,75 @@ REBLEN Find_Symbol_In_Context(
         return MOD_VAR(c, symbol, strict) ? INDEX_ATTACHED : 0;
     }
 
+    struct Reb_Method_Cache_Entry *cached = nullptr;
+
+    if (not IS_FRAME(context)) {  // frame key visibility depends on phase
+        Context(*) c = VAL_CONTEXT(context);
+        Keylist(*) keylist = CTX_KEYLIST(c);
+
+        // Check the method cache first.  A hit is only a hint: trust it
+        // solely if the key at the remembered index checks out against the
+        // live keylist (so stale entries degrade to misses, see above).
+        //
+        cached = Method_Cache_Entry(keylist, symbol);
+        if (cached->keylist == keylist and cached->symbol == symbol) {
+            REBLEN n = cached->index;
+            assert(n != 0);
+            if (n <= CTX_LEN(c)) {
+                Symbol(const*) candidate = KEY_SYMBOL(CTX_KEY(c, n));
+                if (
+                    (strict
+                        ? (candidate == symbol)
+                        : Are_Synonyms(candidate, symbol))
+                    and Not_Cell_Flag(CTX_VAR(c, n), VAR_MARKED_HIDDEN)
+                ){
+                    return n;
+                }
+            }
+        }
+
+        if (SER_USED(keylist) >= KEYLIST_HASH_THRESHOLD) {
+            REBSER *hashlist;
+            if (GET_SERIES_FLAG(keylist, MISC_NODE_NEEDS_MARK))
+                hashlist = MISC(Hashlist, keylist);
+            else
+                hashlist = Build_Keylist_Hashlist(keylist);
+
+            struct Reb_Hashlist_Entry *entries
+                = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
+            REBLEN num_slots = SER_USED(hashlist);
+
+            uint32_t hash = Hash_String(symbol);
+            REBLEN slot = hash % num_slots;
+            REBLEN n;
+            while ((n = entries[slot].index) != 0) {
+                if (entries[slot].hash == hash) {
+                    Symbol(const*) candidate = KEY_SYMBOL(CTX_KEY(c, n));
+                    if (
+                        strict
+                            ? (candidate == symbol)
+                            : Are_Synonyms(candidate, symbol)
+                    ){
+                        // Hidden fields act as if absent, the way the scan
+                        // below skips them.  Keep probing: a synonym could
+                        // still be later in the chain.
+                        //
+                        if (Not_Cell_Flag(CTX_VAR(c, n), VAR_MARKED_HIDDEN)) {
+                            cached->keylist = keylist;
+                            cached->symbol = symbol;
+                            cached->index = n;
+                            return n;
+                        }
+                    }
+                }
+                ++slot;
+                if (slot == num_slots)
+                    slot = 0;
+            }
+            return 0;
+        }
+    }
+
     EVARS e;
     Init_Evars(&e, context);
 
@@ -841,6 +1285,12 @@ REBLEN Find_Symbol_In_Context(
                 continue;
         }
 
+        if (cached != nullptr) {  // non-frame, remember for next lookup
+            cached->keylist = CTX_KEYLIST(VAL_CONTEXT(context));
+            cached->symbol = symbol;
+            cached->index = e.index;
+        }
+
         Shutdown_Evars(&e);
         return e.index;
     }
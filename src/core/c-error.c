@@ -251,6 +251,24 @@ REBLEN Stack_Depth(void)
 }
 
 
+// Every error construction looks its ID up in the catalog from %errors.r,
+// and that catalog has no index.  Rather than pay for a linear search over
+// all the categories on each fail(), the position of a template is memoized
+// by symbol number the first time it is found.  Only the category context
+// and index are stored--not a pointer to the variable cell--since appending
+// new IDs to a category can reallocate its varlist.
+//
+// (An API handle on the catalog is kept so the memoized categories stay
+// live even if someone were to overwrite system.catalog.errors.)
+//
+static struct {
+    Context(*) category;
+    REBLEN n;  // index of the message template in the category context
+} Error_Template_Memos[ALL_SYMS_MAX];
+
+static REBVAL *Error_Catalog_Handle = nullptr;
+
+
 //
 //  Find_Error_For_Sym: C
 //
@@ -259,12 +277,24 @@ REBLEN Stack_Depth(void)
 // block-or-string for a given error ID.
 //
 // This once used numeric error IDs.  Now that the IDs are symbol-based, a
-// linear search has to be used...though a MAP! could/should be used.
+// linear search has to be used...though that search only happens the first
+// time an ID is seen (the found position is memoized for later lookups).
 //
 // If the message is not found, return nullptr.
 //
 const REBVAL *Find_Error_For_Sym(enum Reb_Symbol_Id id_sym)
 {
+    assert(id_sym != SYM_0 and cast(REBLEN, id_sym) < ALL_SYMS_MAX);
+
+    if (Error_Template_Memos[id_sym].category != nullptr) {
+        REBVAL *message = CTX_VAR(
+            Error_Template_Memos[id_sym].category,
+            Error_Template_Memos[id_sym].n
+        );
+        assert(IS_BLOCK(message) or IS_TEXT(message));
+        return message;
+    }
+
     Symbol(const*) id_canon = Canon_Symbol(id_sym);
 
     Context(*) categories = VAL_CONTEXT(Get_System(SYS_CATALOG, CAT_ERRORS));
@@ -278,12 +308,14 @@ const REBVAL *Find_Error_For_Sym(enum Reb_Symbol_Id id_sym)
             if (Are_Synonyms(KEY_SYMBOL(CTX_KEY(category, n)), id_canon)) {
                 REBVAL *message = CTX_VAR(category, n);
                 assert(IS_BLOCK(message) or IS_TEXT(message));
+                Error_Template_Memos[id_sym].category = category;
+                Error_Template_Memos[id_sym].n = n;
                 return message;
             }
         }
     }
 
-    return nullptr;
+    return nullptr;  // misses not memoized (categories can gain IDs later)
 }
 
 
@@ -369,7 +401,7 @@ void Set_Location_Of_Error(
 
     if (f != BOTTOM_FRAME) {  // found a frame with file and line information
         String(const*) file = LINK(Filename, FRM_ARRAY(f));
-        LineNumber line = FRM_ARRAY(f)->misc.line;
+        LineNumber line = Array_Line(FRM_ARRAY(f));
 
         if (file)
             Init_File(&vars->file, file);
@@ -779,6 +811,34 @@ Context(*) Error_User(const char *utf8) {
 }
 
 
+//
+//  Error_User_Id: C
+//
+// RAISE with a WORD! makes an id-only "user" error, for definitional
+// failures whose callers typically just test the ID and discard them.
+// Going through MAKE ERROR! with a block would bind and evaluate that
+// block--a lot of machinery for an error that carries no arguments--so
+// this builds the context directly.
+//
+// The message is the ID's symbol aliased as a read-only TEXT!, the way
+// AS TEXT! of a WORD! would alias it...so no string copy is made.
+//
+Context(*) Error_User_Id(Symbol(const*) id)
+{
+    Context(*) root_error = VAL_CONTEXT(Get_System(SYS_STANDARD, STD_ERROR));
+
+    Context(*) error = Copy_Context_Extra_Managed(root_error, 0, 0);
+    mutable_HEART_BYTE(CTX_ROOTVAR(error)) = REB_ERROR;
+
+    ERROR_VARS *vars = ERR_VARS(error);
+    Init_Word(&vars->type, Canon(USER));
+    Init_Word(&vars->id, id);
+    Init_Any_String(&vars->message, REB_TEXT, id);
+
+    return error;
+}
+
+
 //
 //  Error_Need_Non_End: C
 //
@@ -1327,10 +1387,27 @@ Context(*) Startup_Errors(const REBVAL *boot_errors)
         Init_Object(category, error);
     }
 
+    // The template memos from any previous boot point into a dead catalog.
+    //
+    memset(Error_Template_Memos, 0, sizeof(Error_Template_Memos));
+
+    assert(Error_Catalog_Handle == nullptr);
+    Error_Catalog_Handle = Init_Object(Alloc_Value(), catalog);
+
     return catalog;
 }
 
 
+//
+//  Shutdown_Errors: C
+//
+void Shutdown_Errors(void)
+{
+    rebRelease(Error_Catalog_Handle);
+    Error_Catalog_Handle = nullptr;
+}
+
+
 //
 //  Startup_Stackoverflow: C
 //
@@ -115,7 +115,11 @@ static void Finalize_Param(Value(*) param) {
     // order to establish &(ANY-VALUE?) as a type annotation, because
     // ANY-VALUE? has to bootstrap itself somehow.
     //
-    UNUSED(param);
+    // But the slot is still a chance to do per-parameter optimization: if
+    // the type spec is a pure union of built-in datatypes, compile it into
+    // a kind bitmask so calls don't walk the spec.  See Typecheck_Value().
+    //
+    Try_Cache_Param_Kind_Mask(param);
 }
 
 
@@ -164,15 +168,16 @@ void Push_Paramlist_Quads_May_Fail(
 
             if (Is_Word_Isotope_With_Id(KEY_SLOT(TOP_INDEX), SYM_KEY)) {
                 // no keys seen yet, act as description
-                Init_Text(notes, Copy_String_At(item));
                 *flags |= MKF_HAS_DESCRIPTION;
             }
             else {
                 assert(IS_WORD(KEY_SLOT(TOP_INDEX)));
-                Init_Text(notes, Copy_String_At(item));
                 *flags |= MKF_HAS_NOTES;
             }
 
+            if (not (*flags & MKF_DEFER_META))  // copy only if meta built now
+                Init_Text(notes, Copy_String_At(item));
+
             continue;
         }
 
@@ -225,11 +230,9 @@ void Push_Paramlist_Quads_May_Fail(
           blockscope {
             StackValue(*) types = TYPES_SLOT(TOP_INDEX);
 
-            if (IS_BLOCK(types))  // too many, `func [x [integer!] [blank!]]`
+            if (not Is_Nulled(types))  // too many, `func [x [integer!] [_]]`
                 fail (Error_Bad_Func_Def_Raw(item));
 
-            assert(Is_Nulled(types));
-
             // You currently can't say `<local> x [integer!]`, because locals
             // are hidden from the interface, and hidden values (notably
             // specialized-out values) use the `param` slot for the value,
@@ -262,14 +265,22 @@ void Push_Paramlist_Quads_May_Fail(
             was_refinement = GET_PARAM_FLAG(param, REFINEMENT);
             pclass = VAL_PARAM_CLASS(cast_PAR(param));
 
-            Init_Block(
-                types,
-                Copy_Array_At_Deep_Managed(
-                    VAL_ARRAY(item),
-                    VAL_INDEX(item),
-                    derived
-                )
-            );
+            // The deep copy of the types block only matters to the meta's
+            // `parameter-types`; the typeset bits below work directly off
+            // the spec.  If the meta is deferred, just mark the slot so a
+            // duplicate types block for this parameter is still an error.
+            //
+            if (*flags & MKF_DEFER_META)
+                Init_Blank(types);
+            else
+                Init_Block(
+                    types,
+                    Copy_Array_At_Deep_Managed(
+                        VAL_ARRAY(item),
+                        VAL_INDEX(item),
+                        derived
+                    )
+                );
           }
 
             Cell(const*) types_tail;
@@ -717,7 +728,9 @@ Array(*) Pop_Paramlist_With_Meta_May_Fail(
 
     // !!! See notes on ACTION-META in %sysobj.r
 
-    if (flags & (MKF_HAS_DESCRIPTION | MKF_HAS_TYPES | MKF_HAS_NOTES))
+    if (flags & MKF_DEFER_META)  // see Force_Action_Meta() for the build
+        *meta = nullptr;  // spec noticed description/types/notes, but skipped
+    else if (flags & (MKF_HAS_DESCRIPTION | MKF_HAS_TYPES | MKF_HAS_NOTES))
         *meta = Copy_Context_Shallow_Managed(VAL_CONTEXT(Root_Action_Meta));
     else
         *meta = nullptr;
@@ -725,7 +738,7 @@ Array(*) Pop_Paramlist_With_Meta_May_Fail(
     // If a description string was gathered, it's sitting in the first string
     // slot, the third cell we pushed onto the stack.  Extract it if so.
     //
-    if (flags & MKF_HAS_DESCRIPTION) {
+    if (*meta and (flags & MKF_HAS_DESCRIPTION)) {
         StackValue(*) description = NOTES_SLOT(base + 4);
         assert(IS_TEXT(description));
         Copy_Cell(
@@ -736,7 +749,7 @@ Array(*) Pop_Paramlist_With_Meta_May_Fail(
 
     // Only make `parameter-types` if there were blocks in the spec
     //
-    if (flags & MKF_HAS_TYPES) {
+    if (*meta and (flags & MKF_HAS_TYPES)) {
         Array(*) types_varlist = Make_Array_Core(
             num_slots,
             SERIES_MASK_VARLIST | NODE_FLAG_MANAGED
@@ -785,7 +798,7 @@ Array(*) Pop_Paramlist_With_Meta_May_Fail(
 
     // Only make `parameter-notes` if there were strings (besides description)
     //
-    if (flags & MKF_HAS_NOTES) {
+    if (*meta and (flags & MKF_HAS_NOTES)) {
         Array(*) notes_varlist = Make_Array_Core(
             num_slots,
             SERIES_MASK_VARLIST | NODE_FLAG_MANAGED
@@ -915,6 +928,54 @@ Array(*) Make_Paramlist_Managed_May_Fail(
 }
 
 
+//
+//  Force_Action_Meta: C
+//
+// Generators that expect heavy function churn pass MKF_DEFER_META, which
+// skips building the meta object (description, parameter types and notes)
+// and stashes the spec block in the meta slot instead--as a plain 2-element
+// array of the spec and the generator's MKF flags.  Most such functions are
+// never asked for their help, so the string and array copies for it would
+// be wasted; this runs the skipped analysis on the first request.
+//
+// Note the spec is a user block which could have been modified since the
+// action was made.  The deferred help reflects such modifications, and if
+// they made the spec invalid, the error surfaces on the META-OF that asked.
+//
+Context(*) Force_Action_Meta(Action(*) act)
+{
+    Array(*) details = ACT_IDENTITY(act);
+    if (details->misc.any.node == nullptr)
+        return nullptr;
+
+    REBSER *s = SER(node_MISC(DetailsMeta, details));
+    if (SER_FLAVOR(s) == FLAVOR_VARLIST)
+        return CTX(s);  // already built (or patched in via SET-META)
+
+    Array(*) pending = ARR(s);
+    assert(SER_FLAVOR(pending) == FLAVOR_ARRAY);
+    assert(ARR_LEN(pending) == 2);
+
+    REBVAL *spec = SPECIFIC(ARR_AT(pending, 0));
+    Flags flags = VAL_INT32(ARR_AT(pending, 1));
+    assert(not (flags & MKF_DEFER_META));
+
+    // The paramlist made by re-analysis is redundant with the one the action
+    // already has, and just gets GC'd...a one-time cost on first request.
+    //
+    Context(*) meta;
+    Array(*) paramlist = Make_Paramlist_Managed_May_Fail(
+        &meta,
+        spec,
+        &flags
+    );
+    UNUSED(paramlist);
+
+    node_MISC(DetailsMeta, details) = meta;  // null if strings since removed
+    return meta;
+}
+
+
 //
 //  Make_Action: C
 //
@@ -1046,6 +1107,41 @@ Action(*) Make_Action(
             Set_Action_Flag(act, SKIPPABLE_FIRST);
     }
 
+    // Also check if every unspecialized parameter is a plain evaluated
+    // positional argument.  If so, each call can fulfill its arguments with
+    // a minimum of parameter convention analysis...see the fast path in
+    // Action_Executor() that DETAILS_FLAG_SIMPLE_ARGS enables.
+
+    const REBKEY *key_tail;
+    const REBKEY *key = ACT_KEYS(&key_tail, act);
+    const REBPAR *param = ACT_PARAMS_HEAD(act);
+    for (; key != key_tail; ++key, ++param) {
+        if (Is_Specialized(param))
+            continue;  // locals and specializations not seen by callsites
+
+        if (GET_PARAM_FLAG(param, REFINEMENT))
+            goto args_not_simple;
+
+        switch (VAL_PARAM_CLASS(param)) {
+          case PARAM_CLASS_RETURN:
+          case PARAM_CLASS_OUTPUT:
+            continue;  // just initialized, nothing consumed from callsite
+
+          case PARAM_CLASS_NORMAL:
+            if (GET_PARAM_FLAG(param, VARIADIC))
+                goto args_not_simple;
+            if (GET_PARAM_FLAG(param, SKIPPABLE))
+                goto args_not_simple;
+            continue;
+
+          default:  // META and quoting conventions need the full treatment
+            goto args_not_simple;
+        }
+    }
+    Set_Action_Flag(act, SIMPLE_ARGS);
+
+  args_not_simple:
+
     return act;
 }
 
@@ -1091,6 +1187,15 @@ void Get_Maybe_Fake_Action_Body(REBVAL *out, const REBVAL *action)
         Array(*) details = ACT_DETAILS(a);
         Cell(*) body = ARR_AT(details, IDX_DETAILS_1);
 
+        // A never-dispatched body may have been deflated by the GC; it has
+        // to be made ordinary before being exposed as a value (the caller
+        // could traverse or execute it without going through the
+        // dispatcher).  See COLD SOURCE COMPRESSION in %m-gc.c
+        //
+        Array(*) body_array = m_cast(Array(*), VAL_ARRAY(body));
+        if (Get_Subclass_Flag(ARRAY, body_array, COLD_SOURCE))
+            Thaw_Cold_Source(body_array);
+
         // The PARAMLIST_HAS_RETURN tricks for definitional return make it
         // seem like a generator authored more code in the action's body...but
         // the code isn't *actually* there and an optimized internal trick is
@@ -55,16 +55,12 @@
 // this routine to process any "signals"...which could be requests for
 // garbage collection, network-related, Ctrl-C being hit, etc.
 //
-// It also would check the Eval_Signals mask to see if it was non-zero on
-// every step.  If it was, then it would always call this routine--regardless
-// of the Eval_Countdown.
-//
-// While a broader review of how signals would work in Ren-C is pending, it
-// seems best to avoid checking two things each step.  So only the Eval_Countdown
-// is checked, and places that set Eval_Signals set it to 1...to have the
-// same effect as if it were being checked.  Then if the Eval_Signals are
-// not cleared by the end of this routine, it resets the Eval_Countdown to 1
-// rather than giving it the full EVAL_DOSE of counts until next call.
+// Ren-C gets the arithmetic out of the evaluator's hottest loop by having
+// each step test a single flag instead (Eval_Signal_Pending).  SET_SIGNAL()
+// raises the flag at the moment a signal comes in, and the periodic timer
+// below raises it so that time-based duties (incremental sweep slices,
+// profiler samples, signals raised while the sigmask filtered them) still
+// get their callouts even when nothing new has been signaled.
 //
 // Currently the ability of a signal to THROW comes from the processing of
 // breakpoints.  The RESUME instruction is able to execute code with /DO,
@@ -72,35 +68,11 @@
 //
 bool Do_Signals_Throws(Frame(*) frame_)
 {
-    if (Eval_Countdown >= 0) {  // natural countdown or invocation
-        //
-        // Periodic reconciliation of total evaluation cycles.  Avoids needing
-        // to touch *both* Eval_Countdown and Total_Eval_Cycles on every eval.
-        //
-        Total_Eval_Cycles += Eval_Dose - Eval_Countdown;
-    }
-    else if (Eval_Countdown == -2) {
-        //
-        // SET_SIGNAL() sets the countdown to -1, which then reaches -2 on
-        // a tick of the evaluator.  We *only* add that one tick, because
-        // reconciliation was already performed.
-        //
-        ++Total_Eval_Cycles;
-    }
-    else {
-        // This means SET_SIGNAL() ran, and Do_Signals_Throws() was called
-        // before the evaluator was called.  That can happen with the manual
-        // call in Prin_OS_String at time of writing.  There's no tick that
-        // needs accounting for in this case.
-        //
-        assert(Eval_Countdown == -1);
-    }
-
-  #if !defined(NDEBUG)
-    assert(Total_Eval_Cycles == Total_Eval_Cycles_Doublecheck);
-  #endif
-
-    Eval_Countdown = Eval_Dose;
+    // Lower the flag before reading the signal bits (not after), so that a
+    // SET_SIGNAL() racing this routine leaves the flag raised...and gets its
+    // signal processed at the next checkpoint instead of lost.
+    //
+    Eval_Signal_Pending = 0;
 
     bool thrown = false;
 
@@ -119,6 +91,28 @@ bool Do_Signals_Throws(Frame(*) frame_)
         Recycle();
     }
 
+    // If an incremental recycle left sweep slices outstanding, do a bounded
+    // amount of that work at each signal checkpoint.  (A full Recycle() just
+    // above would have drained any prior window before opening a new one.)
+    //
+    if (GC_Sweep_Pending)
+        Sweep_Series_Slice(PG_GC_Sweep_Slice);
+
+    // Dead stubs whose freeing the sweep deferred get decayed in bounded
+    // batches here, moving that part of the reclamation out of the
+    // collection pause as well.  (See RECYCLE/DEFERRED.)
+    //
+    if (GC_Decay_Pending != nullptr)
+        Maintain_Pending_Decay(PG_GC_Decay_Batch);
+
+    // While the sampling profiler is on, each checkpoint snapshots the frame
+    // stack.  Piggybacking on the existing periodic callout is what keeps
+    // the overhead low enough to profile production scripts.  (See the
+    // PROFILE native in %d-stats.c for use and output format.)
+    //
+    if (TG_Profile_Sampling)
+        Sample_Profile_Stack(frame_);
+
     if (filtered_sigs & SIG_HALT) {
         //
         // Early in the booting process, it's not possible to handle Ctrl-C.
@@ -154,6 +148,276 @@ bool Do_Signals_Throws(Frame(*) frame_)
         fail ("BREAKPOINT from SIG_INTERRUPT not currently implemented");
     }
 
+    // Crossing the soft memory watermark is detected by the allocator, but
+    // user code can't run there--the crossing may come halfway through
+    // manipulating a managed series.  So Did_Trap_Alloc_Limit() only raises
+    // this signal, and the hook configured by MEMORY-LIMIT runs here.  With
+    // no hook, the response is a recycle--shedding garbage being the best
+    // generic reaction to memory pressure.  (A fail() in the hook surfaces
+    // as a trappable error at this checkpoint, like the budget below.)
+    //
+    if (filtered_sigs & SIG_MEM_WATERMARK) {
+        CLR_SIGNAL(SIG_MEM_WATERMARK);
+
+        Eval_Sigmask = saved_sigmask;  // hook may allocate and need recycles
+
+        if (PG_Mem_Watermark_Hook)
+            rebElide(
+                rebRUN(PG_Mem_Watermark_Hook),
+                rebI(cast(REBI64, PG_Mem_Usage))
+            );
+        else
+            Recycle();
+
+        Eval_Sigmask = 0;
+    }
+
+    // The watermark disarms when it fires, so that staying above the line
+    // doesn't run the hook on every checkpoint.  Re-arming happens here (the
+    // periodic timer guarantees checkpoints keep coming) once usage is back
+    // under the line--whether the hook freed the memory or it just drained
+    // naturally.
+    //
+    if (
+        PG_Mem_Soft_Limit != 0
+        and not PG_Mem_Watermark_Armed
+        and PG_Mem_Usage <= PG_Mem_Soft_Limit
+    ){
+        PG_Mem_Watermark_Armed = true;
+    }
+
+    // A cooperative time-slice budget (see WITH-EVAL-BUDGET in %n-system.c)
+    // is enforced at this same checkpoint: once the timer's tick count gets
+    // past the armed deadline, the running code is failed with a trappable
+    // error so a scheduler can move on to its next task.  Checked after
+    // SIG_HALT on purpose--Ctrl-C beats budgets.
+    //
+    if (Eval_Slice_Deadline != 0 and Eval_Timer_Ticks >= Eval_Slice_Deadline) {
+        Eval_Slice_Deadline = 0;  // WITH-EVAL-BUDGET restores any outer one
+        Eval_Sigmask = saved_sigmask;
+        fail (Error_Eval_Budget_Raw());
+    }
+
+    // Deterministic budgets work the same way, with deadlines expressed as
+    // absolute values of the monotonic step and allocation counters (see
+    // WITH-EVAL-BUDGET/TICKS and /MEMORY).  Enforcement happens only here,
+    // so overshoot is bounded by the signal period--the price of keeping
+    // comparisons out of the evaluator's hot loop.
+    //
+    if (
+        Eval_Cycles_Deadline != 0
+        and Total_Eval_Cycles >= Eval_Cycles_Deadline
+    ){
+        Eval_Cycles_Deadline = 0;
+        Eval_Sigmask = saved_sigmask;
+        fail (Error_Eval_Budget_Raw());
+    }
+    if (
+        Alloc_Bytes_Deadline != 0
+        and Total_Alloc_Bytes >= Alloc_Bytes_Deadline
+    ){
+        Alloc_Bytes_Deadline = 0;
+        Eval_Sigmask = saved_sigmask;
+        fail (Error_Alloc_Budget_Raw());
+    }
+
+    // A registered I/O pump (e.g. the smart console's typeahead echo, see
+    // %readline-posix.c) gets its callout here.  It's a plain C routine
+    // that must not run user code or fail()--it just moves bytes around so
+    // the terminal feels live during long evaluations.
+    //
+    if (PG_IO_Pump_Hook != nullptr)
+        (*PG_IO_Pump_Hook)();
+
     Eval_Sigmask = saved_sigmask;
+
+    // Checkpoints are where most periodic duties finish (sweep windows
+    // drain, watermarks re-arm) or are discovered to be still outstanding
+    // (signals the sigmask filtered above).  Settle whether the wall-clock
+    // timer needs to keep running--when nothing does, it stops, and an idle
+    // interpreter makes no wakeups at all.
+    //
+    Update_Signal_Timer_Demand();
+
     return thrown;
 }
+
+
+//=//// PERIODIC SIGNAL TIMER /////////////////////////////////////////////=//
+//
+// Since the evaluator no longer counts steps between checkpoints, something
+// has to arm Eval_Signal_Pending for work that wants a periodic callout but
+// has no event to SET_SIGNAL() from--outstanding incremental sweep slices,
+// the sampling profiler, an armed WITH-EVAL-BUDGET deadline, a memory
+// watermark waiting to re-arm, or signals that were filtered by
+// Eval_Sigmask at the time they were checked.  That something is a coarse
+// wall-clock timer whose callback does nothing but store 1 into the flag.
+//
+// The timer is *demand-driven*: it only runs while one of those consumers
+// is active, and Update_Signal_Timer_Demand() stops it when the last one
+// goes quiet.  A free-running tick would wake the process dozens of times a
+// second even when it is parked in a blocking read or WAIT--death to power
+// budgets and to server density--so the idle state must make zero wakeups.
+//
+// The granularity is Eval_Signal_Period milliseconds (see Startup_Signals()
+// for the default and the R3_SIGNAL_PERIOD environment variable override).
+// Note that Ctrl-C does not wait on this timer...rebHalt() raises the flag
+// itself through SET_SIGNAL(), so halting is noticed on the very next step.
+
+#if TO_WINDOWS
+    #undef IS_ERROR  // windows has its own meaning for this
+    #define WIN32_LEAN_AND_MEAN  // trim down the Win32 headers
+    #include <windows.h>
+
+    static HANDLE Signal_Timer = nullptr;
+
+    static void CALLBACK Signal_Timer_Elapsed(PVOID param, BOOLEAN fired) {
+        UNUSED(param);
+        UNUSED(fired);
+        ++Eval_Timer_Ticks;  // coarse clock for WITH-EVAL-BUDGET deadlines
+        Eval_Signal_Pending = 1;
+    }
+#else
+    #include <signal.h>
+    #include <sys/time.h>
+
+    static struct sigaction Signal_Timer_Old_Action;
+
+    static void Signal_Timer_Elapsed(int sig) {
+        UNUSED(sig);
+        ++Eval_Timer_Ticks;  // coarse clock for WITH-EVAL-BUDGET deadlines
+        Eval_Signal_Pending = 1;  // a volatile store is async-signal-safe
+    }
+#endif
+
+static bool Signal_Timer_Armed = false;
+
+
+static void Arm_Signal_Timer(void)
+{
+  #if TO_WINDOWS
+    assert(Signal_Timer == nullptr);
+
+    if (not CreateTimerQueueTimer(
+        &Signal_Timer,
+        nullptr,  // default timer queue
+        &Signal_Timer_Elapsed,
+        nullptr,  // no parameter
+        Eval_Signal_Period,  // first callout
+        Eval_Signal_Period,  // repeat period
+        WT_EXECUTEINTIMERTHREAD  // callback is trivial, skip a worker thread
+    )){
+        Signal_Timer = nullptr;  // flag will be armed by SET_SIGNAL() only
+    }
+  #else
+    struct itimerval period;
+    period.it_interval.tv_sec = Eval_Signal_Period / 1000;
+    period.it_interval.tv_usec = (Eval_Signal_Period % 1000) * 1000;
+    period.it_value = period.it_interval;
+    setitimer(ITIMER_REAL, &period, nullptr);
+  #endif
+}
+
+
+static void Disarm_Signal_Timer(void)
+{
+  #if TO_WINDOWS
+    if (Signal_Timer != nullptr) {
+        DeleteTimerQueueTimer(  // INVALID_HANDLE_VALUE waits on any in-flight
+            nullptr, Signal_Timer, INVALID_HANDLE_VALUE
+        );
+        Signal_Timer = nullptr;
+    }
+  #else
+    struct itimerval disarm;
+    disarm.it_interval.tv_sec = 0;
+    disarm.it_interval.tv_usec = 0;
+    disarm.it_value = disarm.it_interval;
+    setitimer(ITIMER_REAL, &disarm, nullptr);
+  #endif
+}
+
+
+//
+//  Update_Signal_Timer_Demand: C
+//
+// Start or stop the periodic timer to match whether anything currently
+// needs unprompted checkpoints.  Called wherever one of the demand states
+// flips on, and from the checkpoint itself as duties drain away.  The
+// toggle is cheap, but transitions are rare--most programs spend their
+// lives with every demand off and the timer stopped.
+//
+// (If the platform timer couldn't start, nothing degrades beyond what the
+// old free-running timer's failure mode was: SET_SIGNAL() still arms the
+// flag for all the critical cases.)
+//
+void Update_Signal_Timer_Demand(void)
+{
+    bool demand =
+        GC_Sweep_Pending  // incremental sweep slices outstanding
+        or GC_Decay_Pending != nullptr  // deferred decay batches outstanding
+        or TG_Profile_Sampling  // profiler snapshots each checkpoint
+        or Eval_Slice_Deadline != 0  // budget deadline needs the tick clock
+        or Eval_Cycles_Deadline != 0  // step budget needs the checkpoint
+        or Alloc_Bytes_Deadline != 0  // allocation budget does too
+        or (PG_Mem_Soft_Limit != 0 and not PG_Mem_Watermark_Armed)  // re-arm
+        or PG_IO_Pump_Hook != nullptr  // console typeahead pump wants ticks
+        or Eval_Signals != 0;  // raised but filtered by Eval_Sigmask
+
+    if (demand == Signal_Timer_Armed)
+        return;
+
+    Signal_Timer_Armed = demand;
+    if (demand)
+        Arm_Signal_Timer();
+    else
+        Disarm_Signal_Timer();
+}
+
+
+//
+//  Startup_Signal_Timer: C
+//
+// Only the callback's delivery mechanism is set up here; the timer itself
+// stays off until Update_Signal_Timer_Demand() finds a reason to run it.
+//
+void Startup_Signal_Timer(void)
+{
+  #if TO_WINDOWS
+    assert(Signal_Timer == nullptr);
+  #else
+    // SIGALRM is taken over here, which an embedding application might not
+    // appreciate.  SA_RESTART keeps blocking reads and waits from failing
+    // with EINTR every period.  The previous disposition is put back by
+    // Shutdown_Signal_Timer()...this could become a chain if a client turns
+    // up that needs its own alarms while the interpreter is running.
+    //
+    struct sigaction action;
+    action.sa_handler = &Signal_Timer_Elapsed;
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    sigaction(SIGALRM, &action, &Signal_Timer_Old_Action);
+  #endif
+
+    assert(not Signal_Timer_Armed);
+}
+
+
+//
+//  Shutdown_Signal_Timer: C
+//
+// The callback only stores to a global flag, but it must be stopped before
+// the code implementing it can be unloaded (e.g. a DLL client), and so that
+// startup/shutdown/startup sequences balance.
+//
+void Shutdown_Signal_Timer(void)
+{
+    if (Signal_Timer_Armed) {
+        Signal_Timer_Armed = false;
+        Disarm_Signal_Timer();
+    }
+
+  #if !TO_WINDOWS
+    sigaction(SIGALRM, &Signal_Timer_Old_Action, nullptr);
+  #endif
+}
@@ -49,6 +49,8 @@ void Snap_State_Core(struct Reb_State *s)
     s->mold_buf_size = STR_SIZE(STR(MOLD_BUF));
     s->mold_loop_tail = SER_USED(TG_Mold_Stack);
 
+    s->protect_epochs = PG_Protect_Epochs;
+
     s->saved_sigmask = Eval_Sigmask;
 }
 
@@ -90,7 +92,11 @@ void Rollback_Globals_To_State(struct Reb_State *s)
     TG_Pushing_Mold = false;
   #endif
 
-    SET_SERIES_LEN(TG_Mold_Stack, s->mold_loop_tail);
+    Rollback_Mold_Stack(s->mold_loop_tail);  // pops the visit set too
+
+    PG_Protect_Epochs = s->protect_epochs;  // WITH-EPOCH-PROTECTION unwound
+    PG_Epoch_Protect_Mask =
+        PG_Protect_Epochs == 0 ? 0 : SERIES_INFO_EPOCH_PROTECTED;
 
     Eval_Sigmask = s->saved_sigmask;
 }
@@ -167,6 +173,13 @@ void Unplug_Stack(
         //
         temp->baseline.stack_base -= base->baseline.stack_base;
 
+        // A detached fragment leaves its cancellation scope: the token's
+        // HANDLE! may be collected (and the struct freed) while the fragment
+        // sleeps in a suspended generator.  Replug_Stack() re-inherits from
+        // whatever base the fragment is resumed under.
+        //
+        temp->cancel_token = nullptr;
+
         if (temp->prior == base) {
             //
             // The frame below the base was not fulfilling an argument, it
@@ -268,6 +281,8 @@ void Replug_Stack(Frame(*) f, Frame(*) base, Value(*) plug) {
 
         temp->baseline.stack_base += base->baseline.stack_base;  // see [2]
 
+        temp->cancel_token = base->cancel_token;  // join new base's scope
+
         if (temp->prior == nullptr)
             break;
         temp = temp->prior;
@@ -377,6 +392,7 @@ void Assert_State_Balanced_Debug(
     assert(s->mold_buf_len == STR_LEN(STR(MOLD_BUF)));
     assert(s->mold_buf_size == STR_SIZE(STR(MOLD_BUF)));
     assert(s->mold_loop_tail == SER_USED(TG_Mold_Stack));
+    assert(s->protect_epochs == PG_Protect_Epochs);
 
 /*    assert(s->saved_sigmask == Eval_Sigmask);  // !!! is this always true? */
 }
@@ -355,7 +355,7 @@ void* Probe_Core_Debug(
         Probe_Print_Helper(p, expr, "Mold Stack", file, line);
         break;
 
-    //=//// SERIES WITH ELEMENTS sizeof(REBLEN) ////////////////////////////=//
+    //=//// SERIES WITH ELEMENTS sizeof(struct Reb_Hashlist_Entry) /////////=//
 
       case FLAVOR_HASHLIST:
         Probe_Print_Helper(p, expr, "Hashlist", file, line);
@@ -121,11 +121,11 @@ REBINT Get_Hash_Prime_May_Fail(REBLEN minimum)
 //
 //  Expand_Word_Table: C
 //
-// Expand the hash table part of the word_table by allocating
-// the next larger table size and rehashing all the words of
+// Expand the hash table part of the word_table by allocating the next table
+// size at least as large as `minimum_slots` and rehashing all the words of
 // the current table.  Free the old hash array.
 //
-static void Expand_Word_Table(void)
+static void Expand_Word_Table(REBLEN minimum_slots)
 {
     // The only full list of symbol words available is the old hash table.
     // Hold onto it while creating the new hash table.
@@ -133,7 +133,9 @@ static void Expand_Word_Table(void)
     REBLEN old_num_slots = SER_USED(PG_Symbols_By_Hash);
     Symbol(*) *old_symbols_by_hash = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
 
-    REBLEN num_slots = Get_Hash_Prime_May_Fail(old_num_slots + 1);
+    REBLEN num_slots = Get_Hash_Prime_May_Fail(
+        MAX(minimum_slots, old_num_slots + 1)
+    );
     assert(SER_WIDE(PG_Symbols_By_Hash) == sizeof(Symbol(*)));
 
     REBSER *ser = Make_Series_Core(
@@ -180,6 +182,28 @@ static void Expand_Word_Table(void)
 }
 
 
+//
+//  Reserve_Symbol_Table: C
+//
+// Pre-size the symbol hash table for an expected number of additional
+// distinct symbols.  Bulk interning (e.g. LOAD of data with millions of
+// unique words) otherwise pays for a chain of ever-larger rehashes as the
+// table doubles its way up; declaring the count up front does one rehash
+// to the final size before the insertions begin.
+//
+void Reserve_Symbol_Table(REBLEN num_symbols)
+{
+    // Intern_UTF8_Managed_Core() expands once half the slots fill, so ask
+    // for twice the anticipated population to stay under that load factor.
+    //
+    REBLEN needed = (PG_Num_Symbol_Slots_In_Use + num_symbols) * 2;
+    if (needed <= SER_USED(PG_Symbols_By_Hash))
+        return;  // table already big enough
+
+    Expand_Word_Table(needed);
+}
+
+
 //
 //  Intern_UTF8_Managed: C
 //
@@ -202,7 +226,8 @@ static void Expand_Word_Table(void)
 Symbol(const*) Intern_UTF8_Managed_Core(
     option(void*) preallocated,  // most calls don't know if allocation needed
     const Byte* utf8,
-    size_t size
+    size_t size,
+    option(const uint32_t*) precomputed_hash  // build-time hash for boot syms
 ){
     // The hashing technique used is called "linear probing":
     //
@@ -215,16 +240,29 @@ Symbol(const*) Intern_UTF8_Managed_Core(
     //
     REBLEN num_slots = SER_USED(PG_Symbols_By_Hash);
     if (PG_Num_Symbol_Slots_In_Use > num_slots / 2) {
-        Expand_Word_Table();
+        Expand_Word_Table(num_slots + 1);
         num_slots = SER_USED(PG_Symbols_By_Hash);  // got larger
     }
 
     Symbol(*) *symbols_by_hash = SER_HEAD(Symbol(*), PG_Symbols_By_Hash);
 
+    // %make-boot.r knows all the built-in symbol spellings, so it hashes
+    // them at build time...meaning Startup_Symbols() doesn't have to.  But
+    // its copy of the hash function could drift from the real one, so the
+    // debug build double-checks the answer here.
+    //
+    uint32_t hash;
+    if (precomputed_hash) {
+        hash = *unwrap(precomputed_hash);
+        assert(hash == Hash_Scan_UTF8_Caseless_May_Fail(utf8, size));
+    }
+    else
+        hash = Hash_Scan_UTF8_Caseless_May_Fail(utf8, size);
+
     REBLEN skip; // how many slots to skip when occupied candidates found
     REBLEN slot = First_Hash_Candidate_Slot(
         &skip,
-        Hash_Scan_UTF8_Caseless_May_Fail(utf8, size),
+        hash,
         num_slots
     );
 
@@ -549,7 +587,9 @@ void Startup_Symbols(void)
         Symbol_Strings_Compressed,
         Symbol_Strings_Compressed_Size,
         max,
-        SYM_GZIP
+        SYM_GZIP,
+        nullptr,  // no preset dictionary
+        0
     );
 
     // All words that do not have a SYM_XXX get back VAL_WORD_ID(w) == SYM_0
@@ -572,7 +612,12 @@ void Startup_Symbols(void)
         ++at;
 
         Symbol(*) canon = &PG_Symbol_Canons[id];  // pass as preallocated space
-        Intern_UTF8_Managed_Core(canon, at, size);
+        Intern_UTF8_Managed_Core(
+            canon,
+            at,
+            size,
+            &Symbol_Hashes_Precomputed[cast(REBLEN, id) - 1]  // no SYM_0 entry
+        );
         at += size;
 
         // Symbol series store symbol number in the header's 2nd uint16_t.
@@ -653,3 +698,154 @@ void Shutdown_Interning(void)
     Free_Unmanaged_Series(PG_Symbols_By_Hash);
     PG_Symbols_By_Hash = nullptr;
 }
+
+
+//=//// KEYWORD SETS //////////////////////////////////////////////////////=//
+//
+// Built-in words get dense SYM_XXX integer IDs assigned by %make-boot.r,
+// letting native dialects (PARSE, etc.) dispatch keywords through C switch
+// statements instead of comparing spellings.  Words outside %words.r answer
+// SYM_0, so user dialects historically had no equivalently cheap dispatch.
+//
+// A "keyword set" compiles a dialect's words into the same kind of dense
+// 1-based IDs, in declaration order.  Looking a word up in a set scans the
+// (typically short) declaration for a synonym...but the result is cached on
+// the queried symbol stub itself, in the high 32 bits of the info that are
+// unused on 64-bit platforms: 16 bits tag which set the cache belongs to,
+// 16 bits hold the ID (0 caches a known miss).  A symbol fed repeatedly to
+// the same dialect thus resolves with two masked compares, like SYM_XXX.
+//
+// Set tags are never reused, so stale caches can't produce false hits; if
+// more than 65535 sets are made in one session, later ones simply stop
+// caching (the lookup stays correct, just unaccelerated--as on 32-bit).
+
+struct Reb_Keywords {
+    REBVAL *words;  // frozen BLOCK! (API handle roots the symbols)
+    uint16_t set_tag;  // nonzero cache tag, 0 if caching disabled
+};
+
+static uint32_t PG_Keyword_Set_Tags = 0;  // total tags issued, monotonic
+
+static void cleanup_keywords(const REBVAL *v) {
+    struct Reb_Keywords *kws = VAL_HANDLE_POINTER(struct Reb_Keywords, v);
+    rebRelease(kws->words);
+    FREE(struct Reb_Keywords, kws);
+}
+
+
+//
+//  make-keywords: native [
+//
+//  {Compile a dialect's keyword words into dense integer IDs for dispatch}
+//
+//      return: "Keyword set, for use with KEYWORD-ID"
+//          [handle!]
+//      words "IDs are 1-based declaration order, matched case-insensitively"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(make_keywords)
+{
+    INCLUDE_PARAMS_OF_MAKE_KEYWORDS;
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, ARG(words));
+    REBLEN num = 0;
+    for (; item != tail; ++item, ++num) {
+        if (not ANY_WORD(item))
+            fail (Error_Bad_Value(item));
+
+        Cell(const*) check = VAL_ARRAY_AT(nullptr, ARG(words));
+        for (; check != item; ++check) {
+            if (Are_Synonyms(VAL_WORD_SYMBOL(item), VAL_WORD_SYMBOL(check))) {
+                DECLARE_LOCAL (duplicate);
+                Init_Word(duplicate, VAL_WORD_SYMBOL(item));
+                fail (Error_Dup_Vars_Raw(duplicate));  // IDs would be ambiguous
+            }
+        }
+    }
+
+    if (num > UINT16_MAX)  // IDs (and cache slots) are 16-bit
+        fail ("MAKE-KEYWORDS is limited to 65535 keywords per set");
+
+    struct Reb_Keywords *kws = TRY_ALLOC(struct Reb_Keywords);
+    if (kws == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Keywords)));
+
+    // A frozen copy both defends against mutation invalidating the IDs and
+    // GC-protects the symbols for the lifetime of the set (the handle is an
+    // API reference, hence a root).
+    //
+    kws->words = rebValue("freeze copy", ARG(words));
+
+    if (PG_Keyword_Set_Tags < UINT16_MAX) {
+        ++PG_Keyword_Set_Tags;
+        kws->set_tag = cast(uint16_t, PG_Keyword_Set_Tags);
+    }
+    else
+        kws->set_tag = 0;  // tags exhausted, lookups still work uncached
+
+    return Init_Handle_Cdata_Managed(
+        OUT, kws, sizeof(struct Reb_Keywords), &cleanup_keywords
+    );
+}
+
+
+//
+//  keyword-id: native [
+//
+//  {Get a word's dense integer ID in a keyword set (null if not a keyword)}
+//
+//      return: [<opt> integer!]
+//      keywords "Keyword set made by MAKE-KEYWORDS"
+//          [handle!]
+//      word [any-word!]
+//  ]
+//
+DECLARE_NATIVE(keyword_id)
+{
+    INCLUDE_PARAMS_OF_KEYWORD_ID;
+
+    if (VAL_HANDLE_CLEANER(ARG(keywords)) != &cleanup_keywords)
+        fail (PARAM(keywords));
+
+    struct Reb_Keywords *kws
+        = VAL_HANDLE_POINTER(struct Reb_Keywords, ARG(keywords));
+
+    Symbol(const*) symbol = VAL_WORD_SYMBOL(ARG(word));
+
+  #if HAS_SECOND_UINT32
+    if (kws->set_tag != 0) {
+        uint32_t cache = SECOND_UINT32(symbol->info);
+        if (cache >> 16 == kws->set_tag) {
+            if ((cache & 0xFFFF) == 0)
+                return nullptr;  // cached miss
+            return Init_Integer(OUT, cache & 0xFFFF);
+        }
+    }
+  #endif
+
+    Cell(const*) tail;
+    Cell(const*) item = VAL_ARRAY_AT(&tail, kws->words);
+    REBLEN id = 0;
+    REBLEN n = 1;
+    for (; item != tail; ++item, ++n) {
+        if (Are_Synonyms(symbol, VAL_WORD_SYMBOL(item))) {
+            id = n;
+            break;
+        }
+    }
+
+  #if HAS_SECOND_UINT32
+    if (kws->set_tag != 0) {  // remember answer (even a miss) on the stub
+        SET_SECOND_UINT32(
+            m_cast(Raw_Symbol*, symbol)->info,
+            (cast(uint32_t, kws->set_tag) << 16) | id
+        );
+    }
+  #endif
+
+    if (id == 0)
+        return nullptr;
+    return Init_Integer(OUT, id);
+}
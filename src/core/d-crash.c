@@ -258,10 +258,10 @@ DECLARE_NATIVE(panic)
 //
 //  raise*: native [
 //
-//  {Version of RAISE of definitional error that only takes ERROR!}
+//  {Version of RAISE of definitional error that only takes ERROR! or id}
 //
 //      return: [raised?]
-//      reason [error!]
+//      reason [error! word!]
 //  ]
 //
 DECLARE_NATIVE(raise_p)
@@ -270,6 +270,9 @@ DECLARE_NATIVE(raise_p)
 
     Value(*) v = ARG(reason);
 
+    if (IS_WORD(v))  // id-only failure, no MAKE ERROR! (see Error_User_Id)
+        return RAISE(Error_User_Id(VAL_WORD_SYMBOL(v)));
+
     return Raisify(COPY(v));
 }
 
@@ -84,8 +84,8 @@ void Dump_Info(void)
 
     printf("Evaluator:\n");
     printf("    Cycles:  %ld\n", cast(unsigned long, Total_Eval_Cycles));
-    printf("    Counter: %d\n", cast(int, Eval_Countdown));
-    printf("    Dose:    %d\n", cast(int, Eval_Dose));
+    printf("    Pending: %d\n", cast(int, Eval_Signal_Pending));
+    printf("    Period:  %d\n", cast(int, Eval_Signal_Period));
     printf("    Signals: %lx\n", cast(unsigned long, Eval_Signals));
     printf("    Sigmask: %lx\n", cast(unsigned long, Eval_Sigmask));
     printf("    TOP_INDEX: %ld\n", cast(unsigned long, TOP_INDEX));
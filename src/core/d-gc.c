@@ -295,7 +295,7 @@ void Assert_Cell_Marked_Correctly(Cell(const*) v)
         if (GET_SERIES_FLAG(a, INACCESSIBLE))
             break;
 
-        ASSERT_SERIES_TERM_IF_NEEDED(a);
+        ASSERT_SERIES_TERM_IF_NEEDED(a);  // tolerates COLD_COMPRESSED
 
         assert(Get_Cell_Flag(v, FIRST_IS_NODE));
         assert(Is_Marked(a));
@@ -342,6 +342,11 @@ void Assert_Cell_Marked_Correctly(Cell(const*) v)
             Array(*) a = ARR(VAL_NODE1(v));
             assert(NOT_SERIES_FLAG(a, INACCESSIBLE));
 
+            if (Get_Subclass_Flag(ARRAY, a, COLD_COMPRESSED)) {
+                assert(Is_Marked(a));  // cells deflated, see %m-gc.c
+                break;
+            }
+
             assert(ARR_LEN(a) >= 2);
             Cell(const*) tail = ARR_TAIL(a);
             Cell(const*) item = ARR_HEAD(a);
@@ -413,6 +418,10 @@ void Assert_Cell_Marked_Correctly(Cell(const*) v)
                 or IS_WORD(body)  // GENERIC uses the slot for the "verb"
             );
             assert(ANY_CONTEXT(context));
+
+            Value(*) intrinsic = DETAILS_AT(details, IDX_NATIVE_INTRINSIC);
+            assert(IS_BLANK(intrinsic) or Is_Handle_Cfunc(intrinsic));
+            UNUSED(intrinsic);
         }
 
         // We used to check the [0] slot of the details holds an archetype
@@ -524,14 +533,12 @@ void Assert_Array_Marked_Correctly(Array(const*) a) {
     }
     else if (IS_PAIRLIST(a)) {
         //
-        // There was once a "small map" optimization that wouldn't
-        // produce a hashlist for small maps and just did linear search.
-        // @giuliolunati deleted that for the time being because it
-        // seemed to be a source of bugs, but it may be added again...in
-        // which case the hashlist may be NULL.
+        // Small maps (fewer than MIN_DICT pairs) don't make a hashlist
+        // and are searched linearly, so the hashlist may be NULL.
         //
         REBSER *hashlist = LINK(Hashlist, a);
-        assert(SER_FLAVOR(hashlist) == FLAVOR_HASHLIST);
+        if (hashlist)
+            assert(SER_FLAVOR(hashlist) == FLAVOR_HASHLIST);
         UNUSED(hashlist);
     }
 }
@@ -46,15 +46,13 @@ DECLARE_NATIVE(stats)
 {
     INCLUDE_PARAMS_OF_STATS;
 
-    REBI64 num_evals = Total_Eval_Cycles + Eval_Dose - Eval_Countdown;
-
     if (REF(evals))
-        return Init_Integer(OUT, num_evals);
+        return Init_Integer(OUT, Total_Eval_Cycles);  // counted in all builds
 
     if (REF(profile)) {
       #if DEBUG_COLLECT_STATS
         return rebValue("make object! [",
-            "evals:", rebI(num_evals),
+            "evals:", rebI(Total_Eval_Cycles),
             "series-made:", rebI(PG_Reb_Stats->Series_Made),
             "series-freed:", rebI(PG_Reb_Stats->Series_Freed),
             "series-expanded:", rebI(PG_Reb_Stats->Series_Expanded),
@@ -89,6 +87,600 @@ DECLARE_NATIVE(stats)
 }
 
 
+//
+//  metrics: native [
+//
+//  {Running totals for evaluation and allocation accounting}
+//
+//      return: "Monotonic counters (snapshot before/after and difference)"
+//          [object!]
+//  ]
+//
+DECLARE_NATIVE(metrics)
+//
+// Unlike STATS/PROFILE (debug counters) or MEMORY-TALLY (a windowed report
+// with per-flavor attribution), this is available in every build and cheap
+// enough to call per-invocation: a multi-tenant scheduler snapshots the
+// totals around each script it runs and differences them to bill it.  The
+// same counters back the budgets of WITH-EVAL-BUDGET/TICKS and /MEMORY.
+//
+// EVALS and ALLOCATED only ever go up; MEMORY is the live heap figure that
+// MEMORY-LIMIT polices, and TIMER-TICKS is the coarse monotonic clock the
+// time budgets are measured on (it only advances while something has the
+// signal timer armed).
+//
+// The MAP-PROBE-XXX counters watch hash health: total slots stepped over by
+// MAP! lookups, the longest single probe run, and how many runs passed the
+// alarm length (see Update_Map_Probe_Stats() in %t-map.c).  Hash seeding
+// makes engineered collisions impractical, so a growing alarm count is the
+// signal that some map's keys merit investigation.
+{
+    INCLUDE_PARAMS_OF_METRICS;
+
+    return rebValue("make object! [",
+        "evals:", rebI(Total_Eval_Cycles),
+        "allocated:", rebI(Total_Alloc_Bytes),
+        "memory:", rebI(cast(REBI64, PG_Mem_Usage)),
+        "timer-ticks:", rebI(cast(REBI64, Eval_Timer_Ticks)),
+        "map-probes:", rebI(Total_Map_Probes),
+        "map-probe-longest:", rebI(cast(REBI64, Map_Probe_Longest)),
+        "map-probe-alarms:", rebI(Map_Probe_Alarms),
+    "]");
+}
+
+
+//=//// ALLOCATION ACCOUNTING /////////////////////////////////////////////=//
+//
+// STATS/PROFILE gives coarse totals, and only in builds with the
+// DEBUG_COLLECT_STATS counters compiled in.  When a production job's heap
+// grows to gigabytes, what's wanted is attribution: which series subclasses
+// the stubs and bytes went to, which size pools served them, and how much of
+// each collection's work was churn versus long-lived data.
+//
+// MEMORY-TALLY keeps that accounting in plain counters behind a single
+// pointer test on the allocation paths (see PG_Mem_Tally uses in
+// %sys-series.h and %m-gc.c), so it can be left available in release builds
+// and only costs anything while switched on.  The report keys series
+// counts and bytes by "flavor"--the allocation-side notion of subclass--as
+// the datatype a stub ends up representing isn't knowable at alloc time.
+
+static const char *Flavor_Names[FLAVOR_MAX] = {
+    "array",  // FLAVOR_ARRAY is 0
+    "use",
+    "hitch",
+    "partials",
+    "library",
+    "handle",
+    "feed",
+    "api",
+    "instruction-splice",
+    "pairlist",
+    "varlist",  // also paramlists, see FLAVOR_PARAMLIST
+    "details",
+    "let",
+    "patch",
+    "datastack",
+    "plug",
+    "keylist",
+    "pointer",
+    "canontable",
+    "nodelist",
+    "serieslist",
+    "moldstack",
+    "hashlist",
+    "bookmarklist",
+    "binary",
+    "string",
+    "symbol",
+    "inaccessible",  // FLAVOR_THE_GLOBAL_INACCESSIBLE
+  #if !defined(NDEBUG)
+    "trash",
+  #endif
+};
+
+static REBVAL *Tally_By_Flavor_Block(const REBI64 *counts)
+{
+    StackIndex base = TOP_INDEX;
+
+    REBLEN i;
+    for (i = 0; i < FLAVOR_MAX; ++i) {
+        if (counts[i] == 0)
+            continue;  // only report flavors that actually allocated
+        Init_Word(PUSH(), Intern_UTF8_Managed(
+            cb_cast(Flavor_Names[i]),
+            strsize(Flavor_Names[i])
+        ));
+        Init_Integer(PUSH(), counts[i]);
+    }
+
+    return Init_Block(Alloc_Value(), Pop_Stack_Values(base));
+}
+
+static REBVAL *Tally_By_Pool_Block(const REBI64 *counts)
+{
+    StackIndex base = TOP_INDEX;
+
+    // Only the small-size pools and the SYSTEM_POOL fallback serve series
+    // data (see Pool_Id_For_Size()).  Pool IDs are an implementation detail,
+    // so key the counts by the pool's unit size, which is what a reader
+    // comparing against series widths actually wants.
+    //
+    REBLEN id;
+    for (id = 0; id < MAX_POOLS; ++id) {
+        if (counts[id] == 0)
+            continue;
+        if (id == SYSTEM_POOL)
+            Init_Word(PUSH(), Canon(SYSTEM));
+        else
+            Init_Integer(PUSH(), Mem_Pools[id].wide);
+        Init_Integer(PUSH(), counts[id]);
+    }
+
+    return Init_Block(Alloc_Value(), Pop_Stack_Values(base));
+}
+
+
+//
+//  memory-tally: native [
+//
+//  {Low-overhead allocation accounting, to attribute heap use to its makers}
+//
+//      return: "Tally object when stopping, otherwise none"
+//          [<opt> object!]
+//      'instruction "ON to begin, RESET to zero the counters, OFF to stop"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(memory_tally)
+//
+// Typical usage:
+//
+//     memory-tally on
+//     ...workload...
+//     probe memory-tally off
+//
+// The survival counters give churn vs. retention: a window whose sweeps see
+// high stubs-swept relative to stubs-survived is burning allocation rate,
+// while the reverse means the heap growth is long-lived data.
+{
+    INCLUDE_PARAMS_OF_MEMORY_TALLY;
+
+    switch (VAL_WORD_ID(ARG(instruction))) {
+      case SYM_ON: {
+        if (PG_Mem_Tally)
+            fail ("MEMORY-TALLY ON while tallying is already on");
+
+        REB_MEM_TALLY *tally = TRY_ALLOC(REB_MEM_TALLY);
+        if (not tally)
+            fail (Error_No_Memory(sizeof(REB_MEM_TALLY)));
+        memset(tally, 0, sizeof(REB_MEM_TALLY));
+
+        PG_Mem_Tally = tally;  // allocation paths start counting
+        return NONE; }
+
+      case SYM_RESET:
+        if (not PG_Mem_Tally)
+            fail ("MEMORY-TALLY RESET while tallying was not on");
+
+        memset(PG_Mem_Tally, 0, sizeof(REB_MEM_TALLY));
+        return NONE;
+
+      case SYM_OFF: {
+        if (not PG_Mem_Tally)
+            fail ("MEMORY-TALLY OFF while tallying was not on");
+
+        REB_MEM_TALLY *tally = PG_Mem_Tally;
+        PG_Mem_Tally = nullptr;  // don't count the report's own allocations
+
+        REBVAL *report = rebValue("make object! [",
+            "series-made:", rebR(Tally_By_Flavor_Block(tally->Series_Made)),
+            "series-bytes:", rebR(Tally_By_Flavor_Block(tally->Series_Bytes)),
+            "data-allocs:", rebR(Tally_By_Pool_Block(tally->Data_Allocs)),
+            "recycles:", rebI(tally->Recycles),
+            "stubs-swept:", rebI(tally->Stubs_Swept),
+            "stubs-survived:", rebI(tally->Stubs_Survived),
+        "]");
+
+        FREE(REB_MEM_TALLY, tally);
+        return report; }
+
+      default:
+        fail ("MEMORY-TALLY supports the instructions ON, RESET, and OFF");
+    }
+}
+
+
+//=//// SAMPLING PROFILER /////////////////////////////////////////////////=//
+//
+// %d-trace.c instruments every evaluator step, which is far too slow to
+// leave enabled on production scripts.  The sampling profiler takes the
+// opposite approach: while it is on, the signal checkpoint in
+// Do_Signals_Throws()--which the periodic timer already triggers every
+// Eval_Signal_Period msec--walks the frame stack and tallies what was
+// running.  The result is "collapsed stack" text (`caller;callee count`
+// lines) that flamegraph tooling can consume directly:
+//
+//     https://github.com/brendangregg/FlameGraph
+//
+// The timer only raises a flag: the frame stack is walked at the next
+// evaluator checkpoint, where it is coherent--so there are none of the
+// async-signal-safety concerns a SIGPROF-style profiler has.  The tradeoff
+// is that a native which blocks in C for a long while is still only one
+// sample, since no checkpoints happen until it returns to the trampoline.
+//
+// Consecutive identical samples (the common case in a hot loop) are
+// run-length compressed before being flushed to the output buffer.
+
+#define PROFILE_MAX_DEPTH  256  // deeper stacks get truncated at the root
+
+static void Flush_Profile_Pending(void)
+{
+    if (TG_Profile_Pending_Count == 0)
+        return;
+
+    Append_Utf8(
+        TG_Profile_Buffer,
+        cs_cast(STR_HEAD(TG_Profile_Pending)),
+        STR_SIZE(TG_Profile_Pending)
+    );
+    Append_Codepoint(TG_Profile_Buffer, ' ');
+    Append_Int(TG_Profile_Buffer, TG_Profile_Pending_Count);
+    Append_Codepoint(TG_Profile_Buffer, '\n');
+
+    TG_Profile_Pending_Count = 0;
+}
+
+
+//
+//  Sample_Profile_Stack: C
+//
+// Snapshot the labels of the currently running action frames, innermost
+// last, as one collapsed-stack sample.  Called from Do_Signals_Throws()
+// while TG_Profile_Sampling is on.
+//
+void Sample_Profile_Stack(Frame(*) f)
+{
+    option(Symbol(const*)) labels[PROFILE_MAX_DEPTH];  // innermost first
+    REBLEN depth = 0;
+
+    for (; f != BOTTOM_FRAME; f = f->prior) {
+        if (not Is_Action_Frame(f) or Is_Action_Frame_Fulfilling(f))
+            continue;  // same notion of "running" as backtrace uses
+        if (depth == PROFILE_MAX_DEPTH)
+            break;  // truncate at the root; innermost frames matter most
+        labels[depth] = f->label;
+        ++depth;
+    }
+
+    String(*) scratch = TG_Profile_Scratch;
+    TERM_STR_LEN_SIZE(scratch, 0, 0);
+
+    if (depth == 0)
+        Append_Ascii(scratch, "(top-level)");
+
+    while (depth != 0) {  // emit root first, as flamegraphs expect
+        --depth;
+        if (labels[depth])
+            Append_Spelling(scratch, unwrap(labels[depth]));
+        else
+            Append_Ascii(scratch, "(anonymous)");
+        if (depth != 0)
+            Append_Codepoint(scratch, ';');
+    }
+
+    if (
+        TG_Profile_Pending_Count != 0
+        and STR_SIZE(scratch) == STR_SIZE(TG_Profile_Pending)
+        and 0 == memcmp(
+            STR_HEAD(scratch),
+            STR_HEAD(TG_Profile_Pending),
+            STR_SIZE(scratch)
+        )
+    ){
+        ++TG_Profile_Pending_Count;  // run-length identical samples
+        return;
+    }
+
+    Flush_Profile_Pending();
+
+    TG_Profile_Scratch = TG_Profile_Pending;  // swap roles for next sample
+    TG_Profile_Pending = scratch;
+    TG_Profile_Pending_Count = 1;
+}
+
+
+//
+//  profile: native [
+//
+//  {Control the sampling profiler, producing flamegraph-compatible output}
+//
+//      return: "Collapsed-stack text when stopping, otherwise none"
+//          [<opt> text!]
+//      'instruction "ON to begin sampling, OFF to stop and return results"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(profile)
+//
+// Typical usage:
+//
+//     profile on
+//     ...workload...
+//     write %out.folded profile off
+//
+// Then e.g. `flamegraph.pl out.folded > out.svg`.
+{
+    INCLUDE_PARAMS_OF_PROFILE;
+
+    switch (VAL_WORD_ID(ARG(instruction))) {
+      case SYM_ON:
+        if (TG_Profile_Sampling)
+            fail ("PROFILE ON while sampling is already on");
+
+        TERM_STR_LEN_SIZE(TG_Profile_Buffer, 0, 0);
+        TG_Profile_Pending_Count = 0;
+        TG_Profile_Sampling = true;
+        Update_Signal_Timer_Demand();  // sampling needs the periodic callout
+        return NONE;
+
+      case SYM_OFF: {
+        if (not TG_Profile_Sampling)
+            fail ("PROFILE OFF while sampling was not on");
+
+        TG_Profile_Sampling = false;
+        Update_Signal_Timer_Demand();
+        Flush_Profile_Pending();
+
+        String(*) copy = Make_String(STR_SIZE(TG_Profile_Buffer));
+        Append_Utf8(
+            copy,
+            cs_cast(STR_HEAD(TG_Profile_Buffer)),
+            STR_SIZE(TG_Profile_Buffer)
+        );
+        return Init_Text(OUT, copy); }
+
+      default:
+        fail ("Currently PROFILE only supports ON and OFF");
+    }
+}
+
+
+//=//// PARSE GRAMMAR PROFILER ////////////////////////////////////////////=//
+//
+// The sampling profiler above attributes time to *actions*, but a slow PARSE
+// spends nearly all its time inside the one SUBPARSE native--so a grammar
+// hotspot (like an accidentally quadratic rule) is invisible to it.  While
+// PARSE-PROFILE is on, Subparse_Throws() and the alternate-rule handling in
+// %u-parse.c count entries, matches, misses, and backtracks per rule block,
+// keyed by the rule array's identity.
+//
+// A rule block's array could be garbage collected while the profile is
+// still running, so rows never dereference their key after capture: a label
+// excerpt (any file/line info plus a molded prefix of the rules) is copied
+// out when the block is first seen.  If an address were reused by a new rule
+// block, its counts would merge with the dead one's--tolerable for a
+// profiler, and avoiding it would mean interfering with GC.
+
+#define PARSE_TALLY_LABEL_LIMIT  60  // codepoints of rule excerpt to keep
+
+//
+//  Tally_Parse_Rule: C
+//
+// Find the counter row for a rule block, adding one (and capturing its
+// label) the first time the block is seen.  Only call while profiling is
+// on.  The returned pointer is good until the next call--the table moves
+// when it grows, so hold onto an index across recursions, not a pointer.
+//
+REB_PARSE_TALLY *Tally_Parse_Rule(Array(const*) rules)
+{
+    assert(TG_Parse_Profiling);
+
+    REBLEN i;
+    for (i = 0; i < TG_Parse_Tallies_Used; ++i)
+        if (TG_Parse_Tallies[i].rules == rules)
+            return &TG_Parse_Tallies[i];
+
+    if (TG_Parse_Tallies_Used == TG_Parse_Tallies_Capacity) {
+        REBLEN capacity = TG_Parse_Tallies_Capacity * 2;
+        REB_PARSE_TALLY *table = TRY_ALLOC_N(REB_PARSE_TALLY, capacity);
+        if (not table)
+            fail (Error_No_Memory(capacity * sizeof(REB_PARSE_TALLY)));
+        memcpy(
+            table,
+            TG_Parse_Tallies,
+            TG_Parse_Tallies_Used * sizeof(REB_PARSE_TALLY)
+        );
+        FREE_N(
+            REB_PARSE_TALLY, TG_Parse_Tallies_Capacity, TG_Parse_Tallies
+        );
+        TG_Parse_Tallies = table;
+        TG_Parse_Tallies_Capacity = capacity;
+    }
+
+    DECLARE_MOLD (mo);
+    SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
+    mo->limit = PARSE_TALLY_LABEL_LIMIT;
+    Push_Mold(mo);
+
+    if (Get_Subclass_Flag(ARRAY, rules, HAS_FILE_LINE_UNMASKED)) {
+        Append_Spelling(mo->series, LINK(Filename, rules));
+        Append_Codepoint(mo->series, ':');
+        Append_Int(mo->series, Array_Line(rules));
+        Append_Codepoint(mo->series, ' ');
+    }
+
+    DECLARE_LOCAL (temp);
+    Init_Block(temp, m_cast(Array(*), rules));
+    Mold_Value(mo, temp);
+
+    Throttle_Mold(mo);  // apply the limit (normally Pop_Molded_*'s job)
+
+    Size size = STR_SIZE(mo->series) - mo->base.size;
+    char *label = TRY_ALLOC_N(char, size + 1);
+    if (not label)
+        fail (Error_No_Memory(size + 1));
+    memcpy(label, BIN_AT(mo->series, mo->base.size), size);
+    label[size] = '\0';
+
+    Drop_Mold(mo);
+
+    REB_PARSE_TALLY *tally = &TG_Parse_Tallies[TG_Parse_Tallies_Used];
+    ++TG_Parse_Tallies_Used;
+
+    tally->rules = rules;
+    tally->label = label;
+    tally->entries = 0;
+    tally->matches = 0;
+    tally->misses = 0;
+    tally->backtracks = 0;
+    return tally;
+}
+
+
+// qsort comparator ranking rows by how often they were entered, so the
+// rules doing the most work (and most backtracking) report first.
+//
+static int Compare_Parse_Tallies(const void *p1, const void *p2)
+{
+    const REB_PARSE_TALLY *t1 = cast(const REB_PARSE_TALLY*, p1);
+    const REB_PARSE_TALLY *t2 = cast(const REB_PARSE_TALLY*, p2);
+
+    if (t1->entries != t2->entries)
+        return t1->entries > t2->entries ? -1 : 1;
+    if (t1->backtracks != t2->backtracks)
+        return t1->backtracks > t2->backtracks ? -1 : 1;
+    return 0;
+}
+
+
+//
+//  parse-profile: native [
+//
+//  {Count per-rule-block PARSE activity, to find grammar hotspots}
+//
+//      return: "Ranked report when stopping, otherwise none"
+//          [<opt> block!]
+//      'instruction "ON to begin counting, OFF to stop and report"
+//          [word!]
+//  ]
+//
+DECLARE_NATIVE(parse_profile)
+//
+// Typical usage:
+//
+//     parse-profile on
+//     parse big-input my-rules
+//     probe parse-profile off
+//
+// The report is a block of objects, one per distinct rule block, ranked by
+// entry count: [rule entries matches misses backtracks].  A quadratic
+// grammar shows up as a rule whose entries dwarf the input's size.
+{
+    INCLUDE_PARAMS_OF_PARSE_PROFILE;
+
+    switch (VAL_WORD_ID(ARG(instruction))) {
+      case SYM_ON: {
+        if (TG_Parse_Profiling)
+            fail ("PARSE-PROFILE ON while profiling is already on");
+
+        REBLEN capacity = 64;
+        TG_Parse_Tallies = TRY_ALLOC_N(REB_PARSE_TALLY, capacity);
+        if (not TG_Parse_Tallies)
+            fail (Error_No_Memory(capacity * sizeof(REB_PARSE_TALLY)));
+        TG_Parse_Tallies_Used = 0;
+        TG_Parse_Tallies_Capacity = capacity;
+
+        TG_Parse_Profiling = true;  // Subparse_Throws() starts counting
+        return NONE; }
+
+      case SYM_OFF: {
+        if (not TG_Parse_Profiling)
+            fail ("PARSE-PROFILE OFF while profiling was not on");
+
+        TG_Parse_Profiling = false;  // stop counting before reporting
+
+        qsort(
+            TG_Parse_Tallies,
+            TG_Parse_Tallies_Used,
+            sizeof(REB_PARSE_TALLY),
+            &Compare_Parse_Tallies
+        );
+
+        StackIndex base = TOP_INDEX;
+
+        REBLEN i;
+        for (i = 0; i < TG_Parse_Tallies_Used; ++i) {
+            REB_PARSE_TALLY *tally = &TG_Parse_Tallies[i];
+            REBVAL *row = rebValue("make object! [",
+                "rule:", rebT(tally->label),
+                "entries:", rebI(tally->entries),
+                "matches:", rebI(tally->matches),
+                "misses:", rebI(tally->misses),
+                "backtracks:", rebI(tally->backtracks),
+            "]");
+            Copy_Cell(PUSH(), row);
+            rebRelease(row);
+
+            FREE_N(char, strsize(tally->label) + 1, tally->label);
+        }
+
+        FREE_N(
+            REB_PARSE_TALLY, TG_Parse_Tallies_Capacity, TG_Parse_Tallies
+        );
+        TG_Parse_Tallies = nullptr;
+        TG_Parse_Tallies_Used = 0;
+        TG_Parse_Tallies_Capacity = 0;
+
+        return Init_Block(OUT, Pop_Stack_Values(base)); }
+
+      default:
+        fail ("Currently PARSE-PROFILE only supports ON and OFF");
+    }
+}
+
+
+//
+//  Startup_Profiler: C
+//
+void Startup_Profiler(void)
+{
+    TG_Profile_Sampling = false;
+    TG_Profile_Pending_Count = 0;
+    TG_Profile_Buffer = Make_String_Core(1000, SERIES_FLAG_DYNAMIC);
+    TG_Profile_Pending = Make_String_Core(100, SERIES_FLAG_DYNAMIC);
+    TG_Profile_Scratch = Make_String_Core(100, SERIES_FLAG_DYNAMIC);
+}
+
+
+//
+//  Shutdown_Profiler: C
+//
+void Shutdown_Profiler(void)
+{
+    if (TG_Parse_Tallies) {  // PARSE-PROFILE was left on, free its table
+        TG_Parse_Profiling = false;
+        REBLEN i;
+        for (i = 0; i < TG_Parse_Tallies_Used; ++i) {
+            char *label = TG_Parse_Tallies[i].label;
+            FREE_N(char, strsize(label) + 1, label);
+        }
+        FREE_N(
+            REB_PARSE_TALLY, TG_Parse_Tallies_Capacity, TG_Parse_Tallies
+        );
+        TG_Parse_Tallies = nullptr;
+        TG_Parse_Tallies_Used = 0;
+        TG_Parse_Tallies_Capacity = 0;
+    }
+
+    Free_Unmanaged_Series(TG_Profile_Scratch);
+    TG_Profile_Scratch = nullptr;
+    Free_Unmanaged_Series(TG_Profile_Pending);
+    TG_Profile_Pending = nullptr;
+    Free_Unmanaged_Series(TG_Profile_Buffer);
+    TG_Profile_Buffer = nullptr;
+}
+
+
 #if defined(INCLUDE_CALLGRIND_NATIVE)
     #include <valgrind/callgrind.h>
 #endif
@@ -171,6 +171,60 @@ Bounce Proxy_Multi_Returns_Core(Frame(*) f, Value(*) v)
 }
 
 
+// Delegation is a promise from a dispatcher that it wants no further
+// callbacks--the delegated frame's result becomes the action's result.  So
+// the delegating action's arguments and locals are dead weight the whole
+// time the delegate runs.  Dialect processors routinely delegate many levels
+// deep, and if every level held onto its argument data then memory use would
+// be bounded by the total delegation count instead of the active depth.
+//
+// The data can only be freed if nothing can see the variables:
+//
+// * Any cell referencing the varlist would have forced it to be managed (see
+//   INIT_BINDING_MAY_MANAGE), so an unmanaged varlist has no FRAME! values
+//   or specifically-bound words pointing at it.  (This covers VARARGS! as
+//   well--making a frame visible that way manages the varlist.)
+//
+// * But dispatchers can delegate a relative body with SPC(f->varlist) as the
+//   branch specifier without managing it (e.g. Does_Dispatcher()).  The
+//   delegate then resolves relative values through its feed's specifier
+//   chain...so walk that chain, which bottoms out on nullptr or a varlist.
+//
+// When the varlist does qualify, Decay_Series() frees the data and leaves an
+// inaccessible stub with the rootvar tucked into the node--the same state
+// Encloser_Dispatcher() leaves behind when it gives the variables away, which
+// the GC, Drop_Action(), and the after-action checks already know to skip.
+//
+static void Reclaim_Delegating_Frame_Storage(Frame(*) f)
+{
+    assert(Get_Executor_Flag(ACTION, f, DELEGATE_CONTROL));
+
+    if (GET_SERIES_FLAG(f->varlist, MANAGED))
+        return;  // outstanding references may exist
+
+    if (Get_Executor_Flag(ACTION, f, DISPATCHER_CATCHES))
+        return;  // dispatcher gets reentered on throw, may look at args
+
+    if (Get_Frame_Flag(f, NOTIFY_ON_ABRUPT_FAILURE))
+        return;  // ...same, via the abrupt failure notification
+
+    if (f == TOP_FRAME)
+        return;  // delegation resolved without pushing a frame
+
+    REBSPC *specifier = FEED_SPECIFIER(TOP_FRAME->feed);
+    for (; specifier != SPECIFIED; specifier = NextVirtual(specifier)) {
+        if (specifier == f->varlist)
+            return;  // delegate reads our args through its specifier
+        if (IS_VARLIST(specifier))
+            break;  // chain bottomed out on some other frame
+    }
+
+    Decay_Series(f->varlist);  // preserves rootvar in the stub's fixed cell
+    CLEAR_SERIES_FLAG(f->varlist, DYNAMIC);  // "freed stub" convention
+    f->rootvar = cast(REBVAL*, &f->varlist->content.fixed);
+}
+
+
 //
 //  Action_Executor: C
 //
@@ -226,6 +280,15 @@ Bounce Action_Executor(Frame(*) f)
           case ST_ACTION_TYPECHECKING:
             goto typecheck_then_dispatch;
 
+          case ST_ACTION_PRECHECKED:
+            //
+            // RUN-FRAME armed this frame: a previous invocation already did
+            // the typechecking walk, and the caller promises only argument
+            // cells of vetted types were overwritten since.
+            //
+            FRESHEN(OUT);  // typecheck_then_dispatch would have done this
+            goto dispatch;
+
           default:
             assert(false);
         }
@@ -246,6 +309,51 @@ Bounce Action_Executor(Frame(*) f)
 
     assert(STATE != ST_ACTION_DOING_PICKUPS);
 
+    // Each pushed refinement (or reordering) names a parameter that the walk
+    // below has to recognize when it reaches it.  Resolve them all to their
+    // parameter indices up front--one hashed keylist lookup apiece--so the
+    // per-parameter override check compares indices instead of matching every
+    // pushed symbol against every key.  (The keylist's hash index is built
+    // lazily and shared, see Find_Exact_Symbol_In_Keylist(); heavily-refined
+    // calls like APPEND/PART/DUP thus resolve in time independent of how
+    // many parameters the action has.)
+    //
+    // A refinement matching no unspecialized parameter is left unbound, and
+    // the pickup phase reports it as a bad parameter just as it always has.
+    // The lower of two duplicates is also left unbound, so the topmost one
+    // wins--the same outcome the walk's topmost-first scan produced.
+    //
+    if (TOP_INDEX != BASELINE->stack_base) {
+        Keylist(*) keylist = ACT_KEYLIST(ORIGINAL);
+        StackValue(*) ordered = TOP;
+        StackValue(*) lowest_ordered = Data_Stack_At(BASELINE->stack_base);
+        for (; ordered != lowest_ordered; --ordered) {
+            assert(Is_Pushed_Refinement(ordered));
+            Symbol(const*) symbol = VAL_WORD_SYMBOL(ordered);
+
+            REBLEN n = 0;
+            while (
+                (n = Find_Exact_Symbol_In_Keylist(keylist, symbol, n)) != 0
+            ){
+                if (not Is_Specialized(PARAM + n - 1))
+                    break;  // locals/specializations invisible to callsites
+            }
+            if (n == 0)
+                continue;  // not a parameter; pickups error on it
+
+            StackValue(*) above = TOP;
+            for (; above != ordered; --above) {
+                if (IS_WORD_BOUND(above) and VAL_WORD_INDEX(above) == n)
+                    break;  // duplicate; the one pushed later claimed it
+            }
+            if (above != ordered)
+                continue;
+
+            INIT_VAL_WORD_BINDING(ordered, f->varlist);
+            INIT_VAL_WORD_INDEX(ordered, n);
+        }
+    }
+
     for (; KEY != KEY_TAIL; ++KEY, ++ARG, ++PARAM) {
 
   //=//// CONTINUES (AT TOP SO GOTOS DO NOT CROSS INITIALIZATIONS /////////=//
@@ -270,6 +378,60 @@ Bounce Action_Executor(Frame(*) f)
 
       fulfill_loop_body:
 
+  //=//// FAST PATH FOR SIMPLE POSITIONAL PARAMETERS //////////////////////=//
+
+        // Most actions--and nearly all natives--take only plain evaluated
+        // positional arguments: no quoting conventions, no refinements, no
+        // variadics.  Make_Action() caches that as DETAILS_FLAG_SIMPLE_ARGS,
+        // letting fulfillment skip the refinement reordering scan and the
+        // parameter convention switch for every argument of every call.
+        //
+        // The flag can't help if refinements were (erroneously) pushed at
+        // the callsite--fall through and let the pickup logic error--nor
+        // while an enfix left-hand argument is still waiting in OUT.
+        //
+        if (
+            Get_Action_Flag(ORIGINAL, SIMPLE_ARGS)
+            and TOP_INDEX == BASELINE->stack_base
+            and STATE != ST_ACTION_FULFILLING_ENFIX_FROM_OUT
+        ){
+            if (Is_Specialized(PARAM)) {  // specialized includes local
+                Copy_Cell(ARG, PARAM);
+                goto continue_fulfilling;
+            }
+
+            if (
+                VAL_PARAM_CLASS(PARAM) == PARAM_CLASS_RETURN
+                or VAL_PARAM_CLASS(PARAM) == PARAM_CLASS_OUTPUT
+            ){
+                Finalize_None(ARG);  // filled in by the dispatcher
+                goto continue_fulfilling;
+            }
+
+            assert(VAL_PARAM_CLASS(PARAM) == PARAM_CLASS_NORMAL);
+
+            if (Not_Executor_Flag(ACTION, f, RUNNING_ENFIX))
+                Clear_Feed_Flag(f->feed, NO_LOOKAHEAD);
+
+            if (Get_Feed_Flag(f->feed, DEFERRING_ENFIX))
+                fail (Error_Ambiguous_Infix_Raw());
+
+            if (Is_Frame_At_End(f)) {
+                Init_Word_Isotope(ARG, Canon(END));
+                goto continue_fulfilling;
+            }
+
+            Flags flags = EVAL_EXECUTOR_FLAG_FULFILLING_ARG;
+            if (Did_Init_Inert_Optimize_Complete(ARG, f->feed, &flags)) {
+                Clear_Feed_Flag(f->feed, NO_LOOKAHEAD);
+                goto continue_fulfilling;
+            }
+
+            Frame(*) subframe = Make_Frame(f->feed, flags);
+            Push_Frame(ARG, subframe);
+            return CATCH_CONTINUE_SUBFRAME(subframe);
+        }
+
   //=//// SPECIALIZED ARGUMENTS ////////////////////////////////////////////=//
 
         // Parameters that are specialized (which includes locals, that are
@@ -307,27 +469,30 @@ Bounce Action_Executor(Frame(*) f)
         // use refinements for optional parameters, Ren-C leverages the same
         // two-pass mechanism to implement the reordering of non-optional
         // parameters at the callsite.
+        //
+        // The pushed refinements were already bound to their parameter
+        // indices before the walk started, so overriding is an integer
+        // compare here (unbound ones match nothing, and get reported as bad
+        // parameters when the pickups reach them).
 
         if (TOP_INDEX != BASELINE->stack_base) {  // reorderings/refinements
             StackValue(*) ordered = TOP;
             StackValue(*) lowest_ordered = Data_Stack_At(BASELINE->stack_base);
-            Symbol(const*) param_symbol = KEY_SYMBOL(KEY);
+            REBLEN here = (ARG - FRM_ARGS_HEAD(f)) + 1;  // this param, 1-based
 
             for (; ordered != lowest_ordered; --ordered) {
                 assert(Is_Pushed_Refinement(ordered));
 
-                if (VAL_WORD_SYMBOL(ordered) != param_symbol)
+                if (not IS_WORD_BOUND(ordered))
+                    continue;
+                if (VAL_WORD_INDEX(ordered) != here)
                     continue;
-
-                REBLEN offset = ARG - FRM_ARGS_HEAD(f);
-                INIT_VAL_WORD_BINDING(ordered, f->varlist);
-                INIT_VAL_WORD_INDEX(ordered, offset + 1);
 
                 if (Is_Parameter_Unconstrained(PARAM)) {
                     //
                     // There's no argument, so we won't need to come back
-                    // for this one.  But we did need to set its index
-                    // so we knew it was valid (errors later if not set).
+                    // for this one.  Its index being set is what marked it
+                    // as valid (errors later if not set).
                     //
                     Init_Blackhole(ARG);  // # means refinement used
                     goto continue_fulfilling;
@@ -964,6 +1129,11 @@ Bounce Action_Executor(Frame(*) f)
   // 3. Resetting the spare cell here has a slight cost, but stops leaks of
   //    internal processing to actions.  It means that any attempts to read
   //    the spare cell will give an assert.
+  //
+  // 4. Leaf natives (see CELL_FLAG_LEAF_NATIVE) promise not to run arbitrary
+  //    code--no evaluation, no continuations, no variable writes.  So the
+  //    feed's lookahead variable cache stays good across the call, saving a
+  //    re-fetch of the next word after thin calls like comparisons.
 
     assert(Not_Executor_Flag(ACTION, f, IN_DISPATCH));
     Set_Executor_Flag(ACTION, f, IN_DISPATCH);
@@ -996,7 +1166,8 @@ Bounce Action_Executor(Frame(*) f)
     FRESHEN(SPARE);  // tiny cost (one bit clear) but worth it, see [3]
     STATE = STATE_0;  // reset to zero for each phase
 
-    f_next_gotten = nullptr;  // arbitrary code changes fetched variables
+    if (not Is_Action_Leaf(FRM_PHASE(f)))  // leaves can't change them, see [4]
+        f_next_gotten = nullptr;  // arbitrary code changes fetched variables
 
 } dispatch_phase: {  /////////////////////////////////////////////////////////
 
@@ -1015,6 +1186,10 @@ Bounce Action_Executor(Frame(*) f)
   //    !!! Once the IS_NATIVE flag was the same as the HOLD info bit, but
   //    that trick got shaken up with flag reordering.  Review.
   //
+  //    Leaf natives never give usermode code a chance to look at the frame
+  //    while the C is running, so they skip the hold (and its clear in
+  //    Drop_Action() becomes a no-op write).  See CELL_FLAG_LEAF_NATIVE.
+  //
   // 3. The stale bit is set on the output before we run the dispatcher.  We
   //    check to make sure it's not stale at the end--because that could often
   //    mean the function forgot to write the output cell on some code path.
@@ -1027,7 +1202,7 @@ Bounce Action_Executor(Frame(*) f)
     Action(*) phase = FRM_PHASE(f);
 
     /*STATIC_ASSERT(DETAILS_FLAG_IS_NATIVE == SERIES_INFO_HOLD);*/
-    if (Is_Action_Native(phase))
+    if (Is_Action_Native(phase) and not Is_Action_Leaf(phase))
         SER_INFO(f->varlist) |= SERIES_INFO_HOLD;  // prevents crashes, see [2]
 
     Dispatcher* dispatcher = ACT_DISPATCHER(phase);
@@ -1055,6 +1230,7 @@ Bounce Action_Executor(Frame(*) f)
       case C_DELEGATION:
         Set_Executor_Flag(ACTION, FRAME, DELEGATE_CONTROL);
         STATE = DELEGATE_255;  // the trampoline does this when delegating
+        Reclaim_Delegating_Frame_Storage(f);  // args dead if no references
         return BOUNCE_CONTINUE;
 
       case C_SUSPEND:
@@ -1160,6 +1336,7 @@ Bounce Action_Executor(Frame(*) f)
     if (IS_ACTION(label)) {
         if (
             VAL_ACTION(label) == VAL_ACTION(Lib(REDO))  // REDO, see [1]
+            and NOT_SERIES_FLAG(f->varlist, INACCESSIBLE)  // decayed? no CTX()
             and VAL_ACTION_BINDING(label) == CTX(f->varlist)
         ){
             CATCH_THROWN(OUT, frame_);
@@ -1322,6 +1499,9 @@ void Begin_Action_Core(
 
     ORIGINAL = FRM_PHASE(f);
 
+    if (PG_Counting_Actions)  // see PROFILE-ACTIONS
+        Count_Action_Invocation(ORIGINAL);
+
     KEY = ACT_KEYS(&KEY_TAIL, ORIGINAL);
     PARAM = ACT_PARAMS_HEAD(ORIGINAL);
     ARG = f->rootvar + 1;
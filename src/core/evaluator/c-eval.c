@@ -56,6 +56,8 @@
 
 #include "sys-core.h"
 
+#include "sys-int-funcs.h"  // enfix arithmetic fast path, overflow-checked
+
 
 // The frame contains a "feed" whose ->value typically represents a "current"
 // step in the feed.  But the evaluator is organized in a way that the
@@ -81,6 +83,21 @@
 #define kind_current VAL_TYPE_UNCHECKED(f_current)
 
 
+// The main switch compiles to a jump table, but the compiler still emits a
+// range check before the indirect branch.  When EVALUATOR_COMPUTED_GOTO is
+// enabled (GCC/Clang "labels as values") the dispatch instead goes through a
+// table of label addresses built on first use--see the code ahead of the
+// switch.  The evalcase() macro plants a label at the head of each case it
+// wraps so the table has somewhere to jump; in the plain build it is just
+// the case label and the switch behaves as it always has.
+//
+#if EVALUATOR_COMPUTED_GOTO
+    #define evalcase(t)  case t: eval_label_##t
+#else
+    #define evalcase(t)  case t
+#endif
+
+
 #define frame_ f  // for OUT, SPARE, STATE macros
 
 #define SCRATCH cast(Value(*), &(f->u.eval.scratch))
@@ -216,6 +233,42 @@ inline static Frame(*) Maybe_Rightward_Continuation_Needed(Frame(*) f)
 }
 
 
+// The result of an inert value's evaluation step is just the value, and an
+// array executor overwrites that result with the next step's unless it is
+// void.  So in a run of inert values all but the last are dead--each can be
+// skipped without a trampoline bounce, as long as looking ahead proves the
+// kept material behaves the same.  An item may be skipped when its successor
+// is inert (that step will overwrite the output) and the cell after that is
+// also inert, a comma, or the end.  The last condition matters: if the cell
+// two ahead could be an enfix function, it might consume the successor and
+// vanish (e.g. return NIHIL), in which case the output must still hold the
+// prior step's value.  The feed's cursor cache provides the lookahead.
+//
+static void Skip_Dead_Inert_Feed_Items(Feed(*) feed)
+{
+    if (Get_Feed_Flag(feed, NEEDS_SYNC))
+        return;  // fresh variadic, (feed)->p is not a cell pointer yet
+
+    while (Not_Feed_At_End(feed) and ANY_INERT(At_Feed(feed))) {
+        Cell(const*) next = feed->cursor;  // successor, see %sys-rebfed.h
+        if (next == nullptr or next == feed->cursor_tail)
+            break;  // splice or pending pointers can't be seen through
+        if (not ANY_INERT(next))
+            break;  // successor's step may not overwrite the output
+        Cell(const*) after = next + 1;
+        if (after == feed->cursor_tail) {
+            if (FEED_SPLICE(feed) != nullptr)
+                break;  // true successor is in an outer splice level
+        }
+        else if (not ANY_INERT(after) and not IS_COMMA(after))
+            break;  // could be enfix, might vanish the successor's step
+        Fetch_Next_In_Feed(feed);
+
+        Clear_Feed_Flag(feed, NO_LOOKAHEAD);  // elided step would have
+    }
+}
+
+
 //
 //  Array_Executor: C
 //
@@ -252,6 +305,8 @@ Bounce Array_Executor(Frame(*) f)
     if (Is_Feed_At_End(f->feed))
         return OUT;
 
+    Skip_Dead_Inert_Feed_Items(f->feed);  // lookahead never consumes the last
+
     Frame(*) sub = Make_Frame(
         f->feed,
         FRAME_FLAG_FAILURE_RESULT_OK
@@ -266,6 +321,8 @@ Bounce Array_Executor(Frame(*) f)
     if (not Is_Nihil(SPARE))  // heed ELIDE or COMMENT, preserve old result
         Move_Cell(OUT, SPARE);
 
+    Skip_Dead_Inert_Feed_Items(SUBFRAME->feed);
+
     if (Not_Frame_At_End(SUBFRAME)) {
         if (Is_Raised(OUT))  // promote errors to failure on step, see [1]
             fail (VAL_CONTEXT(OUT));
@@ -556,6 +613,97 @@ Bounce Evaluator_Executor(Frame(*) f)
 
     assert(Is_Fresh(OUT));  // except see [1]
 
+  #if EVALUATOR_COMPUTED_GOTO
+  blockscope {
+    //
+    // A table of label addresses lets the dispatch branch straight to the
+    // case bodies without the switch's range check.  It's filled in on the
+    // first evaluation; any kind it doesn't map (e.g. pseudotypes) lands on
+    // eval_label_switch and takes the ordinary switch--so correctness never
+    // depends on this list being exhaustive, only speed does.
+    //
+    static void* eval_jump_table[REB_MAX];
+    if (eval_jump_table[REB_WORD] == nullptr) {
+        REBLEN i;
+        for (i = 0; i < REB_MAX; ++i)
+            eval_jump_table[i] = &&eval_label_switch;
+
+        eval_jump_table[REB_VOID] = &&eval_label_REB_VOID;
+        eval_jump_table[REB_COMMA] = &&eval_label_REB_COMMA;
+        eval_jump_table[REB_ACTION] = &&eval_label_REB_ACTION;
+
+        eval_jump_table[REB_WORD] = &&eval_label_REB_WORD;
+        eval_jump_table[REB_SET_WORD] = &&eval_label_REB_SET_WORD;
+        eval_jump_table[REB_META_WORD] = &&eval_label_REB_META_WORD;
+        eval_jump_table[REB_GET_WORD] = &&eval_label_REB_META_WORD;
+
+        eval_jump_table[REB_GET_GROUP] = &&eval_label_REB_GET_GROUP;
+        eval_jump_table[REB_GROUP] = &&eval_label_REB_GET_GROUP;
+        eval_jump_table[REB_META_GROUP] = &&eval_label_REB_GET_GROUP;
+        eval_jump_table[REB_SET_GROUP] = &&eval_label_REB_SET_GROUP;
+
+        eval_jump_table[REB_TUPLE] = &&eval_label_REB_TUPLE;
+        eval_jump_table[REB_PATH] = &&eval_label_REB_PATH;
+        eval_jump_table[REB_SET_PATH] = &&eval_label_REB_SET_PATH;
+        eval_jump_table[REB_SET_TUPLE] = &&eval_label_REB_SET_TUPLE;
+        eval_jump_table[REB_META_PATH] = &&eval_label_REB_META_PATH;
+        eval_jump_table[REB_META_TUPLE] = &&eval_label_REB_META_PATH;
+        eval_jump_table[REB_GET_PATH] = &&eval_label_REB_META_PATH;
+        eval_jump_table[REB_GET_TUPLE] = &&eval_label_REB_META_PATH;
+
+        eval_jump_table[REB_GET_BLOCK] = &&eval_label_REB_GET_BLOCK;
+        eval_jump_table[REB_SET_BLOCK] = &&eval_label_REB_SET_BLOCK;
+        eval_jump_table[REB_META_BLOCK] = &&eval_label_REB_META_BLOCK;
+
+        eval_jump_table[REB_THE_BLOCK] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_THE_WORD] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_THE_PATH] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_THE_TUPLE] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_THE_GROUP] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_BLOCK] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_BINARY] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_TEXT] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_FILE] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_EMAIL] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_URL] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_TAG] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_ISSUE] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_BITSET] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_MAP] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_VARARGS] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_OBJECT] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_FRAME] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_MODULE] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_ERROR] = &&eval_label_REB_THE_BLOCK;
+        eval_jump_table[REB_PORT] = &&eval_label_REB_THE_BLOCK;
+
+        eval_jump_table[REB_BLANK] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_INTEGER] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_DECIMAL] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_PERCENT] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_MONEY] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_PAIR] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TIME] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_DATE] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_PARAMETER] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TYPE_WORD] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TYPE_BLOCK] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TYPE_GROUP] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TYPE_PATH] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_TYPE_TUPLE] = &&eval_label_REB_BLANK;
+        eval_jump_table[REB_HANDLE] = &&eval_label_REB_BLANK;
+
+        eval_jump_table[REB_QUASI] = &&eval_label_REB_QUASI;
+        eval_jump_table[REB_QUOTED] = &&eval_label_REB_QUOTED;
+    }
+
+    STATE = VAL_TYPE(f_current);
+    goto *eval_jump_table[STATE];
+  }
+
+  eval_label_switch:
+  #endif
+
     switch ((STATE = VAL_TYPE(f_current))) {  // type doubles as state, see [2]
 
     //=//// NULL //////////////////////////////////////////////////////////=//
@@ -582,7 +730,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //     bool is_null = rebUnboxLogic("null?", rebQ(v));
     //     bool is_null = rebUnboxLogic("null? @", v);  // equivalent, shorter
 
-      case REB_VOID:
+      evalcase(REB_VOID):
         fail (Error_Evaluate_Null_Raw());
 
 
@@ -611,7 +759,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //    what would happen with (nihil then [...]) which shows the only
     //    current difference between COMMA! and a WORD! evaluating to nihil.
 
-      case REB_COMMA:
+      evalcase(REB_COMMA):
         Init_Nihil(OUT);
         goto finished;  // skip lookahead, see [1]
 
@@ -627,7 +775,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     // 1. If an enfix action is run at this moment, it will not have a left
     //    hand side argument.
 
-      case REB_ACTION: {
+      evalcase(REB_ACTION): {
         Frame(*) subframe = Make_Action_Subframe(f);
         Push_Frame(OUT, subframe);
         Push_Action(
@@ -680,7 +828,7 @@ Bounce Evaluator_Executor(Frame(*) f)
         f_current_gotten = Lookup_Word_May_Fail(f_current, f_specifier);
         goto word_common;
 
-      case REB_WORD:
+      evalcase(REB_WORD):
         if (not f_current_gotten)
             f_current_gotten = Lookup_Word_May_Fail(f_current, f_specifier);
 
@@ -775,7 +923,7 @@ Bounce Evaluator_Executor(Frame(*) f)
 
     set_word_common: /////////////////////////////////////////////////////////
 
-      case REB_SET_WORD: {
+      evalcase(REB_SET_WORD): {
         assert(STATE == REB_SET_WORD);
 
         Frame(*) subframe = Maybe_Rightward_Continuation_Needed(f);
@@ -832,7 +980,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //
     // https://forum.rebol.info/t/1301
 
-      case REB_META_WORD:
+      evalcase(REB_META_WORD):
       case REB_GET_WORD:
         if (not f_current_gotten)
             f_current_gotten = Lookup_Word_May_Fail(f_current, f_specifier);
@@ -867,7 +1015,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //        >> 1 + 2 (comment "hi")
     //        == 3  ; e.g. not void
 
-      case REB_GET_GROUP:  // synonym for GROUP!, see [1]
+      evalcase(REB_GET_GROUP):  // synonym for GROUP!, see [1]
       case REB_GROUP:
       case REB_META_GROUP: {
         f_next_gotten = nullptr;  // arbitrary code changes fetched variables
@@ -913,7 +1061,7 @@ Bounce Evaluator_Executor(Frame(*) f)
 
       tuple_common:  /////////////////////////////////////////////////////////
 
-      case REB_TUPLE: {
+      evalcase(REB_TUPLE): {
         Cell(const*) head = VAL_SEQUENCE_AT(SCRATCH, f_current, 0);
         if (IS_BLANK(head) or ANY_INERT(head)) {
             Derelativize(OUT, f_current, f_specifier);
@@ -977,7 +1125,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     // PATH!s starting with inert values do not evaluate.  `/foo/bar` has a
     // blank at its head, and it evaluates to itself.
 
-      case REB_PATH: {
+      evalcase(REB_PATH): {
         Cell(const*) temp = VAL_SEQUENCE_AT(SPARE, f_current, 0);
         if (IS_BLANK(temp) or ANY_INERT(temp)) {
             Derelativize(OUT, f_current, f_specifier);
@@ -1070,7 +1218,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //
     // But for the moment, it is just used in Redbol emulation.
 
-      case REB_SET_PATH: {
+      evalcase(REB_SET_PATH): {
         REBVAL *redbol = Get_System(SYS_OPTIONS, OPTIONS_REDBOL_PATHS);
         if (not IS_LOGIC(redbol) or VAL_LOGIC(redbol) == false) {
             Derelativize(OUT, f_current, f_specifier);
@@ -1118,7 +1266,7 @@ Bounce Evaluator_Executor(Frame(*) f)
 
     generic_set_common: //////////////////////////////////////////////////////
 
-      case REB_SET_TUPLE: {
+      evalcase(REB_SET_TUPLE): {
         assert(STATE == REB_SET_TUPLE or STATE == REB_SET_PATH);
 
         Frame(*) subframe = Maybe_Rightward_Continuation_Needed(f);
@@ -1162,7 +1310,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     // A SET-GROUP! will act as a SET-WORD!, SET-TUPLE!, or SET-BLOCK! based
     // on what the group evaluates to.
 
-      case REB_SET_GROUP: {
+      evalcase(REB_SET_GROUP): {
         f_next_gotten = nullptr;  // arbitrary code changes fetched variables
 
         Frame(*) subframe = Make_Frame_At_Core(
@@ -1216,7 +1364,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     // Consistent with GET-WORD!, a GET-PATH! won't allow none access on
     // the plain (unfriendly) forms.
 
-      case REB_META_PATH:
+      evalcase(REB_META_PATH):
       case REB_META_TUPLE:
       case REB_GET_PATH:
       case REB_GET_TUPLE:
@@ -1245,7 +1393,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //
     // Note that GET-BLOCK! is available as a branch type, `if true :[a b]`
 
-      case REB_GET_BLOCK: {
+      evalcase(REB_GET_BLOCK): {
         Derelativize(SPARE, f_current, f_specifier);
         mutable_HEART_BYTE(SPARE) = REB_BLOCK;
         if (rebRunThrows(
@@ -1313,7 +1461,7 @@ Bounce Evaluator_Executor(Frame(*) f)
       //    something like that to add more?  :-/
       //
 
-      case REB_SET_BLOCK: {
+      evalcase(REB_SET_BLOCK): {
         assert(STATE == REB_SET_BLOCK);
 
         if (VAL_LEN_AT(f_current) == 0)  // not supported, see [1]
@@ -1351,16 +1499,16 @@ Bounce Evaluator_Executor(Frame(*) f)
                     Metafy(SCRATCH);
                 heart = CELL_HEART(SCRATCH);
             }
-            else {
+            else
                 is_optional = false;  // no leading slash means required
-                Derelativize(SCRATCH, check, check_specifier);
-            }
 
             if (
                 heart == REB_GROUP
                 or heart == REB_THE_GROUP
                 or heart == REB_META_GROUP
             ){
+                if (not is_optional)  // optional forms put group in SCRATCH
+                    Derelativize(SCRATCH, check, check_specifier);
                 if (Do_Any_Array_At_Throws(SPARE, SCRATCH, SPECIFIED)) {
                     Drop_Data_Stack_To(BASELINE->stack_base);
                     goto return_thrown;
@@ -1375,8 +1523,10 @@ Bounce Evaluator_Executor(Frame(*) f)
                 heart = CELL_HEART(SPARE);
                 Copy_Cell(PUSH(), SPARE);
             }
+            else if (is_optional)
+                Copy_Cell(PUSH(), SCRATCH);  // slash already stripped off
             else
-                Copy_Cell(PUSH(), SCRATCH);
+                Derelativize(PUSH(), check, check_specifier);  // most common
 
             if (is_optional)  // so next phase won't worry about leading slash
                 Set_Cell_Flag(TOP, STACK_NOTE_OPTIONAL);
@@ -1435,6 +1585,14 @@ Bounce Evaluator_Executor(Frame(*) f)
       //    that if any of the multi-returns were marked as "circled" then the
       //    overwrite of the returned OUT for the whole evaluation will happen
       //    *after* the original OUT was captured into any desired variable.
+      //
+      // 3. Set_Var_May_Fail() handles the general case, but most multi-return
+      //    targets are plain words.  Those get the same direct store the
+      //    evaluator's own SET-WORD! case uses--a lookup and a cell copy--so
+      //    `[a b c]:` costs little more than the three stores.  (The resolved
+      //    variable cells can't be cached across the right hand side's
+      //    evaluation, since it runs arbitrary code...which can rebind the
+      //    words, or relocate a varlist by expanding its context.)
 
         if (Is_Raised(OUT))  // don't assign variables, see [1]
             goto set_block_drop_stack_and_continue;
@@ -1517,14 +1675,20 @@ Bounce Evaluator_Executor(Frame(*) f)
                 or var_heart == REB_META_TUPLE
             ){
                 if (pack_meta_at == pack_meta_tail) {  // special detection
-                    Set_Var_May_Fail(var, SPECIFIED, Lib(NULL));
+                    if (var_heart == REB_META_WORD)  // direct store, see [3]
+                        Copy_Cell(Sink_Word_May_Fail(var, SPECIFIED), Lib(NULL));
+                    else
+                        Set_Var_May_Fail(var, SPECIFIED, Lib(NULL));
                     goto circled_check;
                 }
                 if (Is_Meta_Of_Raised(SPARE) and not raised_ok) {
                     mutable_QUOTE_BYTE(SPARE) = UNQUOTED_1;
                     fail (VAL_CONTEXT(SPARE));
                 }
-                Set_Var_May_Fail(var, SPECIFIED, SPARE);  // came in meta'd
+                if (var_heart == REB_META_WORD)  // direct store, see [3]
+                    Copy_Cell(Sink_Word_May_Fail(var, SPECIFIED), SPARE);
+                else
+                    Set_Var_May_Fail(var, SPECIFIED, SPARE);  // came in meta'd
                 goto circled_check;
             }
 
@@ -1553,10 +1717,14 @@ Bounce Evaluator_Executor(Frame(*) f)
             ){
                 fail (Error_Bad_Isotope(SPARE));
             }
-            else if (
-                var_heart == REB_WORD or var_heart == REB_TUPLE
-                or var_heart == REB_THE_WORD or var_heart == REB_THE_TUPLE
-            ){
+            else if (var_heart == REB_WORD or var_heart == REB_THE_WORD) {
+                //
+                // Plain word targets don't run arbitrary code the way TUPLE!
+                // pokes can, so they can store directly, see [3]
+                //
+                Copy_Cell(Sink_Word_May_Fail(var, SPECIFIED), SPARE);
+            }
+            else if (var_heart == REB_TUPLE or var_heart == REB_THE_TUPLE) {
                 Set_Var_May_Fail(var, SPECIFIED, SPARE);
             }
             else
@@ -1605,7 +1773,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //
     // (It's hard to think of another meaning that would be sensible.)
 
-      case REB_META_BLOCK:
+      evalcase(REB_META_BLOCK):
         Inertly_Derelativize_Inheriting_Const(OUT, f_current, f->feed);
         mutable_HEART_BYTE(OUT) = REB_BLOCK;
         Quotify(OUT, 1);
@@ -1618,7 +1786,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //
     //=////////////////////////////////////////////////////////////////////=//
 
-      case REB_THE_BLOCK:
+      evalcase(REB_THE_BLOCK):
       case REB_THE_WORD:
       case REB_THE_PATH:
       case REB_THE_TUPLE:
@@ -1656,7 +1824,7 @@ Bounce Evaluator_Executor(Frame(*) f)
     //=///////////////////////////////////////////////////////////////////=//
 
     inert:
-      case REB_BLANK:  // once blanks evaluated to null, but that was panned
+      evalcase(REB_BLANK):  // once blanks evaluated to null, but that was panned
       case REB_INTEGER:
       case REB_DECIMAL:
       case REB_PERCENT:
@@ -1692,7 +1860,7 @@ Bounce Evaluator_Executor(Frame(*) f)
       //
       // To bypass the error, use GET/ANY.
 
-      case REB_QUASI:
+      evalcase(REB_QUASI):
         Derelativize(OUT, f_current, f_specifier);
         mutable_QUOTE_BYTE(OUT) = ISOTOPE_0;
         break;
@@ -1704,7 +1872,7 @@ Bounce Evaluator_Executor(Frame(*) f)
       // reduced case of a single ' produces a void.
       //
 
-      case REB_QUOTED:
+      evalcase(REB_QUOTED):
         Derelativize(OUT, f_current, f_specifier);
         Unquotify(OUT, 1);  // asserts it is not an isotope
         break;
@@ -1974,6 +2142,125 @@ Bounce Evaluator_Executor(Frame(*) f)
     // of parameter fulfillment.  We want to reuse the OUT value and get it
     // into the new function's frame.
 
+  //=//// ENFIX ARITHMETIC FAST PATH //////////////////////////////////////=//
+
+    // `1 + 2` pays for a frame push, argument fulfillment and typechecking,
+    // and the generic dispatch into T_Integer()...dwarfing the cost of the
+    // add itself.  When the operator is the plain enfixed copy of the ADD,
+    // SUBTRACT, or MULTIPLY generic--checked by dispatcher and verb, so
+    // adaptations and specializations take the normal route--and both
+    // operands are already in hand as INTEGER!s or DECIMAL!s, the arithmetic
+    // can run right here with no frame at all.
+    //
+    // The right operand must be a literal or a WORD! looking up to a plain
+    // value.  Anything else (GROUP!s, isotopes, unbound words) takes the
+    // ordinary path, as do overflows and non-finite decimal results...so the
+    // error or definitional raise comes from the real frame machinery.
+    //
+    // Note the operator WORD! has to be skipped before the operand is even
+    // visible (feeds only offer one value of lookahead).  So the binding and
+    // label are captured first, and the fallback pushes the frame after the
+    // skip--equivalent to the plain pushing below, just reordered.
+
+    if (
+        ACT_DISPATCHER(enfixed) == &Generic_Dispatcher
+        and Not_Action_Flag(enfixed, QUOTES_FIRST)
+        and (
+            VAL_TYPE_UNCHECKED(OUT) == REB_INTEGER
+            or VAL_TYPE_UNCHECKED(OUT) == REB_DECIMAL
+        )
+    ){
+        option(SymId) id = VAL_WORD_ID(
+            DETAILS_AT(ACT_DETAILS(enfixed), 1)  // IDX_GENERIC_VERB
+        );
+        if (id == SYM_ADD or id == SYM_SUBTRACT or id == SYM_MULTIPLY) {
+            Context(*) binding = VAL_ACTION_BINDING(unwrap(f_next_gotten));
+            option(Symbol(const*)) label = IS_ACTION(f_next)
+                ? VAL_ACTION_LABEL(f_next)
+                : VAL_WORD_SYMBOL(f_next);
+
+            Fetch_Next_Forget_Lookback(f);  // skip operator, see note above
+
+            Cell(const*) operand = nullptr;
+            if (Is_Feed_At_End(f->feed)) {
+                // fall through, ordinary path reports the missing argument
+            }
+            else if (
+                VAL_TYPE_UNCHECKED(f_next) == REB_INTEGER
+                or VAL_TYPE_UNCHECKED(f_next) == REB_DECIMAL
+            ){
+                operand = f_next;
+            }
+            else if (VAL_TYPE_UNCHECKED(f_next) == REB_WORD) {
+                option(const REBVAL*) var = Lookup_Word(
+                    f_next, FEED_SPECIFIER(f->feed)
+                );
+                if (
+                    var and (
+                        VAL_TYPE_UNCHECKED(unwrap(var)) == REB_INTEGER
+                        or VAL_TYPE_UNCHECKED(unwrap(var)) == REB_DECIMAL
+                    )
+                ){
+                    operand = unwrap(var);
+                }
+            }
+
+            if (
+                operand
+                and VAL_TYPE_UNCHECKED(operand) == VAL_TYPE_UNCHECKED(OUT)
+            ){
+                if (VAL_TYPE_UNCHECKED(OUT) == REB_INTEGER) {
+                    REBI64 result;
+                    bool overflow;
+                    if (id == SYM_ADD)
+                        overflow = REB_I64_ADD_OF(
+                            VAL_INT64(OUT), VAL_INT64(operand), &result
+                        );
+                    else if (id == SYM_SUBTRACT)
+                        overflow = REB_I64_SUB_OF(
+                            VAL_INT64(OUT), VAL_INT64(operand), &result
+                        );
+                    else
+                        overflow = REB_I64_MUL_OF(
+                            VAL_INT64(OUT), VAL_INT64(operand), &result
+                        );
+                    if (not overflow) {
+                        Init_Integer(OUT, result);
+                        Fetch_Next_Forget_Lookback(f);  // consume operand
+                        Clear_Feed_Flag(f->feed, NO_LOOKAHEAD);
+                        goto lookahead;
+                    }
+                }
+                else {
+                    REBDEC d1 = VAL_DECIMAL(OUT);
+                    REBDEC d2 = VAL_DECIMAL(operand);
+                    if (id == SYM_ADD)
+                        d1 += d2;
+                    else if (id == SYM_SUBTRACT)
+                        d1 -= d2;
+                    else
+                        d1 *= d2;
+                    if (FINITE(d1)) {
+                        Init_Decimal(OUT, d1);
+                        Fetch_Next_Forget_Lookback(f);  // consume operand
+                        Clear_Feed_Flag(f->feed, NO_LOOKAHEAD);
+                        goto lookahead;
+                    }
+                }
+            }
+
+            // Unsuitable operand (or overflow): the operator word has been
+            // skipped, but the operand has not been consumed...so pushing
+            // the frame now is equivalent to the unoptimized code below.
+            //
+            Frame(*) fastsub = Make_Action_Subframe(f);
+            Push_Frame(OUT, fastsub);
+            Push_Action(fastsub, enfixed, binding);
+            Begin_Enfix_Action(fastsub, label);
+            goto process_action;
+        }
+    }
+
     Frame(*) subframe = Make_Action_Subframe(f);
     Push_Frame(OUT, subframe);
     Push_Action(subframe, enfixed, VAL_ACTION_BINDING(unwrap(f_next_gotten)));
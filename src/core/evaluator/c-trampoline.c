@@ -165,11 +165,9 @@ Bounce Trampoline_From_Top_Maybe_Root(void)
 
     Bounce r;
 
-  #if !defined(NDEBUG)  // Total_Eval_Cycles is periodically reconciled
-    ++Total_Eval_Cycles_Doublecheck;
-  #endif
+    ++Total_Eval_Cycles;  // monotonic; backs METRICS and /TICKS budgets
 
-    if (--Eval_Countdown <= 0) {
+    if (Eval_Signal_Pending) {  // one load; see SET_SIGNAL() and the timer
         //
         // Doing signals covers several things that may cause interruptions:
         //
@@ -183,6 +181,19 @@ Bounce Trampoline_From_Top_Maybe_Root(void)
         }
     }
 
+    if (FRAME->cancel_token != nullptr) {  // inside WITH-CANCELLATION scope
+        //
+        // Unlike HALT--which rides the signal timer and aborts to the top--
+        // a cancellation applies to one frame subtree and is noticed here at
+        // bounce granularity, as a trappable failure.  Don't fire while a
+        // throw is unwinding: the frames it passes through still carry the
+        // token, and clobbering the throw would lose it.  (The token stays
+        // requested, so an intercepted cancellation re-raises next bounce.)
+        //
+        if (FRAME->cancel_token->requested and not Is_Throwing(FRAME))
+            fail (Error_Cancelled_Raw());
+    }
+
     if (Get_Frame_Flag(FRAME, ABRUPT_FAILURE)) {
         assert(Get_Frame_Flag(FRAME, NOTIFY_ON_ABRUPT_FAILURE));
         assert(Is_Throwing(FRAME));
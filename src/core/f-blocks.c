@@ -177,6 +177,25 @@ void Clonify(
             would_need_deep = true;
         }
         else if (ANY_ARRAYLIKE(v)) {
+            //
+            // A deeply frozen array can never be mutated again--by anyone.
+            // SERIES_INFO_FROZEN_DEEP documents that this means copies may
+            // share it rather than clone it, which turns deep copies of
+            // frozen structures (e.g. a config snapshot) into cheap aliases.
+            // Writes through the shared reference get the ordinary frozen
+            // error at the ENSURE_MUTABLE choke points, so code that wants
+            // divergent state copies just the parts it touches.
+            //
+            // (ANY-SEQUENCE! can't share: despite immutability its copies
+            // need new cells so the words can be bound differently, below.)
+            //
+            if (
+                not ANY_SEQUENCE_KIND(heart)
+                and Is_Array_Frozen_Deep(VAL_ARRAY(v))
+            ){
+                return;
+            }
+
             series = Copy_Array_At_Extra_Shallow(
                 VAL_ARRAY(v),
                 0,  // index
@@ -198,6 +217,9 @@ void Clonify(
             would_need_deep = true;
         }
         else if (ANY_SERIES_KIND(heart)) {
+            if (Is_Series_Frozen(VAL_SERIES(v)))
+                return;  // never mutable again, so share instead of clone
+
             series = Copy_Series_Core(
                 VAL_SERIES(v),
                 NODE_FLAG_MANAGED
@@ -375,6 +397,39 @@ Cell(*) Alloc_Tail_Array(Array(*) a)
 }
 
 
+//
+//  Alloc_Tail_Array_N: C
+//
+// Bulk form of Alloc_Tail_Array() for code that is building a large array
+// from a loop.  Reserving all the slots in a single expansion--and paying
+// for the length and termination updates once--lets the loop body fill the
+// cells through a raw cursor instead of going through a series modification
+// per element.
+//
+// The caller must initialize all `n` cells before anything can enumerate
+// the array (including the garbage collector).
+//
+Cell(*) Alloc_Tail_Array_N(Array(*) a, REBLEN n)
+{
+    assert(n > 0);
+    EXPAND_SERIES_TAIL(a, n);
+    SET_SERIES_LEN(a, ARR_LEN(a));
+    Cell(*) first = ARR_TAIL(a) - n;
+
+  #if DEBUG_ERASE_ALLOC_TAIL_CELLS
+    Cell(*) cursor = first;
+    for (; cursor != ARR_TAIL(a); ++cursor) {
+        if (not Is_Cell_Erased(cursor)) {
+            assert(WRITABLE(cursor));
+            Erase_Cell(cursor);  // helps ensure new values written
+        }
+    }
+  #endif
+
+    return first;
+}
+
+
 //
 //  Uncolor_Array: C
 //
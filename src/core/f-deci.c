@@ -423,6 +423,20 @@ inline static void make_comparable(
 bool deci_is_equal(deci a, deci b) {
     int32_t ea = a.e, eb = b.e, ta, tb;
 
+    /*
+        Fast path: with equal exponents and significands fitting in 64 bits,
+        no aligning shifts or rounding can occur, so equality is just a
+        comparison of magnitudes and signs.  Monetary data (integer or
+        cents-scale exponents from the same source) nearly always lands here.
+    */
+    if (a.e == b.e && a.m2 == 0 && b.m2 == 0) {
+        REBU64 ma = (cast(REBU64, a.m1) << 32) | a.m0;
+        REBU64 mb = (cast(REBU64, b.m1) << 32) | b.m0;
+        if (ma != mb)
+            return false;
+        return (a.s == b.s) || ma == 0;  /* zeros equal regardless of sign */
+    }
+
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[4];
     uint32_t sb[4];
@@ -452,6 +466,22 @@ bool deci_is_equal(deci a, deci b) {
 bool deci_is_lesser_or_equal(deci a, deci b) {
     int32_t ea = a.e, eb = b.e, ta, tb;
 
+    /*
+        Fast path: equal exponents with significands below 2 ** 63 compare
+        as plain signed 64-bit integers (see deci_is_equal for rationale).
+    */
+    if (a.e == b.e && a.m2 == 0 && b.m2 == 0
+        && a.m1 < 0x80000000u && b.m1 < 0x80000000u
+    ){
+        REBI64 va = cast(REBI64, (cast(REBU64, a.m1) << 32) | a.m0);
+        REBI64 vb = cast(REBI64, (cast(REBU64, b.m1) << 32) | b.m0);
+        if (a.s)
+            va = -va;
+        if (b.s)
+            vb = -vb;
+        return va <= vb;
+    }
+
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[4];
     uint32_t sb[4];
@@ -488,6 +518,38 @@ deci deci_add(deci a, deci b) {
     uint32_t sc[4];
     int32_t ea = a.e, eb = b.e, ta, tb, tc, test;
 
+    /*
+        Fast path: with equal exponents and magnitudes below 2 ** 63, the sum
+        or difference of magnitudes fits in 64 bits--far below the 1e26 - 1
+        significand limit--so no normalization or rounding can occur and the
+        result is bit-identical to what the general path would compute.
+        (deci_subtract comes through here too, with b's sign flipped.)
+    */
+    if (a.e == b.e && a.m2 == 0 && b.m2 == 0
+        && a.m1 < 0x80000000u && b.m1 < 0x80000000u
+    ){
+        REBU64 ma = (cast(REBU64, a.m1) << 32) | a.m0;
+        REBU64 mb = (cast(REBU64, b.m1) << 32) | b.m0;
+        REBU64 mc;
+        if (a.s == b.s) {
+            mc = ma + mb;
+            c.s = a.s;
+        }
+        else if (ma >= mb) {
+            mc = ma - mb;
+            c.s = a.s;
+        }
+        else {
+            mc = mb - ma;
+            c.s = b.s;
+        }
+        c.m0 = MASK32(mc);
+        c.m1 = MASK32(mc >> 32);
+        c.m2 = 0;
+        c.e = a.e;
+        return c;
+    }
+
     // Must be compile-time const for '= {...}' style init (-Wc99-extensions)
     uint32_t sa[4];
     uint32_t sb[4];
@@ -992,6 +1054,22 @@ deci deci_multiply(const deci a, const deci b) {
     /* compute the sign */
     c.s = (!a.s && b.s) || (a.s && !b.s);
 
+    /*
+        Fast path: significands fitting in 32 bits multiply into 64 bits,
+        which is below the 1e26 - 1 limit--no normalizing shift, no rounding.
+        Only the exponent sum must already be storable.
+    */
+    if (a.m1 == 0 && a.m2 == 0 && b.m1 == 0 && b.m2 == 0
+        && a.e + b.e >= -128 && a.e + b.e <= 127
+    ){
+        REBU64 mc = cast(REBU64, a.m0) * b.m0;
+        c.m0 = MASK32(mc);
+        c.m1 = MASK32(mc >> 32);
+        c.m2 = 0;
+        c.e = (mc == 0) ? 0 : a.e + b.e;  /* m_ldexp zeroes e for zero */
+        return c;
+    }
+
     /* multiply sa by sb yielding "double significand" sc */
     m_multiply (sc, 3, sa, 3, sb);
 
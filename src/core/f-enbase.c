@@ -265,6 +265,47 @@ static Binary(*) Decode_Base64(const Byte* *src, REBLEN len, Byte delim)
 
     for (; len > 0; cp++, len--) {
 
+        // Fast path: between irregularities (whitespace, padding, the
+        // delimiter) the input is a run of plain value characters, which can
+        // be decoded a whole quartet at a time without dribbling bits
+        // through the accumulator.  Anything unusual falls through to the
+        // byte-at-a-time logic below, and the last quartets are left to it
+        // as well so padding always goes through the careful handling.
+        //
+        if (flip == 0) {
+            while (len >= 8) {
+                Byte c0 = cp[0];
+                Byte c1 = cp[1];
+                Byte c2 = cp[2];
+                Byte c3 = cp[3];
+                if ((c0 | c1 | c2 | c3) > 127)
+                    break;  // out of range (or the 0xA0 hard space)
+                if (delim and (
+                    c0 == delim or c1 == delim or c2 == delim or c3 == delim
+                )){
+                    break;
+                }
+                if (c0 == '=' or c1 == '=' or c2 == '=' or c3 == '=')
+                    break;  // pad decodes as 0 in the table, can't trust it
+                Byte l0 = Debase64[c0];
+                Byte l1 = Debase64[c1];
+                Byte l2 = Debase64[c2];
+                Byte l3 = Debase64[c3];
+                if ((l0 | l1 | l2 | l3) & (BIN_ERROR | BIN_SPACE))
+                    break;
+                uint32_t bits
+                    = (cast(uint32_t, l0) << 18)
+                    | (cast(uint32_t, l1) << 12)
+                    | (cast(uint32_t, l2) << 6)
+                    | l3;
+                *bp++ = cast(Byte, bits >> 16);
+                *bp++ = cast(Byte, bits >> 8);
+                *bp++ = cast(Byte, bits);
+                cp += 4;
+                len -= 4;
+            }
+        }
+
         // Check for terminating delimiter (optional):
         if (delim && *cp == delim) break;
 
@@ -400,23 +441,36 @@ void Form_Base16(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
     if (len == 0)
         return;
 
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor"):
+    String(*) buf = mo->series;
+
+    // Two hex digits per byte (plus the periodic line breaks) make the
+    // output size exactly predictable.  Reserve it in one go and write the
+    // ASCII directly, instead of paying Append_Codepoint() costs per nibble.
     //
-    //     len * 2 + len / 32 + 32
+    Length len_old = STR_LEN(buf);
+    Size size_old = STR_SIZE(buf);
+    EXPAND_SERIES_TAIL(buf, (2 * len) + (brk ? len / 32 + 2 : 0));
+    TERM_STR_LEN_SIZE(buf, len_old, size_old);
+
+    Byte* dp = BIN_TAIL(buf);
+    Byte* start = dp;
 
     if (brk and len >= 32)
-        Append_Codepoint(mo->series, LF);
+        *dp++ = LF;
 
     REBLEN count;
     for (count = 1; count <= len; count++) {
-        Form_Hex2(mo, *src++);
+        Byte b = *src++;
+        *dp++ = Hex_Digits[(b & 0xf0) >> 4];
+        *dp++ = Hex_Digits[b & 0xf];
         if (brk and ((count % 32) == 0))
-            Append_Codepoint(mo->series, LF);
+            *dp++ = LF;
     }
 
-    if (brk and (len >= 32) and *BIN_LAST(mo->series) != LF)
-        Append_Codepoint(mo->series, LF);
+    if (brk and (len >= 32) and dp[-1] != LF)
+        *dp++ = LF;
+
+    TERM_STR_LEN_SIZE(buf, len_old + (dp - start), size_old + (dp - start));
 }
 
 
@@ -430,51 +484,52 @@ void Form_Base16(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 //
 void Form_Base64(REB_MOLD *mo, const Byte* src, REBLEN len, bool brk)
 {
-    // !!! This used to predict the length, accounting for hex digits, lines,
-    // and extra syntax ("slop factor") and preallocate size for that.  Now
-    // it appends one character at a time and relies upon the mold buffer's
-    // natural expansion.  Review if it needs the optimization.
-
     String(*) s = mo->series;
 
+    // Four output characters per input triple (plus the periodic line
+    // breaks) make the output size exactly predictable.  Reserve it in one
+    // go and write the ASCII directly; going through Append_Codepoint() per
+    // character costs more than the encoding itself does.
+    //
+    Length len_old = STR_LEN(s);
+    Size size_old = STR_SIZE(s);
+    EXPAND_SERIES_TAIL(s, ((len + 2) / 3) * 4 + (brk ? len / 48 + 2 : 0));
+    TERM_STR_LEN_SIZE(s, len_old, size_old);
+
+    Byte* dp = BIN_TAIL(s);
+    Byte* start = dp;
+
     REBINT loop = cast(int, len / 3) - 1;
     if (brk and 4 * loop > 64)
-        Append_Codepoint(s, LF);
+        *dp++ = LF;
 
     REBINT x;
     for (x = 0; x <= 3 * loop; x += 3) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x] & 0x3) << 4) + (src[x + 1] >> 4)]
-        );
-        Append_Codepoint(
-            s,
-            Enbase64[((src[x + 1] & 0xF) << 2) + (src[x + 2] >> 6)]
-        );
-        Append_Codepoint(s, Enbase64[(src[x + 2] % 0x40)]);
+        *dp++ = Enbase64[src[x] >> 2];
+        *dp++ = Enbase64[((src[x] & 0x3) << 4) + (src[x + 1] >> 4)];
+        *dp++ = Enbase64[((src[x + 1] & 0xF) << 2) + (src[x + 2] >> 6)];
+        *dp++ = Enbase64[(src[x + 2] % 0x40)];
         if ((x + 3) % 48 == 0 && brk)
-            Append_Codepoint(s, LF);
+            *dp++ = LF;
     }
 
     if ((len % 3) != 0) {
-        Append_Codepoint(s, Enbase64[src[x] >> 2]);
+        *dp++ = Enbase64[src[x] >> 2];
 
         if (len - x == 1) {
-            Append_Codepoint(s, Enbase64[((src[x] & 0x3) << 4)]);
-            Append_Codepoint(s, '=');
+            *dp++ = Enbase64[((src[x] & 0x3) << 4)];
+            *dp++ = '=';
         }
         else {
-            Append_Codepoint(
-                s,
-                Enbase64[((src[x] & 0x3) << 4) | (src[x + 1] >> 4)]
-            );
-            Append_Codepoint(s, Enbase64[(src[x + 1] & 0xF) << 2]);
+            *dp++ = Enbase64[((src[x] & 0x3) << 4) | (src[x + 1] >> 4)];
+            *dp++ = Enbase64[(src[x + 1] & 0xF) << 2];
         }
 
-        Append_Codepoint(s, '=');
+        *dp++ = '=';
     }
 
-    if (brk and x > 49 and *BIN_LAST(s) != LF)
-        Append_Codepoint(s, LF);
+    if (brk and x > 49 and dp != start and dp[-1] != LF)
+        *dp++ = LF;
+
+    TERM_STR_LEN_SIZE(s, len_old + (dp - start), size_old + (dp - start));
 }
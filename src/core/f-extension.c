@@ -200,7 +200,9 @@ DECLARE_NATIVE(load_extension)
         VAL_HANDLE_POINTER(Byte, script_compressed),
         VAL_HANDLE_LEN(script_compressed),
         -1,  // max
-        SYM_GZIP
+        SYM_GZIP,
+        nullptr,  // no preset dictionary
+        0
     );
 
     // The decompress routine gives back a pointer which is actually inside of
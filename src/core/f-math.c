@@ -96,6 +96,23 @@ const Byte* Grab_Int_Scale(const Byte* cp, REBINT *val, REBLEN scale)
 }
 
 
+// Two ASCII digits per entry, "00" through "99".  Pulling digits out in
+// pairs halves the number of divides in integer formatting, which is the
+// whole cost of INT_TO_STR on data-emission workloads.
+//
+static const char Digit_Pairs[200] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+
 //
 //  Form_Int_Len: C
 //
@@ -112,7 +129,6 @@ REBINT Form_Int_Len(Byte* buf, REBI64 val, REBINT maxl)
 {
     Byte tmp[MAX_NUM_LEN];
     Byte* tp = tmp;
-    REBI64 n;
     REBI64 r;
     REBINT len = 0;
 
@@ -143,18 +159,25 @@ REBINT Form_Int_Len(Byte* buf, REBI64 val, REBINT maxl)
         len = 1;
     }
 
-    // Generate string in reverse:
+    // Generate string in reverse, two digits per divide (19 digits at most
+    // for a positive int64, so tmp cannot overflow):
+    //
     *tp++ = 0;
-    while (val != 0 && maxl > 0 && tp < tmp + MAX_NUM_LEN) {
-        n = val / 10;   // not using ldiv for easier compatibility
-        r = val % 10;
-        *tp++ = (Byte)('0' + (Byte)(r));
-        val = n;
-        maxl --;
+    while (val >= 100) {
+        r = val % 100;  // not using ldiv for easier compatibility
+        val = val / 100;
+        *tp++ = (Byte)(Digit_Pairs[r * 2 + 1]);
+        *tp++ = (Byte)(Digit_Pairs[r * 2]);
+    }
+    if (val >= 10) {
+        *tp++ = (Byte)(Digit_Pairs[val * 2 + 1]);
+        *tp++ = (Byte)(Digit_Pairs[val * 2]);
     }
+    else
+        *tp++ = (Byte)('0' + (Byte)(val));
     tp--;
 
-    if (maxl == 0) {
+    if (tp - tmp >= maxl) {  // digit count >= maxl means no room for nul
         return 0;
     }
 
@@ -241,6 +264,34 @@ REBINT Emit_Integer(Byte* buf, REBI64 val)
 /* this is appropriate for 64-bit IEEE754 binary floating point format */
 #define MAX_DIGITS 17
 
+
+//=//// DECIMAL FORMATTING MEMO CACHE /////////////////////////////////////=//
+//
+// The dtoa() conversion is correct but costly, and decimal-heavy molding
+// (CSV and JSON emission in particular) tends to repeat the same values over
+// and over: timestamps, prices, column constants.  A small direct-mapped
+// cache keyed on the IEEE754 bit pattern plus the formatting options makes
+// repeats a memcpy instead of a conversion.  Collisions just overwrite, so
+// the cache behaves as a per-slot LRU of depth one.
+//
+// Zeroed (never filled) slots cannot match a query: a real lookup always has
+// a nonzero radix point byte.
+//
+// Note: the longest output is bounded well under the callers' 60 byte
+// buffers (17 digits plus sign, point, exponent, percent sign, terminator).
+
+#define DECIMAL_MEMO_COUNT 64  // power of two, direct-mapped
+
+static struct {
+    uint64_t bits;  // IEEE754 bit pattern of the double
+    Flags flags;
+    REBINT digits;
+    Byte point;
+    Byte len;
+    Byte text[40];
+} Decimal_Memos[DECIMAL_MEMO_COUNT];
+
+
 //
 //  Emit_Decimal: C
 //
@@ -259,6 +310,43 @@ REBINT Emit_Decimal(
     if (decimal_digits < MIN_DIGITS) decimal_digits = MIN_DIGITS;
     else if (decimal_digits > MAX_DIGITS) decimal_digits = MAX_DIGITS;
 
+    uint64_t bits;
+    memcpy(&bits, &d, sizeof(bits));  // type-punning safe form
+
+    REBLEN slot = cast(REBLEN, bits ^ (bits >> 32)) % DECIMAL_MEMO_COUNT;
+    if (
+        Decimal_Memos[slot].bits == bits
+        and Decimal_Memos[slot].flags == flags
+        and Decimal_Memos[slot].digits == decimal_digits
+        and Decimal_Memos[slot].point == point
+    ){
+        memcpy(cp, Decimal_Memos[slot].text, Decimal_Memos[slot].len + 1);
+        return Decimal_Memos[slot].len;
+    }
+
+    // Integral values in the exactly-representable range don't need dtoa's
+    // digit generation loop at all; shortest round-trip form is the integer
+    // itself.  (Bounded to 15 digits so positional notation is assured.)
+    //
+    if (
+        flags == 0
+        and decimal_digits >= 15
+        and d >= -999999999999999.0 and d <= 999999999999999.0
+        and d == cast(REBDEC, cast(REBI64, d))
+    ){
+        if (bits >> 63) {  // signbit (catches -0.0, which compares == 0.0)
+            *cp++ = '-';
+            INT_TO_STR(-cast(REBI64, d), cp);
+        }
+        else
+            INT_TO_STR(cast(REBI64, d), cp);
+        cp = b_cast(strchr(s_cast(cp), 0));
+        *cp++ = point;
+        *cp++ = '0';
+        *cp = 0;
+        goto memoize;
+    }
+
     sig = (Byte* ) dtoa (d, 0, decimal_digits, &e, &sgn, (char **) &rve);
 
     digits_obtained = rve - sig;
@@ -333,5 +421,17 @@ REBINT Emit_Decimal(
 
     if (flags & DEC_MOLD_PERCENT) *cp++ = '%';
     *cp = 0;
-    return cp - start;
+
+  memoize: ;
+
+    REBINT len = cp - start;
+    if (len < cast(REBINT, sizeof(Decimal_Memos[slot].text))) {
+        Decimal_Memos[slot].bits = bits;
+        Decimal_Memos[slot].flags = flags;
+        Decimal_Memos[slot].digits = decimal_digits;
+        Decimal_Memos[slot].point = point;
+        Decimal_Memos[slot].len = len;
+        memcpy(Decimal_Memos[slot].text, start, len + 1);
+    }
+    return len;
 }
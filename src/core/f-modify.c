@@ -138,6 +138,27 @@ REBLEN Modify_Array(
         (dst_idx == ARR_LEN(dst_arr))
         and Get_Subclass_Flag(ARRAY, dst_arr, NEWLINE_AT_TAIL);
 
+    if (GET_SERIES_INFO(dst_arr, JOURNALED)) {
+        //
+        // SNAPSHOT asked for an inverse record of this edit (see the
+        // journaling section of %n-protect.c).  Mirror the branches below
+        // to figure how many cells get overwritten or removed.
+        //
+        REBLEN overwritten;
+        if (sym != SYM_CHANGE)
+            overwritten = 0;
+        else if (size > part)
+            overwritten = part;
+        else if (size < part and (flags & AM_PART))
+            overwritten = part;
+        else
+            overwritten = size;
+        if (dst_idx + overwritten > tail_idx)
+            overwritten = tail_idx - dst_idx;
+
+        Journal_Array_Capture(dst_arr, dst_idx, overwritten, size);
+    }
+
     if (sym != SYM_CHANGE) {
         // Always expand dst_arr for INSERT and APPEND actions:
         Expand_Series(dst_arr, dst_idx, size);
@@ -154,32 +175,51 @@ REBLEN Modify_Array(
 
     tail_idx = (sym == SYM_APPEND) ? 0 : size + dst_idx;
 
-    REBLEN dup_index = 0;
-    for (; dup_index < cast(REBLEN, dups); ++dup_index) {  // dups checked > 0
-        REBLEN index = 0;
-        for (; index < ilen; ++index, ++dst_idx) {
-            Derelativize(
-                ARR_HEAD(dst_arr) + dst_idx,
-                src_rel + index,
-                specifier
-            );
+    REBLEN dst_start = dst_idx;
+    bool src_head_newline = false;  // newline status replicas should inherit
 
-            if (dup_index == 0 and index == 0 and head_newline) {
-                Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
+    REBLEN index = 0;
+    for (; index < ilen; ++index, ++dst_idx) {  // first dup: specify cells
+        Derelativize(
+            ARR_HEAD(dst_arr) + dst_idx,
+            src_rel + index,
+            specifier
+        );
 
-                // The array flag is not cleared until the loop actually
-                // makes a value that will carry on the bit.
-                //
-                Clear_Subclass_Flag(ARRAY, dst_arr, NEWLINE_AT_TAIL);
-                continue;
-            }
+        if (index == 0 and head_newline) {
+            src_head_newline = Get_Cell_Flag(
+                ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE
+            );
+            Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
 
-            if (dup_index > 0 and index == 0 and tail_newline) {
-                Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
-            }
+            // The array flag is not cleared until the loop actually
+            // makes a value that will carry on the bit.
+            //
+            Clear_Subclass_Flag(ARRAY, dst_arr, NEWLINE_AT_TAIL);
         }
     }
 
+    // Further dups are bitwise replicas of cells that were just written
+    // fully specified into dst_arr, so Blit_Cells() can copy them without
+    // re-running Derelativize() (see notes on blitting in %sys-value.h).
+    // Only the newline flag on the head cell of each replica may differ
+    // from the first dup, and gets patched after the copy.
+    //
+    REBLEN dup_index = 1;
+    for (; dup_index < cast(REBLEN, dups); ++dup_index, dst_idx += ilen) {
+        if (ilen == 0)
+            break;  // nothing to replicate (and no head cell to flag)
+        Blit_Cells(
+            ARR_HEAD(dst_arr) + dst_idx,
+            ARR_HEAD(dst_arr) + dst_start,
+            ilen
+        );
+        if (tail_newline)
+            Set_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
+        else if (head_newline and not src_head_newline)
+            Clear_Cell_Flag(ARR_HEAD(dst_arr) + dst_idx, NEWLINE_BEFORE);
+    }
+
     // The above loop only puts on (dups - 1) NEWLINE_BEFORE flags.  The
     // last one might have to be the array flag if at tail.
     //
@@ -211,6 +251,141 @@ REBLEN Modify_Array(
 }
 
 
+// Dedicated fast path for the most common binary stitching operations:
+// APPEND, INSERT, and CHANGE on a plain BINARY! (not aliased as a string)
+// where the source is another BINARY! or a single byte's INTEGER!.  The
+// general routine below handles UTF-8 aliasing, molding of arbitrary
+// source types, /LINE, and /DUP--none of which apply here--so this reduces
+// to one capacity adjustment and a memcpy (or memmove, when the source and
+// destination are the same series and the regions can overlap).
+//
+// Returns false without modifying anything if the preconditions don't
+// hold, so the caller can fall through to the general path.
+//
+static bool Try_Modify_Binary_Fast(
+    REBLEN *result,
+    REBVAL *dst,
+    enum Reb_Symbol_Id sym,
+    const REBVAL *src,
+    Flags flags,
+    REBLEN part,
+    REBINT dups
+){
+    if (dups != 1 or (flags & AM_LINE))
+        return false;
+
+    if (not IS_BINARY(dst))
+        return false;
+
+    Byte src_byte;  // storage must outlive src_ptr use below
+    const Byte* src_ptr;
+    Size src_size;
+    Binary(const*) src_bin = nullptr;
+
+    if (IS_BINARY(src)) {
+        src_bin = VAL_BINARY(src);
+        src_ptr = BIN_AT(src_bin, VAL_INDEX(src));
+        src_size = BIN_LEN(src_bin) - VAL_INDEX(src);
+    }
+    else if (IS_INTEGER(src)) {
+        src_byte = VAL_UINT8(src);  // fails if out of range
+        src_ptr = &src_byte;
+        src_size = 1;
+    }
+    else
+        return false;  // needs molding or forming, use general path
+
+    Binary(*) dst_ser = BIN(VAL_SERIES_ENSURE_MUTABLE(dst));
+    if (IS_NONSYMBOL_STRING(dst_ser))
+        return false;  // UTF-8 aliased, edits need codepoint validation
+
+    if (GET_SERIES_INFO(dst_ser, JOURNALED))
+        return false;  // general path records the inverse for ROLLBACK
+
+    Size dst_used = SER_USED(dst_ser);
+    REBLEN dst_off = VAL_INDEX(dst);  // plain binary, offset is in bytes
+    if (sym == SYM_APPEND or dst_off > dst_used)
+        dst_off = dst_used;
+
+    if (sym != SYM_CHANGE and (flags & AM_PART)) {
+        if (part < src_size)
+            src_size = part;  // APPEND/PART and INSERT/PART are in bytes
+    }
+
+    if (sym == SYM_APPEND or sym == SYM_INSERT) {
+        if (src_size == 0) {
+            *result = (sym == SYM_APPEND) ? 0 : dst_off;
+            return true;
+        }
+
+        // Stitching a slice of a binary onto its own tail is common in
+        // framing code.  The expansion can't disturb bytes below the old
+        // used size, so re-fetching the source pointer afterward (the data
+        // may have been reallocated) makes the copy conflict-free.  An
+        // INSERT below the tail would shift the source region itself, so
+        // leave that to the general path's buffering.
+        //
+        REBLEN src_off = 0;
+        if (src_bin == dst_ser) {
+            if (sym != SYM_APPEND)
+                return false;
+            src_off = VAL_INDEX(src);
+        }
+
+        Expand_Series(dst_ser, dst_off, src_size);
+        SET_SERIES_USED(dst_ser, dst_used + src_size);
+
+        if (src_bin == dst_ser)
+            src_ptr = BIN_AT(dst_ser, src_off);
+
+        memcpy(SER_AT(Byte, dst_ser, dst_off), src_ptr, src_size);
+
+        TERM_SERIES_IF_NECESSARY(dst_ser);
+
+        *result = (sym == SYM_APPEND) ? 0 : dst_off + src_size;
+        return true;
+    }
+
+    assert(sym == SYM_CHANGE);
+
+    Size dst_size_at = dst_used - dst_off;
+
+    Size part_size;  // historical behavior: `change "abc" "d"` gives "dbc"
+    if (not (flags & AM_PART))
+        part_size = src_size;
+    else
+        part_size = part;
+    if (part_size > dst_size_at)
+        part_size = dst_size_at;
+
+    if (src_bin == dst_ser) {
+        if (src_size != part_size)
+            return false;  // shift would move the source region, buffer it
+
+        memmove(SER_AT(Byte, dst_ser, dst_off), src_ptr, src_size);
+
+        *result = dst_off + src_size;
+        return true;
+    }
+
+    if (src_size > part_size) {
+        Expand_Series(dst_ser, dst_off, src_size - part_size);
+        SET_SERIES_USED(dst_ser, dst_used + src_size - part_size);
+    }
+    else if (part_size > src_size) {
+        Remove_Series_Units(dst_ser, dst_off, part_size - src_size);
+        SET_SERIES_USED(dst_ser, dst_used + src_size - part_size);
+    }
+
+    memcpy(SER_AT(Byte, dst_ser, dst_off), src_ptr, src_size);
+
+    TERM_SERIES_IF_NECESSARY(dst_ser);
+
+    *result = dst_off + src_size;
+    return true;
+}
+
+
 //
 //  Modify_String_Or_Binary: C
 //
@@ -238,6 +413,10 @@ REBLEN Modify_String_Or_Binary(
 ){
     assert(sym == SYM_INSERT or sym == SYM_CHANGE or sym == SYM_APPEND);
 
+    REBLEN fast_result;
+    if (Try_Modify_Binary_Fast(&fast_result, dst, sym, src, flags, part, dups))
+        return fast_result;
+
     ENSURE_MUTABLE(dst);  // note this also rules out ANY-WORD!s
 
     Binary(*) dst_ser = BIN(VAL_SERIES_ENSURE_MUTABLE(dst));
@@ -308,6 +487,7 @@ REBLEN Modify_String_Or_Binary(
     Size src_size_raw;  // size in bytes
 
     Byte src_byte;  // only used by BINARY! (mold buffer is UTF-8 legal)
+    Byte src_digits[60];  // INTEGER! fast path (same size as MF_Integer's)
 
     if (IS_ISSUE(src)) {  // characters store their encoding in their payload
         //
@@ -360,17 +540,40 @@ REBLEN Modify_String_Or_Binary(
             src_len_raw = src_size_raw;
     }
     else if (IS_INTEGER(src)) {
-        if (not IS_BINARY(dst))
-            goto form;  // e.g. `append "abc" 10` is "abc10"
-
-        // otherwise `append #{123456} 10` is #{1234560A}, just the byte
+        if (not IS_BINARY(dst)) {
+            //
+            // e.g. `append "abc" 10` is "abc10".  The digits have a
+            // context-free rendering, so emit them directly instead of
+            // round-tripping them through the mold buffer.
+            //
+            src_len_raw = src_size_raw
+                = Emit_Integer(src_digits, VAL_INT64(src));  // ASCII only
+            src_ptr = src_digits;
+        }
+        else {
+            // `append #{123456} 10` is #{1234560A}, just the byte
 
-        src_byte = VAL_UINT8(src);  // fails if out of range
-        if (IS_NONSYMBOL_STRING(dst_ser) and src_byte >= 0x80)
-            fail (Error_Bad_Utf8_Bin_Edit_Raw());
+            src_byte = VAL_UINT8(src);  // fails if out of range
+            if (IS_NONSYMBOL_STRING(dst_ser) and src_byte >= 0x80)
+                fail (Error_Bad_Utf8_Bin_Edit_Raw());
 
-        src_ptr = &src_byte;
-        src_len_raw = src_size_raw = 1;
+            src_ptr = &src_byte;
+            src_len_raw = src_size_raw = 1;
+        }
+    }
+    else if (IS_WORD(src)) {
+        //
+        // FORM of a plain WORD! is exactly its spelling, so point right at
+        // the symbol's frozen UTF-8 and copy once into the destination.
+        // (Decorated words like SET-WORD! take the general mold route.)
+        //
+        Symbol(const*) symbol = VAL_WORD_SYMBOL(src);
+        src_ptr = cast(const Byte*, STR_HEAD(symbol));
+        src_size_raw = STR_SIZE(symbol);
+        if (IS_NONSYMBOL_STRING(dst_ser))
+            src_len_raw = STR_LEN(symbol);
+        else
+            src_len_raw = src_size_raw;
     }
     else if (IS_BINARY(src)) {
         Binary(const*) bin = VAL_BINARY(src);
@@ -544,6 +747,9 @@ REBLEN Modify_String_Or_Binary(
     // longer series.
 
     if (sym == SYM_APPEND or sym == SYM_INSERT) {  // always expands
+        if (GET_SERIES_INFO(dst_ser, JOURNALED))
+            Journal_Bytes_Capture(dst_ser, dst_off, 0, src_size_total);
+
         Expand_Series(dst_ser, dst_off, src_size_total);
         SET_SERIES_USED(dst_ser, dst_used + src_size_total);
 
@@ -647,6 +853,9 @@ REBLEN Modify_String_Or_Binary(
                 part_size = part;
         }
 
+        if (GET_SERIES_INFO(dst_ser, JOURNALED))
+            Journal_Bytes_Capture(dst_ser, dst_off, part_size, src_size_total);
+
         if (src_size_total > part_size) {
             //
             // We're adding more bytes than we're taking out.  Expand.
@@ -103,7 +103,7 @@ Bounce Series_Common_Action_Maybe_Unhandled(
                 return nullptr;
             if (Not_Subclass_Flag(ARRAY, s, HAS_FILE_LINE_UNMASKED))
                 return nullptr;
-            return Init_Integer(OUT, s->misc.line); }
+            return Init_Integer(OUT, Array_Line(cast(Array(const*), s))); }
 
           default:
             break;
@@ -327,9 +327,16 @@ void Extra_Init_Action_Checks_Debug(Action(*) a) {
     );
 
     // !!! Currently only a context can serve as the "meta" information,
-    // though the interface may expand.
+    // though the interface may expand.  A generator may also have stashed
+    // the spec here for a deferred build--see Force_Action_Meta().
     //
-    assert(not ACT_META(a) or ANY_CONTEXT_KIND(CTX_TYPE(ACT_META(a))));
+    if (ACT_IDENTITY(a)->misc.any.node != nullptr) {
+        REBSER *meta = SER(node_MISC(DetailsMeta, ACT_IDENTITY(a)));
+        if (SER_FLAVOR(meta) == FLAVOR_VARLIST)
+            assert(ANY_CONTEXT_KIND(CTX_TYPE(CTX(meta))));
+        else
+            assert(SER_FLAVOR(meta) == FLAVOR_ARRAY);  // pending spec
+    }
 }
 
 #endif
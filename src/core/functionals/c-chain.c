@@ -255,6 +255,47 @@ DECLARE_NATIVE(chain_p)  // see extended definition CHAIN in %base-defs.r
         }
     }
 
+    // If steps in the pipeline are CHAINs themselves, splice their pipelines
+    // in flat.  A chain's interface is its first step's interface and each
+    // subsequent step just post-processes a result, so running the steps
+    // directly is indistinguishable from recursing into the sub-chain...
+    // minus a Chainer_Dispatcher() frame per layer on every call.  (Only an
+    // action value's own binding would distinguish it; chains are created
+    // unbound, but leave any bound oddity alone to be safe.)
+    //
+    bool any_subchains = false;
+    for (check = first; check != tail; ++check) {
+        if (
+            ACT_DISPATCHER(VAL_ACTION(check)) == &Chainer_Dispatcher
+            and VAL_ACTION_BINDING(check) == UNBOUND
+        ){
+            any_subchains = true;
+            break;
+        }
+    }
+    if (any_subchains) {
+        StackIndex base = TOP_INDEX;
+        for (check = first; check != tail; ++check) {
+            if (
+                ACT_DISPATCHER(VAL_ACTION(check)) != &Chainer_Dispatcher
+                or VAL_ACTION_BINDING(check) != UNBOUND
+            ){
+                Derelativize(PUSH(), check, VAL_SPECIFIER(pipeline));
+                continue;
+            }
+            Array(*) sub_details = ACT_DETAILS(VAL_ACTION(check));
+            Cell(const*) sub_tail;
+            Cell(const*) sub = VAL_ARRAY_AT(
+                &sub_tail,
+                DETAILS_AT(sub_details, IDX_CHAINER_PIPELINE)
+            );
+            for (; sub != sub_tail; ++sub)
+                Derelativize(PUSH(), sub, SPECIFIED);  // was frozen specific
+        }
+        Init_Block(pipeline, Pop_Stack_Values(base));
+        first = VAL_ARRAY_AT(&tail, pipeline);  // same interface, see below
+    }
+
     // The chained function has the same interface as head of the chain.
     //
     // !!! Output (RETURN) should match the *tail* of the chain.  Is this
@@ -114,7 +114,7 @@ Bounce Block_Dispatcher(Frame(*) f)
         //
         if (Get_Subclass_Flag(ARRAY, body, HAS_FILE_LINE_UNMASKED)) {
             mutable_LINK(Filename, relativized) = LINK(Filename, body);
-            relativized->misc.line = body->misc.line;
+            relativized->misc.line = Array_Line(body);
             Set_Subclass_Flag(ARRAY, relativized, HAS_FILE_LINE_UNMASKED);
         }
 
@@ -111,6 +111,7 @@ DECLARE_NATIVE(generic)
     Array(*) details = ACT_DETAILS(generic);
     Init_Word(ARR_AT(details, IDX_NATIVE_BODY), VAL_WORD_SYMBOL(verb));
     Copy_Cell(ARR_AT(details, IDX_NATIVE_CONTEXT), Lib_Context_Value);
+    Init_Blank(ARR_AT(details, IDX_NATIVE_INTRINSIC));  // generics: frame only
 
     REBVAL *verb_var = Sink_Word_May_Fail(verb, SPECIFIED);
     Init_Activation(verb_var, generic, VAL_WORD_SYMBOL(verb), UNBOUND);
@@ -127,6 +128,21 @@ DECLARE_NATIVE(generic)
 Array(*) Startup_Generics(const REBVAL *boot_generics)
 {
     assert(VAL_INDEX(boot_generics) == 0); // should be at head, sanity check
+
+    // Flatten the dispatch decision made by Run_Generic_Dispatch_Core() into
+    // one table lookup.  Only plain (unquoted) values consult the hook for
+    // their specific type; isotopes, quasiforms, and quoted values each get
+    // a uniform handler regardless of what their heart byte is.
+    //
+    REBLEN k;
+    for (k = 0; k < REB_MAX; ++k) {
+        PG_Generic_Hooks[ISOTOPE_0][k] = &T_Isotope;
+        PG_Generic_Hooks[UNQUOTED_1][k] = cast(
+            GENERIC_HOOK*, Builtin_Type_Hooks[k][IDX_GENERIC_HOOK]
+        );
+        PG_Generic_Hooks[QUASI_2][k] = &T_Quasi;
+        PG_Generic_Hooks[QUASI_2 + 1][k] = &T_Quoted;
+    }
     Cell(const*) tail;
     Cell(*) head = VAL_ARRAY_KNOWN_MUTABLE_AT(&tail, boot_generics);
     REBSPC *specifier = VAL_SPECIFIER(boot_generics);
@@ -87,6 +87,8 @@ void Splice_Block_Into_Feed(Feed(*) feed, const REBVAL *splice) {
         SET_SERIES_INFO(m_cast(Array(*), FEED_ARRAY(feed)), HOLD);
         Set_Feed_Flag(feed, TOOK_HOLD);
     }
+
+    Update_Feed_Cursor(feed);  // singular was repointed at the splice array
 }
 
 
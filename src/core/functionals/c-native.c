@@ -33,6 +33,77 @@
 #include "sys-core.h"
 
 
+//=//// INTRINSIC REGISTRATION ////////////////////////////////////////////=//
+//
+// Natives whose dispatchers have an Intrinsic counterpart (a plain C function
+// that takes the single evaluated argument and writes the result, without a
+// FRAME! being built) are registered here.  Make_Native() consults the table
+// and stores the function in the details with DETAILS_FLAG_IS_INTRINSIC set,
+// so callsites like Pushed_Continuation() can recognize them.
+//
+// The table is tiny and only scanned once per native creation, so a linear
+// search is fine.
+//
+static struct {
+    Dispatcher* dispatcher;
+    Intrinsic* intrinsic;
+} const Native_Intrinsics[] = {
+    { &N_null_q, &Intrinsic_Null_Q },
+    { &N_logic_q, &Intrinsic_Logic_Q },
+    { &N_void_q, &Intrinsic_Void_Q },
+    { &N_not_1, &Intrinsic_Not },
+    { &N_to_logic, &Intrinsic_To_Logic },
+    { nullptr, nullptr }
+};
+
+static Intrinsic* Try_Intrinsic_For_Dispatcher(Dispatcher* dispatcher) {
+    int i = 0;
+    for (; Native_Intrinsics[i].dispatcher != nullptr; ++i)
+        if (Native_Intrinsics[i].dispatcher == dispatcher)
+            return Native_Intrinsics[i].intrinsic;
+    return nullptr;
+}
+
+
+//=//// LEAF REGISTRATION /////////////////////////////////////////////////=//
+//
+// "Leaf" natives promise to run no arbitrary code: no evaluation, no
+// continuations, no variable writes.  See CELL_FLAG_LEAF_NATIVE for what the
+// action executor does with the promise.  The comparison family is the
+// archetypal case--called constantly, and each call does nothing but look at
+// its two (already typechecked) arguments and produce a LOGIC!.
+//
+// Registering a dispatcher here which can reach usermode code would corrupt
+// the evaluator's lookahead cache and let frames be mutated mid-native, so
+// entries require the same kind of audit as the intrinsics above.
+//
+static Dispatcher* const Native_Leaves[] = {
+    &N_equal_q,
+    &N_not_equal_q,
+    &N_strict_equal_q,
+    &N_strict_not_equal_q,
+    &N_same_q,
+    &N_lesser_q,
+    &N_equal_or_lesser_q,
+    &N_greater_q,
+    &N_greater_or_equal_q,
+    &N_maximum,
+    &N_minimum,
+    &N_negative_q,
+    &N_positive_q,
+    &N_zero_q,
+    nullptr
+};
+
+static bool Is_Dispatcher_Leaf(Dispatcher* dispatcher) {
+    int i = 0;
+    for (; Native_Leaves[i] != nullptr; ++i)
+        if (Native_Leaves[i] == dispatcher)
+            return true;
+    return false;
+}
+
+
 //
 //  Make_Native: C
 //
@@ -97,6 +168,45 @@ Action(*) Make_Native(
     Array(*) details = ACT_DETAILS(native);
     Init_Blank(ARR_AT(details, IDX_NATIVE_BODY));
     Copy_Cell(ARR_AT(details, IDX_NATIVE_CONTEXT), CTX_ARCHETYPE(module));
+    Init_Blank(ARR_AT(details, IDX_NATIVE_INTRINSIC));
+
+    if (Is_Dispatcher_Leaf(dispatcher)) {
+        assert(not is_combinator);  // combinators call back into PARSE rules
+        Clear_Cell_Flag(ACT_ARCHETYPE(native), PROTECTED);  // debug sets it
+        Set_Cell_Flag(ACT_ARCHETYPE(native), LEAF_NATIVE);
+        Set_Cell_Flag(ACT_ARCHETYPE(native), PROTECTED);  // restore invariant
+    }
+
+    Intrinsic* intrinsic = Try_Intrinsic_For_Dispatcher(dispatcher);
+    if (intrinsic and not is_combinator) {
+        Init_Handle_Cfunc(
+            DETAILS_AT(details, IDX_NATIVE_INTRINSIC),
+            cast(CFUNC*, intrinsic)
+        );
+        Set_Action_Flag(native, IS_INTRINSIC);
+
+      #if !defined(NDEBUG)  // frameless call needs one normal evaluated arg
+        REBLEN arity = 0;
+        const REBKEY *tail;
+        const REBKEY *key = ACT_KEYS(&tail, native);
+        const REBPAR *param = ACT_PARAMS_HEAD(native);
+        for (; key != tail; ++key, ++param) {
+            if (Is_Specialized(param))
+                continue;
+            if (
+                VAL_PARAM_CLASS(param) == PARAM_CLASS_RETURN
+                or VAL_PARAM_CLASS(param) == PARAM_CLASS_OUTPUT
+            ){
+                continue;
+            }
+            ++arity;
+            assert(VAL_PARAM_CLASS(param) == PARAM_CLASS_NORMAL);
+            assert(NOT_PARAM_FLAG(param, REFINEMENT));
+            assert(NOT_PARAM_FLAG(param, VARIADIC));
+        }
+        assert(arity == 1);
+      #endif
+    }
 
     // NATIVE-COMBINATORs actually aren't *quite* their own dispatchers, they
     // all share a common hook to help with tracing and doing things like
@@ -66,6 +66,31 @@ Bounce Specializer_Dispatcher(Frame(*) f)
 }
 
 
+// Specializations of specializations would pay a Specializer_Dispatcher()
+// hop per layer on every invocation, just to arrive at a phase and binding
+// that are fully knowable when the composition is created.  Because each
+// layer's exemplar copies the specialized slots of the layer below into
+// itself, none of the intermediate layers contribute anything at runtime.
+// So retarget the new exemplar's archetype to aim past any Specializer
+// layers...making the call a single hop no matter how deeply specializations
+// are stacked.  (This is the same archetype-retargeting trick ENCLOSE uses
+// on the frame it passes to its outer function.)
+//
+static void Flatten_Specialization(Context(*) exemplar)
+{
+    REBVAL *rootvar = CTX_ROOTVAR(exemplar);
+    while (true) {
+        Action(*) target = CTX_FRAME_ACTION(exemplar);
+        if (ACT_DISPATCHER(target) != &Specializer_Dispatcher)
+            break;
+
+        Context(*) inner = ACT_EXEMPLAR(target);
+        INIT_VAL_FRAME_PHASE(rootvar, CTX_FRAME_ACTION(inner));
+        INIT_VAL_FRAME_BINDING(rootvar, CTX_FRAME_BINDING(inner));
+    }
+}
+
+
 //
 //  Make_Context_For_Action_Push_Partials: C
 //
@@ -433,6 +458,8 @@ bool Specialize_Action_Throws(
         }
     }
 
+    Flatten_Specialization(exemplar);  // collapse layered specializations
+
     Action(*) specialized = Make_Action(
         CTX_VARLIST(exemplar),
         partials,
@@ -760,6 +787,9 @@ Action(*) Alloc_Action_From_Exemplar(
 
     // This code parallels Specialize_Action_Throws(), see comments there
 
+    if (dispatcher == &Specializer_Dispatcher)
+        Flatten_Specialization(exemplar);  // collapse layers, single hop
+
     Action(*) action = Make_Action(
         CTX_VARLIST(exemplar),
         nullptr,  // no partials
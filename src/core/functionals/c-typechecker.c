@@ -143,6 +143,131 @@ DECLARE_NATIVE(typechecker)
 }
 
 
+// Try to turn one element of a parameter's type spec into FLAGIT_KIND()
+// bits OR'd into the mask.  Returns false if the element checks something
+// that can't be expressed as a union of built-in kinds (isotope matchers,
+// arbitrary predicates, unbound words...), in which case the parameter has
+// to use the general walk in Typecheck_Value().
+//
+// Words were derelativized into the parameter array when it was made (see
+// Add_Parameter_Bits_Core()), so the top-level calls are SPECIFIED...but
+// nested TYPE-BLOCK!/TYPE-GROUP! contents may need a derived specifier.
+//
+static bool Try_Add_Kind_Bits(
+    REBU64 *mask,
+    Cell(const*) item,
+    REBSPC *specifier
+){
+    if (IS_QUASI(item))
+        return false;  // matches isotopes by word, not by kind
+
+    Cell(const*) test;
+    if (IS_WORD(item)) {
+        test = try_unwrap(Lookup_Word(item, specifier));
+        if (test == nullptr)
+            return false;  // unbound--has to resolve at check time
+    }
+    else
+        test = item;
+
+    if (Is_Activation(test) or (not Is_Isotope(test) and IS_ACTION(test))) {
+        Action(*) action = VAL_ACTION(test);
+
+        if (ACT_DISPATCHER(action) == &Typeset_Checker_Dispatcher) {
+            Index n = VAL_INT32(
+                DETAILS_AT(ACT_DETAILS(action), IDX_TYPECHECKER_TYPE)
+            );
+            *mask |= Typesets[n];
+            return true;
+        }
+
+        if (ACT_DISPATCHER(action) == &Datatype_Checker_Dispatcher) {
+            Value(*) type_word = DETAILS_AT(
+                ACT_DETAILS(action),
+                IDX_TYPECHECKER_TYPE
+            );
+            *mask |= FLAGIT_KIND(VAL_TYPE_KIND(type_word));
+            return true;
+        }
+
+        return false;  // arbitrary predicate, needs a frame to run
+    }
+
+    if (Is_Isotope(test))
+        return false;  // e.g. word looked up to an unset variable
+
+    switch (VAL_TYPE(test)) {
+      case REB_TYPE_WORD:
+        *mask |= FLAGIT_KIND(VAL_TYPE_KIND(test));
+        return true;
+
+      case REB_BLOCK:
+      case REB_TYPE_BLOCK: {  // matches any item, so the union is exact
+        REBSPC *subspecifier = Derive_Specifier(specifier, test);
+        Cell(const*) sub_tail;
+        Cell(const*) sub = VAL_ARRAY_AT(&sub_tail, test);
+        for (; sub != sub_tail; ++sub)
+            if (not Try_Add_Kind_Bits(mask, sub, subspecifier))
+                return false;
+        return true; }
+
+      case REB_GROUP:
+      case REB_TYPE_GROUP: {  // matches all items; only trivial case is pure
+        REBSPC *subspecifier = Derive_Specifier(specifier, test);
+        Cell(const*) sub_tail;
+        Cell(const*) sub = VAL_ARRAY_AT(&sub_tail, test);
+        if (sub + 1 != sub_tail)
+            return false;  // intersections can't be OR'd into the union
+        return Try_Add_Kind_Bits(mask, sub, subspecifier); }
+
+      default:
+        return false;  // tags like <opt> etc. take the general walk
+    }
+}
+
+
+//
+//  Try_Cache_Param_Kind_Mask: C
+//
+// Most parameter type specs are plain unions of built-in datatypes, like
+// `[integer! block!]` or `[any-series!]`.  Walking the spec array on every
+// call--with a word lookup per element, and evaluator reentry for the
+// constraint forms--is measurable overhead in call-heavy code.  So when the
+// paramlist is being made, try compiling the spec down to a single bitmask
+// over the kind byte...reserving the walk for genuinely predicated checks.
+//
+// Note this resolves the spec's words when the function is created (as
+// R3-Alpha's typesets did).  Words that don't look up to datatypes or the
+// optimized typeset checkers--or don't look up to anything yet--simply
+// don't get cached, and keep the check-time lookup behavior.
+//
+void Try_Cache_Param_Kind_Mask(Value(*) param)
+{
+    assert(IS_PARAMETER(param));
+
+    if (GET_PARAM_FLAG(param, KIND_MASK_CACHED))
+        return;  // e.g. AUGMENT re-pops already-finalized parameters
+
+    Array(const*) array = try_unwrap(VAL_PARAMETER_ARRAY(param));
+    if (array == nullptr)
+        return;  // unconstrained, no walk to accelerate
+
+    REBU64 mask = 0;
+
+    Cell(const*) tail = ARR_TAIL(array);
+    Cell(const*) item = ARR_HEAD(array);
+    for (; item != tail; ++item)
+        if (not Try_Add_Kind_Bits(&mask, item, SPECIFIED))
+            return;
+
+    if (mask != cast(REBU64, cast(uintptr_t, mask)))
+        return;  // won't fit the cell slot on a 32-bit build
+
+    VAL_PARAM_KIND_MASK(param) = cast(uintptr_t, mask);
+    SET_PARAM_FLAG(param, KIND_MASK_CACHED);
+}
+
+
 //
 //  Typecheck_Value: C
 //
@@ -169,6 +294,17 @@ bool Typecheck_Value(
         match_all = true;
     }
     else if (IS_PARAMETER(tests)) {
+        if (GET_PARAM_FLAG(tests, KIND_MASK_CACHED)) {
+            //
+            // Spec was compiled down to a union of built-in kinds when the
+            // paramlist was made...one mask test replaces the whole walk.
+            //
+            return did (
+                cast(REBU64, VAL_PARAM_KIND_MASK(tests))
+                & FLAGIT_KIND(VAL_TYPE(v))
+            );
+        }
+
         Array(const*) array = try_unwrap(VAL_PARAMETER_ARRAY(tests));
         if (array == nullptr)
             return true;  // implicitly all is permitted
@@ -153,19 +153,25 @@ Bounce Yielder_Dispatcher(Frame(*) f)
     }
 
     // With variables extracted, we no longer need the varlist for this
-    // invocation (wrong identity) so we free it, if it isn't GC-managed,
-    // as it wouldn't get freed otherwise.
+    // invocation (wrong identity) so we free it, if it isn't GC-managed...
+    // as it wouldn't get freed otherwise.  Tight resume loops pump through
+    // here millions of times, so leaving each invocation's stub to leak
+    // (or even to await a sweep) is what used to dominate generator cost.
     //
-/*    if (NOT_SERIES_FLAG(yielder_frame->varlist, MANAGED)) {
-        //
-        // We only want to kill off this one frame; but the GC will think
-        // that we want to kill the whole stack of frames if we don't
-        // zero out the keylist node.
+    // No GC can run between here and the repointing of f->varlist below
+    // (allocations only trigger collection at trampoline checkpoints), so
+    // there is no moment where the frame is seen with a dead varlist.
+    //
+    Array(*) fresh_varlist = yielder_frame->varlist;
+    if (NOT_SERIES_FLAG(fresh_varlist, MANAGED))
+        GC_Kill_Series(SER(fresh_varlist));  // frees stub and arg cells
+    else {
+        // Reification could have managed it; decay the keysource the way
+        // Drop_Action() would and let the sweep have it (nothing should
+        // reference it after this dispatch).
         //
-        LINK(yielder_frame->varlist).custom.node = nullptr;
-
-        GC_Kill_Series(SER(yielder_frame->varlist));  // Note: no tracking
-    } */
+        INIT_BONUS_KEYSOURCE(fresh_varlist, ACT_KEYLIST(phase));
+    }
 
     // When the last yielder dropped from the frame stack, it should have
     // decayed its keysource from a REBFRM* to the action that was
@@ -128,6 +128,14 @@ Bounce Func_Dispatcher(Frame(*) f)
     Cell(*) body = ARR_AT(details, IDX_DETAILS_1);  // code to run
     assert(IS_BLOCK(body) and IS_RELATIVE(body) and VAL_INDEX(body) == 0);
 
+    // A body that was never dispatched may have been deflated by the GC to
+    // save memory; the first run reinflates it and ends its eligibility.
+    // (Just a flag test after that.)  See COLD SOURCE COMPRESSION, %m-gc.c
+    //
+    Array(*) body_array = m_cast(Array(*), VAL_ARRAY(body));
+    if (Get_Subclass_Flag(ARRAY, body_array, COLD_SOURCE))
+        Thaw_Cold_Source(body_array);
+
     assert(ACT_HAS_RETURN(phase));  // all FUNC have RETURN
     assert(KEY_SYM(ACT_KEYS_HEAD(phase)) == SYM_RETURN);
 
@@ -173,6 +181,303 @@ Bounce Func_Dispatcher(Frame(*) f)
 }}
 
 
+//=//// BODY REUSE CACHE //////////////////////////////////////////////////=//
+//
+// Code that says `for-each x data [process func [y] [y + x]]` churns out a
+// paramlist, a deep relativized body copy, and a details array on every
+// iteration--even though each product is interchangeable with the last (an
+// "allocation storm" from what was probably an accidental function-in-loop).
+//
+// A small direct-mapped cache remembers the last action made from a given
+// (spec, body, flags, dispatcher) source.  On a repeat, the prototype's
+// paramlist and relativized body array are reused--only a fresh details
+// array is made, so each call still gets a distinct identity (SAME? is
+// false across iterations, and HIJACK of one does not affect the others).
+// Sharing the body is legal because relative binding only requires that the
+// binding action's keylist match the running frame's (Action_Is_Base_Of()),
+// which holds for all actions sharing the prototype's paramlist.
+//
+// 1. Arrays have no mutation choke point which could invalidate an entry,
+//    so each hit revalidates against a signature of the source's raw cell
+//    bits (including word bindings, which CT_Word() comparison ignores).
+//    The walk mirrors the recursion Clonify_And_Bind_Relative() would do:
+//    anything which would be copied is signed by content, anything which
+//    would be shared is signed by pointer.  A changed source simply misses.
+//
+// 2. Pointer comparisons are sound because each entry holds API handles on
+//    the source cells and the prototype: everything reachable from them is
+//    GC-live, so an equal pointer cannot be a recycled lookalike.
+//
+// 3. Participation requires the body to have the CONST flag (the common
+//    case).  A body built under `do mutable` may be modified through one
+//    function, which must not be visible through another--so those keep
+//    getting private copies.
+//
+
+#define BODY_CACHE_SLOTS 8  // loops rarely make many distinct funcs at once
+
+#define BODY_CACHE_DEEP_TYPES \
+    ((TS_SERIES | TS_SEQUENCE) & ~TS_NOT_COPIED)  // Copy_And_Bind's types
+
+struct Reb_Body_Cache_Entry {
+    REBVAL *archetype;  // API handle of prototype action (nullptr if empty)
+    REBVAL *spec;  // API handle on source cell; keeps array/specifier live
+    REBVAL *body;
+    Array(*) relativized;  // prototype's body copy (live via archetype)
+    REBVAL *signature_handle;  // API handle keeping the signature alive
+    Binary(*) signature;  // raw bits of source for revalidation
+    Flags mkf_flags;
+    Dispatcher *dispatcher;
+    REBLEN details_capacity;
+    bool has_pending_meta;  // prototype stashed spec for Force_Action_Meta()
+    Flags pending_flags;  // analysis flags to stash along with the spec
+};
+
+static struct Reb_Body_Cache_Entry Body_Caches[BODY_CACHE_SLOTS];
+
+struct Reb_Body_Signer {
+    Binary(*) bin;
+    Size offset;  // read cursor while verifying
+    bool writing;
+    bool ok;  // false once verification diverges (or the walk gives up)
+};
+
+static void Sign_Bytes(struct Reb_Body_Signer *s, const void *data, Size size)
+{
+    if (s->writing) {
+        REBLEN used = BIN_LEN(s->bin);
+        EXPAND_SERIES_TAIL(s->bin, size);
+        memcpy(BIN_AT(s->bin, used), data, size);
+    }
+    else {
+        if (
+            s->offset + size > BIN_LEN(s->bin)
+            or memcmp(BIN_AT(s->bin, s->offset), data, size) != 0
+        ){
+            s->ok = false;
+        }
+        s->offset += size;
+    }
+}
+
+static void Sign_Array(struct Reb_Body_Signer *s, Array(const*) a)
+{
+    if (not s->ok)
+        return;
+
+    if (C_STACK_OVERFLOWING(&s)) {
+        s->ok = false;  // deep sources just miss the cache, not a failure
+        return;
+    }
+
+    REBLEN len = ARR_LEN(a);
+    Sign_Bytes(s, &len, sizeof(len));
+
+    Cell(const*) v = ARR_HEAD(a);
+    Cell(const*) tail = ARR_TAIL(a);
+    for (; v != tail; ++v) {
+        uintptr_t raw[4];  // header/extra/payload; covers bindings, see [1]
+        raw[0] = v->header.bits & ~cast(uintptr_t, NODE_FLAG_MARKED);
+        raw[1] = EXTRA(Any, v).u;
+        raw[2] = PAYLOAD(Any, v).first.u;
+        raw[3] = PAYLOAD(Any, v).second.u;
+        Sign_Bytes(s, raw, sizeof(raw));
+
+        enum Reb_Kind heart = CELL_HEART_UNCHECKED(v);
+        if (not (
+            FLAGIT_KIND(heart) & BODY_CACHE_DEEP_TYPES & TS_SERIES_OBJ
+        )){
+            continue;  // would not be copied; raw bits suffice, see [2]
+        }
+
+        if (ANY_ARRAYLIKE(v))
+            Sign_Array(s, VAL_ARRAY(v));
+        else if (ANY_SERIES_KIND(heart)) {
+            const REBSER *sub = VAL_SERIES(v);
+            REBLEN used = SER_USED(sub);
+            Sign_Bytes(s, &used, sizeof(used));
+            Sign_Bytes(s, SER_DATA(m_cast(REBSER*, sub)), used * SER_WIDE(sub));
+        }
+
+        if (not s->ok)
+            return;
+    }
+}
+
+static void Sign_Block(struct Reb_Body_Signer *s, const REBVAL *v)
+{
+    const void *p = VAL_ARRAY(v);
+    Sign_Bytes(s, &p, sizeof(p));
+    REBLEN i = VAL_INDEX(v);
+    Sign_Bytes(s, &i, sizeof(i));
+    p = VAL_SPECIFIER(v);
+    Sign_Bytes(s, &p, sizeof(p));
+    Sign_Array(s, VAL_ARRAY(v));
+}
+
+static void Sign_Source(
+    struct Reb_Body_Signer *s,
+    const REBVAL *spec,
+    const REBVAL *body
+){
+    Sign_Block(s, spec);
+    if (s->ok)
+        Sign_Block(s, body);
+}
+
+static bool Did_Body_Cache_Entry_Match(
+    struct Reb_Body_Cache_Entry *entry,
+    const REBVAL *spec,
+    const REBVAL *body,
+    Flags mkf_flags,
+    Dispatcher *dispatcher,
+    REBLEN details_capacity
+){
+    if (entry->archetype == nullptr)
+        return false;
+
+    if (
+        entry->mkf_flags != mkf_flags
+        or entry->dispatcher != dispatcher
+        or entry->details_capacity != details_capacity
+        or VAL_ARRAY(spec) != VAL_ARRAY(entry->spec)
+        or VAL_ARRAY(body) != VAL_ARRAY(entry->body)
+    ){
+        return false;
+    }
+
+    struct Reb_Body_Signer signer;
+    signer.bin = entry->signature;
+    signer.offset = 0;
+    signer.writing = false;
+    signer.ok = true;
+    Sign_Source(&signer, spec, body);  // catches mutation/rebinding, see [1]
+    return signer.ok and signer.offset == BIN_LEN(entry->signature);
+}
+
+// On a hit, a fresh details array (hence a fresh identity) is made sharing
+// the prototype's paramlist and relativized body.  Returns nullptr if the
+// prototype no longer has the expected shape--e.g. it was HIJACK'd, which
+// swaps its details out from under us--in which case the caller falls back
+// to the ordinary creation path (and the entry gets refilled).
+//
+static Action(*) Try_Make_Action_From_Body_Cache(
+    struct Reb_Body_Cache_Entry *entry,
+    const REBVAL *spec,
+    Dispatcher *dispatcher,
+    REBLEN details_capacity
+){
+    Action(*) proto = VAL_ACTION(entry->archetype);
+
+    if (ACT_DISPATCHER(proto) != dispatcher)
+        return nullptr;  // HIJACK'd (or otherwise retooled)
+
+    Cell(*) proto_body = ARR_AT(ACT_DETAILS(proto), IDX_NATIVE_BODY);
+    if (
+        not IS_BLOCK(proto_body)
+        or VAL_ARRAY(proto_body) != entry->relativized
+    ){
+        return nullptr;
+    }
+
+    Action(*) a = Make_Action(
+        ACT_PARAMLIST(proto),  // shared; identity lives in the details
+        nullptr,  // no partials
+        dispatcher,
+        details_capacity
+    );
+
+    assert(ACT_META(a) == nullptr);
+    if (entry->has_pending_meta) {
+        Array(*) pending = Make_Array_Core(2, NODE_FLAG_MANAGED);
+        SET_SERIES_LEN(pending, 2);
+        Copy_Cell(ARR_AT(pending, 0), spec);
+        Init_Integer(ARR_AT(pending, 1), entry->pending_flags);
+        node_MISC(DetailsMeta, ACT_IDENTITY(a)) = pending;
+    }
+
+    Cell(*) rebound = Init_Relative_Block(
+        ARR_AT(ACT_DETAILS(a), IDX_NATIVE_BODY),
+        a,  // legal: `a` shares the prototype's keylist (Action_Is_Base_Of)
+        entry->relativized
+    );
+    Set_Cell_Flag(rebound, CONST);  // cache participation required CONST
+
+    return a;
+}
+
+static void Fill_Body_Cache_Entry(
+    struct Reb_Body_Cache_Entry *entry,
+    const REBVAL *spec,
+    const REBVAL *body,
+    Flags mkf_flags,
+    Dispatcher *dispatcher,
+    REBLEN details_capacity,
+    Action(*) a,
+    bool has_pending_meta,
+    Flags pending_flags
+){
+    Binary(*) bin = Make_Binary(128);
+    struct Reb_Body_Signer signer;
+    signer.bin = bin;
+    signer.offset = 0;
+    signer.writing = true;
+    signer.ok = true;
+    Sign_Source(&signer, spec, body);
+    if (not signer.ok) {  // e.g. source too deep to walk comfortably
+        Free_Unmanaged_Series(bin);
+        return;
+    }
+
+    REBLEN used = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, 1);  // ensure room for terminator byte
+    TERM_BIN_LEN(bin, used);
+    Manage_Series(bin);  // handle below keeps it alive (manuals must balance)
+
+    if (entry->archetype) {
+        rebRelease(entry->archetype);
+        rebRelease(entry->spec);
+        rebRelease(entry->body);
+        rebRelease(entry->signature_handle);
+    }
+
+    entry->archetype = Copy_Cell(Alloc_Value(), ACT_ARCHETYPE(a));
+    entry->spec = Copy_Cell(Alloc_Value(), spec);
+    entry->body = Copy_Cell(Alloc_Value(), body);
+    entry->signature_handle = Init_Binary(Alloc_Value(), bin);
+    entry->relativized = m_cast(Array(*),
+        VAL_ARRAY(ARR_AT(ACT_DETAILS(a), IDX_NATIVE_BODY))
+    );
+    entry->signature = bin;
+    entry->mkf_flags = mkf_flags;
+    entry->dispatcher = dispatcher;
+    entry->details_capacity = details_capacity;
+    entry->has_pending_meta = has_pending_meta;
+    entry->pending_flags = pending_flags;
+}
+
+
+//
+//  Discard_Interpreted_Body_Cache: C
+//
+// Release the handles pinning the cached prototype actions and sources, so
+// Shutdown_Core() doesn't see them as leaks.
+//
+void Discard_Interpreted_Body_Cache(void)
+{
+    struct Reb_Body_Cache_Entry *entry = Body_Caches;
+    for (; entry != Body_Caches + BODY_CACHE_SLOTS; ++entry) {
+        if (not entry->archetype)
+            continue;
+        rebRelease(entry->archetype);
+        rebRelease(entry->spec);
+        rebRelease(entry->body);
+        rebRelease(entry->signature_handle);
+        entry->archetype = nullptr;
+    }
+}
+
+
 //
 //  Make_Interpreted_Action_May_Fail: C
 //
@@ -236,6 +541,37 @@ Action(*) Make_Interpreted_Action_May_Fail(
     assert(IS_BLOCK(spec) and IS_BLOCK(body));
     assert(details_capacity >= 1);  // relativized body put in details[0]
 
+    // If the same source was just used to make an action of the same shape,
+    // share the prototype's paramlist and relativized body rather than
+    // digesting the spec and deep copying all over again.  (Mutable bodies
+    // can't share, see [3] in the cache notes.)
+    //
+    struct Reb_Body_Cache_Entry *entry = nullptr;
+    if (Get_Cell_Flag(body, CONST)) {
+        entry = &Body_Caches[
+            (cast(uintptr_t, VAL_ARRAY(body)) >> 6) % BODY_CACHE_SLOTS
+        ];
+        if (Did_Body_Cache_Entry_Match(
+            entry, spec, body, mkf_flags, dispatcher, details_capacity
+        )){
+            Action(*) cached = Try_Make_Action_From_Body_Cache(
+                entry, spec, dispatcher, details_capacity
+            );
+            if (cached)
+                return cached;
+        }
+    }
+
+    Flags cache_key_flags = mkf_flags;  // caller's flags key the cache
+
+    // Interpreted functions are churned out in large numbers (think lambdas
+    // made per-item in a loop) and few ever have their help asked for.  So
+    // the description/types/notes meta is built on first META-OF request.
+    //
+    mkf_flags |= MKF_DEFER_META;
+
+    Flags saved_flags = mkf_flags;  // analysis ORs in MKF_HAS_XXX, see below
+
     Context(*) meta;
     Array(*) paramlist = Make_Paramlist_Managed_May_Fail(
         &meta,
@@ -251,7 +587,22 @@ Action(*) Make_Interpreted_Action_May_Fail(
     );
 
     assert(ACT_META(a) == nullptr);
-    mutable_ACT_META(a) = meta;
+
+    if (not (mkf_flags & MKF_DEFER_META))
+        mutable_ACT_META(a) = meta;
+    else if (mkf_flags & (MKF_HAS_DESCRIPTION | MKF_HAS_TYPES | MKF_HAS_NOTES)) {
+        //
+        // The spec has help material in it, but building the meta object was
+        // deferred.  Stash the spec and the flags the analysis ran under, so
+        // Force_Action_Meta() can reproduce it on the first META-OF request.
+        //
+        assert(meta == nullptr);
+        Array(*) pending = Make_Array_Core(2, NODE_FLAG_MANAGED);
+        SET_SERIES_LEN(pending, 2);
+        Copy_Cell(ARR_AT(pending, 0), spec);
+        Init_Integer(ARR_AT(pending, 1), saved_flags & ~MKF_DEFER_META);
+        node_MISC(DetailsMeta, ACT_IDENTITY(a)) = pending;
+    }
 
     Array(*) copy = Copy_And_Bind_Relative_Deep_Managed(
         body,  // new copy has locals bound relatively to the new action
@@ -263,14 +614,14 @@ Action(*) Make_Interpreted_Action_May_Fail(
     //
     if (Get_Subclass_Flag(ARRAY, VAL_ARRAY(spec), HAS_FILE_LINE_UNMASKED)) {
         mutable_LINK(Filename, copy) = LINK(Filename, VAL_ARRAY(spec));
-        copy->misc.line = VAL_ARRAY(spec)->misc.line;
+        copy->misc.line = Array_Line(VAL_ARRAY(spec));
         Set_Subclass_Flag(ARRAY, copy, HAS_FILE_LINE_UNMASKED);
     }
     else if (
         Get_Subclass_Flag(ARRAY, VAL_ARRAY(body), HAS_FILE_LINE_UNMASKED)
     ){
         mutable_LINK(Filename, copy) = LINK(Filename, VAL_ARRAY(body));
-        copy->misc.line = VAL_ARRAY(body)->misc.line;
+        copy->misc.line = Array_Line(VAL_ARRAY(body));
         Set_Subclass_Flag(ARRAY, copy, HAS_FILE_LINE_UNMASKED);
     }
     else {
@@ -279,6 +630,15 @@ Action(*) Make_Interpreted_Action_May_Fail(
         // function it doesn't work...trying to fix that.
     }
 
+    // Until the first dispatch, the copied body tree is reachable only
+    // through the details array being built here.  Mark it as eligible for
+    // the GC to deflate if it stays unexecuted--loaded-but-never-called
+    // functions are pure memory overhead otherwise.  (Only FUNC bodies for
+    // now; Func_Dispatcher() and BODY-OF know to reinflate them.)
+    //
+    if (dispatcher == &Func_Dispatcher)
+        Set_Subclass_Flag(ARRAY, copy, COLD_SOURCE);
+
     // Save the relativized body in the action's details block.  Since it is
     // a Cell(*) and not a REBVAL*, the dispatcher must combine it with a
     // running frame instance (the Frame(*) received by the dispatcher) before
@@ -316,6 +676,24 @@ Action(*) Make_Interpreted_Action_May_Fail(
     if (Get_Cell_Flag(body, CONST))
         Set_Cell_Flag(rebound, CONST);  // Inherit_Const() would need REBVAL*
 
+    // Remember this action as the prototype for its source, so making the
+    // "same" function again can share its paramlist and body copy.  (If the
+    // meta wasn't deferred after all, skip--a hit couldn't reproduce it.)
+    //
+    if (entry and (mkf_flags & MKF_DEFER_META)) {
+        Fill_Body_Cache_Entry(
+            entry,
+            spec,
+            body,
+            cache_key_flags,
+            dispatcher,
+            details_capacity,
+            a,
+            did (mkf_flags & (MKF_HAS_DESCRIPTION | MKF_HAS_TYPES | MKF_HAS_NOTES)),
+            saved_flags & ~MKF_DEFER_META
+        );
+    }
+
     return a;
 }
 
@@ -536,6 +914,7 @@ DECLARE_NATIVE(unwind)
 //      return: []  ; !!! notation for "divergent?"
 //      ^value [<opt> <void> <raised> <pack> any-value!]
 //      /only "Do not do proxying of output variables, just return argument"
+//      /run "Tail call: restart the function from the top, reusing its frame"
 //  ]
 //
 DECLARE_NATIVE(definitional_return)
@@ -586,6 +965,26 @@ DECLARE_NATIVE(definitional_return)
     //
     Action(*) target_fun = target_frame->u.action.original;
 
+    // RETURN/RUN is a tail call: instead of unwinding with a result, restart
+    // the returned-to function from the top.  Recursions written this way
+    // (poke new argument values into the frame via BINDING OF 'RETURN, then
+    // RETURN/RUN) reuse the varlist already allocated rather than pushing a
+    // Frame per call--Action_Executor() catches the REDO-labeled throw and
+    // re-enters typechecking on the same frame.  The ^value argument is not
+    // used, since the restarted function produces the eventual result.
+    //
+    if (REF(run)) {
+        DECLARE_LOCAL (restartee);
+        Copy_Cell(restartee, CTX_ARCHETYPE(f_binding));
+        INIT_VAL_FRAME_PHASE(restartee, FRM_PHASE(target_frame));
+        INIT_VAL_FRAME_BINDING(restartee, FRM_BINDING(target_frame));
+
+        Copy_Cell(SPARE, Lib(REDO));
+        INIT_VAL_ACTION_BINDING(SPARE, f_binding);
+
+        return Init_Thrown_With_Label(FRAME, restartee, SPARE);
+    }
+
     // Defininitional returns are "locals"--there's no argument type check.
     // So TYPESET! bits in the RETURN param are used for legal return types.
     //
@@ -674,7 +1073,7 @@ DECLARE_NATIVE(inherit_meta)
 
     UNUSED(ARG(augment));  // !!! not yet implemented
 
-    Context(*) m1 = ACT_META(VAL_ACTION(original));
+    Context(*) m1 = Force_Action_Meta(VAL_ACTION(original));
     if (not m1)  // nothing to copy
         return COPY(ARG(derived));
 
@@ -682,7 +1081,7 @@ DECLARE_NATIVE(inherit_meta)
     // if it was created via an AUGMENT, it will have some...only the notes
     // and types for the added parameters, the others will be NULL.
     //
-    Context(*) m2 = ACT_META(VAL_ACTION(derived));
+    Context(*) m2 = Force_Action_Meta(VAL_ACTION(derived));
     if (not m2) {  // doesn't have its own information
         m2 = Copy_Context_Shallow_Managed(VAL_CONTEXT(Root_Action_Meta));
         mutable_ACT_META(VAL_ACTION(derived)) = m2;
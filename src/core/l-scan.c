@@ -234,6 +234,94 @@ const Byte Lex_Map[256] =
     LEX_WORD,LEX_WORD,LEX_WORD,LEX_UTFE
 };
 
+
+//=//// WORD-AT-A-TIME SKIPPING OF WHITESPACE AND COMMENTS ////////////////=//
+//
+// Lex_Map gives a one-load classification per byte, but indentation runs and
+// comment bodies still advanced a byte at a time--which is what bounds LOAD
+// on large data files.  These helpers consume such runs a machine word per
+// iteration, reusing the SWAR masks from %sys-char.h (see notes there on why
+// intrinsics aren't needed).
+//
+// The scanner has no end pointer at these call sites--its buffers are
+// NUL-terminated.  So each helper walks bytewise up to a word boundary and
+// only then switches to whole-word loads; an aligned load can't cross a page
+// boundary, and NUL is among the bytes every chunk test stops on.
+//
+
+// Any byte in 0x01..0x20 other than LF and CR (so including TAB and other
+// control characters Lex_Map files under LEX_DEFAULT).  High-bit bytes that
+// alias LEX_DEFAULT (C0, C1, F5, FF) can't appear in valid UTF-8, and would
+// just be handed back to the caller's table-driven loop anyway.
+//
+inline static bool All_Bytes_Lex_Space(uintptr_t chunk) {
+    if (chunk & SWAR_HIGHS)
+        return false;  // some byte is non-ASCII
+    if ((chunk + (SWAR_ONES * 0x5F)) & SWAR_HIGHS)
+        return false;  // some byte is above 0x20 (no carry: all below 0x80)
+    if ((chunk - SWAR_ONES) & ~chunk & SWAR_HIGHS)
+        return false;  // some byte is NUL (the end-of-input delimiter)
+    uintptr_t xlf = chunk ^ (SWAR_ONES * LF);
+    if ((xlf - SWAR_ONES) & ~xlf & SWAR_HIGHS)
+        return false;  // some byte is a linefeed
+    uintptr_t xcr = chunk ^ (SWAR_ONES * CR);
+    if ((xcr - SWAR_ONES) & ~xcr & SWAR_HIGHS)
+        return false;  // some byte is a carriage return
+    return true;
+}
+
+static const Byte* Skip_Lex_Space(const Byte* cp)
+{
+    while (cast(uintptr_t, cp) % UTF8_SWAR_CHUNK != 0) {
+        if (not IS_LEX_SPACE(*cp))
+            return cp;
+        ++cp;
+    }
+    uintptr_t chunk;
+    memcpy(&chunk, cp, sizeof(chunk));  // aligned; compiles to plain load
+    while (All_Bytes_Lex_Space(chunk)) {
+        cp += UTF8_SWAR_CHUNK;
+        memcpy(&chunk, cp, sizeof(chunk));
+    }
+    while (IS_LEX_SPACE(*cp))  // sort out which byte stopped the chunk
+        ++cp;
+    return cp;
+}
+
+// A comment runs to the first NUL, LF, or CR--anything else (including
+// arbitrary UTF-8 continuation bytes) is skipped without classification.
+//
+inline static bool No_Bytes_End_Comment(uintptr_t chunk) {
+    if ((chunk - SWAR_ONES) & ~chunk & SWAR_HIGHS)
+        return false;  // some byte is NUL
+    uintptr_t xlf = chunk ^ (SWAR_ONES * LF);
+    if ((xlf - SWAR_ONES) & ~xlf & SWAR_HIGHS)
+        return false;  // some byte is a linefeed
+    uintptr_t xcr = chunk ^ (SWAR_ONES * CR);
+    if ((xcr - SWAR_ONES) & ~xcr & SWAR_HIGHS)
+        return false;  // some byte is a carriage return
+    return true;
+}
+
+static const Byte* Skip_Comment_Body(const Byte* cp)
+{
+    while (cast(uintptr_t, cp) % UTF8_SWAR_CHUNK != 0) {
+        if (ANY_CR_LF_END(*cp))
+            return cp;
+        ++cp;
+    }
+    uintptr_t chunk;
+    memcpy(&chunk, cp, sizeof(chunk));
+    while (No_Bytes_End_Comment(chunk)) {
+        cp += UTF8_SWAR_CHUNK;
+        memcpy(&chunk, cp, sizeof(chunk));
+    }
+    while (not ANY_CR_LF_END(*cp))
+        ++cp;
+    return cp;
+}
+
+
 #ifdef LOWER_CASE_BYTE
 //
 // Maps each character to its upper case value.  Done this way for speed.
@@ -833,8 +921,7 @@ static LEXFLAGS Prescan_Token(SCAN_STATE *ss)
     const Byte* cp = ss->begin;
     LEXFLAGS flags = 0;  // flags for all LEX_SPECIALs seen after ss->begin[0]
 
-    while (IS_LEX_SPACE(*cp))  // skip whitespace (if any)
-        ++cp;
+    cp = Skip_Lex_Space(cp);  // skip whitespace (if any), a word at a time
     ss->begin = cp;  // don't count leading whitespace as part of token
 
     while (true) {
@@ -1375,8 +1462,7 @@ static enum Reb_Token Maybe_Locate_Token_May_Push_Mold(
         assert(GET_LEX_VALUE(*cp) != LEX_SPECIAL_BAR);  // weird word, handled
 
         if (GET_LEX_VALUE(*cp) == LEX_SPECIAL_SEMICOLON) {  // begin comment
-            while (not ANY_CR_LF_END(*cp))
-                ++cp;
+            cp = Skip_Comment_Body(cp);
             if (*cp == '\0')
                 return TOKEN_END;  // `load ";"` is [] with no newline on tail
             if (*cp == LF)
@@ -1821,6 +1907,55 @@ static enum Reb_Token Maybe_Locate_Token_May_Push_Mold(
 }
 
 
+//=//// SOURCE FORMAT TABLE COLLECTION ////////////////////////////////////=//
+//
+// TRANSCODE/FORMATTED asks every array level of a scan to collect the
+// whitespace that precedes each value it pushes, run-length-encoded into a
+// byte table that gets hung off the popped array for MOLD to replay.  (The
+// byte layout is documented at FORMAT_TABLE_HEADER_SIZE in %sys-array.h.)
+//
+// Tables are unmanaged while a level is collecting into them--attachment
+// manages them, and failure paths have to free them explicitly.
+//
+
+static Byte Format_Byte(REBLEN n)
+  { return n > 255 ? 255 : cast(Byte, n); }
+
+static Binary(*) Make_Format_Table(void)
+{
+    Binary(*) format = Make_Binary(FORMAT_TABLE_HEADER_SIZE + 16);
+    memset(BIN_HEAD(format), 0, FORMAT_TABLE_HEADER_SIZE);
+    TERM_BIN_LEN(format, FORMAT_TABLE_HEADER_SIZE);
+    return format;
+}
+
+static void Record_Format_Run(Binary(*) format, Byte newlines, Byte indent)
+{
+    Size used = BIN_LEN(format);
+    if (used > FORMAT_TABLE_HEADER_SIZE) {  // try extending the last run
+        Byte* last = BIN_AT(format, used - 3);
+        if (last[0] != 255 and last[1] == newlines and last[2] == indent) {
+            ++last[0];
+            return;
+        }
+    }
+    EXPAND_SERIES_TAIL(format, 3);
+    Byte* at = BIN_AT(format, used);
+    at[0] = 1;  // run length
+    at[1] = newlines;
+    at[2] = indent;
+}
+
+static void Attach_Format_Table(Array(*) a, Binary(*) format)
+{
+    assert(Not_Subclass_Flag(ARRAY, a, HAS_FORMAT_TABLE));
+    Manage_Series(format);
+    mutable_MISC(Format, a) = format;  // line number lives in table header
+    Set_Subclass_Flag(ARRAY, a, HAS_FORMAT_TABLE);
+    SET_SERIES_FLAG(a, MISC_NODE_NEEDS_MARK);
+}
+
+
 //
 //  Init_Scan_Level: C
 //
@@ -1850,6 +1985,14 @@ void Init_Scan_Level(
     level->start_line_head = ss->line_head = ss->begin;
     level->start_line = ss->line = line;
     level->mode = '\0';
+
+    level->index = nullptr;  // TRANSCODE/INDEX opts in after this returns
+    level->index_head = nullptr;
+    level->value_start = nullptr;
+
+    level->format = nullptr;  // TRANSCODE/FORMATTED opts in as well
+    level->format_newlines = 0;
+    level->format_indent = 0;
 }
 
 
@@ -1955,10 +2098,27 @@ Bounce Scanner_Executor(Frame(*) f) {
 
     ss->begin = ss->end;  // accept token
 
+    // When collecting a top-level offset index, the first token that isn't
+    // a newline after a completed value is where the next value's bytes
+    // start (quote marks, sigils, and path segments are all "first tokens"
+    // of the value they decorate...only the earliest position counts).
+    //
+    if (
+        (level->index != nullptr or level->format != nullptr)
+        and level->value_start == nullptr
+        and level->token != TOKEN_NEWLINE
+    ){
+        level->value_start = bp;
+        if (level->format != nullptr and bp >= ss->line_head)
+            level->format_indent = cast(REBLEN, bp - ss->line_head);
+    }
+
     switch (level->token) {
       case TOKEN_NEWLINE:
         Set_Executor_Flag(SCAN, f, NEWLINE_PENDING);
         ss->line_head = ep;
+        if (level->format != nullptr)
+            ++level->format_newlines;  // reset when next value is pushed
         goto loop;
 
       case TOKEN_BLANK:
@@ -2156,6 +2316,13 @@ Bounce Scanner_Executor(Frame(*) f) {
         subframe->u.scan.start_line_head = ss->line_head;
 
         subframe->u.scan.mode = (level->token == TOKEN_BLOCK_BEGIN ? ']' : ')');
+        subframe->u.scan.index = nullptr;  // only top level collects offsets
+        if (level->format != nullptr) {  // nested arrays get their own table
+            subframe->u.scan.format = Make_Format_Table();
+            subframe->u.scan.value_start = nullptr;
+        }
+        else
+            subframe->u.scan.format = nullptr;
         STATE = ST_SCANNER_SCANNING_CHILD_ARRAY;
         Push_Frame(OUT, subframe);
         return CATCH_CONTINUE_SUBFRAME(subframe); }
@@ -2173,11 +2340,13 @@ Bounce Scanner_Executor(Frame(*) f) {
             SUBFRAME->baseline.stack_base,
             flags
         );
+        if (SUBFRAME->u.scan.format != nullptr)
+            Attach_Format_Table(a, SUBFRAME->u.scan.format);
         Drop_Frame(SUBFRAME);
 
         // Tag array with line where the beginning bracket/group/etc. was found
         //
-        a->misc.line = ss->line;
+        Set_Array_Line(a, ss->line);
         mutable_LINK(Filename, a) = ss->file;
         Set_Subclass_Flag(ARRAY, a, HAS_FILE_LINE_UNMASKED);
         SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
@@ -2440,6 +2609,8 @@ Bounce Scanner_Executor(Frame(*) f) {
         subframe->u.scan.start_line_head = ss->line_head;
 
         subframe->u.scan.mode = ']';
+        subframe->u.scan.index = nullptr;  // only top level collects offsets
+        subframe->u.scan.format = nullptr;  // constructs re-derive layout
         STATE = ST_SCANNER_SCANNING_CONSTRUCT;
         Push_Frame(OUT, subframe);
         return CATCH_CONTINUE_SUBFRAME(subframe); }
@@ -2629,6 +2800,8 @@ Bounce Scanner_Executor(Frame(*) f) {
                 child->mode = '.';
             else
                 child->mode = '/';
+            child->index = nullptr;  // only top level collects offsets
+            child->format = nullptr;  // paths can't span lines
 
             Push_Frame(OUT, subframe);
 
@@ -2780,7 +2953,7 @@ Bounce Scanner_Executor(Frame(*) f) {
             and IS_SER_ARRAY(SER(VAL_NODE1(TOP)))
         ){
             Array(*) a = ARR(VAL_NODE1(TOP));
-            a->misc.line = ss->line;
+            Set_Array_Line(a, ss->line);
             mutable_LINK(Filename, a) = ss->file;
             Set_Subclass_Flag(ARRAY, a, HAS_FILE_LINE_UNMASKED);
             SET_SERIES_FLAG(a, LINK_NODE_NEEDS_MARK);
@@ -2901,6 +3074,37 @@ Bounce Scanner_Executor(Frame(*) f) {
         Set_Cell_Flag(TOP, NEWLINE_BEFORE);
     }
 
+    // A complete value was pushed, so a collected format table gets a
+    // record of the whitespace run that preceded it.
+    //
+    if (level->format != nullptr) {
+        Record_Format_Run(
+            level->format,
+            Format_Byte(level->format_newlines),
+            Format_Byte(level->format_indent)
+        );
+        level->format_newlines = 0;
+    }
+
+    // A top-level value is complete at this point, so if an offset index
+    // was requested it gets a [start end) pair of 1-based byte offsets.
+    // ss->begin has advanced past the value (including any trailing `:` or
+    // `~` absorbed above) but not past any whitespace following it.
+    //
+    if (level->index != nullptr) {
+        assert(level->value_start != nullptr and ss->begin != nullptr);
+        Init_Integer(
+            Alloc_Tail_Array(level->index),
+            1 + (level->value_start - level->index_head)
+        );
+        Init_Integer(
+            Alloc_Tail_Array(level->index),
+            1 + (ss->begin - level->index_head)
+        );
+    }
+
+    level->value_start = nullptr;  // next token starts the next value
+
     // Added for TRANSCODE/NEXT (LOAD/NEXT is deprecated, see #1703)
     //
     if (Get_Executor_Flag(SCAN, f, JUST_ONCE))
@@ -2918,12 +3122,33 @@ Bounce Scanner_Executor(Frame(*) f) {
 
     // Note: ss->newline_pending may be true; used for ARRAY_NEWLINE_AT_TAIL
 
+    // Seal a collected format table with the whitespace that preceded the
+    // closing delimiter (for a top-level scan just the trailing newlines;
+    // the closing indent byte stays 0).
+    //
+    if (level->format != nullptr) {
+        Byte* head = BIN_HEAD(level->format);
+        head[4] = Format_Byte(level->format_newlines);
+        if (
+            (level->mode == ']' or level->mode == ')')
+            and ss->begin != nullptr
+            and ss->begin > ss->line_head  // begin is just past the delimiter
+        ){
+            head[5] = Format_Byte(
+                cast(REBLEN, (ss->begin - 1) - ss->line_head)
+            );
+        }
+    }
+
     return NONE;
 
 } handle_failure: {  /////////////////////////////////////////////////////////
 
     assert(Is_Raised(OUT));
 
+    if (SUBFRAME->u.scan.format != nullptr)  // was unmanaged while collecting
+        Free_Unmanaged_Series(SUBFRAME->u.scan.format);
+
     Drop_Frame(SUBFRAME);  // could `return RAISE(VAL_CONTEXT(OUT))`
     return OUT;
 }}
@@ -2988,6 +3213,107 @@ Array(*) Scan_UTF8_Managed(
 }
 
 
+//=//// VARIADIC FRAGMENT SCAN CACHE //////////////////////////////////////=//
+//
+// API calls like `rebValue("if", cond, "[...]")` re-scan their UTF-8 string
+// fragments on every call, though the fragments are almost always C string
+// literals whose text never changes.  When a fragment makes up the whole
+// remaining tail of its variadic feed (so no spliced values interleave with
+// the scan), the reified array is cached under the fragment's pointer
+// identity and reused by later calls at the same address--see the
+// DETECTED_AS_UTF8 case in %sys-feed.h.
+//
+// C doesn't promise a literal's address is unique to its text (and a freed
+// heap string's address may be recycled for different text), so each entry
+// keeps a private copy of the fragment's bytes which is verified against
+// the live string on every hit.  The binding context is part of the key,
+// since scanned words get bound to it during the scan.
+//
+// The cached arrays are managed, referenced only by cells of an *unmanaged*
+// holder array: Mark_Root_Series() walks unmanaged arrays' cells, which is
+// what keeps cache entries (and the contexts their words are bound into)
+// alive across garbage collections.  Eviction is just overwriting the cell.
+//
+
+#define SCAN_CACHE_SLOTS 64  // direct-mapped, must be a power of two
+#define SCAN_CACHE_FRAGMENT_MAX 1024  // don't copy arbitrarily big fragments
+
+static struct Scan_Cache_Key {
+    const void *utf8;  // pointer identity of fragment (nullptr if unused)
+    Size size;
+    Byte *copy;  // verification bytes (raw allocation, no GC interaction)
+    Context(*) context;  // words were bound into this during the scan
+    Array(*) reified;  // kept alive by the holder array's cell
+} Scan_Cache_Keys[SCAN_CACHE_SLOTS];
+
+static Array(*) Scan_Cache_Holder;  // unmanaged, so GC marks its cells
+
+inline static struct Scan_Cache_Key *Scan_Cache_Slot(const void *utf8) {
+    uintptr_t bits = cast(uintptr_t, cast(intptr_t, utf8));
+    return &Scan_Cache_Keys[(bits >> 4) & (SCAN_CACHE_SLOTS - 1)];
+}
+
+
+//
+//  Try_Find_Cached_Variadic_Scan: C
+//
+// The pointer identity check is only a hint: the live bytes must match the
+// entry's copy, terminator included (so a shorter string with a matching
+// prefix at a recycled address can't fool it).
+//
+option(Array(*)) Try_Find_Cached_Variadic_Scan(
+    const void *utf8,
+    option(Context(*)) context
+){
+    struct Scan_Cache_Key *key = Scan_Cache_Slot(utf8);
+    if (key->utf8 != utf8 or key->context != try_unwrap(context))
+        return nullptr;
+
+    if (memcmp(utf8, key->copy, key->size + 1) != 0)
+        return nullptr;  // address was reused for different text
+
+    return key->reified;
+}
+
+
+//
+//  Maybe_Cache_Variadic_Scan: C
+//
+// Called after a scan of a fragment which was its feed's entire remaining
+// content.  Direct-mapped: a colliding entry is simply evicted (dropping
+// the holder's cell reference lets the GC reclaim its array in time).
+//
+void Maybe_Cache_Variadic_Scan(
+    const void *utf8,
+    option(Context(*)) context,
+    Array(*) reified
+){
+    Size size = strsize(cast(const char*, utf8));
+    if (size > SCAN_CACHE_FRAGMENT_MAX)
+        return;  // transient buffers (e.g. whole scripts) scan this way too
+
+    struct Scan_Cache_Key *key = Scan_Cache_Slot(utf8);
+    if (key->utf8 != nullptr)
+        FREE_N(Byte, key->size + 1, key->copy);
+
+    key->utf8 = utf8;
+    key->size = size;
+    key->copy = TRY_ALLOC_N(Byte, size + 1);
+    if (not key->copy) {  // allocation failure just means no caching
+        key->utf8 = nullptr;
+        return;
+    }
+    memcpy(key->copy, utf8, size + 1);
+    key->context = try_unwrap(context);
+    key->reified = reified;
+
+    Init_Block(
+        ARR_AT(Scan_Cache_Holder, key - Scan_Cache_Keys),  // GC anchor
+        reified
+    );
+}
+
+
 //
 //  Startup_Scanner: C
 //
@@ -2997,6 +3323,19 @@ void Startup_Scanner(void)
     while (Token_Names[n])
         ++n;
     assert(cast(enum Reb_Token, n) == TOKEN_MAX);
+
+    memset(Scan_Cache_Keys, 0, sizeof(Scan_Cache_Keys));
+
+    Scan_Cache_Holder = Make_Array_Core(
+        SCAN_CACHE_SLOTS,
+        FLAG_FLAVOR(ARRAY) | SERIES_FLAGS_NONE  // unmanaged on purpose
+    );
+    SET_SERIES_LEN(Scan_Cache_Holder, SCAN_CACHE_SLOTS);
+  blockscope {
+    REBLEN i;
+    for (i = 0; i < SCAN_CACHE_SLOTS; ++i)
+        Init_Blank(ARR_AT(Scan_Cache_Holder, i));
+  }
 }
 
 
@@ -3005,6 +3344,14 @@ void Startup_Scanner(void)
 //
 void Shutdown_Scanner(void)
 {
+    REBLEN i;
+    for (i = 0; i < SCAN_CACHE_SLOTS; ++i)
+        if (Scan_Cache_Keys[i].utf8 != nullptr)
+            FREE_N(Byte, Scan_Cache_Keys[i].size + 1, Scan_Cache_Keys[i].copy);
+    memset(Scan_Cache_Keys, 0, sizeof(Scan_Cache_Keys));
+
+    Free_Unmanaged_Series(Scan_Cache_Holder);
+    Scan_Cache_Holder = nullptr;
 }
 
 
@@ -3026,6 +3373,9 @@ void Shutdown_Scanner(void)
 //          [integer! any-word!]
 //      /where "Where you want to bind words to (default unbound)"
 //          [module!]
+//      /index "Word set to [start end ...] byte offsets of top-level values"
+//          [any-word!]
+//      /formatted "Attach tables letting MOLD reproduce source whitespace"
 //  ]
 //
 DECLARE_NATIVE(transcode)
@@ -3139,6 +3489,31 @@ DECLARE_NATIVE(transcode)
 
     Init_Scan_Level(level, ss, file, start_line, bp);
 
+    // The offset index is collected by the scan level as it goes.  It's
+    // stashed in the /WHERE argument slot for GC visibility--that slot has
+    // served its purpose once the context is captured in the feed above.
+    // (Compare the reuse of the return slot for the scan state buffer.)
+    //
+    if (REF(index)) {
+        if (REF(one))
+            fail (Error_Bad_Refines_Raw());  // index spans a whole scan
+
+        Array(*) index = Make_Array_Core(20, NODE_FLAG_MANAGED);
+        Init_Block(ARG(where), index);
+        level->index = index;
+        level->index_head = bp;
+    }
+
+    // Formatting is collected by every level of the scan into unmanaged
+    // binaries, which get managed when attached to the popped arrays.  (The
+    // failure paths free whatever a raising level had collected.)
+    //
+    if (REF(formatted)) {
+        if (REF(one))
+            fail (Error_Bad_Refines_Raw());  // tables span a whole scan
+        level->format = Make_Format_Table();
+    }
+
     TERM_BIN_LEN(bin, sizeof(SCAN_STATE));
 
     Init_Binary(ss_buffer, bin);
@@ -3155,6 +3530,8 @@ DECLARE_NATIVE(transcode)
     // Return a block of the results, so [1] and [[1]] in those cases.
 
     if (Is_Raised(OUT)) {
+        if (SUBFRAME->u.scan.format != nullptr)  // still unmanaged
+            Free_Unmanaged_Series(SUBFRAME->u.scan.format);
         Drop_Frame(SUBFRAME);
         return OUT;  // the raised error
     }
@@ -3174,9 +3551,12 @@ DECLARE_NATIVE(transcode)
 
         Array(*) a = Pop_Stack_Values_Core(STACK_BASE, flags);
 
-        a->misc.line = ss->line;
+        if (SUBFRAME->u.scan.format != nullptr)
+            Attach_Format_Table(a, SUBFRAME->u.scan.format);
+
         mutable_LINK(Filename, a) = ss->file;
         a->leader.bits |= ARRAY_MASK_HAS_FILE_LINE;
+        Set_Array_Line(a, ss->line);
 
         Init_Block(OUT, a);
     }
@@ -3190,6 +3570,15 @@ DECLARE_NATIVE(transcode)
             return THROWN;
     }
 
+    if (REF(index)) {  // collected block was stashed in the /WHERE slot
+        assert(IS_BLOCK(ARG(where)));
+        if (Set_Var_Core_Throws(
+            SPARE, nullptr, ARG(index), SPECIFIED, ARG(where)
+        )){
+            return THROWN;
+        }
+    }
+
     // Return the input BINARY! or TEXT! advanced by how much the transcode
     // operation consumed.
     //
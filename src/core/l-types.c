@@ -644,6 +644,36 @@ const Byte* Scan_Integer(
          }
     }
 
+    // Fast path: a plain digit run (optionally signed) of 18 characters or
+    // fewer cannot overflow an int64, so it can accumulate directly--no
+    // buffer copy and no platform-dependent strtoll/errno machinery.  Tick
+    // marks, junk, and the 19-digit boundary cases drop to the full path.
+    //
+    if (len != 0 && len <= 18) {
+        const Byte* dp = cp;
+        const Byte* ep = cp + len;
+        bool minus = false;
+        if (*dp == '-') {
+            minus = true;
+            ++dp;
+        }
+        else if (*dp == '+')
+            ++dp;
+
+        if (dp != ep) {
+            REBI64 accum = 0;
+            for (; dp != ep; ++dp) {
+                if (*dp < '0' || *dp > '9')
+                    break;
+                accum = accum * 10 + (*dp - '0');
+            }
+            if (dp == ep) {
+                Init_Integer(out, minus ? -accum : accum);
+                return ep;
+            }
+        }
+    }
+
     Byte buf[MAX_NUM_LEN + 4];
     if (len > MAX_NUM_LEN)
         return_NULL; // prevent buffer overflow
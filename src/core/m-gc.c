@@ -59,6 +59,19 @@
 // nodes used for other purposes.  Review in light of any new garbage collect
 // approaches used.
 //
+// !!! A generational scheme (nursery + write barrier, so minor collections
+// only scan recently-created nodes) was investigated for workloads that hold
+// large long-lived datasets, where every Recycle_Core() walking the full
+// live set is the dominant pause cost.  The blocker is that cell writes are
+// raw assignments through macros like Copy_Cell()--there is no funnel point
+// through which an old-to-young pointer store could be trapped to maintain a
+// remembered set, and without that a minor collection cannot soundly prove
+// nursery liveness.  Until cell writes get a barrier-capable choke point,
+// the tractable pieces are: tracking the survivor count (so pacing can grow
+// the allocation budget proportionally to the live set, rather than walking
+// a stable multi-gigabyte heap at a fixed allocation interval), and slicing
+// the phases that don't need barriers.  See GC_Last_Survivors below.
+//
 
 #include "sys-core.h"
 
@@ -136,6 +149,9 @@ static void Queue_Mark_Pairing_Deep(REBVAL *paired)
 
 static void Queue_Unmarked_Accessible_Series_Deep(REBSER *s);
 
+static void Queue_Mark_Cold_Compressed_Array(Array(*) a);
+static void Age_Cold_Source_Array(Array(*) a);
+
 
 // This routine is given the *address* of the node to mark, so that if the
 // node has become inaccessible it can be canonized into the global node for
@@ -209,6 +225,14 @@ static void Queue_Mark_Node_Deep(const Node**pp) {
 //
 static void Queue_Unmarked_Accessible_Series_Deep(REBSER *s)
 {
+    // Shared (blessed) series are GC-exempt: the sweep won't free them, and
+    // since blessing guaranteed everything they reference is also shared,
+    // there is nothing to learn by traversing into them.  Pruning here is
+    // what makes a huge shared dataset cost the GC nothing per recycle.
+    //
+    if (GET_SERIES_FLAG(s, SHARED))
+        return;
+
     s->leader.bits |= NODE_FLAG_MARKED;
     ++mark_count;
 
@@ -255,6 +279,21 @@ static void Queue_Unmarked_Accessible_Series_Deep(REBSER *s)
     else if (IS_SER_ARRAY(s)) {
         Array(*) a = ARR(s);
 
+        if (SER_FLAVOR(a) == FLAVOR_ARRAY) {  // cold flags plain-array-only
+            if (Get_Subclass_Flag(ARRAY, a, COLD_COMPRESSED)) {
+                //
+                // The cell data is a deflate blob; everything the cells
+                // reference is marked through the recorded keepalive slots.
+                // (There are no cells to push onto the mark stack.)
+                //
+                Queue_Mark_Cold_Compressed_Array(a);
+                return;
+            }
+
+            if (Get_Subclass_Flag(ARRAY, a, COLD_SOURCE))
+                Age_Cold_Source_Array(a);  // may queue for deflation
+        }
+
     //=//// MARK BONUS (if not using slot for `bias`) /////////////////////=//
 
         // Whether the bonus slot needs to be marked is dictated by internal
@@ -344,6 +383,25 @@ static void Queue_Mark_Cell_Deep(Cell(const*) cv)
 }
 
 
+// Most of the time spent propagating marks on a large heap is not the flag
+// twiddling--it's cache misses on the leading header byte of the nodes that
+// cells reference, since series stubs are scattered across pool segments.
+// While one cell is being processed, this starts pulling in the lines for
+// the node targets of a cell a little further along in the same array, so
+// the miss overlaps useful work instead of stalling Queue_Mark_Node_Deep().
+//
+// It's only a hint: the peeked cell hasn't been validated, but reading its
+// header bits and payload pointer fields is safe for any initialized cell
+// (fresh cells have no flags set, so nothing gets prefetched).
+//
+inline static void Prefetch_Cell_Node_Targets(Cell(const*) v) {
+    if (v->header.bits & CELL_FLAG_FIRST_IS_NODE)
+        PREFETCH_READ(PAYLOAD(Any, v).first.node);
+    if (v->header.bits & CELL_FLAG_SECOND_IS_NODE)
+        PREFETCH_READ(PAYLOAD(Any, v).second.node);
+}
+
+
 //
 //  Propagate_All_GC_Marks: C
 //
@@ -378,9 +436,16 @@ static void Propagate_All_GC_Marks(void)
         //
         assert(a->leader.bits & NODE_FLAG_MARKED);
 
+        if (SER_USED(GC_Mark_Stack) != 0)  // start pulling next array's cells
+            PREFETCH_READ(ARR_HEAD(
+                *SER_AT(Array(*), GC_Mark_Stack, SER_USED(GC_Mark_Stack) - 1)
+            ));
+
         Cell(*) v = ARR_HEAD(a);
         Cell(const*) tail = ARR_TAIL(a);
         for (; v != tail; ++v) {
+            if (tail - v > 2)  // overlap misses on node targets ahead
+                Prefetch_Cell_Node_Targets(v + 2);
           #if DEBUG
             Flavor flavor = SER_FLAVOR(a);
             assert(flavor <= FLAVOR_MAX_ARRAY);
@@ -416,6 +481,421 @@ static void Propagate_All_GC_Marks(void)
 }
 
 
+//=//// COLD SOURCE COMPRESSION ///////////////////////////////////////////=//
+//
+// Interpreted functions keep a deep relativized copy of their body so the
+// code is available for execution, BODY-OF, and error reporting.  In a
+// long-lived process that loads a lot of code, bodies which are never (or
+// rarely) called can approach the size of the loaded source itself--pure
+// RSS overhead.  Since the body copy is reachable only through the action's
+// details array until the first dispatch (see Clonify_And_Bind_Relative()),
+// a body that stays cold can have its cell data deflated in place, and
+// reinflated if the function ever does run.
+//
+// 1. Creation sets ARRAY_FLAG_COLD_SOURCE on the top-level body array (see
+//    Make_Interpreted_Action_May_Fail()).  Each recycle that marks such an
+//    array bumps an age byte in its INFO; at COLD_SOURCE_AGE_THRESHOLD the
+//    array is queued, and once marking completes the queue is processed--at
+//    that point everything the body references is provably live, so the
+//    keepalive slots recorded with the blob start out consistent.
+//
+// 2. A compressed array keeps its stub (identity, file/line, flags) but its
+//    dynamic data pointer holds a single allocation: a header, then the
+//    node pointers the GC must keep marking on the cells' behalf (in the
+//    deterministic order binding/first/second per cell, exactly the fields
+//    Queue_Mark_Cell_Deep() would visit), then the raw deflate of the cell
+//    memory.  Marking through the slot *addresses* means a referenced
+//    series that decays still gets canonized to PG_Inaccessible_Series;
+//    inflation writes the slots back over the cells' stale pointers, so the
+//    thawed body can't dangle.
+//
+// 3. First dispatch and Get_Maybe_Fake_Action_Body() call
+//    Thaw_Cold_Source(), which reinflates the tree and permanently clears
+//    ARRAY_FLAG_COLD_SOURCE.  The flag is cleared *after* the walk, so a
+//    failure partway (e.g. out of memory) leaves a state that just retries.
+//
+// 4. Only arrays that Clonify_And_Bind_Relative() would have freshly copied
+//    are touched (same deep_types test), so every compressed array is
+//    exclusively owned by the body tree.  An array the evaluator is holding
+//    or that blessing marked SERIES_INFO_HOLD/SERIES_FLAG_SHARED is skipped
+//    outright--though neither should be seen on a never-dispatched body.
+//
+
+#define COLD_SOURCE_AGE(a)          THIRD_BYTE(SER_INFO(a))
+#define mutable_COLD_SOURCE_AGE(a)  mutable_THIRD_BYTE(SER_INFO(a))
+
+#define COLD_SOURCE_AGE_THRESHOLD 8  // recycles unexecuted before deflation
+
+#define COLD_SOURCE_MIN_CELLS 8  // below this, blob overhead eats the win
+
+#define COLD_SOURCE_DEEP_TYPES \
+    ((TS_SERIES | TS_SEQUENCE) & ~TS_NOT_COPIED)  // Clonify's deep types
+
+struct Reb_Cold_Source_Compressed {
+    REBLEN cell_count;  // original SER_USED() in cells
+    REBLEN slot_count;  // node pointers extracted for marking, see [2]
+    Size deflated_size;  // bytes of raw deflate following the slots
+};
+
+inline static const Node** Cold_Compressed_Slots(
+    struct Reb_Cold_Source_Compressed *c
+){
+    return cast(const Node**, cast(void*, c + 1));
+}
+
+inline static Byte* Cold_Compressed_Deflated(
+    struct Reb_Cold_Source_Compressed *c
+){
+    return cast(Byte*, Cold_Compressed_Slots(c) + c->slot_count);
+}
+
+inline static Size Cold_Compressed_Total(
+    struct Reb_Cold_Source_Compressed *c
+){
+    return sizeof(struct Reb_Cold_Source_Compressed)
+        + c->slot_count * sizeof(const Node*)
+        + c->deflated_size;
+}
+
+inline static struct Reb_Cold_Source_Compressed *Cold_Compressed_Data(
+    Array(*) a
+){
+    assert(Get_Subclass_Flag(ARRAY, a, COLD_COMPRESSED));
+    return cast(
+        struct Reb_Cold_Source_Compressed*,
+        cast(void*, a->content.dynamic.data)
+    );
+}
+
+// Mirrors the test Clonify_And_Bind_Relative() used to decide which arrays
+// got fresh copies when the body was made--anything else is shared and must
+// be left alone.  See [4]
+//
+inline static bool Is_Cold_Source_Child(Cell(const*) v) {
+    enum Reb_Kind heart = CELL_HEART_UNCHECKED(v);
+    if (not (FLAGIT_KIND(heart) & COLD_SOURCE_DEEP_TYPES & TS_SERIES_OBJ))
+        return false;
+    return ANY_ARRAYLIKE(v);  // false for byte-packed sequences
+}
+
+// Number of node pointers marking would visit in this cell (the same fields
+// Queue_Mark_Cell_Deep() checks, in the same order).  Returns -1 if the cell
+// holds a reference the keepalive slots can't carry--an unmanaged binding is
+// not kept alive by the GC, so a snapshot of it could go stale.
+//
+static REBINT Cold_Cell_Slot_Count(Cell(const*) v) {
+    REBINT count = 0;
+
+    enum Reb_Kind heart = CELL_HEART_UNCHECKED(v);
+    if (IS_BINDABLE_KIND(heart)) {
+        REBSER *binding = BINDING(v);
+        if (binding != UNBOUND) {
+            if (not (NODE_BYTE(binding) & NODE_BYTEMASK_0x20_MANAGED))
+                return -1;
+            ++count;
+        }
+    }
+
+    if ((v->header.bits & CELL_FLAG_FIRST_IS_NODE) and VAL_NODE1(v))
+        ++count;
+
+    if ((v->header.bits & CELL_FLAG_SECOND_IS_NODE) and VAL_NODE2(v))
+        ++count;
+
+    return count;
+}
+
+static void Queue_Mark_Cold_Compressed_Array(Array(*) a)
+{
+    struct Reb_Cold_Source_Compressed *c = Cold_Compressed_Data(a);
+    const Node** slots = Cold_Compressed_Slots(c);
+
+    REBLEN i;
+    for (i = 0; i < c->slot_count; ++i)
+        Queue_Mark_Node_Deep(&slots[i]);  // by address: canonizes, see [2]
+}
+
+// Bump the survived-unexecuted count of a COLD_SOURCE array being marked.
+// Crossing the threshold queues it for one deflation attempt after the mark
+// phase finishes; the age is left past the threshold so an array whose data
+// turned out incompressible isn't retried every collection.
+//
+static void Age_Cold_Source_Array(Array(*) a)
+{
+    Byte age = COLD_SOURCE_AGE(a);
+    if (age > COLD_SOURCE_AGE_THRESHOLD)
+        return;  // already had its deflation attempt
+
+    mutable_COLD_SOURCE_AGE(a) = age + 1;
+    if (age < COLD_SOURCE_AGE_THRESHOLD)
+        return;  // still warming toward the threshold, see [1]
+
+    if (SER_FULL(GC_Cold_Queue))
+        Extend_Series_If_Necessary(GC_Cold_Queue, 8);
+    *SER_AT(Array(*), GC_Cold_Queue, SER_USED(GC_Cold_Queue)) = a;
+    SET_SERIES_USED(GC_Cold_Queue, SER_USED(GC_Cold_Queue) + 1);
+}
+
+// Try to deflate one array's cell data.  Runs inside Recycle_Core() and so
+// must not fail--any problem (allocation failure, data which doesn't shrink)
+// just leaves the array as it was.
+//
+static bool Try_Deflate_Cold_Array(Array(*) a)
+{
+    assert(SER_FLAVOR(a) == FLAVOR_ARRAY);
+    assert(Not_Subclass_Flag(ARRAY, a, COLD_COMPRESSED));
+    assert(GET_SERIES_FLAG(a, DYNAMIC));
+
+    REBLEN used = ARR_LEN(a);
+    if (used < COLD_SOURCE_MIN_CELLS)
+        return false;
+
+    Byte wide = SER_WIDE(a);
+    Size size_orig = used * wide;
+
+    REBLEN slot_count = 0;
+    Cell(const*) v = ARR_HEAD(a);
+    Cell(const*) tail = ARR_TAIL(a);
+    for (; v != tail; ++v) {
+        REBINT count = Cold_Cell_Slot_Count(v);
+        if (count < 0)
+            return false;  // unmanaged binding; leave this array alone
+        slot_count += count;
+    }
+
+    Size bound = Deflate_Raw_Bound(size_orig);
+    Byte* defbuf = TRY_ALLOC_N(Byte, bound);
+    if (defbuf == nullptr)
+        return false;
+
+    Size deflated_size = bound;
+    if (not Try_Deflate_Raw(
+        defbuf, &deflated_size, a->content.dynamic.data, size_orig
+    )){
+        FREE_N(Byte, bound, defbuf);
+        return false;
+    }
+
+    Size total = sizeof(struct Reb_Cold_Source_Compressed)
+        + slot_count * sizeof(const Node*)
+        + deflated_size;
+
+    if (total >= size_orig) {  // blob plus bookkeeping must actually shrink
+        FREE_N(Byte, bound, defbuf);
+        return false;
+    }
+
+    struct Reb_Cold_Source_Compressed *c = cast(
+        struct Reb_Cold_Source_Compressed*,
+        cast(void*, TRY_ALLOC_N(Byte, total))
+    );
+    if (c == nullptr) {
+        FREE_N(Byte, bound, defbuf);
+        return false;
+    }
+
+    c->cell_count = used;
+    c->slot_count = slot_count;
+    c->deflated_size = deflated_size;
+
+    const Node** slots = Cold_Compressed_Slots(c);
+    REBLEN i = 0;
+    for (v = ARR_HEAD(a); v != tail; ++v) {  // same order as the count pass
+        enum Reb_Kind heart = CELL_HEART_UNCHECKED(v);
+        if (IS_BINDABLE_KIND(heart)) {
+            if (BINDING(v) != UNBOUND)
+                slots[i++] = v->extra.Binding;
+        }
+        if ((v->header.bits & CELL_FLAG_FIRST_IS_NODE) and VAL_NODE1(v))
+            slots[i++] = PAYLOAD(Any, v).first.node;
+        if ((v->header.bits & CELL_FLAG_SECOND_IS_NODE) and VAL_NODE2(v))
+            slots[i++] = PAYLOAD(Any, v).second.node;
+    }
+    assert(i == slot_count);
+
+    memcpy(Cold_Compressed_Deflated(c), defbuf, deflated_size);
+    FREE_N(Byte, bound, defbuf);
+
+    // Release the cell data the same way Decay_Series() would have.
+    //
+    REBLEN bias = SER_BIAS(a);
+    Size old_total = (bias + SER_REST(a)) * wide;
+    char *unbiased = a->content.dynamic.data - (wide * bias);
+    Free_Unbiased_Series_Data(unbiased, old_total);
+
+    a->content.dynamic.data = cast(char*, cast(void*, c));
+    a->content.dynamic.used = 0;  // stray walkers see an empty array
+    a->content.dynamic.rest = 1 + total / wide;  // approximate, for stats
+    SER_SET_BIAS(a, 0);
+    Set_Subclass_Flag(ARRAY, a, COLD_COMPRESSED);
+
+    if (old_total > total) {
+        int tmp;  // freed more than allocated: credit ballast like a decay
+        GC_Ballast = REB_I32_ADD_OF(GC_Ballast, old_total - total, &tmp)
+            ? INT32_MAX
+            : tmp;
+    }
+
+    return true;
+}
+
+// Deflate a body tree bottom-up, recursing only into the arrays the body
+// exclusively owns, see [4].  Singular (non-dynamic) arrays can't hold a
+// blob but can still reference deflatable children through their one cell.
+//
+static void Deflate_Cold_Tree(Array(*) a)
+{
+    if (C_STACK_OVERFLOWING(&a))
+        return;  // deeper levels just stay uncompressed
+
+    if (SER_FLAVOR(a) != FLAVOR_ARRAY)
+        return;  // shared context/action guts are never touched
+    if (Get_Subclass_Flag(ARRAY, a, COLD_COMPRESSED))
+        return;
+
+    if (GET_SERIES_INFO(a, HOLD) or GET_SERIES_FLAG(a, SHARED))
+        return;  // someone else is invested in this subtree, see [4]
+
+    Cell(const*) v = ARR_HEAD(a);
+    Cell(const*) tail = ARR_TAIL(a);
+    for (; v != tail; ++v) {
+        if (Is_Cold_Source_Child(v))
+            Deflate_Cold_Tree(ARR(m_cast(Node*, VAL_NODE1(v))));
+    }
+
+    if (
+        GET_SERIES_FLAG(a, DYNAMIC)
+        and NOT_SERIES_FLAG(a, DATA_NOT_OWNED)
+    ){
+        Try_Deflate_Cold_Array(a);  // children stay deflated if this fails
+    }
+}
+
+// Process the bodies that crossed the age threshold during this recycle's
+// mark phase.  Called by Recycle_Core() after marking completes, see [1].
+// (A shutdown recycle only marks partially, so its candidates are dropped.)
+//
+static void Deflate_Cold_Source_Queue(bool shutdown)
+{
+    REBLEN n = SER_USED(GC_Cold_Queue);
+    if (n == 0)
+        return;
+
+    if (not shutdown) {
+        REBLEN i;
+        for (i = 0; i < n; ++i) {
+            Array(*) a = *SER_AT(Array(*), GC_Cold_Queue, i);
+            assert(Get_Subclass_Flag(ARRAY, a, COLD_SOURCE));
+            Deflate_Cold_Tree(a);
+        }
+    }
+
+    SET_SERIES_USED(GC_Cold_Queue, 0);
+}
+
+// Reinflate one array's cells from its blob and write the (possibly
+// canonized) keepalive slots back over the stale pointers, see [2].
+//
+static void Inflate_Cold_Array(Array(*) a)
+{
+    struct Reb_Cold_Source_Compressed *c = Cold_Compressed_Data(a);
+    REBLEN cell_count = c->cell_count;
+    Byte wide = SER_WIDE(a);
+
+    char *old_data = a->content.dynamic.data;
+    REBLEN old_rest = a->content.dynamic.rest;
+
+    if (not Did_Series_Data_Alloc(a, cell_count + 1)) {
+        a->content.dynamic.data = old_data;  // still compressed, can retry
+        a->content.dynamic.rest = old_rest;
+        fail (Error_No_Memory(cast(REBLEN, cell_count + 1) * wide));
+    }
+
+    if (not Try_Inflate_Raw(
+        a->content.dynamic.data,
+        cell_count * wide,
+        Cold_Compressed_Deflated(c),
+        c->deflated_size
+    )){
+        panic (a);  // we wrote this blob; failure means heap corruption
+    }
+
+    a->content.dynamic.used = cell_count;
+    TERM_SERIES_IF_NECESSARY(a);
+
+    const Node** slots = Cold_Compressed_Slots(c);
+    REBLEN i = 0;
+    Cell(*) v = ARR_HEAD(a);
+    Cell(const*) tail = ARR_TAIL(a);
+    for (; v != tail; ++v) {  // inflated fields make the same tests pass
+        enum Reb_Kind heart = CELL_HEART_UNCHECKED(v);
+        if (IS_BINDABLE_KIND(heart)) {
+            if (BINDING(v) != UNBOUND)
+                v->extra.Binding = slots[i++];
+        }
+        if ((v->header.bits & CELL_FLAG_FIRST_IS_NODE) and VAL_NODE1(v))
+            PAYLOAD(Any, v).first.node = slots[i++];
+        if ((v->header.bits & CELL_FLAG_SECOND_IS_NODE) and VAL_NODE2(v))
+            PAYLOAD(Any, v).second.node = slots[i++];
+    }
+    assert(i == c->slot_count);
+
+    Clear_Subclass_Flag(ARRAY, a, COLD_COMPRESSED);
+    FREE_N(Byte, Cold_Compressed_Total(c), cast(Byte*, cast(void*, c)));
+}
+
+static void Thaw_Cold_Tree(Array(*) a)
+{
+    if (C_STACK_OVERFLOWING(&a))
+        Fail_Stack_Overflow();  // flags intact; a retry is consistent
+
+    if (SER_FLAVOR(a) != FLAVOR_ARRAY)
+        return;
+
+    if (Get_Subclass_Flag(ARRAY, a, COLD_COMPRESSED))
+        Inflate_Cold_Array(a);  // may fail on out-of-memory
+
+    Cell(const*) v = ARR_HEAD(a);
+    Cell(const*) tail = ARR_TAIL(a);
+    for (; v != tail; ++v) {
+        if (Is_Cold_Source_Child(v))
+            Thaw_Cold_Tree(ARR(m_cast(Node*, VAL_NODE1(v))));
+    }
+}
+
+//
+//  Thaw_Cold_Source: C
+//
+// Make a cold function body ordinary again: reinflate any deflated arrays in
+// the tree and give up eligibility for future compression.  Called on the
+// first dispatch (Func_Dispatcher()) and by Get_Maybe_Fake_Action_Body()
+// before the body can be seen or executed, see [3].
+//
+void Thaw_Cold_Source(Array(*) a)
+{
+    assert(Get_Subclass_Flag(ARRAY, a, COLD_SOURCE));
+
+    Thaw_Cold_Tree(a);  // can fail; flag cleared only on full success
+
+    Clear_Subclass_Flag(ARRAY, a, COLD_SOURCE);
+}
+
+//
+//  Decay_Cold_Compressed_Array: C
+//
+// Hook for Decay_Series(): a compressed array's data pointer isn't a biased
+// pool allocation, so the generic release math doesn't apply.  Returns the
+// number of bytes freed for the caller's ballast accounting.
+//
+Size Decay_Cold_Compressed_Array(Array(*) a)
+{
+    struct Reb_Cold_Source_Compressed *c = Cold_Compressed_Data(a);
+    Size total = Cold_Compressed_Total(c);
+    FREE_N(Byte, total, cast(Byte*, cast(void*, c)));
+    return total;
+}
+
+
 //
 //  Reify_Variadic_Feed_As_Array_Feed: C
 //
@@ -494,6 +974,8 @@ void Reify_Variadic_Feed_As_Array_Feed(
     }
 
     assert(FEED_INDEX(feed) <= cast(Index, ARR_LEN(FEED_ARRAY(feed))));
+
+    Update_Feed_Cursor(feed);  // singular now points at the reified array
 }
 
 
@@ -905,105 +1387,125 @@ static void Mark_Frame_Stack_Deep(void)
 //    cells a size greater than REBSER size require doing pairings in a
 //    different pool.
 //
-static Count Sweep_Series(void)
+// 3. The count of stubs that survive a sweep approximates the live set size.
+//    It is kept in GC_Last_Survivors so that collection pacing can scale the
+//    allocation budget to the heap that must be walked--a large stable heap
+//    should not be re-marked at the same allocation interval as a small one.
+//
+static Count Sweep_Stub_Segment(Segment* seg, Count *survivors)
 {
     Count sweep_count = 0;
 
-  blockscope {
-    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+    Byte* stub = cast(Byte*, seg + 1);  // byte beats strict alias, see [1]
+
+    for (; n > 0; --n, stub += sizeof(Stub)) {
+        switch (*stub >> 4) {
+          case 0:
+          case 1:  // 0x1
+          case 2:  // 0x2
+          case 3:  // 0x2 + 0x1
+          case 4:  // 0x4
+          case 5:  // 0x4 + 0x1
+          case 6:  // 0x4 + 0x2
+          case 7:  // 0x4 + 0x2 + 0x1
+            //
+            // NODE_FLAG_NODE (0x8) is clear.  This signature is
+            // reserved for UTF-8 strings (corresponding to valid ASCII
+            // values in the first byte).
+            //
+            panic (stub);
 
-    for (; seg != nullptr; seg = seg->next) {
-        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
-        Byte* stub = cast(Byte*, seg + 1);  // byte beats strict alias, see [1]
+        // v-- Everything below here has NODE_FLAG_NODE set (0x8)
 
-        for (; n > 0; --n, stub += sizeof(Stub)) {
-            switch (*stub >> 4) {
-              case 0:
-              case 1:  // 0x1
-              case 2:  // 0x2
-              case 3:  // 0x2 + 0x1
-              case 4:  // 0x4
-              case 5:  // 0x4 + 0x1
-              case 6:  // 0x4 + 0x2
-              case 7:  // 0x4 + 0x2 + 0x1
-                //
-                // NODE_FLAG_NODE (0x8) is clear.  This signature is
-                // reserved for UTF-8 strings (corresponding to valid ASCII
-                // values in the first byte).
-                //
-                panic (stub);
-
-            // v-- Everything below here has NODE_FLAG_NODE set (0x8)
+          case 8:
+            // 0x8: unmanaged and unmarked, e.g. a series that was made
+            // with Make_Series() and hasn't been managed.  It doesn't
+            // participate in the GC.  Leave it as is.
+            //
+            // !!! Are there actually legitimate reasons to do this with
+            // arrays, where the creator knows the cells do not need
+            // GC protection?  Should finding an array in this state be
+            // considered a problem (e.g. the GC ran when you thought it
+            // couldn't run yet, hence would be able to free the array?)
+            //
+            break;
 
-              case 8:
-                // 0x8: unmanaged and unmarked, e.g. a series that was made
-                // with Make_Series() and hasn't been managed.  It doesn't
-                // participate in the GC.  Leave it as is.
-                //
-                // !!! Are there actually legitimate reasons to do this with
-                // arrays, where the creator knows the cells do not need
-                // GC protection?  Should finding an array in this state be
-                // considered a problem (e.g. the GC ran when you thought it
-                // couldn't run yet, hence would be able to free the array?)
-                //
+          case 9:
+            // 0x8 + 0x1: marked but not managed.  The marking phase
+            // asserts nodes are managed, so ordinarily this can't
+            // happen.  But while incremental sweep slices are
+            // outstanding, unmanaged nodes are allocated "black" so a
+            // later slice won't misread them...just clear the mark.
+            //
+            if (GC_Sweep_Pending) {
+                *stub &= ~NODE_BYTEMASK_0x10_MARKED;
                 break;
+            }
+            panic (stub);
 
-              case 9:
-                // 0x8 + 0x1: marked but not managed, this can't happen,
-                // because the marking itself asserts nodes are managed.
-                //
-                panic (stub);
-
-              case 10:
-                // 0x8 + 0x2: managed but didn't get marked, should be GC'd
-                //
-                // !!! It would be nice if we could have NODE_FLAG_CELL here
-                // as part of the switch, but see its definition for why it
-                // is at position 8 from left and not an earlier bit.
-                //
-                if (*stub & NODE_BYTEMASK_0x01_CELL) {
-                    assert(not (*stub & NODE_BYTEMASK_0x02_ROOT));
-                    Free_Pooled(STUB_POOL, stub);  // Free_Pairing manual
-                }
-                else {
-                    REBSER *s = cast(REBSER*, stub);
-                    GC_Kill_Series(s);
+          case 10:
+            // 0x8 + 0x2: managed but didn't get marked, should be GC'd
+            //
+            // !!! It would be nice if we could have NODE_FLAG_CELL here
+            // as part of the switch, but see its definition for why it
+            // is at position 8 from left and not an earlier bit.
+            //
+            if (*stub & NODE_BYTEMASK_0x01_CELL) {
+                assert(not (*stub & NODE_BYTEMASK_0x02_ROOT));
+                Free_Pooled(STUB_POOL, stub);  // Free_Pairing manual
+            }
+            else {
+                REBSER *s = cast(REBSER*, stub);
+                if (GET_SERIES_FLAG(s, SHARED)) {  // blessed, GC-exempt
+                    ++(*survivors);  // marking pruned, so no mark to clear
+                    break;
                 }
-                ++sweep_count;
-                break;
+                if (PG_GC_Decay_Batch == 0 or not Try_Defer_Stub_Decay(s))
+                    GC_Kill_Series(s);  // else checkpoint batches free it
+            }
+            ++sweep_count;
+            break;
 
-              case 11:
-                // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
-                // Don't GC it, just clear the mark.
-                //
-                *stub &= ~NODE_BYTEMASK_0x10_MARKED;
-              #if !defined(NDEBUG)
-                --mark_count;
-              #endif
-                break;
+          case 11:
+            // 0x8 + 0x2 + 0x1: managed and marked, so it's still live.
+            // Don't GC it, just clear the mark.
+            //
+            *stub &= ~NODE_BYTEMASK_0x10_MARKED;
+            ++(*survivors);
+          #if !defined(NDEBUG)
+            --mark_count;
+          #endif
+            break;
 
-            // v-- Everything below this line has the two leftmost bits set
-            // in the header.  In the *general* case this could be a valid
-            // first byte of a multi-byte sequence in UTF-8...so only the
-            // special bit pattern of the free case uses this.
+        // v-- Everything below this line has the two leftmost bits set
+        // in the header.  In the *general* case this could be a valid
+        // first byte of a multi-byte sequence in UTF-8...so only the
+        // special bit pattern of the free case uses this.
 
-              case 12:
-                // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
-                //
-                assert(*stub == FREED_SERIES_BYTE);
-                break;
+          case 12:
+            // 0x8 + 0x4: free node, uses special illegal UTF-8 byte
+            //
+            assert(*stub == FREED_SERIES_BYTE);
+            break;
 
-              case 13:
-              case 14:
-              case 15:
-                panic (stub);  // 0x8 + 0x4 + ... reserved for UTF-8
-            }
+          case 13:
+          case 14:
+          case 15:
+            panic (stub);  // 0x8 + 0x4 + ... reserved for UTF-8
         }
     }
-  }
 
-  #if UNUSUAL_CELL_SIZE  // pairing pool is separate in this case, see [2]
-  blockscope {
+    return sweep_count;
+}
+
+
+#if UNUSUAL_CELL_SIZE  // pairing pool is separate in this case, see [2]
+
+static Count Sweep_Pairings(void)
+{
+    Count sweep_count = 0;
+
     Segment* seg = Mem_Pools[PAIR_POOL].segments;
 
     for (; seg != nullptr; seg = seg->next) {
@@ -1031,15 +1533,307 @@ static Count Sweep_Series(void)
                     ++sweep_count;
                 }
             }
+            else if (v->header.bits & NODE_FLAG_MARKED) {
+                //
+                // Unmanaged pairings allocated "black" during an incremental
+                // sweep window carry a stray mark; clear it so it can't be
+                // mistaken for a trace result by the next marking phase.
+                //
+                assert(GC_Sweep_Pending);
+                v->header.bits &= ~NODE_FLAG_MARKED;
+            }
         }
     }
-  }
+
+    return sweep_count;
+}
+
+#endif
+
+
+static Count Sweep_Series(void)
+{
+    Count sweep_count = 0;
+    Count survivor_count = 0;  // managed stubs that stay live, see [3]
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next)
+        sweep_count += Sweep_Stub_Segment(seg, &survivor_count);
+
+  #if UNUSUAL_CELL_SIZE
+    sweep_count += Sweep_Pairings();
   #endif
 
+    GC_Last_Survivors = survivor_count;  // live set estimate, see [3]
+
+    if (PG_Mem_Tally) {  // allocation accounting, see MEMORY-TALLY
+        PG_Mem_Tally->Stubs_Swept += sweep_count;
+        PG_Mem_Tally->Stubs_Survived += survivor_count;
+    }
+
     return sweep_count;
 }
 
 
+// While sweep slices are outstanding, every new node comes into existence
+// pre-marked ("black"), since a slice that hasn't reached its segment yet
+// would otherwise see a managed-but-unmarked node and reap it.  The newborn
+// list remembers them so the window close can clear the stray marks--they
+// were never produced by tracing, so they must not survive into the next
+// marking phase (a pre-marked node would be skipped without its contents
+// getting traced).
+//
+static void Flush_Sweep_Newborns(void)
+{
+    assert(not GC_Sweep_Pending);  // stop blackening before flushing
+
+    void* *np = SER_HEAD(void*, GC_Sweep_Newborns);
+    REBLEN n = SER_USED(GC_Sweep_Newborns);
+    for (; n > 0; --n, ++np) {
+        Byte* b = cast(Byte*, *np);
+        if (*b == FREED_SERIES_BYTE)
+            continue;  // node was freed (and possibly reused) mid-window
+        *b &= ~NODE_BYTEMASK_0x10_MARKED;
+    }
+
+    SET_SERIES_USED(GC_Sweep_Newborns, 0);
+}
+
+
+//
+//  Blacken_Node_During_Sweep: C
+//
+// Called on node creation (and when an existing node becomes managed) while
+// an incremental sweep has slices outstanding.  See Flush_Sweep_Newborns().
+//
+void Blacken_Node_During_Sweep(void *p)
+{
+    assert(GC_Sweep_Pending);
+
+    Byte* b = cast(Byte*, p);
+    *b |= NODE_BYTEMASK_0x10_MARKED;
+
+    if (SER_FULL(GC_Sweep_Newborns))
+        Extend_Series_If_Necessary(GC_Sweep_Newborns, 8);
+
+    *SER_AT(void*, GC_Sweep_Newborns, SER_USED(GC_Sweep_Newborns)) = p;
+    SET_SERIES_USED(GC_Sweep_Newborns, SER_USED(GC_Sweep_Newborns) + 1);
+}
+
+
+//
+//  Sweep_Series_Slice: C
+//
+// Sweep up to `max_segments` segments of the stub pool, resuming where the
+// previous slice left off (0 means drain everything that remains).  When the
+// final segment is done, the pairing pool is swept and the window closes.
+//
+// Marking cannot be sliced this way: without a write barrier on cell
+// assignment, evaluation interleaved with partial marking could hide live
+// references behind already-blackened nodes.  Sweeping has no such hazard,
+// as liveness was fully decided before the first slice.
+//
+Count Sweep_Series_Slice(REBLEN max_segments)
+{
+    assert(GC_Sweep_Pending);
+
+    Count sweep_count = 0;
+
+    REBLEN budget = max_segments;
+    while (GC_Sweep_Segment != nullptr) {
+        sweep_count += Sweep_Stub_Segment(GC_Sweep_Segment, &GC_Sweep_Survivors);
+        GC_Sweep_Segment = GC_Sweep_Segment->next;
+        if (max_segments != 0 and --budget == 0)
+            break;
+    }
+
+    if (GC_Sweep_Segment != nullptr) {
+        if (PG_Mem_Tally)
+            PG_Mem_Tally->Stubs_Swept += sweep_count;
+        return sweep_count;  // slices still outstanding
+    }
+
+  #if UNUSUAL_CELL_SIZE
+    sweep_count += Sweep_Pairings();  // small enough to not slice
+  #endif
+
+    GC_Sweep_Pending = false;
+    Update_Signal_Timer_Demand();  // periodic slice callouts no longer needed
+    Flush_Sweep_Newborns();
+
+    GC_Last_Survivors = GC_Sweep_Survivors;  // live set estimate, see [3]
+
+    if (PG_Mem_Tally) {  // allocation accounting, see MEMORY-TALLY
+        PG_Mem_Tally->Stubs_Swept += sweep_count;
+        PG_Mem_Tally->Stubs_Survived += GC_Sweep_Survivors;
+    }
+
+    return sweep_count;
+}
+
+
+//=//// SHARED (GC-EXEMPT) BLESSING ///////////////////////////////////////=//
+//
+// The SHARE native stamps SERIES_FLAG_SHARED on everything reachable from a
+// deeply-frozen value, making the whole graph exempt from collection: the
+// marking phase prunes at a shared stub, and the sweep treats unmarked
+// shared stubs as survivors.  See remarks on the flag in %sys-rebser.h.
+//
+// Pruned marking is only sound if nothing reachable from a shared stub can
+// come to point at a collectible node after the blessing.  So the entire
+// closure must be incapable of acquiring new node references: frozen-deep
+// plain arrays, interned symbols, and byte-width series (whose content can
+// never hold a node, so even mutable ones--like the filename strings that
+// arrays with file-line info link to--are safe).  Bindings into contexts,
+// actions, and PAIR! pairings (cells have no flag space to spare for this)
+// disqualify the graph, and the blessing is refused without changing any
+// flags.  Pure loaded data qualifies, which is the case the feature exists
+// for.
+
+static bool Stub_Eligible_For_Sharing(REBSER *s)
+{
+    if (GET_SERIES_FLAG(s, SHARED))
+        return true;  // already blessed via an overlapping graph
+
+    if (IS_SER_ARRAY(s)) {
+        if (SER_FLAVOR(s) != FLAVOR_ARRAY)
+            return false;  // varlist, pairlist, patch...mutable innards
+        return GET_SERIES_INFO(s, FROZEN_DEEP);
+    }
+
+    if (SER_FLAVOR(s) >= FLAVOR_MIN_BYTESIZE)
+        return true;  // binaries, strings, symbols: bytes can't be nodes
+
+    return false;  // keylists, hashlists...can grow new node references
+}
+
+
+//
+//  Try_Bless_Value_Shared: C
+//
+// The traversal is the GC's own marking machinery, so the blessed closure
+// agrees exactly with what the GC would keep alive...then a pass over the
+// stub pool converts the marks into SERIES_FLAG_SHARED.
+//
+// Returns how many stubs were newly blessed, or -1 if something in the
+// value's graph was ineligible (in which case no flags were changed).
+//
+REBINT Try_Bless_Value_Shared(Cell(const*) v)
+{
+    assert(not GC_Recycling);
+
+    if (GC_Sweep_Pending)
+        Sweep_Series_Slice(0);  // don't mingle bless marks with sweep state
+
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    Queue_Mark_Cell_Deep(v);
+    Propagate_All_GC_Marks();
+
+    // First pass: no stub that got marked may be ineligible.  (Marked cells
+    // in the stub pool are managed pairings--no flag space, so no blessing.)
+    //
+    bool eligible = true;
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if (not (*stub & NODE_BYTEMASK_0x10_MARKED))
+                continue;
+            if (*stub & NODE_BYTEMASK_0x01_CELL)
+                eligible = false;
+            else if (not Stub_Eligible_For_Sharing(cast(REBSER*, stub)))
+                eligible = false;
+        }
+    }
+
+  #if UNUSUAL_CELL_SIZE  // pairings are in their own pool, scrub any marks
+    seg = Mem_Pools[PAIR_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Length len = Mem_Pools[PAIR_POOL].num_units_per_segment;
+        REBVAL *paired = cast(REBVAL*, seg + 1);
+        for (; len > 0; --len, paired += 2) {
+            if (paired->header.bits & SERIES_FLAG_FREE)
+                continue;
+            if (not (paired->header.bits & NODE_FLAG_MARKED))
+                continue;
+            eligible = false;  // managed pairing in graph, can't bless
+            paired->header.bits &= ~NODE_FLAG_MARKED;
+          #if !defined(NDEBUG)
+            --mark_count;
+          #endif
+        }
+    }
+  #endif
+
+    // Second pass: erase the marks (the next Recycle must start clean), and
+    // stamp the shared flag if the graph qualified.
+    //
+    REBINT blessed = 0;
+
+    seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if (not (*stub & NODE_BYTEMASK_0x10_MARKED))
+                continue;
+            *stub &= ~NODE_BYTEMASK_0x10_MARKED;
+          #if !defined(NDEBUG)
+            --mark_count;
+          #endif
+            if (eligible and not (*stub & NODE_BYTEMASK_0x01_CELL)) {
+                SET_SERIES_FLAG(cast(REBSER*, stub), SHARED);
+                ++blessed;
+            }
+        }
+    }
+
+    ASSERT_NO_GC_MARKS_PENDING();
+
+    return eligible ? blessed : -1;
+}
+
+
+//
+//  Clear_All_Shared_Flags: C
+//
+// Used by UNSHARE when a root's refcount hits zero.  Since graphs may
+// overlap, the flags can't be cleared for just one root...so they are all
+// cleared, and the caller re-blesses the roots that remain.  Unblessed
+// stubs just become ordinary GC-managed series again; if nothing else
+// references them, the next recycle reclaims them.
+//
+Count Clear_All_Shared_Flags(void)
+{
+    if (GC_Sweep_Pending)
+        Sweep_Series_Slice(0);  // sweep believed these stubs were exempt
+
+    Count cleared = 0;
+
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+        for (; n > 0; --n, stub += sizeof(Stub)) {
+            if (*stub == FREED_SERIES_BYTE)
+                continue;
+            if (*stub & NODE_BYTEMASK_0x01_CELL)
+                continue;  // pairings never get blessed
+            REBSER *s = cast(REBSER*, stub);
+            if (GET_SERIES_FLAG(s, SHARED)) {
+                CLEAR_SERIES_FLAG(s, SHARED);
+                ++cleared;
+            }
+        }
+    }
+
+    return cleared;
+}
+
+
 #if !defined(NDEBUG)
 
 //
@@ -1108,6 +1902,64 @@ REBLEN Fill_Sweeplist(REBSER *sweeplist)
 #endif
 
 
+//
+//  Update_GC_Pacing: C
+//
+// Decide how many bytes may be allocated before the next automatic recycle,
+// and put that in GC_Ballast (which counts down in the allocators and raises
+// SIG_RECYCLE when it crosses zero).
+//
+// Historically the budget was a constant: every recycle reset the ballast to
+// TG_Ballast, regardless of heap size.  That serves interactive use, but a
+// fixed interval is pathological at the extremes--an allocation-heavy load
+// phase with a large live heap re-marks millions of surviving nodes every
+// few megabytes, while a workload the constant happens to overshoot balloons
+// before any collection runs.
+//
+// When RECYCLE/ADAPTIVE sets a growth percentage, the budget instead scales
+// with the live heap: the process may grow by that percentage of what
+// survived the collection just finished before being collected again.  This
+// keeps the marking cost amortized at a roughly constant fraction of
+// allocation work.  (GC_Last_Survivors tracks the same quantity in stub
+// counts--see Sweep_Stub_Segment()--and is used here as yield feedback: a
+// collection that swept almost nothing relative to the surviving set was
+// wasted effort, so the headroom is doubled rather than repeating it soon.)
+//
+// RECYCLE/MAX-HEAP gives a soft ceiling: pacing stops granting headroom as
+// usage approaches it, falling back to eager small-budget collections above
+// it.  It is "soft" in that it only influences scheduling--allocations that
+// genuinely outlive collection still succeed.  (PG_Mem_Limit via SECURE is
+// the hard limit that makes allocations fail.)
+//
+static void Update_GC_Pacing(REBLEN sweep_count)
+{
+    if (TG_GC_Growth_Pct == 0) {  // adaptive pacing off, fixed budget
+        GC_Ballast = TG_Ballast;
+        return;
+    }
+
+    REBI64 ballast = (cast(REBI64, PG_Mem_Usage) * TG_GC_Growth_Pct) / 100;
+
+    if (sweep_count < GC_Last_Survivors / 8)  // low yield, see comment above
+        ballast = ballast * 2;
+
+    if (ballast < TG_Ballast)
+        ballast = TG_Ballast;  // configured ballast acts as the floor
+
+    if (TG_GC_Max_Heap != 0) {
+        if (PG_Mem_Usage >= TG_GC_Max_Heap)
+            ballast = MEM_BALLAST / 8;  // over budget, collect eagerly
+        else if (PG_Mem_Usage + cast(REBU64, ballast) > TG_GC_Max_Heap)
+            ballast = TG_GC_Max_Heap - PG_Mem_Usage;
+    }
+
+    if (ballast > INT32_MAX)  // GC_Ballast is only a REBINT
+        ballast = INT32_MAX;
+
+    GC_Ballast = cast(REBINT, ballast);
+}
+
+
 //
 //  Recycle_Core: C
 //
@@ -1144,6 +1996,44 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
 
     ASSERT_NO_GC_MARKS_PENDING();
 
+    // If a previous collection left sweep slices outstanding, they must be
+    // drained before a new marking phase--stale mark bits from the previous
+    // cycle would short-circuit tracing and hide live references.
+    //
+    if (GC_Sweep_Pending)
+        Sweep_Series_Slice(0);  // 0 = no slice budget, drain fully
+
+    // Stubs whose decay was deferred to checkpoint batches must likewise be
+    // gone before a new sweep: they are managed-but-unmarked, so it would
+    // find them a second time.  (At shutdown, deferral is switched off
+    // entirely--no checkpoints come afterward to drive the batches.)
+    //
+    if (shutdown)
+        PG_GC_Decay_Batch = 0;
+    if (GC_Decay_Pending != nullptr)
+        Maintain_Pending_Decay(0);  // 0 = drain completely
+
+  #if !defined(NDEBUG)
+    if (GC_Mark_Balance_Unreliable) {
+        //
+        // Allocate-black bookkeeping during an incremental window isn't
+        // threaded through mark_count, so rebaseline it for this cycle.
+        //
+        mark_count = 0;
+        GC_Mark_Balance_Unreliable = false;
+    }
+  #endif
+
+    // The virtual bind and module inheritance lookup caches key on node
+    // addresses, and the sweep below is what can free nodes and let their
+    // addresses be reused for new identities.  Invalidate both rather than
+    // trying to filter entries (a wipe for one, an epoch bump for the
+    // other).
+    //
+    Invalidate_Virtual_Bind_Cache();
+    Invalidate_Module_Inherit_Cache();
+    Invalidate_Spec_Keylist_Cache();  // also keyed on (and holding) nodes
+
   #if DEBUG_COLLECT_STATS
     PG_Reb_Stats->Recycle_Counter++;
     PG_Reb_Stats->Recycle_Series = Mem_Pools[STUB_POOL].free;
@@ -1225,6 +2115,14 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
             break;  // no more added
     }
 
+    // Function bodies that have now survived enough collections without
+    // being dispatched get their cell data deflated.  This must wait until
+    // the mark phase is complete: everything the bodies reference has been
+    // proven live this cycle, so the keepalive slots recorded with each
+    // blob start out consistent.  See COLD SOURCE COMPRESSION above.
+    //
+    Deflate_Cold_Source_Queue(shutdown);
+
     // SWEEPING PHASE
 
     ASSERT_NO_GC_MARKS_PENDING();
@@ -1243,9 +2141,30 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
         sweep_count = Fill_Sweeplist(sweeplist);
     #endif
     }
+    else if (not shutdown and PG_GC_Sweep_Slice != 0) {
+        //
+        // Incremental mode: open a sweep window and do only the first slice
+        // here.  The rest are driven from the signal checkpoint, bounding
+        // this pause to the mark phase plus one slice.
+        //
+        GC_Sweep_Pending = true;
+        GC_Sweep_Segment = Mem_Pools[STUB_POOL].segments;
+        GC_Sweep_Survivors = 0;
+      #if !defined(NDEBUG)
+        GC_Mark_Balance_Unreliable = true;
+      #endif
+        Update_Signal_Timer_Demand();  // drive further slices by the timer
+        sweep_count = Sweep_Series_Slice(PG_GC_Sweep_Slice);
+    }
     else
         sweep_count = Sweep_Series();
 
+    if (GC_Decay_Pending != nullptr)
+        Update_Signal_Timer_Demand();  // checkpoint batches drain the chain
+
+    if (PG_Mem_Tally)  // allocation accounting, see MEMORY-TALLY
+        ++PG_Mem_Tally->Recycles;  // sweeps tally themselves (may be sliced)
+
     // Unmark the Lib() fixed patches
     //
     for (REBLEN i = 1; i < LIB_SYMS_MAX; ++i) {
@@ -1271,7 +2190,8 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     }
 
    #if !defined(NDEBUG)
-     assert(mark_count == 0);  // should balance out
+     if (not GC_Sweep_Pending and not GC_Mark_Balance_Unreliable)
+         assert(mark_count == 0);  // should balance out
    #endif
 
   #if DEBUG_COLLECT_STATS
@@ -1293,8 +2213,11 @@ REBLEN Recycle_Core(bool shutdown, REBSER *sweeplist)
     // Reverted to the R3-Alpha state, accommodating a comment "do not adjust
     // task variables or boot strings in shutdown when they are being freed."
     //
+    // (Update_GC_Pacing() reproduces that fixed reset unless RECYCLE/ADAPTIVE
+    // has switched on heap-growth-scaled budgets.)
+    //
     if (not shutdown)
-        GC_Ballast = TG_Ballast;
+        Update_GC_Pacing(sweep_count);
 
     ASSERT_NO_GC_MARKS_PENDING();
 
@@ -1411,6 +2334,14 @@ void Startup_GC(void)
     // nested structures don't cause the C stack to overflow.
     //
     GC_Mark_Stack = Make_Series_Core(100, FLAG_FLAVOR(NODELIST));
+
+    // Nodes allocated "black" while incremental sweep slices are pending.
+    //
+    GC_Sweep_Newborns = Make_Series_Core(100, FLAG_FLAVOR(NODELIST));
+
+    // Cold function bodies queued during marking for post-mark deflation.
+    //
+    GC_Cold_Queue = Make_Series_Core(15, FLAG_FLAVOR(NODELIST));
 }
 
 
@@ -1421,4 +2352,6 @@ void Shutdown_GC(void)
 {
     Free_Unmanaged_Series(GC_Guarded);
     Free_Unmanaged_Series(GC_Mark_Stack);
+    Free_Unmanaged_Series(GC_Sweep_Newborns);
+    Free_Unmanaged_Series(GC_Cold_Queue);
 }
@@ -59,10 +59,63 @@
 // R3_ALWAYS_MALLOC to 1.
 //
 
+#ifdef __linux__
+    //
+    // For mremap() in <sys/mman.h>; must be defined before any system header
+    // gets included.  (See the "anonymous memory mappings" section below for
+    // why series data uses memory mappings at all.)
+    //
+    #define _GNU_SOURCE
+#endif
+
 #include "sys-core.h"
 #include "sys-int-funcs.h"
 
 
+//
+//  Did_Trap_Alloc_Limit: C
+//
+// The routines that raise PG_Mem_Usage funnel their increment through here,
+// so the limits see mapped allocations the same as malloc()'d ones.
+//
+// Crossing the soft watermark doesn't fail anything: it raises a signal,
+// and the hook configured by MEMORY-LIMIT runs at the next evaluator
+// checkpoint, where running Rebol code is safe.  (The crossing itself may
+// happen halfway through manipulating a managed series--the same reasoning
+// that makes SIG_RECYCLE a signal instead of a synchronous collection.)
+// The watermark disarms as it fires, and the checkpoint only re-arms it
+// once usage has dropped back under the line...so a workload that stays
+// above the watermark gets one callout per excursion, not one for every
+// allocation it makes while up there.
+//
+// A true result means the hard cap would be exceeded: the increment is
+// backed out, and the caller returns nullptr--which surfaces to script
+// code as a trappable Error_No_Memory().
+//
+bool Did_Trap_Alloc_Limit(size_t size)
+{
+    PG_Mem_Usage += size;
+    Total_Alloc_Bytes += size;  // monotonic accounting total, never debited
+
+    if (
+        PG_Mem_Soft_Limit != 0
+        and PG_Mem_Watermark_Armed
+        and PG_Mem_Usage > PG_Mem_Soft_Limit
+    ){
+        PG_Mem_Watermark_Armed = false;
+        SET_SIGNAL(SIG_MEM_WATERMARK);
+    }
+
+    if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit) {
+        PG_Mem_Usage -= size;
+        Total_Alloc_Bytes -= size;  // allocation didn't happen
+        return true;
+    }
+
+    return false;
+}
+
+
 //
 //  Try_Alloc_Mem: C
 //
@@ -93,10 +146,8 @@ void *Try_Alloc_Mem(size_t size)
 {
     // Trap memory usage limit *before* the allocation is performed
 
-    PG_Mem_Usage += size;
-    if (PG_Mem_Limit != 0 and PG_Mem_Usage > PG_Mem_Limit) {
-        PG_Mem_Usage -= size;
-    }
+    if (Did_Trap_Alloc_Limit(size))
+        return nullptr;
 
   #if !defined(NDEBUG)
     if (PG_Fuzz_Factor != 0) {
@@ -171,6 +222,165 @@ void Free_Mem(void *mem, size_t size)
 }
 
 
+//=//// LARGE SERIES DATA IN ANONYMOUS MEMORY MAPPINGS ////////////////////=//
+//
+// Series data of MEM_MMAP_THRESHOLD bytes or more is taken directly from the
+// operating system as an anonymous mapping on platforms that support it,
+// instead of going through malloc().  Two properties matter at that size:
+//
+// * Growth can use mremap(), which relinks the pages at a new virtual
+//   address if the mapping can't be extended in place.  Either way the bytes
+//   themselves are never copied--expanding a multi-hundred-megabyte BINARY!
+//   costs page table work, not a giant memcpy.
+//
+// * Freeing unmaps the pages, returning the memory to the OS the moment
+//   Decay_Series() runs...rather than leaving a large hole behind in (and
+//   fragmenting) the malloc() heap.
+//
+// There is deliberately no flag in the series node saying which allocator
+// the data came from: Free_Unbiased_Series_Data() only receives a pointer
+// and a total, so the routing has to be decidable from the size alone.
+// Is_Series_Data_Mapped() is that decision...and the allocation side takes
+// care that the total a series will free with (its rest * wide, which for
+// irregular element widths truncates below the page-rounded mapping size)
+// lands on the same side of the threshold.
+
+#if TO_LINUX
+    #include <sys/mman.h>
+    #include <unistd.h>  // sysconf(_SC_PAGESIZE)
+
+    static Size Page_Round_Up(Size size) {
+        static Size pagesize = 0;
+        if (pagesize == 0)
+            pagesize = sysconf(_SC_PAGESIZE);
+        return size + ((pagesize - (size % pagesize)) % pagesize);
+    }
+#endif
+
+
+//
+//  Is_Series_Data_Mapped: C
+//
+// Whether series data whose recorded total is `total` lives in an anonymous
+// mapping (vs. malloc() memory or a memory pool).
+//
+bool Is_Series_Data_Mapped(Size total)
+{
+  #if TO_LINUX
+    return total >= MEM_MMAP_THRESHOLD;
+  #else
+    UNUSED(total);
+    return false;
+  #endif
+}
+
+
+//
+//  Try_Alloc_Series_Data_Mapped: C
+//
+// Returns nullptr if the allocation isn't eligible for mapping (too small,
+// or the platform has no support)--the caller just continues down the
+// ordinary allocation path.  On success, *size_in_out comes back rounded up
+// to a page multiple; the caller records it as capacity, and totals derived
+// from it route back here via Is_Series_Data_Mapped() when freed.
+//
+void *Try_Alloc_Series_Data_Mapped(Size *size_in_out, Byte wide)
+{
+  #if TO_LINUX
+    if (*size_in_out > INT32_MAX - 4096)
+        return nullptr;  // page rounding could pass the series size cap
+
+    Size size = Page_Round_Up(*size_in_out);
+    if (size - (size % wide) < MEM_MMAP_THRESHOLD)
+        return nullptr;  // freed total would route to FREE_N(), see above
+
+    void *p = mmap(
+        nullptr,
+        size,
+        PROT_READ | PROT_WRITE,
+        MAP_PRIVATE | MAP_ANONYMOUS,
+        -1,
+        0
+    );
+    if (p == MAP_FAILED)
+        return nullptr;  // ordinary path gets a try (and raises the error)
+
+    if (Did_Trap_Alloc_Limit(size)) {
+        munmap(p, size);
+        return nullptr;  // ordinary path will trap too, and raise the error
+    }
+    *size_in_out = size;
+    return p;
+  #else
+    UNUSED(size_in_out);
+    UNUSED(wide);
+    return nullptr;
+  #endif
+}
+
+
+//
+//  Try_Remap_Series_Data_Mapped: C
+//
+// Grow mapped series data without copying.  If the pages can't be extended
+// in place the kernel moves them to a new virtual address, so the pointer
+// that comes back may differ...but no bytes travel through the CPU.
+//
+// Returns nullptr if the kernel couldn't grow the mapping; the caller falls
+// back on allocate-copy-free.
+//
+void *Try_Remap_Series_Data_Mapped(void *p, Size total_old, Size *size_in_out)
+{
+  #if TO_LINUX
+    if (*size_in_out > INT32_MAX - 4096)
+        return nullptr;
+
+    Size size_old = Page_Round_Up(total_old);  // recovers the mapped size
+    Size size = Page_Round_Up(*size_in_out);
+
+    // The hard cap has to be checked before the kernel call: a grown mapping
+    // that may have moved can't be backed out the way a malloc() can.
+    //
+    if (PG_Mem_Limit != 0 and PG_Mem_Usage + (size - size_old) > PG_Mem_Limit)
+        return nullptr;
+
+    void *p_new = mremap(p, size_old, size, MREMAP_MAYMOVE);
+    if (p_new == MAP_FAILED)
+        return nullptr;
+
+    cast(void, Did_Trap_Alloc_Limit(size - size_old));  // cap checked above
+    *size_in_out = size;
+    return p_new;
+  #else
+    UNUSED(p);
+    UNUSED(total_old);
+    UNUSED(size_in_out);
+    return nullptr;
+  #endif
+}
+
+
+//
+//  Free_Series_Data_Mapped: C
+//
+// The munmap() length is page-rounded the same way the allocation was, which
+// recovers the mapped size from a total that an irregular element width may
+// have truncated (by less than one element, so always less than a page).
+//
+void Free_Series_Data_Mapped(void *p, Size total)
+{
+  #if TO_LINUX
+    Size size = Page_Round_Up(total);
+    if (munmap(p, size) != 0)
+        panic (p);
+    PG_Mem_Usage -= size;
+  #else
+    UNUSED(total);
+    panic (p);  // the allocation side never maps on unsupported platforms
+  #endif
+}
+
+
 /***********************************************************************
 **
 **  MEMORY POOLS
@@ -313,6 +523,8 @@ void Startup_Pools(REBINT scale)
     memset(PG_Reb_Stats, 0, sizeof(REB_STATS));
   #endif
 
+    PG_Mem_Tally = nullptr;  // accounting off until MEMORY-TALLY ON
+
     // Manually allocated series that GC is not responsible for (unless a
     // trap occurs). Holds series pointers.
     //
@@ -328,6 +540,8 @@ void Startup_Pools(REBINT scale)
     Prior_Expand = TRY_ALLOC_N(REBSER*, MAX_EXPAND_LIST);
     memset(Prior_Expand, 0, sizeof(REBSER*) * MAX_EXPAND_LIST);
     Prior_Expand[0] = (REBSER*)1;
+
+    GC_Decay_Pending = nullptr;  // see Maintain_Pending_Decay()
 }
 
 
@@ -338,11 +552,34 @@ void Startup_Pools(REBINT scale)
 //
 void Shutdown_Pools(void)
 {
+    // Nothing should be awaiting deferred decay--the shutdown recycle turns
+    // deferral off and drains the chain--but a stray stub would trip the
+    // leak check below, so be thorough.
+    //
+    Maintain_Pending_Decay(0);
+
     // Can't use Free_Unmanaged_Series() because GC_Manuals couldn't be put in
     // the manuals list...
     //
     GC_Kill_Series(GC_Manuals);
 
+    // Give any frame shells held by the private cache back to the pool, so
+    // the pool's own free accounting is accurate for the checks below.
+    //
+    while (TG_Frame_Shell_Cache) {
+        PoolUnit* unit = TG_Frame_Shell_Cache;
+        TG_Frame_Shell_Cache = unit->next_if_free;
+        Free_Pooled(FRAME_POOL, unit);
+    }
+    TG_Frame_Shell_Cache_Used = 0;
+
+    while (TG_Api_Stub_Cache) {  // same treatment for cached API stubs
+        PoolUnit* unit = TG_Api_Stub_Cache;
+        TG_Api_Stub_Cache = unit->next_if_free;
+        Free_Pooled(STUB_POOL, unit);
+    }
+    TG_Api_Stub_Cache_Used = 0;
+
   #if !defined(NDEBUG)
   blockscope {
     Count num_leaks = 0;
@@ -408,6 +645,11 @@ void Shutdown_Pools(void)
     FREE(REB_STATS, PG_Reb_Stats);
   #endif
 
+    if (PG_Mem_Tally) {  // shutdown with MEMORY-TALLY still on
+        FREE(REB_MEM_TALLY, PG_Mem_Tally);
+        PG_Mem_Tally = nullptr;
+    }
+
   #if !defined(NDEBUG)
     if (PG_Mem_Usage != 0) {
         //
@@ -433,6 +675,38 @@ void Shutdown_Pools(void)
 }
 
 
+//=//// NUMA PLACEMENT OF POOL SEGMENTS ///////////////////////////////////=//
+//
+// Mem_Pools is thread-local: each thread that starts up the core fills and
+// drains its own pools, so a pool unit is only ever handed out and freed on
+// the thread whose segments it lives in.  The pool free list is thus already
+// a per-thread cache--the frame shell and API stub LIFOs (see
+// Alloc_Frame_Shell() and %sys-roots.h) just sit above it to skip the
+// bookkeeping for the two highest-churn clients.
+//
+// That layout is also what makes pool memory land on the right socket of a
+// multi-node machine without any explicit binding.  The default kernel
+// policy places an anonymous page on the memory node of the thread that
+// first *writes* it ("first touch")--and the free list threading pass below
+// writes the header of every unit in a new segment.  Since no pool's unit
+// width exceeds a page, that pass faults every page of the segment from the
+// allocating thread, pinning the whole segment to that thread's node.  No
+// libnuma dependency or mbind() call is needed; the property just has to be
+// preserved:
+//
+// * Don't turn the threading pass into pointer arithmetic that skips
+//   touching units (e.g. computing the links lazily at allocation time).
+//   It doubles as the first-touch pass.
+//
+// * Don't share segments or recycle units across threads.  A future
+//   work-stealing scheme that migrated freed units between isolates would
+//   reintroduce exactly the cross-socket traffic this layout avoids.
+//
+// (Large series data from Try_Alloc_Series_Data_Mapped() needs no such
+// care: anonymous mappings are faulted lazily, page by page, by whichever
+// thread writes them--which is first-touch placement by definition.)
+
+
 //
 //  Fill_Pool: C
 //
@@ -455,7 +729,9 @@ bool Try_Fill_Pool(Pool* pool)
     pool->has += num_units;
     pool->free += num_units;
 
-    // Add new nodes to the end of free list:
+    // Add new nodes to the end of free list.  Writing every unit here also
+    // faults every page of the segment in from this thread, which is what
+    // gives segments their NUMA node affinity (see note above Fill_Pool).
 
     PoolUnit* unit = cast(PoolUnit*, seg + 1);
 
@@ -590,6 +866,9 @@ REBVAL *Alloc_Pairing(void) {
     REBVAL *key = PAIRING_KEY(paired);
     Erase_Cell(key);
 
+    if (GC_Sweep_Pending)  // sweep slices outstanding: allocate "black"
+        Blacken_Node_During_Sweep(paired);
+
     return paired;
 }
 
@@ -602,6 +881,12 @@ REBVAL *Alloc_Pairing(void) {
 //
 void Manage_Pairing(REBVAL *paired) {
     Set_Cell_Flag(paired, MANAGED);
+
+    // Pairings managed mid-window weren't marked as live by the mark phase,
+    // so a pending sweep slice would reap them.  Allocate-black rules apply.
+    //
+    if (GC_Sweep_Pending and not (paired->header.bits & NODE_FLAG_MARKED))
+        Blacken_Node_During_Sweep(paired);
 }
 
 
@@ -674,13 +959,345 @@ void Free_Unbiased_Series_Data(char *unbiased, Size total)
         mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
     }
     else {
-        FREE_N(char, total, unbiased);
+        if (Is_Series_Data_Mapped(total))
+            Free_Series_Data_Mapped(unbiased, total);  // pages released now
+        else
+            FREE_N(char, total, unbiased);
         Mem_Pools[SYSTEM_POOL].has -= total;
         Mem_Pools[SYSTEM_POOL].free++;
     }
 }
 
 
+//=//// PAGE-LEVEL POOL COMPACTION ////////////////////////////////////////=//
+//
+// A load-then-drop workload leaves the fixed-size data pools fragmented:
+// every segment from the load's high-water mark stays allocated as long as
+// one survivor's data lives in it, so the process RSS never comes back down
+// even though most units are on the free list.  RECYCLE/COMPACT migrates
+// series data off nearly-empty segments and returns those segments to the
+// OS.
+//
+// Only series *data* moves--stub addresses are identity (cells point at
+// them) and can never relocate.  Data relocation is the same liberty
+// Expand_Series() has always taken, and the same flag governs it:
+// SERIES_FLAG_DONT_RELOCATE (a synonym of FIXED_SIZE) marks the series
+// whose data is pointed into from outside--frame varlists, symbols, binary
+// views.  A few subclasses without the flag cache data pointers in C
+// structures or globals, so they are excluded by flavor below.
+//
+//////////////////////////////////////////////////////////////////////////////
+//
+// 1. Frozen series have had "these bytes will never move" observed by other
+//    mechanisms: binary views borrow windows into frozen owners, and port
+//    layers write frozen buffers zero-copy.  Cheaper to pin them all than to
+//    track which frozen series have lent their data out.
+//
+// 2. Feeds under enumeration cache cell pointers (and the prefetch cursor)
+//    into the array's data; they always put SERIES_INFO_HOLD on it first.
+//
+// 3. Anything on the guard stack might be a cell pointer into an array's
+//    data (PUSH_GC_GUARD of a value slot), which migration would strand.
+//    Guarded stubs are fine--only address-level guards pin a segment.
+
+static bool Is_Series_Data_Movable(REBSER *s)
+{
+    if (NOT_SERIES_FLAG(s, DYNAMIC))
+        return false;  // data lives inside the stub itself
+    if (GET_SERIES_FLAG(s, INACCESSIBLE))
+        return false;  // decayed, data already freed
+    if (GET_SERIES_FLAG(s, DONT_RELOCATE))
+        return false;  // outside pointers into data (see notes on flag)
+    if (GET_SERIES_FLAG(s, DATA_NOT_OWNED))
+        return false;  // a view; the unit belongs to some other series
+    if (GET_SERIES_FLAG(s, INFO_NODE_NEEDS_MARK))
+        return false;  // info slot is a node, can't test info bits below
+    if (Is_Series_Frozen(s))
+        return false;  // bytes promised immovable to views/ports, see [1]
+    if (GET_SERIES_INFO(s, HOLD))
+        return false;  // feed enumerators point into the data, see [2]
+
+    switch (SER_FLAVOR(s)) {
+      case FLAVOR_VARLIST:  // frames and EVARS point at the variable cells
+      case FLAVOR_PAIRLIST:  // map internals, conservative
+      case FLAVOR_KEYLIST:  // fulfilling frames cache key pointers
+      case FLAVOR_DETAILS:  // dispatchers may hold cell pointers mid-bounce
+      case FLAVOR_DATASTACK:  // DS_Movable_Base and friends
+      case FLAVOR_MOLDSTACK:
+        return false;
+      default:
+        break;
+    }
+
+    return true;
+}
+
+// If a series' data came from one of the small fixed-size pools, give back
+// which one (mirroring how Free_Unbiased_Series_Data() re-derives the pool
+// from the total allocation size alone).  SYSTEM_POOL means malloc'd or
+// mapped data, which frees page-granular on its own and needs no help.
+//
+inline static PoolID Data_Pool_Id_Of(REBSER *s)
+    { return Pool_Id_For_Size(SER_TOTAL(s)); }
+
+inline static Byte* Unbiased_Series_Data(REBSER *s) {
+    return cast(Byte*, s->content.dynamic.data)
+        - SER_BIAS(s) * SER_WIDE(s);
+}
+
+// Detach every free unit belonging to the segment from the pool's free list,
+// returning them as a separate chain.  If the segment ends up released the
+// chain is simply forgotten along with it; if the compaction of the segment
+// has to be abandoned the chain is given back via the routine below.
+//
+static Count Remove_Segment_Units_From_Free_List(
+    Pool* pool,
+    Byte* units_head,
+    Size units_span,
+    PoolUnit** discards
+){
+    Count removed = 0;
+    PoolUnit* discard_chain = nullptr;
+
+    PoolUnit** prior = &pool->first;
+    PoolUnit* last_kept = nullptr;
+    PoolUnit* unit = pool->first;
+    while (unit != nullptr) {
+        PoolUnit* next = unit->next_if_free;
+        Byte* addr = cast(Byte*, unit);
+        if (addr >= units_head and addr < units_head + units_span) {
+            *prior = next;  // unlink
+            unit->next_if_free = discard_chain;
+            discard_chain = unit;
+            ++removed;
+        }
+        else {
+            prior = &unit->next_if_free;
+            last_kept = unit;
+        }
+        unit = next;
+    }
+
+    pool->last = last_kept;
+    pool->free -= removed;
+
+    *discards = discard_chain;
+    return removed;
+}
+
+static void Give_Back_Units_To_Free_List(
+    Pool* pool,
+    PoolUnit* chain,
+    Count count
+){
+    if (chain == nullptr)
+        return;
+
+    PoolUnit* tail = chain;
+    while (tail->next_if_free != nullptr)
+        tail = tail->next_if_free;
+
+    tail->next_if_free = pool->first;
+    pool->first = chain;
+    if (pool->last == nullptr)
+        pool->last = tail;
+
+    pool->free += count;
+}
+
+// Walk the stub pool and move the data of every movable series whose unit
+// lies in the address range off to freshly allocated units.  The caller has
+// already removed the range's free units from the free list and ensured
+// enough free units exist elsewhere, so allocation cannot land back in the
+// range (nor fail).
+//
+static void Migrate_Series_Data_Out_Of_Range(
+    PoolID pool_id,
+    Byte* units_head,
+    Size units_span,
+    Count movable  // how many series the census counted in the range
+){
+    Segment* seg = Mem_Pools[STUB_POOL].segments;
+    for (; seg != nullptr and movable != 0; seg = seg->next) {
+        Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+        Byte* stub = cast(Byte*, seg + 1);
+
+        for (; n > 0 and movable != 0; --n, stub += sizeof(Stub)) {
+            if (*stub & NODE_BYTEMASK_0x40_STALE)
+                continue;  // free unit
+            if (*stub & NODE_BYTEMASK_0x01_CELL)
+                continue;  // a pairing
+
+            REBSER *s = SER(cast(void*, stub));
+            if (not Is_Series_Data_Movable(s))
+                continue;
+
+            Byte* unbiased = Unbiased_Series_Data(s);
+            if (unbiased < units_head or unbiased >= units_head + units_span)
+                continue;
+
+            Byte* unit = cast(Byte*, Try_Alloc_Pooled(pool_id));
+            assert(unit != nullptr);  // caller reserved capacity
+
+            memcpy(unit, unbiased, Mem_Pools[pool_id].wide);
+            s->content.dynamic.data
+                = cast(char*, unit) + SER_BIAS(s) * SER_WIDE(s);
+
+            --movable;
+        }
+    }
+
+    assert(movable == 0);  // census and migration walks must agree
+}
+
+//
+//  Compact_Data_Pools: C
+//
+// Compaction pass over the small fixed-size data pools: a census of the
+// stub pool attributes every pooled data allocation to its segment, then
+// segments that are nearly empty--and pinned by nothing immovable--have
+// their survivors migrated out and are returned to the OS.  Returns the
+// number of segments released.
+//
+// The cost is a handful of stub-pool walks, so this does not run inside
+// ordinary recycles; it's triggered explicitly via RECYCLE/COMPACT when a
+// process knows it just dropped a large working set.
+//
+Count Compact_Data_Pools(void)
+{
+    Count released = 0;
+
+    PoolID pool_id;
+    for (pool_id = 0; pool_id < STUB_POOL; ++pool_id) {
+        Pool* pool = &Mem_Pools[pool_id];
+
+        if (pool->segments == nullptr or pool->segments->next == nullptr)
+            continue;  // one segment (or none): nothing to consolidate into
+
+        Count units_per_seg = pool->num_units_per_segment;
+        Size units_span = pool->wide * units_per_seg;
+
+        Segment* seg = pool->segments;
+        Segment* prior_seg = nullptr;
+        while (seg != nullptr) {
+            Segment* next_seg = seg->next;
+            Byte* units_head = cast(Byte*, seg + 1);
+
+            // Census: count movable series in this segment, and bail on the
+            // first immovable one (it pins the whole segment).
+
+            bool pinned = false;
+            Count movable = 0;
+
+            Segment* stub_seg = Mem_Pools[STUB_POOL].segments;
+            for (; stub_seg != nullptr and not pinned;
+                 stub_seg = stub_seg->next
+            ){
+                Count n = Mem_Pools[STUB_POOL].num_units_per_segment;
+                Byte* stub = cast(Byte*, stub_seg + 1);
+                for (; n > 0; --n, stub += sizeof(Stub)) {
+                    if (*stub & NODE_BYTEMASK_0x40_STALE)
+                        continue;
+                    if (*stub & NODE_BYTEMASK_0x01_CELL)
+                        continue;
+
+                    REBSER *s = SER(cast(void*, stub));
+                    if (
+                        NOT_SERIES_FLAG(s, DYNAMIC)
+                        or GET_SERIES_FLAG(s, INACCESSIBLE)
+                        or GET_SERIES_FLAG(s, DATA_NOT_OWNED)
+                        or Data_Pool_Id_Of(s) != pool_id
+                    ){
+                        continue;  // owns no unit in this pool
+                    }
+
+                    Byte* unbiased = Unbiased_Series_Data(s);
+                    if (
+                        unbiased < units_head
+                        or unbiased >= units_head + units_span
+                    ){
+                        continue;  // different segment
+                    }
+
+                    if (not Is_Series_Data_Movable(s)) {
+                        pinned = true;
+                        break;
+                    }
+                    ++movable;
+                }
+            }
+
+            if (not pinned) {  // address-level guards also pin, see [3]
+                const Node* *np = SER_HEAD(const Node*, GC_Guarded);
+                REBLEN n = SER_USED(GC_Guarded);
+                for (; n > 0; --n, ++np) {
+                    Byte* addr = cast(Byte*, m_cast(Node*, *np));
+                    if (
+                        Is_Node_A_Cell(*np)
+                        and addr >= units_head
+                        and addr < units_head + units_span
+                    ){
+                        pinned = true;
+                        break;
+                    }
+                }
+            }
+
+            if (pinned or movable > units_per_seg / 8) {
+                prior_seg = seg;  // not nearly-empty (or unmovable), keep
+                seg = next_seg;
+                continue;
+            }
+
+            // Commit: pull the segment's free units out of circulation so
+            // migration can't allocate back into it, top up the free list
+            // from other segments if the survivors need more room, move the
+            // survivors, and free the segment.
+
+            PoolUnit* discards;
+            Count removed = Remove_Segment_Units_From_Free_List(
+                pool, units_head, units_span, &discards
+            );
+            assert(removed == units_per_seg - movable);
+
+            bool enough = true;
+            while (pool->free < movable) {
+                if (not Try_Fill_Pool(pool)) {
+                    enough = false;  // OOM; leave this segment as it was
+                    break;
+                }
+            }
+            if (not enough) {
+                Give_Back_Units_To_Free_List(pool, discards, removed);
+                prior_seg = seg;
+                seg = next_seg;
+                continue;
+            }
+
+            if (movable != 0)
+                Migrate_Series_Data_Out_Of_Range(
+                    pool_id, units_head, units_span, movable
+                );
+
+            if (prior_seg == nullptr)
+                pool->segments = next_seg;
+            else
+                prior_seg->next = next_seg;
+
+            pool->has -= units_per_seg;
+
+            assert(seg->size == units_span + sizeof(Segment));
+            FREE_N(char, seg->size, cast(char*, seg));
+
+            ++released;
+            seg = next_seg;  // prior_seg unchanged; this one is gone
+        }
+    }
+
+    return released;
+}
+
+
 //
 //  Expand_Series: C
 //
@@ -853,6 +1470,62 @@ void Expand_Series(REBSER *s, REBLEN index, REBLEN delta)
     }
   #endif
 
+//=//// TRY GROWING MAPPED DATA WITHOUT A COPY ////////////////////////////=//
+
+    // If the data lives in an anonymous mapping (see Is_Series_Data_Mapped)
+    // then the kernel can grow it by relinking pages--no copy of the bytes,
+    // no matter how many hundreds of megabytes they are.  Only the part
+    // after the expansion point needs the ordinary slide to open the gap.
+    //
+    // (Head bias would sit between the mapping base and the data pointer;
+    // such series are rare at this size and just take the copying path.)
+    //
+    if (was_dynamic and SER_BIAS(s) == 0) {
+        Size total_old = SER_TOTAL(s);
+        Size size_new = cast(Size, used_old + delta + x) * wide;
+        if (Is_Series_Data_Mapped(total_old) and size_new > total_old) {
+            UNPOISON_SERIES_TAIL(s);
+            char *data = cast(char*, Try_Remap_Series_Data_Mapped(
+                s->content.dynamic.data, total_old, &size_new
+            ));
+            if (data) {
+                s->content.dynamic.data = data;
+                s->content.dynamic.rest = size_new / wide;
+
+                memmove(data + start + extra, data + start, size - start);
+                Set_Series_Used_Internal(s, used_old + delta);
+                POISON_SERIES_TAIL(s);
+
+                if (n_found >= MAX_EXPAND_LIST)
+                    Prior_Expand[n_available] = s;
+
+                if ((GC_Ballast -= size_new - total_old) <= 0)
+                    SET_SIGNAL(SIG_RECYCLE);
+
+              #if !defined(NDEBUG)
+                if (IS_SER_ARRAY(s)) {
+                    //
+                    // The opened up area needs to be set to "settable" trash
+                    // in the debug build, same as the in-place slide above.
+                    //
+                    REBLEN n = delta;
+                    while (n != 0) {
+                        --n;
+                        Erase_Cell(ARR_AT(ARR(s), index + n));
+                    }
+                }
+              #endif
+
+              #if DEBUG_COLLECT_STATS
+                PG_Reb_Stats->Series_Expanded++;
+              #endif
+
+                TERM_SERIES_IF_NECESSARY(s);
+                return;
+            }
+        }
+    }
+
     // !!! The protocol for doing new allocations currently mandates that the
     // dynamic content area be cleared out.  But the data lives in the content
     // area if there's no dynamic portion.  The in-REBSER content has to be
@@ -1147,22 +1820,39 @@ void Decay_Series(REBSER *s)
         if (Prior_Expand[n] == s) Prior_Expand[n] = 0;
     }
 
-    if (GET_SERIES_FLAG(s, DYNAMIC)) {
-        Byte wide = SER_WIDE(s);
-        REBLEN bias = SER_BIAS(s);
-        REBLEN total = (bias + SER_REST(s)) * wide;
-        char *unbiased = s->content.dynamic.data - (wide * bias);
-
-        // !!! Contexts and actions keep their archetypes, for now, in the
-        // now collapsed node.  For FRAME! this means holding onto the binding
-        // which winds up being used in Derelativize().  See SPC_BINDING.
-        // Preserving ACTION!'s archetype is speculative--to point out the
-        // possibility exists for the other array with a "canon" [0]
-        //
-        if (IS_VARLIST(s) or IS_DETAILS(s))
-            s->content.fixed.cells[0] = *ARR_HEAD(ARR(s));
+    if (
+        GET_SERIES_FLAG(s, DYNAMIC)
+        and NOT_SERIES_FLAG(s, DATA_NOT_OWNED)  // e.g. Make_Binary_View()
+    ){
+        REBLEN total;
+
+        if (
+            SER_FLAVOR(s) == FLAVOR_ARRAY
+            and Get_Subclass_Flag(ARRAY, ARR(s), COLD_COMPRESSED)
+        ){
+            // The data pointer holds a deflate blob, not a biased pool
+            // allocation.  See COLD SOURCE COMPRESSION in %m-gc.c.
+            //
+            total = Decay_Cold_Compressed_Array(ARR(s));
+        }
+        else {
+            Byte wide = SER_WIDE(s);
+            REBLEN bias = SER_BIAS(s);
+            total = (bias + SER_REST(s)) * wide;
+            char *unbiased = s->content.dynamic.data - (wide * bias);
+
+            // !!! Contexts and actions keep their archetypes, for now, in
+            // the now collapsed node.  For FRAME! this means holding onto
+            // the binding which winds up being used in Derelativize().  See
+            // SPC_BINDING.  Preserving ACTION!'s archetype is speculative--
+            // to point out the possibility exists for the other array with
+            // a "canon" [0]
+            //
+            if (IS_VARLIST(s) or IS_DETAILS(s))
+                s->content.fixed.cells[0] = *ARR_HEAD(ARR(s));
 
-        Free_Unbiased_Series_Data(unbiased, total);
+            Free_Unbiased_Series_Data(unbiased, total);
+        }
 
         // !!! This indicates reclaiming of the space, not for the series
         // nodes themselves...have they never been accounted for, e.g. in
@@ -1223,6 +1913,70 @@ void GC_Kill_Series(REBSER *s)
 }
 
 
+//
+//  Try_Defer_Stub_Decay: C
+//
+// The sweep calls this for a doomed stub when RECYCLE/DEFERRED is active.
+// If the stub qualifies it is threaded onto a pending chain, and the real
+// freeing happens later in Maintain_Pending_Decay()--shifting that part of
+// the reclamation out of the collection pause.
+//
+// The chain is threaded through the stub's `info` slot, so deferral costs
+// no allocation during the sweep...but a flavor whose decay still reads
+// `info` can't be deferred (LETs keep their symbol there).  Symbols and
+// module patches are also excluded: they sit in name-resolution structures
+// that lookups consult (the interning table, the per-symbol variable lists
+// that MOD_VAR() walks), and must leave those structures before the sweep
+// finishes rather than at some later checkpoint.
+//
+bool Try_Defer_Stub_Decay(REBSER *s)
+{
+    switch (SER_FLAVOR(s)) {
+      case FLAVOR_SYMBOL:
+      case FLAVOR_PATCH:
+      case FLAVOR_LET:
+        return false;
+
+      default:
+        break;
+    }
+
+    if (GET_SERIES_FLAG(s, INACCESSIBLE))
+        return false;  // already decayed; killing is just the Free_Pooled()
+
+    *m_cast(Node**, &s->info.node) = GC_Decay_Pending;  // dead, slot free
+    GC_Decay_Pending = s;
+    return true;
+}
+
+
+//
+//  Maintain_Pending_Decay: C
+//
+// Free up to `max_stubs` stubs from the pending-decay chain (0 means drain
+// it completely).  This is the half of a dead stub's reclamation that the
+// sweep deferred; bounded batches run from the signal checkpoint, and the
+// demand-driven timer keeps checkpoints coming until the chain is empty.
+//
+Count Maintain_Pending_Decay(REBLEN max_stubs)
+{
+    Count count = 0;
+
+    while (GC_Decay_Pending != nullptr) {
+        REBSER *s = GC_Decay_Pending;
+        GC_Decay_Pending = cast(REBSER*, m_cast(Node*, s->info.node));
+
+        GC_Kill_Series(s);
+
+        ++count;
+        if (max_stubs != 0 and --max_stubs == 0)
+            break;
+    }
+
+    return count;
+}
+
+
 //
 //  Free_Unmanaged_Series: C
 //
@@ -1607,3 +2361,144 @@ REBU64 Inspect_Series(bool show)
 }
 
 #endif
+
+
+//
+//  pool-stats: native [
+//
+//  {Segment occupancy and fragmentation of the memory pools}
+//
+//      return: "One object per fixed-size pool"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(pool_stats)
+//
+// Dump_Pools() prints coarse counts to stdout, and only in debug builds.
+// Capacity automation wants the answer as data from the build it actually
+// runs: how full each pool's segments are, and whether the free units are
+// pooled together (a workload trough--new allocations will pack into them)
+// or smeared thinly across mostly-full segments (no segment can ever be
+// returned, and locality decays).  That distinction is what decides whether
+// to keep going, schedule a compacting restart, or just shed caches.
+//
+// A unit's content doesn't say whether it is free (data pools hold raw
+// series bytes), so the segment maps are built by walking each pool's free
+// list and attributing the units to segments by address.  Cost is linear in
+// free units; no allocation happens between a pool's walk and its report.
+// Units parked in the frame shell and API stub caches are counted as used,
+// since they are not in the free lists (they are already spoken for).
+//
+// Per pool object:
+//
+//   id, wide, units-per-segment, segments -- shape of the pool
+//   units, free                           -- Dump_Pools' coarse counts
+//   largest-free-run                      -- longest contiguous free span,
+//                                            in units (runs don't cross
+//                                            segment boundaries)
+//   fragmentation                         -- 0-100: percent of free units
+//                                            NOT in the largest run
+//   occupancy                             -- 10-slot histogram of segments
+//                                            by used decile (last slot is
+//                                            the 90-100% segments)
+//
+{
+    INCLUDE_PARAMS_OF_POOL_STATS;
+
+    REBVAL *result = rebValue("copy []");
+
+    PoolID id;
+    for (id = 0; id != SYSTEM_POOL; ++id) {
+        Pool* pool = &Mem_Pools[id];
+        Length per_seg = pool->num_units_per_segment;
+
+        Count num_segs = 0;
+        Segment* seg = pool->segments;
+        for (; seg != nullptr; seg = seg->next)
+            ++num_segs;
+
+        Segment** segv = nullptr;
+        Byte* freemap = nullptr;  // byte per unit, 1 if on the free list
+
+        if (num_segs != 0) {
+            segv = TRY_ALLOC_N(Segment*, num_segs);
+            freemap = TRY_ALLOC_N_ZEROFILL(Byte, num_segs * per_seg);
+            if (segv == nullptr or freemap == nullptr)
+                fail (Error_No_Memory(num_segs * per_seg));
+
+            Count n = 0;
+            for (seg = pool->segments; seg != nullptr; seg = seg->next)
+                segv[n++] = seg;
+        }
+
+        PoolUnit* unit = pool->first;
+        for (; unit != nullptr; unit = unit->next_if_free) {
+            Byte* addr = cast(Byte*, unit);
+            Count s;
+            for (s = 0; s < num_segs; ++s) {
+                Byte* head = cast(Byte*, segv[s] + 1);
+                if (addr >= head and addr < head + per_seg * pool->wide) {
+                    freemap[(s * per_seg) + (addr - head) / pool->wide] = 1;
+                    break;
+                }
+            }
+        }
+
+        Count hist[10];
+        Count b;
+        for (b = 0; b < 10; ++b)
+            hist[b] = 0;
+
+        Count largest_run = 0;
+        Count mapped_free = 0;
+
+        Count s;
+        for (s = 0; s < num_segs; ++s) {
+            Count used = 0;
+            Count run = 0;
+
+            Count u;
+            for (u = 0; u < per_seg; ++u) {
+                if (freemap[(s * per_seg) + u]) {
+                    ++mapped_free;
+                    ++run;
+                    if (run > largest_run)
+                        largest_run = run;
+                }
+                else {
+                    ++used;
+                    run = 0;
+                }
+            }
+
+            ++hist[used == per_seg ? 9 : (used * 10) / per_seg];
+        }
+
+        Count frag = 0;
+        if (mapped_free > largest_run)
+            frag = 100 - ((largest_run * 100) / mapped_free);
+
+        if (num_segs != 0) {
+            FREE_N(Segment*, num_segs, segv);
+            FREE_N(Byte, num_segs * per_seg, freemap);
+        }
+
+        REBVAL *occupancy = rebValue("copy []");
+        for (b = 0; b < 10; ++b)
+            rebElide("append", occupancy, rebI(hist[b]));
+
+        rebElide("append", result, "make object! [",
+            "id:", rebI(id),
+            "wide:", rebI(pool->wide),
+            "units-per-segment:", rebI(per_seg),
+            "segments:", rebI(num_segs),
+            "units:", rebI(pool->has),
+            "free:", rebI(pool->free),
+            "largest-free-run:", rebI(largest_run),
+            "fragmentation:", rebI(frag),
+            "occupancy:", rebR(occupancy),
+        "]");
+    }
+
+    return result;
+}
@@ -287,15 +287,20 @@ void Expand_Data_Stack_May_Fail(REBLEN amount)
     );
 
     // If adding in the requested amount would overflow the stack limit, then
-    // give a data stack overflow error.
+    // give a data stack overflow error.  (Geometric growth requests from
+    // PUSH() may overshoot near the limit; those get clamped, and only fail
+    // if not even one more cell can be provided.)
     //
     if (SER_REST(DS_Array) + amount >= STACK_LIMIT) {
-        //
-        // Because the stack pointer was incremented and hit the END marker
-        // before the expansion, we have to decrement it if failing.
-        //
-        --DS_Index;
-        Fail_Stack_Overflow(); // !!! Should this be a "data stack" message?
+        if (SER_REST(DS_Array) + 1 >= STACK_LIMIT) {
+            //
+            // Because the stack pointer was incremented and hit the END
+            // marker before the expansion, decrement it if failing.
+            //
+            --DS_Index;
+            Fail_Stack_Overflow(); // !!! Should this be a "data stack" message?
+        }
+        amount = STACK_LIMIT - SER_REST(DS_Array) - 1;
     }
 
     Extend_Series_If_Necessary(DS_Array, amount);
@@ -323,6 +328,61 @@ void Expand_Data_Stack_May_Fail(REBLEN amount)
 }
 
 
+//
+//  Ensure_Data_Stack_Capacity: C
+//
+// Pre-expand the data stack so `needed` cells can be PUSH()'d without any
+// mid-loop reallocations.  Useful when a routine knows up front how many
+// values it will push (e.g. MAP-EACH over a series of known length), since
+// expanding in STACK_EXPAND_BASIS increments would reallocate and re-poison
+// repeatedly on large inputs.
+//
+// Unlike Expand_Data_Stack_May_Fail() this may be called when the stack is
+// not at its allocated end, so it cannot assume the top matches the tail.
+//
+void Ensure_Data_Stack_Capacity(REBLEN needed)
+{
+    REBLEN available = DS_Movable_Tail - DS_Movable_Top - 1;
+    if (available >= needed)
+        return;
+
+    REBLEN amount = needed - available;
+
+    // This is only a hint--the caller may push fewer cells than anticipated
+    // (e.g. a MAP-EACH body that filters most elements out).  So rather than
+    // fail on a hint that exceeds the limit, clamp it and let PUSH() report
+    // overflow if the pushes genuinely materialize.
+    //
+    if (SER_REST(DS_Array) + amount >= STACK_LIMIT) {
+        if (SER_REST(DS_Array) + 1 >= STACK_LIMIT)
+            return;
+        amount = STACK_LIMIT - SER_REST(DS_Array) - 1;
+    }
+
+    REBLEN len_old = ARR_LEN(DS_Array);
+
+    Extend_Series_If_Necessary(DS_Array, amount);
+
+    // The reallocation likely moved the data, so recompute the fast-access
+    // top pointer before anything uses it.
+    //
+    DS_Movable_Top = cast(REBVAL*, ARR_AT(DS_Array, DS_Index));
+
+    REBLEN len_new = len_old + amount;
+    SET_SERIES_LEN(DS_Array, len_new);
+
+  #if DEBUG_POISON_DROPPED_STACK_CELLS
+    REBVAL *poison = cast(REBVAL*, ARR_AT(DS_Array, len_old));
+    REBLEN n;
+    for (n = len_old; n < len_new; ++n, ++poison)
+        Poison_Cell(poison);
+    assert(poison == ARR_TAIL(DS_Array));
+  #endif
+
+    DS_Movable_Tail = ARR_TAIL(DS_Array);
+}
+
+
 //
 //  Pop_Stack_Values_Core: C
 //
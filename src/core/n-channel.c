@@ -0,0 +1,201 @@
+//
+//  File: %n-channel.c
+//  Summary: "native functions for bounded value channels"
+//  Section: natives
+//  Project: "Rebol 3 Interpreter and Run-time (Ren-C branch)"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2022 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information.
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Channels are bounded FIFOs intended for handing values between the stages
+// of a pipeline (scan -> transform -> emit).  Every value sent is frozen
+// deeply first--so whatever comes out the other side can be used without
+// worrying that the producer will mutate it afterward.  That discipline is
+// what would make it safe to someday drain a channel from a different
+// evaluator than the one that filled it; for now both ends run on the same
+// evaluator, and "back-pressure" takes the form of CHANNEL-SEND returning
+// false (full) and CHANNEL-RECEIVE returning void (nothing yet).
+//
+// A channel is represented as a BLOCK! whose array is marked with
+// SERIES_INFO_PROTECTED: user code can inspect it, but only the natives in
+// this file mutate it.  A few header slots precede the ring storage.
+//
+
+#include "sys-core.h"
+
+enum {
+    IDX_CHANNEL_HEAD = 0,  // ring offset of the oldest buffered value
+    IDX_CHANNEL_COUNT,  // how many values are currently buffered
+    IDX_CHANNEL_CLOSED,  // nonzero once CHANNEL-CLOSE has run
+    IDX_CHANNEL_MAX  // ring slots follow the header
+};
+
+
+// The channel natives are the mutation boundary for the ring: the array is
+// SERIES_INFO_PROTECTED so user-level code can only inspect it, hence the
+// direct node access here (ENSURE_MUTABLE would refuse the protection).
+//
+static Array(*) Channel_Array_May_Fail(const REBVAL *channel)
+{
+    Array(*) a = ARR(SER(VAL_NODE1(channel)));
+    if (
+        ARR_LEN(a) <= IDX_CHANNEL_MAX  // capacity of at least one
+        or NOT_SERIES_INFO(a, PROTECTED)
+        or not IS_INTEGER(ARR_AT(a, IDX_CHANNEL_HEAD))
+        or not IS_INTEGER(ARR_AT(a, IDX_CHANNEL_COUNT))
+        or not IS_INTEGER(ARR_AT(a, IDX_CHANNEL_CLOSED))
+    ){
+        fail ("BLOCK! is not a channel (make one with MAKE-CHANNEL)");
+    }
+    return a;
+}
+
+
+//
+//  make-channel: native [
+//
+//  {Make a bounded FIFO for passing deeply-frozen values between stages}
+//
+//      return: [block!]
+//      capacity "Most values buffered before CHANNEL-SEND reports full"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(make_channel)
+{
+    INCLUDE_PARAMS_OF_MAKE_CHANNEL;
+
+    REBINT capacity = VAL_INT32(ARG(capacity));
+    if (capacity <= 0)
+        fail (PARAM(capacity));
+
+    Array(*) a = Make_Array_Core(
+        IDX_CHANNEL_MAX + capacity,
+        NODE_FLAG_MANAGED | SERIES_FLAG_FIXED_SIZE
+    );
+    SET_SERIES_LEN(a, IDX_CHANNEL_MAX + capacity);
+
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_HEAD), 0);
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_COUNT), 0);
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_CLOSED), 0);
+
+    REBINT i;
+    for (i = 0; i < capacity; ++i)
+        Init_Blank(ARR_AT(a, IDX_CHANNEL_MAX + i));
+
+    SET_SERIES_INFO(a, PROTECTED);  // inspectable, but user code can't poke
+
+    return Init_Block(OUT, a);
+}
+
+
+//
+//  channel-send: native [
+//
+//  {Put a value into a channel, freezing it deeply first}
+//
+//      return: "True if accepted, false if the channel is full (try again)"
+//          [logic!]
+//      channel [block!]
+//      value [any-value!]
+//  ]
+//
+DECLARE_NATIVE(channel_send)
+{
+    INCLUDE_PARAMS_OF_CHANNEL_SEND;
+
+    Array(*) a = Channel_Array_May_Fail(ARG(channel));
+
+    if (VAL_INT32(ARR_AT(a, IDX_CHANNEL_CLOSED)) != 0)
+        fail ("Cannot CHANNEL-SEND to a closed channel");
+
+    REBINT capacity = ARR_LEN(a) - IDX_CHANNEL_MAX;
+    REBINT head = VAL_INT32(ARR_AT(a, IDX_CHANNEL_HEAD));
+    REBINT count = VAL_INT32(ARR_AT(a, IDX_CHANNEL_COUNT));
+
+    if (count == capacity)
+        return Init_False(OUT);  // back-pressure, caller decides how to wait
+
+    // The receiving end must be able to use the value without coordinating
+    // with the sender, so anything that goes in gets frozen deeply.
+    //
+    Force_Value_Frozen_Deep(ARG(value));
+
+    Copy_Cell(
+        ARR_AT(a, IDX_CHANNEL_MAX + ((head + count) % capacity)),
+        ARG(value)
+    );
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_COUNT), count + 1);
+
+    return Init_True(OUT);
+}
+
+
+//
+//  channel-receive: native [
+//
+//  {Take the oldest value from a channel}
+//
+//      return: "Void if nothing available yet, null if closed and drained"
+//          [<opt> <void> any-value!]
+//      channel [block!]
+//  ]
+//
+DECLARE_NATIVE(channel_receive)
+{
+    INCLUDE_PARAMS_OF_CHANNEL_RECEIVE;
+
+    Array(*) a = Channel_Array_May_Fail(ARG(channel));
+
+    REBINT capacity = ARR_LEN(a) - IDX_CHANNEL_MAX;
+    REBINT head = VAL_INT32(ARR_AT(a, IDX_CHANNEL_HEAD));
+    REBINT count = VAL_INT32(ARR_AT(a, IDX_CHANNEL_COUNT));
+
+    if (count == 0) {
+        if (VAL_INT32(ARR_AT(a, IDX_CHANNEL_CLOSED)) != 0)
+            return nullptr;  // like READ at end of file
+        return VOID;  // nothing yet--the producer may still be running
+    }
+
+    Cell(*) slot = ARR_AT(a, IDX_CHANNEL_MAX + head);
+    Copy_Cell(OUT, SPECIFIC(slot));
+    Init_Blank(slot);  // don't pin the value's GC lifetime to the ring
+
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_HEAD), (head + 1) % capacity);
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_COUNT), count - 1);
+
+    return OUT;
+}
+
+
+//
+//  channel-close: native [
+//
+//  {Close a channel; receivers drain whatever is buffered, then get null}
+//
+//      return: [block!]
+//      channel [block!]
+//  ]
+//
+DECLARE_NATIVE(channel_close)
+{
+    INCLUDE_PARAMS_OF_CHANNEL_CLOSE;
+
+    Array(*) a = Channel_Array_May_Fail(ARG(channel));
+
+    Init_Integer(ARR_AT(a, IDX_CHANNEL_CLOSED), 1);  // idempotent
+
+    return COPY(ARG(channel));
+}
@@ -1152,6 +1152,9 @@ DECLARE_NATIVE(case)
         return CONTINUE_SUBFRAME(sub);
     }
 
+    if (PG_Counting_Branches)  // see PROFILE-BRANCHES
+        Count_Branch_Hit(VAL_ARRAY(cases), branch);
+
     STATE = ST_CASE_RUNNING_BRANCH;
     SUBFRAME->executor = &Just_Use_Out_Executor;
     return CONTINUE_CORE(
@@ -1195,6 +1198,268 @@ DECLARE_NATIVE(case)
 }}
 
 
+//=//// SWITCH LITERAL DISPATCH TABLES ////////////////////////////////////=//
+//
+// SWITCH compares its value against each candidate sequentially, evaluating
+// every candidate expression along the way.  A protocol decoder switching
+// over hundreds of message types pays that scan per packet, even though its
+// candidates are all literals and the answer never changes.
+//
+// When the cases block is FROZEN and every candidate is a literal (a plain
+// or quoted INTEGER!, or a quoted WORD!), the candidates can be compiled
+// once into a hash table mapping candidate to branch offset, and dispatch
+// becomes O(1).  Freezing is what makes the caching sound: a frozen array
+// can never be modified, so the table can't go stale.  Tables are cached in
+// a small direct-mapped array keyed by the block's identity, with an API
+// handle pinning each compiled block (both against GC and against its
+// pointer being reused).
+//
+// The table replicates lax EQUAL? semantics exactly or it doesn't engage:
+// word candidates match spelling caselessly against plain/SET-/GET-/META-
+// word values (the kinds lax equality coerces), integer candidates match
+// INTEGER! values only (a DECIMAL! can laxly equal an integer, so decimals
+// take the sequential path), and a block with trailing fallout or any
+// non-literal candidate is left alone entirely.
+//
+
+typedef struct {
+    REBLEN branch;  // offset of the branch cell plus one (0 = empty slot)
+    bool is_word;
+    Symbol(const*) symbol;  // word candidate, matched caselessly
+    REBI64 i64;  // integer candidate
+} SwitchCaseSlot;
+
+typedef struct {
+    Array(const*) array;  // the frozen cases block this table compiles
+    REBVAL *holder;  // API handle pinning the block (a GC root)
+    REBLEN capacity;  // always a power of two
+    SwitchCaseSlot *slots;
+} SwitchTable;
+
+#define NUM_SWITCH_TABLES 64  // direct-mapped; a collision evicts the loser
+
+static SwitchTable *Switch_Tables[NUM_SWITCH_TABLES];
+
+static SwitchCaseSlot *Probe_Switch_Case_Slot(
+    SwitchTable *t,
+    bool is_word,
+    Symbol(const*) symbol,  // only if is_word
+    REBI64 i64  // only if not is_word
+){
+    uint32_t hash;
+    if (is_word)
+        hash = cast(uint32_t, Hash_String(symbol));  // caseless, canon-free
+    else
+        hash = cast(uint32_t, i64) ^ cast(uint32_t, cast(uint64_t, i64) >> 32);
+
+    REBLEN n = hash & (t->capacity - 1);
+    while (t->slots[n].branch != 0) {
+        SwitchCaseSlot *slot = &t->slots[n];
+        if (slot->is_word == is_word) {
+            if (is_word
+                ? Are_Synonyms(slot->symbol, symbol)
+                : slot->i64 == i64
+            ){
+                return slot;
+            }
+        }
+        n = (n + 1) & (t->capacity - 1);
+    }
+    return &t->slots[n];  // first empty slot probed
+}
+
+static void Free_Switch_Table(SwitchTable *t) {
+    FREE_N(SwitchCaseSlot, t->capacity, t->slots);
+    rebRelease(t->holder);
+    FREE(SwitchTable, t);
+}
+
+//
+//  Discard_Switch_Tables: C
+//
+// Called by Shutdown_Core(); the holder handles are GC roots that would
+// otherwise be reported as leaks.
+//
+void Discard_Switch_Tables(void)
+{
+    REBLEN n;
+    for (n = 0; n < NUM_SWITCH_TABLES; ++n) {
+        if (Switch_Tables[n] != nullptr) {
+            Free_Switch_Table(Switch_Tables[n]);
+            Switch_Tables[n] = nullptr;
+        }
+    }
+}
+
+// Decide if a cell is a literal candidate the table can represent: a plain
+// INTEGER!, or an INTEGER! or WORD! under exactly one quote (an evaluation
+// step peels the quote off, making the cell's heart the compared value).
+//
+static bool Is_Literal_Switch_Candidate(Cell(const*) v) {
+    enum Reb_Kind heart = CELL_HEART(v);
+    if (QUOTE_BYTE(v) == UNQUOTED_1)
+        return heart == REB_INTEGER;
+    if (QUOTE_BYTE(v) == UNQUOTED_1 + 2)  // exactly one quote level
+        return heart == REB_INTEGER or heart == REB_WORD;
+    return false;  // quasiforms, deeper quotes...
+}
+
+// Compile a frozen cases block into a dispatch table, or return nullptr if
+// any candidate isn't a representable literal (or material trails the last
+// branch, since fallout has to be evaluated on a miss).
+//
+static SwitchTable *Try_Make_Switch_Table(const REBVAL *cases)
+{
+    Array(*) arr = m_cast(Array(*), VAL_ARRAY(cases));  // cell access only
+    REBLEN len = ARR_LEN(arr);
+
+    REBLEN num_candidates = 0;
+    REBLEN run = 0;  // candidates since the last branch
+
+    REBLEN n;
+    for (n = 0; n < len; ++n) {
+        Cell(const*) at = ARR_AT(arr, n);
+        enum Reb_Kind heart = CELL_HEART(at);
+        if (QUOTE_BYTE(at) == UNQUOTED_1) {
+            if (heart == REB_COMMA)
+                continue;  // evaluates to nihil, skipped either way
+            if (heart == REB_BLOCK or heart == REB_META_BLOCK) {
+                run = 0;
+                continue;
+            }
+        }
+        if (not Is_Literal_Switch_Candidate(at))
+            return nullptr;
+        ++num_candidates;
+        ++run;
+    }
+    if (run != 0)
+        return nullptr;  // trailing fallout, misses must evaluate it
+    if (num_candidates == 0)
+        return nullptr;  // nothing to look up
+
+    REBLEN capacity = 8;
+    while (capacity < num_candidates * 2)
+        capacity *= 2;
+
+    SwitchCaseSlot *slots = TRY_ALLOC_N_ZEROFILL(SwitchCaseSlot, capacity);
+    if (slots == nullptr)
+        fail (Error_No_Memory(capacity * sizeof(SwitchCaseSlot)));
+
+    SwitchTable *t = TRY_ALLOC(SwitchTable);
+    if (t == nullptr) {
+        FREE_N(SwitchCaseSlot, capacity, slots);
+        fail (Error_No_Memory(sizeof(SwitchTable)));
+    }
+    t->array = VAL_ARRAY(cases);
+    t->capacity = capacity;
+    t->slots = slots;
+
+    // Walking backward, the latest branch seen is each candidate's target.
+    // On duplicate candidates the earliest must win (it is compared first
+    // in sequential order), so earlier insertions overwrite later ones.
+    //
+    REBLEN branch = 0;  // as stored: offset plus one, 0 = none seen
+    for (n = len; n > 0;) {
+        --n;
+        Cell(const*) at = ARR_AT(arr, n);
+        enum Reb_Kind heart = CELL_HEART(at);
+        if (QUOTE_BYTE(at) == UNQUOTED_1) {
+            if (heart == REB_COMMA)
+                continue;
+            if (heart == REB_BLOCK or heart == REB_META_BLOCK) {
+                branch = n + 1;
+                continue;
+            }
+        }
+        assert(branch != 0);  // validated above: no trailing candidates
+
+        SwitchCaseSlot *slot;
+        if (heart == REB_WORD) {
+            slot = Probe_Switch_Case_Slot(
+                t, true, VAL_WORD_SYMBOL(VAL_UNESCAPED(at)), 0
+            );
+            slot->is_word = true;
+            slot->symbol = VAL_WORD_SYMBOL(VAL_UNESCAPED(at));
+        }
+        else {
+            assert(heart == REB_INTEGER);
+            slot = Probe_Switch_Case_Slot(t, false, nullptr, VAL_INT64(at));
+            slot->is_word = false;
+            slot->i64 = VAL_INT64(at);
+        }
+        slot->branch = branch;
+    }
+
+    t->holder = Init_Block(Alloc_Value(), arr);
+
+    Array(*) single = Singular_From_Cell(t->holder);
+    CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+    Unlink_Api_Handle_From_Frame(single);  // the frame compiling the table
+
+    return t;
+}
+
+enum SwitchDispatchResult {
+    SWITCH_DISPATCH_INAPPLICABLE,  // value or block shape needs a real scan
+    SWITCH_DISPATCH_HIT,  // take the branch at *branch_offset
+    SWITCH_DISPATCH_MISS  // proven that no candidate can match
+};
+
+static enum SwitchDispatchResult Try_Dispatch_Switch(
+    REBLEN *branch_offset,
+    const REBVAL *left,
+    const REBVAL *cases
+){
+    if (QUOTE_BYTE(left) != UNQUOTED_1)
+        return SWITCH_DISPATCH_INAPPLICABLE;  // quoted/quasi/isotope forms
+
+    bool is_word;
+    enum Reb_Kind heart = CELL_HEART(left);
+    if (heart == REB_INTEGER)
+        is_word = false;
+    else if (
+        heart == REB_WORD or heart == REB_SET_WORD
+        or heart == REB_GET_WORD or heart == REB_META_WORD
+    ){
+        is_word = true;  // the kinds lax equality compares to WORD! spelling
+    }
+    else
+        return SWITCH_DISPATCH_INAPPLICABLE;  // e.g. DECIMAL! can equal int
+
+    if (VAL_INDEX(cases) != 0)
+        return SWITCH_DISPATCH_INAPPLICABLE;
+
+    Array(const*) a = VAL_ARRAY(cases);
+    if (not Is_Series_Frozen(a))
+        return SWITCH_DISPATCH_INAPPLICABLE;  // mutation could stale a table
+
+    REBLEN cachen = (cast(uintptr_t, cast(const void*, a)) >> 4)
+        % NUM_SWITCH_TABLES;
+    SwitchTable *t = Switch_Tables[cachen];
+    if (t == nullptr or t->array != a) {
+        SwitchTable *built = Try_Make_Switch_Table(cases);
+        if (built == nullptr)
+            return SWITCH_DISPATCH_INAPPLICABLE;
+        if (t != nullptr)
+            Free_Switch_Table(t);  // direct-mapped: evict the collider
+        Switch_Tables[cachen] = t = built;
+    }
+
+    SwitchCaseSlot *slot = Probe_Switch_Case_Slot(
+        t,
+        is_word,
+        is_word ? VAL_WORD_SYMBOL(left) : nullptr,
+        is_word ? 0 : VAL_INT64(left)
+    );
+    if (slot->branch == 0)
+        return SWITCH_DISPATCH_MISS;
+
+    *branch_offset = slot->branch - 1;
+    return SWITCH_DISPATCH_HIT;
+}
+
+
 //
 //  switch: native [
 //
@@ -1259,7 +1524,8 @@ DECLARE_NATIVE(switch)
     enum {
         ST_SWITCH_INITIAL_ENTRY = STATE_0,
         ST_SWITCH_EVALUATING_RIGHT,
-        ST_SWITCH_RUNNING_BRANCH
+        ST_SWITCH_RUNNING_BRANCH,
+        ST_SWITCH_RUNNING_TABLE_BRANCH
     };
 
     switch (STATE) {
@@ -1276,6 +1542,9 @@ DECLARE_NATIVE(switch)
         }
         goto next_switch_step;
 
+      case ST_SWITCH_RUNNING_TABLE_BRANCH:
+        return BRANCHED(OUT);  // table dispatch has no subframe to drop
+
       default: assert(false);
     }
 
@@ -1290,6 +1559,38 @@ DECLARE_NATIVE(switch)
     if (IS_BLOCK(left) and Get_Cell_Flag(left, UNEVALUATED))
         fail (Error_Block_Switch_Raw(left));  // `switch [x] [...]` safeguard
 
+    if (not REF(all) and not REF(type) and Is_Nulled(predicate)) {
+        //
+        // All-literal candidates over a frozen block dispatch in O(1) from
+        // a compiled table instead of comparing sequentially (see the
+        // SWITCH LITERAL DISPATCH TABLES explanation above).
+        //
+        REBLEN branch_offset;
+        enum SwitchDispatchResult r =
+            Try_Dispatch_Switch(&branch_offset, left, cases);
+
+        if (r == SWITCH_DISPATCH_MISS)
+            return Finalize_Void(OUT);  // proven: no candidate matches
+
+        if (r == SWITCH_DISPATCH_HIT) {
+            Cell(const*) branch = ARR_AT(
+                m_cast(Array(*), VAL_ARRAY(cases)), branch_offset
+            );
+
+            if (PG_Counting_Branches)  // see PROFILE-BRANCHES
+                Count_Branch_Hit(VAL_ARRAY(cases), branch);
+
+            STATE = ST_SWITCH_RUNNING_TABLE_BRANCH;
+            return CONTINUE_CORE(
+                FRESHEN(OUT),
+                FRAME_FLAG_BRANCH,
+                VAL_SPECIFIER(cases), branch
+            );
+        }
+
+        // fall through to the sequential scan
+    }
+
     Frame(*) subframe = Make_Frame_At(
         cases,
         FRAME_FLAG_TRAMPOLINE_KEEPALIVE
@@ -1370,6 +1671,9 @@ DECLARE_NATIVE(switch)
         at = At_Frame(SUBFRAME);
     }
 
+    if (PG_Counting_Branches)  // see PROFILE-BRANCHES
+        Count_Branch_Hit(VAL_ARRAY(cases), at);
+
     STATE = ST_SWITCH_RUNNING_BRANCH;
     SUBFRAME->executor = &Just_Use_Out_Executor;
     return CONTINUE_CORE(
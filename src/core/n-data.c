@@ -719,6 +719,56 @@ bool Get_Var_Push_Refinements_Throws(
             panic (var);
         }
 
+        // Sequences like obj.field.sub are overwhelmingly plain WORD!s that
+        // tunnel through plain contexts.  Each such step can be resolved by
+        // a direct slot search, dodging the data stack and the evaluator
+        // frame the generic PICK*-based loop below spins up per step.  Any
+        // element or intermediate value the walk doesn't recognize abandons
+        // it and takes the generic route...lookups are pure reads, so there
+        // is nothing to undo.  (PORT!s are left out, as their PICK* can be
+        // overridden by actors.)
+        //
+        if (not steps_out or steps_out == GROUPS_OK) {
+            Cell(const*) tail;
+            Cell(const*) head = VAL_ARRAY_AT(&tail, var);
+            Cell(const*) at;
+            for (at = head; at != tail; ++at)
+                if (not IS_WORD(at))
+                    break;
+
+            if (at == tail) {  // all plain words, try the direct walk
+                REBSPC *at_specifier = Derive_Specifier(var_specifier, var);
+                const REBVAL *slot = Lookup_Word_May_Fail(head, at_specifier);
+                if (Is_Isotope(slot))
+                    fail (Error_Bad_Word_Get(head, slot));
+
+                for (at = head + 1; at != tail; ++at) {
+                    if (
+                        not IS_OBJECT(slot)
+                        and not IS_MODULE(slot)
+                        and not IS_ERROR(slot)
+                    ){
+                        break;  // generic loop gives the methodized behavior
+                    }
+                    const REBVAL *sub = TRY_VAL_CONTEXT_VAR(
+                        slot, VAL_WORD_SYMBOL(at)
+                    );
+                    if (not sub) {
+                        DECLARE_LOCAL (picker);
+                        Derelativize(picker, at, at_specifier);
+                        fail (Error_Bad_Pick_Raw(picker));
+                    }
+                    slot = sub;
+                }
+
+                if (at == tail) {
+                    Copy_Cell(out, slot);  // void slot gives void, like PICK*
+                    Decay_If_Unstable(out);
+                    return false;
+                }
+            }
+        }
+
         Cell(const*) tail;
         Cell(const*) head = VAL_ARRAY_AT(&tail, var);
         Cell(const*) at;
@@ -1753,6 +1803,45 @@ DECLARE_NATIVE(free)
 }
 
 
+//
+//  reserve: native [
+//
+//  {Pre-expands capacity so later insertions won't reallocate}
+//
+//      return: "The same value (reserved capacity isn't seen by LENGTH OF)"
+//          [any-series! map! object!]
+//      series [any-series! map! object!]
+//      extra "How many additional elements (or pairs/keys) to make room for"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(reserve)
+//
+// Building a large collection by appending in a loop pays for incremental
+// expansions (and for maps, hash table rehashes).  Reserving the room up
+// front turns each append into a plain slot fill.
+{
+    INCLUDE_PARAMS_OF_RESERVE;
+
+    REBVAL *v = ARG(series);
+
+    REBINT extra = VAL_INT32(ARG(extra));
+    if (extra < 0)
+        fail (PARAM(extra));
+
+    if (IS_MAP(v))
+        Reserve_Map(VAL_MAP_ENSURE_MUTABLE(v), extra);
+    else if (ANY_CONTEXT(v))
+        Expand_Context(VAL_CONTEXT(ENSURE_MUTABLE(v)), extra);
+    else {
+        REBSER *s = VAL_SERIES_ENSURE_MUTABLE(v);
+        Extend_Series_If_Necessary(s, extra);
+    }
+
+    return COPY(v);
+}
+
+
 //
 //  free?: native [
 //
@@ -1853,6 +1942,23 @@ bool Try_As_String(
             Size bytes_left = BIN_LEN(bin);
             const Byte* bp = BIN_HEAD(bin);
             for (; bytes_left > 0; --bytes_left, ++bp) {
+                //
+                // Large aliased buffers (e.g. protocol data) are mostly
+                // ASCII, so vouch for whole machine words at a time when
+                // possible.  Anything the chunk test can't clear--high
+                // bits, NUL bytes, CRs--is handled by the byte-at-a-time
+                // code below, then the gobbling resumes.
+                //
+                while (bytes_left >= UTF8_SWAR_CHUNK and Ascii_Chunk_Clean(bp)) {
+                    if (bp < at_ptr)  // all ASCII: byte index = codepoint
+                        index += MIN(cast(Size, at_ptr - bp), UTF8_SWAR_CHUNK);
+                    num_codepoints += UTF8_SWAR_CHUNK;
+                    bp += UTF8_SWAR_CHUNK;
+                    bytes_left -= UTF8_SWAR_CHUNK;
+                }
+                if (bytes_left == 0)
+                    break;
+
                 if (bp < at_ptr)
                     ++index;
 
@@ -1881,7 +1987,10 @@ bool Try_As_String(
 
             // !!! TBD: cache index/offset
 
-            UNUSED(all_ascii);  // TBD: maintain cache
+            // No cache to maintain for the ASCII case: Is_Definitely_Ascii()
+            // notices when the codepoint count matches the byte count.
+            //
+            UNUSED(all_ascii);
         }
         else {
             // !!! It's a string series, but or mapping acceleration is
@@ -2358,6 +2467,84 @@ DECLARE_NATIVE(aliases_q)
 }
 
 
+//
+//  slice: native [
+//
+//  {Read-only view on a segment of a binary, without copying the bytes}
+//
+//      return: [binary!]
+//      series "Frozen deeply if it wasn't already (bytes can never change)"
+//          [binary!]
+//      /part "Length of the view (defaults to running to the tail)"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(slice)
+//
+// Pipelines that extract many substrings from one large buffer would pay for
+// an allocation and a copy per extraction with COPY/PART.  SLICE gives back
+// a series that borrows the buffer's own bytes (see Make_Binary_View()).
+//
+// Like AS, reusing the data is only legal if it can never change or move, so
+// the source is frozen...and won't freeze if it is CONST (the owner of the
+// mutable reference should be the one to make that irreversible decision).
+{
+    INCLUDE_PARAMS_OF_SLICE;
+
+    REBVAL *v = ARG(series);
+
+    Size size;
+    VAL_BINARY_SIZE_AT(&size, v);  // also checks the index is in range
+    Size offset = VAL_INDEX(v);
+
+    if (REF(part)) {
+        REBINT limit = VAL_INT32(ARG(part));
+        if (limit < 0 or cast(Size, limit) > size)
+            fail (Error_Out_Of_Range(ARG(part)));
+        size = limit;
+    }
+
+    Binary(*) bin = m_cast(Binary(*), VAL_BINARY(v));
+    if (not Is_Series_Frozen(bin)) {
+        if (Get_Cell_Flag(v, CONST))
+            fail (Error_Alias_Constrains_Raw());
+
+        Force_Series_Managed(bin);
+        Freeze_Series(bin);
+    }
+
+    // A slice of a slice borrows from the original owner directly, so chains
+    // of extraction stay flat and don't pin intermediate stubs.  But the
+    // owner may not be a byte series at all--e.g. a mapped file's data is
+    // kept alive by a HANDLE! (see Make_Binary_View_Foreign()).  In that
+    // case the view itself serves as the owner: it's frozen, like any other.
+    //
+    if (GET_SERIES_FLAG(bin, DATA_NOT_OWNED)) {
+        REBSER *owner = LINK(ViewOwner, bin);
+        if (
+            SER_FLAVOR(owner) == FLAVOR_BINARY
+            or SER_FLAVOR(owner) == FLAVOR_STRING  // binary was an AS alias
+        ){
+            offset += BIN_HEAD(bin) - BIN_HEAD(BIN(owner));
+            bin = BIN(owner);
+        }
+    }
+
+    return Init_Binary(OUT, Make_Binary_View(bin, offset, size));
+}
+
+
+//
+//  Intrinsic_Null_Q: C
+//
+// Body of NULL?, callable without a frame (see DETAILS_FLAG_IS_INTRINSIC).
+//
+void Intrinsic_Null_Q(REBVAL *out, REBVAL *arg)
+{
+    Init_Logic(out, Is_Nulled(arg));
+}
+
+
 //
 //  null?: native [
 //
@@ -2371,7 +2558,19 @@ DECLARE_NATIVE(null_q)
 {
     INCLUDE_PARAMS_OF_NULL_Q;
 
-    return Init_Logic(OUT, Is_Nulled(ARG(value)));
+    Intrinsic_Null_Q(OUT, ARG(value));
+    return OUT;
+}
+
+
+//
+//  Intrinsic_Logic_Q: C
+//
+// Body of LOGIC?, callable without a frame (see DETAILS_FLAG_IS_INTRINSIC).
+//
+void Intrinsic_Logic_Q(REBVAL *out, REBVAL *arg)
+{
+    Init_Logic(out, IS_LOGIC(arg));
 }
 
 
@@ -2389,7 +2588,8 @@ DECLARE_NATIVE(logic_q)
 {
     INCLUDE_PARAMS_OF_LOGIC_Q;
 
-    return Init_Logic(OUT, IS_LOGIC(ARG(value)));
+    Intrinsic_Logic_Q(OUT, ARG(value));
+    return OUT;
 }
 
 
@@ -2425,6 +2625,17 @@ DECLARE_NATIVE(none)
     return Init_None(OUT);
 }
 
+//
+//  Intrinsic_Void_Q: C
+//
+// Body of VOID?, callable without a frame (see DETAILS_FLAG_IS_INTRINSIC).
+//
+void Intrinsic_Void_Q(REBVAL *out, REBVAL *arg)
+{
+    Init_Logic(out, Is_Void(arg));
+}
+
+
 //
 //  void?: native [
 //
@@ -2438,7 +2649,8 @@ DECLARE_NATIVE(void_q)
 {
     INCLUDE_PARAMS_OF_VOID_Q;
 
-    return Init_Logic(OUT, Is_Void(ARG(optional)));
+    Intrinsic_Void_Q(OUT, ARG(optional));
+    return OUT;
 }
 
 
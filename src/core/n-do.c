@@ -262,6 +262,32 @@ DECLARE_NATIVE(shove)
 }
 
 
+// Streaming state for DO/STREAM, kept in otherwise-generic frame flag bits
+// (precedent: FRAME_FLAG_ALL_VOIDS in %n-control.c)
+//
+#define FRAME_FLAG_STREAM_WROTE FRAME_FLAG_24  // a separator is owed
+#define FRAME_FLAG_STREAM_NEWLINE FRAME_FLAG_25  // step had NEWLINE_BEFORE
+
+
+// Mold one evaluation product of DO/STREAM onto the accumulating chunk.  A
+// fresh mold per value is used (vs. holding one mold open across steps)
+// because the steps run arbitrary code which must see the shared mold buffer
+// in a balanced state--including if it fails abruptly.
+//
+static void Mold_Stream_Step_Into_Chunk(String(*) chunk, Cell(const*) v)
+{
+    DECLARE_MOLD (mo);
+    Push_Mold(mo);
+    Mold_Value(mo, v);
+    Append_Utf8(
+        chunk,
+        cs_cast(BIN_AT(mo->series, mo->base.size)),
+        STR_SIZE(mo->series) - mo->base.size
+    );
+    Drop_Mold(mo);
+}
+
+
 //
 //  do: native [
 //
@@ -285,6 +311,9 @@ DECLARE_NATIVE(shove)
 //      /args "Sets system.script.args if doing a script (usually a TEXT!)"
 //          [any-value!]
 //      /only "Don't catch QUIT (default behavior for BLOCK!)"
+//      /stream "Write each molded product to this port in chunks, return port"
+//          [port!]
+//      <local> chunk
 //  ]
 //
 DECLARE_NATIVE(do)
@@ -298,13 +327,59 @@ DECLARE_NATIVE(do)
 //    and it takes a parameter, but you specify END as the WITH.  But giving
 //    a special error here--that can point people to "did you mean REEVALUATE"
 //    is something that is probably helpful enough to add.
+//
+// 4. DO/STREAM is for generate-and-emit pipelines: instead of collecting
+//    results into a big block and WRITEing a giant mold at the end, each
+//    step's product is molded onto an accumulating TEXT! chunk which is
+//    handed to the port's WRITE actor whenever it passes the same chunk
+//    size MOLD/INTO uses.  Peak memory is one chunk, regardless of how
+//    much output the block generates.  Chunk ownership transfers to the
+//    port on flush (a fresh chunk is allocated), so actors may retain the
+//    TEXT! they are given without copying.
+//
+// 5. The streamed form matches what MOLD SPREAD of the collected block
+//    would produce: space-separated, with newlines between products that
+//    had newlines between their source expressions.  Void and nihil steps
+//    vanish; NULL and other isotopes are errors, as in REDUCE.
 {
     INCLUDE_PARAMS_OF_DO;
 
     REBVAL *source = ARG(source);
 
+    enum {
+        ST_DO_INITIAL_ENTRY = STATE_0,
+        ST_DO_STREAM_STEP
+    };
+
+    switch (STATE) {
+      case ST_DO_INITIAL_ENTRY :
+        goto initial_entry;
+
+      case ST_DO_STREAM_STEP :
+        goto stream_step_result_in_out;
+
+      default : assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
     Tweak_Non_Const_To_Explicitly_Mutable(source);
 
+    if (REF(stream)) {  // constant-memory emission, see [4]
+        if (not IS_BLOCK(source))
+            fail ("DO/STREAM only works with BLOCK! source");
+
+        Init_Text(ARG(chunk), Make_String(MOLD_FLUSH_SIZE_DEFAULT));
+
+        Frame(*) subframe = Make_Frame_At(
+            source,
+            FRAME_FLAG_ALLOCATED_FEED
+                | FRAME_FLAG_TRAMPOLINE_KEEPALIVE  // reused for each step
+        );
+        Push_Frame(OUT, subframe);
+        goto next_stream_step;
+    }
+
   #if !defined(NDEBUG)
     Set_Cell_Flag(source, PROTECTED);  // maybe only GC reference, keep!
   #endif
@@ -398,7 +473,79 @@ DECLARE_NATIVE(do)
     }
 
     fail (Error_Do_Arity_Non_Zero_Raw());  // https://trello.com/c/YMAb89dv
-}
+
+} next_stream_step: {  ///////////////////////////////////////////////////////
+
+    if (Is_Feed_At_End(SUBFRAME->feed))
+        goto stream_finished;
+
+    if (Get_Cell_Flag(At_Feed(SUBFRAME->feed), NEWLINE_BEFORE))
+        Set_Frame_Flag(FRAME, STREAM_NEWLINE);
+    else
+        Clear_Frame_Flag(FRAME, STREAM_NEWLINE);
+
+    SUBFRAME->executor = &Evaluator_Executor;
+    STATE = ST_DO_STREAM_STEP;
+    Restart_Evaluator_Frame(SUBFRAME);
+    return CONTINUE_SUBFRAME(SUBFRAME);
+
+} stream_step_result_in_out: {  //////////////////////////////////////////////
+
+    if (Is_Nihil(OUT) or Is_Void(OUT))
+        goto next_stream_step;  // vanish, as in REDUCE, see [5]
+
+    Decay_If_Unstable(OUT);
+
+    if (Is_Nulled(OUT))
+        return RAISE(Error_Need_Non_Null_Raw());
+
+    String(*) chunk = VAL_STRING_ENSURE_MUTABLE(ARG(chunk));
+
+    if (Is_Splice(OUT)) {
+        Cell(const*) tail;
+        Cell(const*) at = VAL_ARRAY_AT(&tail, OUT);
+        for (; at != tail; ++at) {
+            if (Get_Frame_Flag(FRAME, STREAM_WROTE)) {
+                if (Get_Frame_Flag(FRAME, STREAM_NEWLINE))
+                    Append_Codepoint(chunk, '\n');
+                else
+                    Append_Codepoint(chunk, ' ');
+            }
+            Clear_Frame_Flag(FRAME, STREAM_NEWLINE);  // first item only
+            Mold_Stream_Step_Into_Chunk(chunk, at);
+            Set_Frame_Flag(FRAME, STREAM_WROTE);
+        }
+    }
+    else if (Is_Isotope(OUT))
+        return RAISE(Error_Bad_Isotope(OUT));
+    else {
+        if (Get_Frame_Flag(FRAME, STREAM_WROTE)) {
+            if (Get_Frame_Flag(FRAME, STREAM_NEWLINE))
+                Append_Codepoint(chunk, '\n');
+            else
+                Append_Codepoint(chunk, ' ');
+        }
+        Mold_Stream_Step_Into_Chunk(chunk, OUT);
+        Set_Frame_Flag(FRAME, STREAM_WROTE);
+    }
+
+    if (STR_SIZE(chunk) >= MOLD_FLUSH_SIZE_DEFAULT) {  // hand off, see [4]
+        rebElide("write", ARG(stream), ARG(chunk));
+        Init_Text(ARG(chunk), Make_String(MOLD_FLUSH_SIZE_DEFAULT));
+        SUBFRAME->feed->gotten = nullptr;  // actor ran arbitrary code
+    }
+
+    goto next_stream_step;
+
+} stream_finished: {  ////////////////////////////////////////////////////////
+
+    Drop_Frame(SUBFRAME);
+
+    if (STR_SIZE(VAL_STRING(ARG(chunk))) != 0)
+        rebElide("write", ARG(stream), ARG(chunk));
+
+    return COPY(ARG(stream));  // match WRITE's convention of port result
+}}
 
 
 //
@@ -750,6 +897,107 @@ DECLARE_NATIVE(applique)
 }}
 
 
+//
+//  run-frame: native [
+//
+//  {Run a FRAME! without expiring it, amortizing typechecking across runs}
+//
+//      return: [<opt> <void> any-value!]
+//      frame "Argument cells may be mutated by the call (not copied)"
+//          [frame!]
+//  ]
+//
+DECLARE_NATIVE(run_frame)
+//
+// DO of a FRAME! is one-shot: the call may corrupt the argument cells, so
+// the frame is marked stale and each further run needs a fresh copy...with
+// a new parameter walk and typecheck pass each time.  A dispatch layer that
+// applies the same function with mostly-same arguments at high rates pays
+// that plumbing on every call.
+//
+// RUN-FRAME instead treats the frame as reusable: the first run typechecks
+// normally and "arms" the varlist, and later runs enter Action_Executor()
+// at the dispatch point directly.  The caller's side of the contract is to
+// only overwrite argument cells with values that would have typechecked
+// (and to accept that the call may leave other argument cells changed).
+{
+    INCLUDE_PARAMS_OF_RUN_FRAME;
+
+    Value(*) frame = ARG(frame);
+
+    enum {
+        ST_RUN_FRAME_INITIAL_ENTRY = STATE_0,
+        ST_RUN_FRAME_RUNNING
+    };
+
+    switch (STATE) {
+      case ST_RUN_FRAME_INITIAL_ENTRY :
+        goto initial_entry;
+
+      case ST_RUN_FRAME_RUNNING :
+        goto run_finished;
+
+      default: assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
+    if (IS_FRAME_PHASED(frame))  // see REDO for tail-call recursion
+        fail ("Use REDO to restart a running FRAME! (not RUN-FRAME)");
+
+    Context(*) c = VAL_CONTEXT(frame);  // checks for INACCESSIBLE
+    Array(*) varlist = CTX_VARLIST(c);
+
+    if (CTX_FRAME_IF_ON_STACK(c) != nullptr)
+        fail ("FRAME! given to RUN-FRAME is currently running");
+
+    bool armed = Get_Subclass_Flag(VARLIST, varlist, FRAME_TYPECHECK_DONE);
+
+    if (Get_Subclass_Flag(VARLIST, varlist, FRAME_HAS_BEEN_INVOKED)) {
+        if (not armed)  // expired by a plain DO, not one of our runs
+            fail (Error_Stale_Frame_Raw());
+        Clear_Subclass_Flag(VARLIST, varlist, FRAME_HAS_BEEN_INVOKED);
+    }
+
+    Frame(*) f = Make_End_Frame(
+        FLAG_STATE_BYTE(
+            armed ? ST_ACTION_PRECHECKED : ST_ACTION_TYPECHECKING
+        )
+    );
+    f->executor = &Action_Executor;  // usually done by Push_Action()s
+
+    f->varlist = varlist;
+    f->rootvar = CTX_ROOTVAR(c);
+    INIT_BONUS_KEYSOURCE(varlist, f);
+
+    assert(FRM_PHASE(f) == CTX_FRAME_ACTION(c));
+    INIT_FRM_BINDING(f, VAL_FRAME_BINDING(frame));
+
+    Begin_Prefix_Action(f, VAL_FRAME_LABEL(frame));
+
+    Push_Frame(OUT, f);
+
+    STATE = ST_RUN_FRAME_RUNNING;
+    return BOUNCE_CONTINUE;
+
+} run_finished: {  ///////////////////////////////////////////////////////////
+
+    // Arm only once a run has made it through typechecking and dispatch; a
+    // frame whose check failed stays subject to the full pass next time.
+    //
+    Array(*) varlist = CTX_VARLIST(VAL_CONTEXT(frame));
+    Set_Subclass_Flag(VARLIST, varlist, FRAME_TYPECHECK_DONE);
+
+    // Begin_Action() marked the frame stale, which would also block the
+    // field assignments the caller needs to update arguments between runs.
+    // Reusability is the whole point here, so lift the staleness.
+    //
+    Clear_Subclass_Flag(VARLIST, varlist, FRAME_HAS_BEEN_INVOKED);
+
+    return OUT;
+}}
+
+
 //
 //  apply: native [
 //
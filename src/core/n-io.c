@@ -51,8 +51,8 @@ DECLARE_NATIVE(form)
 //
 //  "Converts value to a REBOL-readable string"
 //
-//      return: "Returns null if input is void"
-//          [<opt> text!]
+//      return: "Returns null if input is void, port if /INTO used"
+//          [<opt> text! port!]
 //      @truncated "Whether the mold was truncated"
 //          [logic!]
 //      value [<maybe> element?]
@@ -61,6 +61,8 @@ DECLARE_NATIVE(form)
 //      /flat "No indentation"
 //      /limit "Limit to a certain length"
 //          [integer!]
+//      /into "Stream output to a port in chunks vs. building one big TEXT!"
+//          [port!]
 //  ]
 //
 DECLARE_NATIVE(mold)
@@ -78,6 +80,24 @@ DECLARE_NATIVE(mold)
         SET_MOLD_FLAG(mo, MOLD_FLAG_LIMIT);
         mo->limit = Int32(ARG(limit));
     }
+    if (REF(into)) {
+        //
+        // Streaming mode never holds more than a chunk of output, so there's
+        // no full string to apply a /LIMIT to.
+        //
+        if (REF(limit))
+            fail (Error_Bad_Refines_Raw());
+
+        mo->port = ARG(into);
+        mo->flush_size = MOLD_FLUSH_SIZE_DEFAULT;
+    }
+    else {
+        // Pre-size the buffer from a cheap estimation pass, so big molds
+        // don't grow it through a cascade of doublings.  (Streaming mode
+        // flushes in chunks, so its buffer never needs to get big.)
+        //
+        Reserve_Mold_Estimated_Size(mo, v);
+    }
 
     Push_Mold(mo);
 
@@ -86,6 +106,15 @@ DECLARE_NATIVE(mold)
 
     Mold_Value(mo, v);
 
+    if (REF(into)) {
+        Flush_Mold_To_Port(mo);  // whatever the chunked flushes left behind
+        Drop_Mold(mo);
+
+        Init_Logic(ARG(truncated), false);
+        Copy_Cell(OUT, ARG(into));  // match WRITE's convention of port result
+        return Proxy_Multi_Returns(frame_);
+    }
+
     String(*) popped = Pop_Molded_String(mo);  // sets MOLD_FLAG_TRUNCATED
 
     Init_Logic(ARG(truncated), did (mo->opts & MOLD_FLAG_WAS_TRUNCATED));
@@ -688,6 +688,29 @@ struct Loop_Each_State {
     REBSPC *specifier;  // specifier (if applicable)
 };
 
+// Cleanups that have to run exactly once per enumeration, whether the state
+// is being freed by a loop native's finalization or by the GC collecting an
+// abandoned MAKE-ITERATOR handle.  Also called eagerly when a cursor hits
+// exhaustion, so the FIXED_SIZE hold doesn't linger until a garbage collect.
+//
+static void Release_Loop_Each_Resources(struct Loop_Each_State *les)
+{
+    if (les->data == nullptr)
+        return;  // already released (e.g. cursor drained before GC'd)
+
+    if (les->took_hold)  // release read-only lock
+        CLEAR_SERIES_FLAG(m_cast(REBSER*, les->series), FIXED_SIZE);
+
+    if (ANY_CONTEXT(les->data))
+        Shutdown_Evars(&les->u.evars);
+
+    if (Is_Api_Value(les->data))  // free data last (used above)
+        rebRelease(les->data);
+
+    les->data = nullptr;
+}
+
+
 //
 //  Init_Loop_Each: C
 //
@@ -699,7 +722,15 @@ void Init_Loop_Each(Value(*) iterator, Value(*) data)
     // about figuring out how to iterate optimized series.  Review as part of
     // an overall vetting of "generic iteration" (is a poor substitute for).
     //
-    assert(not Is_Api_Value(data));  // we will free API handles
+    // API handles are tolerated only if unmanaged, signaling that ownership
+    // is being handed over (the shutdown frees them--as the sequence
+    // conversion below counts on, and as MAKE-ITERATOR uses to keep its data
+    // alive independent of any frame).
+    //
+    assert(
+        not Is_Api_Value(data)
+        or NOT_SERIES_FLAG(Singular_From_Cell(data), MANAGED)
+    );
     if (ANY_SEQUENCE(data)) {
         data = rebValue(Canon(AS), Canon(BLOCK_X), rebQ(data));
         rebUnmanage(data);
@@ -772,16 +803,23 @@ void Init_Loop_Each(Value(*) iterator, Value(*) data)
 //
 // It's possible to opt out of variable slots using BLANK!.
 //
-static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
-{
+// The core routine works on a raw span of cells, so it doesn't care whether
+// they live in a pseudo-variable context or are a single target cell from
+// the cursor fast path (see NEXT-OF).
+//
+static bool Try_Loop_Each_Next_Core(
+    Value(const*) iterator,
+    REBVAL *pseudo_var,  // cells to fill (may be BIND_NOTE_REUSE redirects)
+    Cell(const*) pseudo_tail,
+    REBLEN num_vars
+){
     struct Loop_Each_State *les;
     les = VAL_HANDLE_POINTER(struct Loop_Each_State, iterator);
 
     if (not les->more_data)
         return false;
 
-    const REBVAR *pseudo_tail;
-    REBVAL *pseudo_var = CTX_VARS(&pseudo_tail, vars_ctx);
+    REBVAL *pseudo_head = pseudo_var;
     for (; pseudo_var != pseudo_tail; ++pseudo_var) {
         REBVAL *var = Real_Var_From_Pseudo(pseudo_var);
 
@@ -838,11 +876,11 @@ static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
                 );
             }
 
-            if (CTX_LEN(vars_ctx) == 1) {
+            if (num_vars == 1) {
                 //
                 // Only wanted the key (`for-each key obj [...]`)
             }
-            else if (CTX_LEN(vars_ctx) == 2) {
+            else if (num_vars == 2) {
                 //
                 // Want keys and values (`for-each key val obj [...]`)
                 //
@@ -877,11 +915,11 @@ static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
             if (var)
                 Copy_Cell(var, key);
 
-            if (CTX_LEN(vars_ctx) == 1) {
+            if (num_vars == 1) {
                 //
                 // Only wanted the key (`for-each key map [...]`)
             }
-            else if (CTX_LEN(vars_ctx) == 2) {
+            else if (num_vars == 2) {
                 //
                 // Want keys and values (`for-each key val map [...]`)
                 //
@@ -925,7 +963,7 @@ static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
             }
             else {
                 les->more_data = false;  // any remaining vars must be unset
-                if (pseudo_var == CTX_VARS_HEAD(vars_ctx)) {
+                if (pseudo_var == pseudo_head) {
                     //
                     // If we don't have at least *some* of the variables
                     // set for this body loop run, don't run the body.
@@ -945,6 +983,70 @@ static bool Try_Loop_Each_Next(Value(const*) iterator, Context(*) vars_ctx)
     return true;
 }
 
+
+// Prepares the loop variable(s) a Loop_Each client received in its :vars
+// argument, leaving the result in the vars cell for Try_Loop_Each_Next().
+//
+// Profiling showed the Virtual_Bind_Deep_To_New_Context() call dominating
+// the entry cost of FOR-EACH and friends.  When the spec is a single quoted
+// word, no new variable is created--the body isn't rebound at all, and every
+// assignment just goes through the word's existing binding.  So there is
+// nothing the body could capture beyond the iteration, and the context was
+// pure scaffolding.  Skip it: the unquoted word itself serves as the cursor
+// target.  (A lone BLANK! similarly opts out of having a variable at all.)
+//
+static void Init_Loop_Vars(Value(*) vars, Value(*) body)
+{
+    if (IS_BLANK(vars))
+        return;  // no variable; values are discarded as the data goes by
+
+    if (IS_QUOTED_WORD(vars)) {
+        Unquotify(vars, 1);  // word stays bound, and GC safe in the frame
+        return;
+    }
+
+    Context(*) pseudo_vars_ctx = Virtual_Bind_Deep_To_New_Context(
+        body,  // may be updated, will still be GC safe
+        vars
+    );
+    Init_Object(vars, pseudo_vars_ctx);  // keep GC safe
+}
+
+
+// Advance the enumeration and fill the loop variable(s), where vars is in
+// whatever form Init_Loop_Vars() left it: an OBJECT! of pseudo-variables, a
+// WORD! whose existing binding is being reused, or a BLANK! opt-out (which
+// writes into the scratch cell, as the data must be advanced regardless).
+//
+static bool Try_Loop_Each_Next(
+    Value(const*) iterator,
+    Value(*) vars,
+    Value(*) scratch
+){
+    if (IS_BLANK(vars))
+        return Try_Loop_Each_Next_Core(iterator, scratch, scratch + 1, 1);
+
+    if (IS_WORD(vars)) {
+        //
+        // Looked up fresh each time: the variable's context could expand
+        // and move the address while the body runs.
+        //
+        REBVAL *var = Lookup_Mutable_Word_May_Fail(vars, SPECIFIED);
+        return Try_Loop_Each_Next_Core(iterator, var, var + 1, 1);
+    }
+
+    Context(*) vars_ctx = VAL_CONTEXT(vars);
+    const REBVAR *pseudo_tail;
+    REBVAL *pseudo_var = CTX_VARS(&pseudo_tail, vars_ctx);
+    return Try_Loop_Each_Next_Core(
+        iterator,
+        pseudo_var,
+        pseudo_tail,
+        CTX_LEN(vars_ctx)
+    );
+}
+
+
 //
 //  Shutdown_Loop_Each: C
 //
@@ -955,17 +1057,103 @@ void Shutdown_Loop_Each(Value(*) iterator)
     struct Loop_Each_State *les;
     les = VAL_HANDLE_POINTER(struct Loop_Each_State, iterator);
 
-    if (les->took_hold)  // release read-only lock
-        CLEAR_SERIES_FLAG(m_cast(REBSER*, les->series), FIXED_SIZE);
+    Release_Loop_Each_Resources(les);
 
-    if (ANY_CONTEXT(les->data))
-        Shutdown_Evars(&les->u.evars);
+    FREE(struct Loop_Each_State, les);
+    Init_Trash(iterator);
+}
 
-    if (Is_Api_Value(les->data))  // free data last (used above)
-        rebRelease(les->data);
 
+// HANDLE! cleaner for MAKE-ITERATOR, so that cursors which are simply
+// abandoned get their series hold released and state freed by the GC.  Also
+// serves as the "brand" NEXT-OF uses to know a handle is really a cursor.
+//
+static void Cleanup_Iterator(const REBVAL *v)
+{
+    struct Loop_Each_State *les;
+    les = VAL_HANDLE_POINTER(struct Loop_Each_State, v);
+
+    Release_Loop_Each_Resources(les);  // no-op if drained before collected
     FREE(struct Loop_Each_State, les);
-    Init_Trash(iterator);
+}
+
+
+//
+//  make-iterator: native [
+//
+//  {Create a cell-sized cursor over a series, advanced by NEXT-OF}
+//
+//      return: [handle!]
+//      data "Same types FOR-EACH can enumerate"
+//          [<maybe> any-series! any-context! map! any-sequence! action!]
+//  ]
+//
+DECLARE_NATIVE(make_iterator)
+//
+// This exposes the enumeration state the Loop_Each natives use internally as
+// a first-class value.  No context or binding machinery is involved--the
+// cursor is just a HANDLE! cell, so custom iteration patterns (zips, merges,
+// lookahead) don't pay for variables they don't want.
+{
+    INCLUDE_PARAMS_OF_MAKE_ITERATOR;
+
+    // The iterator may outlive this frame, so the data can't be borrowed
+    // from the frame's argument cell the way the loop natives do it.  Hand
+    // an unmanaged API value over to the enumeration state; the resource
+    // release frees it.
+    //
+    Value(*) data = Copy_Cell(Alloc_Value(), ARG(data));
+    rebUnmanage(data);
+
+    Init_Loop_Each(SPARE, data);  // unmanaged HANDLE!, no cleaner
+
+    struct Loop_Each_State *les;
+    les = VAL_HANDLE_POINTER(struct Loop_Each_State, SPARE);
+
+    return Init_Handle_Cdata_Managed(
+        OUT,
+        les,
+        sizeof(struct Loop_Each_State),
+        &Cleanup_Iterator
+    );
+}
+
+
+//
+//  next-of: native [
+//
+//  {Advance an iterator made by MAKE-ITERATOR, yielding its next value}
+//
+//      return: "Null when the iteration is exhausted"
+//          [<opt> any-value!]
+//      iterator [handle!]
+//  ]
+//
+DECLARE_NATIVE(next_of)
+//
+// Exhaustion releases the series hold (and other resources) eagerly, rather
+// than waiting on the GC to run the handle's cleaner--so a drained cursor
+// doesn't pin its data as read-only any longer than the iteration itself.
+{
+    INCLUDE_PARAMS_OF_NEXT_OF;
+
+    Value(*) iterator = ARG(iterator);
+    if (VAL_HANDLE_CLEANER(iterator) != &Cleanup_Iterator)
+        fail ("NEXT-OF requires a HANDLE! made by MAKE-ITERATOR");
+
+    struct Loop_Each_State *les;
+    les = VAL_HANDLE_POINTER(struct Loop_Each_State, iterator);
+
+    bool got = les->more_data
+        and Try_Loop_Each_Next_Core(iterator, OUT, OUT + 1, 1);
+
+    if (not les->more_data)
+        Release_Loop_Each_Resources(les);
+
+    if (not got)
+        return nullptr;
+
+    return OUT;
 }
 
 
@@ -989,7 +1177,7 @@ DECLARE_NATIVE(for_each)
 {
     INCLUDE_PARAMS_OF_FOR_EACH;
 
-    Value(*) vars = ARG(vars);  // transformed to context on initial_entry
+    Value(*) vars = ARG(vars);  // Init_Loop_Vars() adjusts on initial_entry
     Value(*) data = ARG(data);
     Value(*) body = ARG(body);  // bound to vars context on initial_entry
 
@@ -1016,11 +1204,7 @@ DECLARE_NATIVE(for_each)
     if (IS_BLANK(data))  // same response as to empty series
         return VOID;
 
-    Context(*) pseudo_vars_ctx = Virtual_Bind_Deep_To_New_Context(
-        ARG(body),  // may be updated, will still be GC safe
-        ARG(vars)
-    );
-    Init_Object(ARG(vars), pseudo_vars_ctx);  // keep GC safe
+    Init_Loop_Vars(ARG(vars), ARG(body));  // quoted word skips context
 
     Init_Loop_Each(iterator, data);
     Set_Frame_Flag(frame_, NOTIFY_ON_ABRUPT_FAILURE);  // to clean up iterator
@@ -1029,7 +1213,7 @@ DECLARE_NATIVE(for_each)
 
 } next_iteration: {  /////////////////////////////////////////////////////////
 
-    if (not Try_Loop_Each_Next(iterator, VAL_CONTEXT(vars)))
+    if (not Try_Loop_Each_Next(iterator, vars, SPARE))
         goto finalize_for_each;
 
     STATE = ST_FOR_EACH_RUNNING_BODY;
@@ -1101,7 +1285,7 @@ DECLARE_NATIVE(every)
 {
     INCLUDE_PARAMS_OF_EVERY;
 
-    Value(*) vars = ARG(vars);  // transformed to context on initial_entry
+    Value(*) vars = ARG(vars);  // Init_Loop_Vars() adjusts on initial_entry
     Value(*) data = ARG(data);
     Value(*) body = ARG(body);  // bound to vars context on initial_entry
 
@@ -1126,11 +1310,7 @@ DECLARE_NATIVE(every)
     if (IS_BLANK(data))  // same response as to empty series
         return VOID;
 
-    Context(*) pseudo_vars_ctx = Virtual_Bind_Deep_To_New_Context(
-        ARG(body),  // may be updated, will still be GC safe
-        ARG(vars)
-    );
-    Init_Object(ARG(vars), pseudo_vars_ctx);  // keep GC safe
+    Init_Loop_Vars(ARG(vars), ARG(body));  // quoted word skips context
 
     Init_Loop_Each(iterator, data);
     Set_Frame_Flag(frame_, NOTIFY_ON_ABRUPT_FAILURE);  // to clean up iterator
@@ -1139,7 +1319,7 @@ DECLARE_NATIVE(every)
 
 } next_iteration: {  /////////////////////////////////////////////////////////
 
-    if (not Try_Loop_Each_Next(iterator, VAL_CONTEXT(vars)))
+    if (not Try_Loop_Each_Next(iterator, vars, SPARE))
         goto finalize_every;
 
     STATE = ST_EVERY_RUNNING_BODY;
@@ -1388,22 +1568,26 @@ DECLARE_NATIVE(remove_each)
                 continue;  // not keeping, don't save to buffer
             }
 
-            do {
+            if (IS_BINARY(data)) {
+                //
+                // Append the whole kept run in one memcpy, not a byte at a
+                // time (multiple vars mean runs longer than one byte).
+                //
+                assert(index <= len);
+                Binary(*) bin = BIN(series);
+                Append_Ascii_Len(
+                    mo->series,
+                    cs_cast(BIN_AT(bin, start)),
+                    index - start
+                );
+                start = index;
+            }
+            else do {
                 assert(start <= len);
-                if (IS_BINARY(data)) {
-                    Binary(*) bin = BIN(series);
-                    Append_Ascii_Len(
-                        mo->series,
-                        cs_cast(BIN_AT(bin, start)),
-                        1
-                    );
-                }
-                else {
-                    Append_Codepoint(
-                        mo->series,
-                        GET_CHAR_AT(STR(series), start)
-                    );
-                }
+                Append_Codepoint(
+                    mo->series,
+                    GET_CHAR_AT(STR(series), start)
+                );
                 ++start;
             } while (start != index);
         }
@@ -1601,7 +1785,7 @@ DECLARE_NATIVE(map)
 {
     INCLUDE_PARAMS_OF_MAP;
 
-    Value(*) vars = ARG(vars);  // transformed to context on initial_entry
+    Value(*) vars = ARG(vars);  // Init_Loop_Vars() adjusts on initial_entry
     Value(*) data = ARG(data);
     Value(*) body = ARG(body);  // bound to vars context on initial_entry
 
@@ -1643,11 +1827,15 @@ DECLARE_NATIVE(map)
         fail ("MAP only supports one-level QUOTED! series/path/context ATM");
     }
 
-    Context(*) pseudo_vars_ctx = Virtual_Bind_Deep_To_New_Context(
-        ARG(body),  // may be updated, will still be GC safe
-        ARG(vars)
-    );
-    Init_Object(ARG(vars), pseudo_vars_ctx);  // keep GC safe
+    // When the input length is known, pre-size the data stack for one push
+    // per element so big inputs don't reallocate it over and over.  (The
+    // body can still push more--or less--than one value per element; this
+    // is just a capacity hint, not a commitment.)
+    //
+    if (ANY_SERIES(data))
+        Ensure_Data_Stack_Capacity(VAL_LEN_AT(data));
+
+    Init_Loop_Vars(ARG(vars), ARG(body));  // quoted word skips context
 
     Init_Loop_Each(iterator, data);
     Set_Frame_Flag(frame_, NOTIFY_ON_ABRUPT_FAILURE);  // to clean up iterator
@@ -1656,7 +1844,7 @@ DECLARE_NATIVE(map)
 
 } next_iteration: {  /////////////////////////////////////////////////////////
 
-    if (not Try_Loop_Each_Next(iterator, VAL_CONTEXT(vars)))
+    if (not Try_Loop_Each_Next(iterator, vars, SPARE))
         goto finalize_map;
 
     STATE = ST_MAP_RUNNING_BODY;
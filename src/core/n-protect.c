@@ -197,12 +197,17 @@ void Protect_Series(const REBSER *s_const, REBLEN index, Flags flags)
                 SET_SERIES_INFO(s, FROZEN_DEEP);
             SET_SERIES_INFO(s, FROZEN_SHALLOW);
         }
+        else if (flags & PROT_EPOCH)
+            SET_SERIES_INFO(s, EPOCH_PROTECTED);
         else
             SET_SERIES_INFO(s, PROTECTED);
     }
     else {
         assert(not (flags & PROT_FREEZE));
-        CLEAR_SERIES_INFO(s, PROTECTED);
+        if (flags & PROT_EPOCH)
+            CLEAR_SERIES_INFO(s, EPOCH_PROTECTED);
+        else
+            CLEAR_SERIES_INFO(s, PROTECTED);
     }
 
     if (not IS_SER_ARRAY(s) or not (flags & PROT_DEEP))
@@ -235,12 +240,17 @@ void Protect_Context(Context(*) c, Flags flags)
                 SET_SERIES_INFO(varlist, FROZEN_DEEP);
             SET_SERIES_INFO(varlist, FROZEN_SHALLOW);
         }
+        else if (flags & PROT_EPOCH)
+            SET_SERIES_INFO(varlist, EPOCH_PROTECTED);
         else
             SET_SERIES_INFO(varlist, PROTECTED);
     }
     else {
         assert(not (flags & PROT_FREEZE));
-        CLEAR_SERIES_INFO(varlist, PROTECTED);
+        if (flags & PROT_EPOCH)
+            CLEAR_SERIES_INFO(varlist, EPOCH_PROTECTED);
+        else
+            CLEAR_SERIES_INFO(varlist, PROTECTED);
     }
 
     if (not (flags & PROT_DEEP))
@@ -299,6 +309,8 @@ static Bounce Protect_Unprotect_Core(Frame(*) frame_, Flags flags)
 
     if (REF(deep))
         flags |= PROT_DEEP;
+    if (REF(epoch))
+        flags |= PROT_EPOCH;
     //if (REF(words))
     //  flags |= PROT_WORDS;
 
@@ -379,6 +391,7 @@ static Bounce Protect_Unprotect_Core(Frame(*) frame_, Flags flags)
 //      /words "Process list as words (and path words)"
 //      /values "Process list of values (implied GET)"
 //      /hide "Hide variables (avoid binding and lookup)"
+//      /epoch "Mark epoch membership (enforced by WITH-EPOCH-PROTECTION)"
 //  ]
 //
 DECLARE_NATIVE(protect)
@@ -409,6 +422,7 @@ DECLARE_NATIVE(protect)
     UNUSED(PARAM(deep));
     UNUSED(PARAM(words));
     UNUSED(PARAM(values));
+    UNUSED(PARAM(epoch));
 
     Flags flags = PROT_SET;
 
@@ -432,6 +446,7 @@ DECLARE_NATIVE(protect)
 //      /words "Block is a list of words"
 //      /values "Process list of values (implied GET)"
 //      /hide "HACK to make PROTECT and UNPROTECT have the same signature"
+//      /epoch "Unmark epoch membership (see PROTECT/EPOCH)"
 //  ]
 //
 DECLARE_NATIVE(unprotect)
@@ -444,6 +459,7 @@ DECLARE_NATIVE(unprotect)
     UNUSED(PARAM(deep));
     UNUSED(PARAM(words));
     UNUSED(PARAM(values));
+    UNUSED(PARAM(epoch));
 
     if (REF(hide))
         fail ("Cannot un-hide an object field once hidden");
@@ -468,6 +484,66 @@ DECLARE_NATIVE(unprotect)
 }
 
 
+//
+//  with-epoch-protection: native [
+//
+//  {Evaluate a block with every epoch-marked series protected}
+//
+//      return: [<opt> <void> any-value!]
+//      body [block!]
+//  ]
+//
+DECLARE_NATIVE(with_epoch_protection)
+//
+// PROTECT/DEEP costs a walk of the whole structure, and so does the
+// UNPROTECT afterward--painful when a large shared dataset has to be locked
+// around every call into untrusted code.  With epochs the walk happens only
+// once: PROTECT/DEEP/EPOCH stamps SERIES_INFO_EPOCH_PROTECTED on each
+// reachable series, and this native engages all of the marked series at
+// once by loading the bit into PG_Epoch_Protect_Mask, which the mutation
+// choke points OR into their read-only test.  Engage and disengage are O(1)
+// no matter how much data carries the mark.
+//
+// Engagements nest (PG_Protect_Epochs counts the depth), so a plugin
+// calling another plugin does not unprotect the data early.  An abrupt
+// failure in the body unwinds through Rollback_Globals_To_State(), which
+// restores the depth this frame's baseline snapshotted.
+{
+    INCLUDE_PARAMS_OF_WITH_EPOCH_PROTECTION;
+
+    enum {
+        ST_EPOCH_INITIAL_ENTRY = STATE_0,
+        ST_EPOCH_EVALUATING
+    };
+
+    switch (STATE) {
+      case ST_EPOCH_INITIAL_ENTRY: goto initial_entry;
+      case ST_EPOCH_EVALUATING: goto evaluation_finished;
+      default: assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
+    ++PG_Protect_Epochs;
+    PG_Epoch_Protect_Mask = SERIES_INFO_EPOCH_PROTECTED;
+
+    STATE = ST_EPOCH_EVALUATING;
+    return CATCH_CONTINUE(OUT, ARG(body));
+
+} evaluation_finished: {  ////////////////////////////////////////////////////
+
+    assert(PG_Protect_Epochs != 0);
+    if (--PG_Protect_Epochs == 0)
+        PG_Epoch_Protect_Mask = 0;
+
+    if (THROWING)
+        return BOUNCE_THROWN;
+
+    return OUT;
+  }
+}
+
+
 //
 //  Is_Value_Frozen_Deep: C
 //
@@ -556,6 +632,14 @@ void Force_Value_Frozen_Core(
     else if (ANY_SERIES_KIND(heart)) {
         REBSER *s = m_cast(REBSER*, VAL_SERIES(v));  // mutate flags only
         Freeze_Series(s);
+
+        // Since the string can no longer change, large non-ASCII ones get
+        // a position table giving O(1) random access, in place of the one
+        // floating bookmark.  See Build_Frozen_String_Index().
+        //
+        if (ANY_STRING_KIND(heart))
+            Build_Frozen_String_Index(STR(s));
+
         UNUSED(deep);
         if (locker)
             SET_SERIES_INFO(s, AUTO_LOCKED);
@@ -596,3 +680,630 @@ DECLARE_NATIVE(freeze)
 
     return COPY(ARG(value));
 }
+
+
+//=//// SHARED (GC-EXEMPT) DATA ///////////////////////////////////////////=//
+//
+// A frozen value can't change, but the GC still has to walk it on every
+// recycle to prove it's alive...which for a multi-gigabyte loaded dataset
+// is most of the cost of collection.  SHARE "blesses" a deeply-frozen value
+// so the GC neither traverses nor sweeps it (see SERIES_FLAG_SHARED), and
+// it stays immortal until UNSHARE drops the last reference.
+//
+// The refcounting is done here at the granularity of the SHARE'd roots:
+// because blessed graphs may overlap (one shared block inside another),
+// dropping a root to zero clears *all* the shared flags and re-blesses the
+// roots that remain.  Releases are expected to be rare relative to the
+// recycles the blessing is saving.
+
+static Array(*) Shared_Roots_Array = nullptr;  // [value count ...] pairs
+static REBVAL *Shared_Roots_Block = nullptr;  // root handle marking array
+
+
+// Roots are identified by series node, not by equality...a copy of a shared
+// block is a different dataset.  Returns the value slot of the pair, with
+// the refcount in the cell after it.
+//
+static Cell(*) Find_Shared_Root(const REBVAL *v)
+{
+    if (Shared_Roots_Array == nullptr)
+        return nullptr;
+
+    Cell(const*) tail = ARR_TAIL(Shared_Roots_Array);
+    Cell(*) item = ARR_HEAD(Shared_Roots_Array);
+    for (; item != tail; item += 2) {
+        if (VAL_SERIES(item) == VAL_SERIES(v))
+            return item;
+    }
+    return nullptr;
+}
+
+
+//
+//  share: native [
+//
+//  {Bless a deeply-frozen value as shareable, exempting it from the GC}
+//
+//      return: [any-series!]
+//      value "Will be frozen deeply if it was not already"
+//          [any-series!]
+//  ]
+//
+DECLARE_NATIVE(share)
+//
+// Only "pure data" graphs can be shared: frozen blocks, strings, binaries,
+// and words without bindings.  Anything whose reachable graph includes a
+// context, an action, or a PAIR! is refused--the GC prunes its marking at
+// shared series, so everything one can reach must itself be immortal.
+//
+// SHARE is refcounted: sharing the same root again just bumps its count,
+// and UNSHARE releases it.
+{
+    INCLUDE_PARAMS_OF_SHARE;
+
+    REBVAL *v = ARG(value);
+
+    Force_Value_Frozen_Deep(v);
+
+    Cell(*) found = Find_Shared_Root(v);
+    if (found) {
+        ++VAL_INT64(found + 1);
+        return COPY(v);
+    }
+
+    if (Try_Bless_Value_Shared(v) < 0)
+        fail ("SHARE only works on pure frozen data (no bindings/contexts)");
+
+    if (Shared_Roots_Array == nullptr) {
+        Shared_Roots_Array = Make_Array_Core(2 * 8, NODE_FLAG_MANAGED);
+        Shared_Roots_Block = Init_Block(Alloc_Value(), Shared_Roots_Array);
+
+        Array(*) single = Singular_From_Cell(Shared_Roots_Block);
+        CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+        Unlink_Api_Handle_From_Frame(single);  // this frame (a GC root)
+    }
+
+    Append_Value(Shared_Roots_Array, v);
+    Init_Integer(Alloc_Tail_Array(Shared_Roots_Array), 1);
+
+    return COPY(v);
+}
+
+
+//
+//  unshare: native [
+//
+//  {Drop a SHARE reference (data returns to GC management at zero)}
+//
+//      return: [any-series!]
+//      value "Must be a value that was previously SHARE'd"
+//          [any-series!]
+//  ]
+//
+DECLARE_NATIVE(unshare)
+{
+    INCLUDE_PARAMS_OF_UNSHARE;
+
+    REBVAL *v = ARG(value);
+
+    Cell(*) found = Find_Shared_Root(v);
+    if (found == nullptr)
+        fail ("UNSHARE of a value that is not currently SHARE'd");
+
+    if (--VAL_INT64(found + 1) != 0)
+        return COPY(v);  // other references remain, stay blessed
+
+    REBLEN index = found - ARR_HEAD(Shared_Roots_Array);
+    Remove_Series_Units(SER(Shared_Roots_Array), index, 2);
+
+    // The flags are a property of the global graph, and graphs can overlap.
+    // So clear every blessing and re-stamp from the remaining roots.  (They
+    // were eligible when they were shared, and freezing is permanent, so
+    // the re-blessing cannot fail.)
+    //
+    Clear_All_Shared_Flags();
+
+    Cell(const*) tail = ARR_TAIL(Shared_Roots_Array);
+    Cell(*) item = ARR_HEAD(Shared_Roots_Array);
+    for (; item != tail; item += 2) {
+        REBINT blessed = Try_Bless_Value_Shared(item);
+        assert(blessed >= 0);
+        UNUSED(blessed);
+    }
+
+    return COPY(v);
+}
+
+
+//
+//  shared?: native [
+//
+//  {Determine if a value's underlying series has been blessed by SHARE}
+//
+//      return: [logic?]
+//      value [any-series!]
+//  ]
+//
+DECLARE_NATIVE(shared_q)
+{
+    INCLUDE_PARAMS_OF_SHARED_Q;
+
+    return Init_Logic(
+        OUT,
+        GET_SERIES_FLAG(VAL_SERIES(ARG(value)), SHARED)
+    );
+}
+
+
+//=//// MUTATION JOURNAL (SNAPSHOT / ROLLBACK) ////////////////////////////=//
+//
+// Editor-style applications want cheap undo, and deep-copying a document per
+// operation costs O(document).  SNAPSHOT instead flags a series with
+// SERIES_INFO_JOURNALED, which makes the mutation choke points in
+// %f-modify.c record a compact inverse operation--the overwritten content
+// and the extent of the insertion--into a global journal.  ROLLBACK walks
+// the journal backward re-applying those inverses, which costs O(changes).
+//
+// Entries are groups of four: the target (as a BLOCK! or BINARY! cell, which
+// also keeps the series alive), the index or byte offset of the edit, the
+// count inserted, and the overwritten content (array entries save cells, all
+// string and binary entries save bytes--rolled back through a BINARY! alias,
+// which is exact since offsets land on codepoint boundaries).
+//
+// Only mutations routed through Modify_Array() and Modify_String_Or_Binary()
+// are journaled: APPEND, INSERT, and CHANGE.  Operations that bypass those
+// choke points (SORT, REVERSE, POKE, CLEAR...) are not yet covered, so a
+// rollback after one of them won't reconstruct the original.
+
+static Array(*) Journal_Array = nullptr;  // [target index added saved ...]
+static REBVAL *Journal_Block = nullptr;  // root handle marking array
+
+
+//
+//  Journal_Array_Capture: C
+//
+// Called by Modify_Array() just before it mutates a journaled array:
+// `removals` cells at `index` are about to be overwritten or removed, and
+// `additions` cells inserted in their place.
+//
+void Journal_Array_Capture(
+    Array(*) arr,
+    REBLEN index,
+    REBLEN removals,
+    REBLEN additions
+){
+    assert(GET_SERIES_INFO(arr, JOURNALED));
+    if (Journal_Array == nullptr)
+        return;  // flag survived a journal discard; nothing to record into
+
+    if (removals == 0 and additions == 0)
+        return;
+
+    Array(*) saved = Copy_Array_At_Max_Shallow(
+        arr, index, SPECIFIED, removals
+    );
+    Manage_Series(saved);
+
+    Init_Block(Alloc_Tail_Array(Journal_Array), arr);
+    Init_Integer(Alloc_Tail_Array(Journal_Array), index);
+    Init_Integer(Alloc_Tail_Array(Journal_Array), additions);
+    Init_Block(Alloc_Tail_Array(Journal_Array), saved);
+}
+
+
+//
+//  Journal_Bytes_Capture: C
+//
+// Byte-level counterpart of Journal_Array_Capture(), for binaries and for
+// strings (whose journal entries speak in byte offsets; the offsets always
+// fall on codepoint boundaries since the edits did).
+//
+void Journal_Bytes_Capture(
+    Binary(*) ser,
+    Size offset,
+    Size removals,
+    Size additions
+){
+    assert(GET_SERIES_INFO(ser, JOURNALED));
+    if (Journal_Array == nullptr)
+        return;
+
+    if (removals == 0 and additions == 0)
+        return;
+
+    if (offset + removals > SER_USED(ser))
+        removals = SER_USED(ser) - offset;
+
+    Binary(*) saved = BIN(Copy_Binary_At_Len(ser, offset, removals));
+    Manage_Series(saved);
+
+    Init_Binary(Alloc_Tail_Array(Journal_Array), ser);
+    Init_Integer(Alloc_Tail_Array(Journal_Array), offset);
+    Init_Integer(Alloc_Tail_Array(Journal_Array), additions);
+    Init_Binary(Alloc_Tail_Array(Journal_Array), saved);
+}
+
+
+//
+//  snapshot: native [
+//
+//  {Begin journaling mutations to a series, so ROLLBACK can undo them}
+//
+//      return: [any-series!]
+//      series "Marked in place (not copied); journaling follows the series"
+//          [any-series!]
+//  ]
+//
+DECLARE_NATIVE(snapshot)
+//
+// A second SNAPSHOT of an already-journaled series is a no-op: the journal
+// still reaches back to the first one.  (Nested snapshot points would need
+// per-series marks in the journal; so far one level has been enough.)
+{
+    INCLUDE_PARAMS_OF_SNAPSHOT;
+
+    REBVAL *v = ARG(series);
+    REBSER *s = VAL_SERIES_ENSURE_MUTABLE(v);  // frozen can't need undo
+
+    if (Journal_Array == nullptr) {
+        Journal_Array = Make_Array_Core(4 * 8, NODE_FLAG_MANAGED);
+        Journal_Block = Init_Block(Alloc_Value(), Journal_Array);
+
+        Array(*) single = Singular_From_Cell(Journal_Block);
+        CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+        Unlink_Api_Handle_From_Frame(single);  // this frame (a GC root)
+    }
+
+    SET_SERIES_INFO(s, JOURNALED);
+    return COPY(v);
+}
+
+
+//
+//  rollback: native [
+//
+//  {Undo journaled mutations made since SNAPSHOT, and stop journaling}
+//
+//      return: [any-series!]
+//      series "Must have a SNAPSHOT in effect"
+//          [any-series!]
+//      /keep "Don't undo anything; just discard the records and stop"
+//  ]
+//
+DECLARE_NATIVE(rollback)
+{
+    INCLUDE_PARAMS_OF_ROLLBACK;
+
+    REBVAL *v = ARG(series);
+    REBSER *s = m_cast(REBSER*, VAL_SERIES(v));
+
+    if (NOT_SERIES_INFO(s, JOURNALED))
+        fail ("ROLLBACK of a series that has no SNAPSHOT in effect");
+
+    CLEAR_SERIES_INFO(s, JOURNALED);  // must not re-journal the undoing
+
+    if (Journal_Array == nullptr)
+        return COPY(v);  // flag survived a journal discard
+
+    // Walk the journal backward: later edits must be reverted before the
+    // indices recorded by earlier ones make sense again.  Entries for other
+    // journaled series stay (their indices are unaffected by ours).
+    //
+    REBLEN n = ARR_LEN(Journal_Array);
+    while (n >= 4) {
+        n -= 4;
+        Cell(*) entry = ARR_AT(Journal_Array, n);
+        if (VAL_SERIES(entry) != s)
+            continue;
+
+        if (not REF(keep)) {
+            REBLEN index = cast(REBLEN, VAL_INT64(entry + 1));
+            REBLEN added = cast(REBLEN, VAL_INT64(entry + 2));
+
+            if (IS_BLOCK(entry)) {
+                Modify_Array(
+                    ARR(s),
+                    index,
+                    SYM_CHANGE,
+                    SPECIFIC(entry + 3),
+                    AM_SPLICE | AM_PART,
+                    added,  // remove what the operation inserted...
+                    1  // ...splicing back what it overwrote
+                );
+            }
+            else {
+                DECLARE_LOCAL (dst);
+                Init_Binary_At(dst, BIN(s), index);
+                Modify_String_Or_Binary(
+                    dst,
+                    SYM_CHANGE,
+                    SPECIFIC(entry + 3),
+                    AM_PART,
+                    added,  // /PART counts bytes for a BINARY! target
+                    1
+                );
+            }
+        }
+
+        Remove_Series_Units(SER(Journal_Array), n, 4);
+    }
+
+    return COPY(v);
+}
+
+
+//
+//  Discard_Mutation_Journal: C
+//
+// Called at shutdown; the root handle holding the journal would "leak".
+// (SERIES_INFO_JOURNALED bits may remain set on series, which is harmless:
+// the capture functions do nothing when no journal exists.)
+//
+void Discard_Mutation_Journal(void)
+{
+    if (Journal_Block != nullptr) {
+        rebRelease(Journal_Block);
+        Journal_Block = nullptr;
+        Journal_Array = nullptr;
+    }
+}
+
+
+//
+//  Discard_Shared_Roots: C
+//
+// Called at shutdown: the root block holding the SHARE'd values would
+// "leak", and lingering SERIES_FLAG_SHARED bits would hide stubs from the
+// final cleansing sweeps.
+//
+void Discard_Shared_Roots(void)
+{
+    if (Shared_Roots_Block != nullptr) {
+        Clear_All_Shared_Flags();
+        rebRelease(Shared_Roots_Block);
+        Shared_Roots_Block = nullptr;
+        Shared_Roots_Array = nullptr;
+    }
+}
+
+
+//=//// LITERAL ARRAY POOL ////////////////////////////////////////////////=//
+//
+// Loaded code repeats the same small literal arrays over and over--[0 0]
+// origins, ["y" "n"] choices, rule fragments--and the scanner gives every
+// occurrence its own allocation.  POOL-LITERALS walks loaded data and
+// hash-conses such arrays: the first instance of each distinct content is
+// deeply frozen and entered into a pool, and later equal instances are
+// repointed at it.  (See LOAD/POOL; this is the array-level counterpart of
+// DEDUPLICATE-STRINGS and LOAD/DEDUP.)
+//
+// Only arrays whose elements can't be affected by binding are pooled: plain
+// scalars, strings, and nested arrays that are already frozen deep (which
+// pooling bottom-up arranges).  Anything with a word in it is left alone,
+// since BIND writes into array cells and a shared instance would leak
+// bindings between what used to be independent copies.  Arrays carrying
+// newline markers or a format table (see LOAD/FORMATTED) also stay
+// unshared, so MOLD's layout doesn't change behind the caller's back.
+//
+// The pool is a direct-mapped table of API handles, each pinning its frozen
+// array against GC and pointer reuse; a content-hash collision just evicts
+// the old entry (losing only sharing, never soundness).  Shutdown_Core()
+// discards the pins.
+//
+
+#define NUM_LITERAL_POOL_SLOTS 1024
+
+static REBVAL *Literal_Pool[NUM_LITERAL_POOL_SLOTS];
+
+//
+//  Discard_Literal_Pool: C
+//
+// Called by Shutdown_Core(); the pool's handles are GC roots that would
+// otherwise be reported as leaks.
+//
+void Discard_Literal_Pool(void)
+{
+    REBLEN n;
+    for (n = 0; n < NUM_LITERAL_POOL_SLOTS; ++n) {
+        if (Literal_Pool[n] != nullptr) {
+            rebRelease(Literal_Pool[n]);
+            Literal_Pool[n] = nullptr;
+        }
+    }
+}
+
+// An element is poolable if sharing the array holding it can't be observed
+// through it: immutable scalar bits, head-positioned strings or binaries
+// (they get frozen along with the array), or a nested array that is itself
+// already frozen deep.  Words and sequences are excluded--binding mutates
+// the cells they live in--as is anything quoted, decorated, or carrying a
+// newline marker (sharing would rewrite the mold layout).
+//
+static bool Is_Poolable_Literal_Element(Cell(const*) v)
+{
+    if (QUOTE_BYTE(v) != UNQUOTED_1)
+        return false;
+    if (Get_Cell_Flag(v, NEWLINE_BEFORE))
+        return false;
+
+    switch (CELL_HEART(v)) {
+      case REB_BLANK:
+      case REB_INTEGER:
+      case REB_DECIMAL:
+      case REB_PERCENT:
+      case REB_MONEY:
+      case REB_TIME:
+      case REB_DATE:
+      case REB_PAIR:
+      case REB_ISSUE:
+        return true;
+
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG:
+      case REB_BINARY:
+        return VAL_INDEX(v) == 0;  // positioned: head data matters to it
+
+      case REB_BLOCK:
+      case REB_GROUP:
+        return VAL_INDEX(v) == 0
+            and Is_Array_Frozen_Deep(VAL_ARRAY(v));  // pooled bottom-up
+
+      default:
+        return false;
+    }
+}
+
+static bool Is_Poolable_Literal_Array(Cell(const*) v, REBLEN limit)
+{
+    Array(*) a = m_cast(Array(*), VAL_ARRAY(v));  // cell access only
+
+    REBLEN len = ARR_LEN(a);
+    if (len == 0 or len > limit)
+        return false;  // empty arrays are prime targets for APPEND
+
+    if (Has_Format_Table(a))
+        return false;  // sharing would merge preserved source layouts
+
+    if (a->leader.bits & ARRAY_FLAG_NEWLINE_AT_TAIL)
+        return false;
+
+    REBLEN n;
+    for (n = 0; n < len; ++n) {
+        if (not Is_Poolable_Literal_Element(ARR_AT(a, n)))
+            return false;
+    }
+    return true;
+}
+
+// Case-insensitive like Hash_Value itself is for strings; distinct casings
+// collide and evict each other, but Equal_Array_Contents() is strict, so
+// they are never wrongly merged.
+//
+static uint32_t Hash_Array_Contents(Array(const*) a)
+{
+    uint32_t hash = cast(uint32_t, ARR_LEN(a));
+    REBLEN n;
+    for (n = 0; n < ARR_LEN(a); ++n)
+        hash = hash * 31 + Hash_Value(ARR_AT(m_cast(Array(*), a), n));
+    return hash;
+}
+
+static bool Equal_Array_Contents(Array(const*) a, Array(const*) b)
+{
+    if (ARR_LEN(a) != ARR_LEN(b))
+        return false;
+
+    REBLEN n;
+    for (n = 0; n < ARR_LEN(a); ++n) {
+        REBINT diff = Cmp_Value(
+            ARR_AT(m_cast(Array(*), a), n),
+            ARR_AT(m_cast(Array(*), b), n),
+            true  // strict: "abc" and "ABC" stay distinct instances
+        );
+        if (diff != 0)
+            return false;
+    }
+    return true;
+}
+
+// Walks the data deeply (children before parents, so frozen nested arrays
+// qualify their containers); see POOL-LITERALS for the sharing rules.
+//
+static void Pool_Literals_Core(Cell(*) head, Cell(const*) tail, REBLEN limit)
+{
+    Cell(*) item = head;
+    for (; item != tail; ++item) {
+        if (not IS_BLOCK(item) and not IS_GROUP(item))
+            continue;  // quoted/decorated forms are left alone
+
+        if (not Is_Array_Frozen_Shallow(VAL_ARRAY(item))) {
+            Cell(const*) sub_tail;
+            Cell(*) sub = VAL_ARRAY_AT_ENSURE_MUTABLE(&sub_tail, item);
+            Pool_Literals_Core(sub, sub_tail, limit);
+        }
+
+        if (VAL_INDEX(item) != 0)
+            continue;
+
+        if (not Is_Poolable_Literal_Array(item, limit))
+            continue;
+
+        Array(const*) a = VAL_ARRAY(item);
+
+        REBLEN slot = Hash_Array_Contents(a) % NUM_LITERAL_POOL_SLOTS;
+        REBVAL *holder = Literal_Pool[slot];
+
+        if (holder != nullptr) {
+            if (VAL_ARRAY(holder) == a)
+                continue;  // already the pooled instance
+
+            if (Equal_Array_Contents(VAL_ARRAY(holder), a)) {
+                enum Reb_Kind kind = VAL_TYPE(item);
+                bool newline = Get_Cell_Flag(item, NEWLINE_BEFORE);
+
+                Init_Array_Cell(item, kind, VAL_ARRAY(holder));
+
+                if (newline)
+                    Set_Cell_Flag(item, NEWLINE_BEFORE);
+                continue;
+            }
+
+            rebRelease(holder);  // direct-mapped: evict the collider
+            Literal_Pool[slot] = nullptr;
+        }
+
+        Freeze_Array_Deep(VAL_ARRAY_ENSURE_MUTABLE(item));
+
+        holder = Init_Block(Alloc_Value(), m_cast(Array(*), a));
+
+        Array(*) single = Singular_From_Cell(holder);
+        CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+        Unlink_Api_Handle_From_Frame(single);  // this frame (a GC root)
+
+        Literal_Pool[slot] = holder;
+    }
+}
+
+
+//
+//  pool-literals: native [
+//
+//  {Replace duplicate small literal arrays with frozen shared instances}
+//
+//      return: "The same block (modified deeply)"
+//          [block!]
+//      block "Loaded data with repeated literal blocks/groups"
+//          [block!]
+//      /limit "Longest array to pool, in elements (default 8)"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(pool_literals)
+//
+// Rulebases and datasets repeat small literal arrays thousands of times,
+// and each occurrence costs an array node plus its data--so hash-consing
+// them shrinks the loaded heap and packs the evaluator's working set into
+// fewer cache lines.  The pool persists across calls, so repeated loads of
+// similar data share with each other too.
+//
+// The shared instances are deeply immutable; hence this is opt-in (see
+// LOAD/POOL): attempts to mutate a pooled array error rather than corrupt
+// its siblings.  Source file/line information is also traded away--the
+// shared instance keeps whichever positions it was first loaded from.
+//
+// Long arrays are rarely duplicates, and hashing them costs proportionally
+// to their length--hence the element-count threshold.
+{
+    INCLUDE_PARAMS_OF_POOL_LITERALS;
+
+    REBLEN limit = REF(limit) ? Int32s(ARG(limit), 1) : 8;
+
+    Cell(const*) tail;
+    Cell(*) at = VAL_ARRAY_AT_ENSURE_MUTABLE(&tail, ARG(block));
+    Pool_Literals_Core(at, tail, limit);
+
+    return COPY(ARG(block));
+}
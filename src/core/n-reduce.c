@@ -55,6 +55,14 @@ DECLARE_NATIVE(reduce)
 //    function dispatch has pushed refinements, etc.  So when the REDUCE frame
 //    underneath it pushes a value to the data stack, that frame must be
 //    informed the stack element is "not for it" before the next call.
+//
+// 4. Inert values reduce to themselves, so when no predicate is in effect a
+//    run of them can be pushed directly--no evaluator restart and no
+//    trampoline bounce per item.  The catch is enfix: an operator following
+//    an inert value would consume it as a left argument.  So an item is only
+//    copied when its *successor* is known to be another inert value, a
+//    comma, or the end--the feed's cursor cache gives that one-cell
+//    lookahead for free.  Anything murkier falls through to the evaluator.
 {
     INCLUDE_PARAMS_OF_REDUCE;
 
@@ -100,6 +108,12 @@ DECLARE_NATIVE(reduce)
 
 } initial_entry_any_array: {  ////////////////////////////////////////////////
 
+    // In the common case each item reduces to one value, so hint the data
+    // stack to its anticipated final size up front--no mid-reduce expansions
+    // (splices can still push more; that just expands as usual).
+    //
+    Ensure_Data_Stack_Capacity(VAL_LEN_AT(v));
+
     Frame(*) subframe = Make_Frame_At(
         v,  // REB_BLOCK or REB_GROUP
         FRAME_FLAG_ALLOCATED_FEED
@@ -110,6 +124,25 @@ DECLARE_NATIVE(reduce)
 
 } next_reduce_step: {  ///////////////////////////////////////////////////////
 
+    if (Is_Nulled(predicate)) {  // inert runs bypass the evaluator, see [4]
+        Feed(*) feed = SUBFRAME->feed;
+        while (Not_Feed_At_End(feed) and ANY_INERT(At_Feed(feed))) {
+            Cell(const*) next = feed->cursor;  // successor, see %sys-rebfed.h
+            if (next == nullptr)
+                break;  // spliced or pending material, evaluator sorts it out
+            if (next == feed->cursor_tail) {
+                if (FEED_SPLICE(feed) != nullptr)
+                    break;  // not really at end, outer splice level follows
+            }
+            else if (not ANY_INERT(next) and not IS_COMMA(next))
+                break;  // successor might be enfix and consume leftward
+            Literal_Next_In_Feed(PUSH(), feed);  // newline flag carries over
+            SUBFRAME->baseline.stack_base += 1;  // see [3]
+
+            Clear_Feed_Flag(feed, NO_LOOKAHEAD);  // elided step would have
+        }
+    }
+
     if (Is_Feed_At_End(SUBFRAME->feed))
         goto finished;
 
@@ -333,6 +366,41 @@ bool Match_For_Compose(noquote(Cell(const*)) group, const REBVAL *label) {
 }
 
 
+// Cheap prescan used before recursing in a /DEEP compose: a subtree with no
+// GROUP!s at any depth can't have substitutions, so there is no point in
+// spending a subframe, feed, and a data stack walk discovering that...the
+// value can be pushed to the output as-is.  Template rendering tends to have
+// large static stretches, so this cuts the allocations for a deep compose
+// down to the arrays that actually change.
+//
+// The scan is conservative: any group--matching the label or not--takes the
+// slow path, as do sequences (whose compressed forms would need expansion to
+// walk, and which rarely contain groups...they just get composer frames as
+// they always did).
+//
+static bool May_Need_Composing(Cell(const*) at)
+{
+    enum Reb_Kind heart = CELL_HEART(at);  // quoted groups match, see [2]
+
+    if (ANY_GROUP_KIND(heart))
+        return true;
+
+    if (ANY_SEQUENCE_KIND(heart))
+        return true;
+
+    if (not ANY_ARRAY_KIND(heart))
+        return false;
+
+    Cell(const*) tail = ARR_TAIL(VAL_ARRAY(at));
+    Cell(const*) item = ARR_AT(VAL_ARRAY(at), VAL_INDEX(at));
+    for (; item != tail; ++item)
+        if (May_Need_Composing(item))
+            return true;
+
+    return false;
+}
+
+
 // This is a helper common to the Composer_Executor() and the COMPOSE native
 // which will push a frame that does composing to the trampoline stack.
 //
@@ -360,6 +428,14 @@ static void Push_Composer_Frame(
         adjusted = rebValue(Canon(AS), Canon(BLOCK_X), rebQ(out));
     }
 
+    // Most items land in the output as-is (only groups substitute), so the
+    // input length is a good pre-sizing hint for the data stack.
+    //
+    if (adjusted)
+        Ensure_Data_Stack_Capacity(VAL_LEN_AT(adjusted));
+    else
+        Ensure_Data_Stack_Capacity(VAL_LEN_AT(arraylike));
+
     Frame(*) subframe = Make_Frame_At_Core(
         adjusted ? adjusted : arraylike,
         adjusted ? SPECIFIED : specifier,
@@ -566,6 +642,15 @@ Bounce Composer_Executor(Frame(*) f)
 
     if (not match) {
         if (deep) {
+            if (not May_Need_Composing(at)) {
+                //
+                // Same as the unchanged case below, minus the frame spent
+                // finding out the subtree had nothing to substitute.
+                //
+                Derelativize(PUSH(), at, f_specifier);  // keep newline flag
+                goto handle_next_item;
+            }
+
             // compose/deep [does [(1 + 2)] nested] => [does [3] nested]
 
             Push_Composer_Frame(OUT, main_frame, at, f_specifier);
@@ -879,3 +964,153 @@ DECLARE_NATIVE(flatten)
 
     return Init_Block(OUT, Pop_Stack_Values(base));
 }
+
+
+//=//// COLLECT ///////////////////////////////////////////////////////////=//
+//
+// COLLECT was a mezzanine which built its KEEP function as a SPECIALIZE of
+// an ENCLOSE of APPEND.  That composed well, but it meant every kept value
+// paid for an interpreted frame around an APPEND frame...noticeable in code
+// that keeps millions of values.  Here KEEP is a custom dispatcher which
+// writes into an array held in the keeper action's details, so a keep costs
+// roughly what an APPEND does.
+//
+// The output array lives in the details (and not, say, a C pointer) so that
+// the garbage collector sees it...and so each COLLECT in flight has its own.
+
+enum {
+    IDX_KEEPER_OUT = 1,  // BLOCK! being collected into (null until a keep)
+    IDX_KEEPER_MAX
+};
+
+
+//
+//  keep-internal*: native [
+//
+//      return: [<opt> any-value!]
+//      value "What to keep (isotopic groups will splice, e.g. SPREAD)"
+//          [<void> element? splice!]
+//      /part "Limits to a given length or position"
+//          [any-number! any-series! pair!]
+//      /dup "Duplicates the insert a specified number of times"
+//          [any-number! pair!]
+//      /line "Data should be its own line (use as formatting cue if molding)"
+//  ]
+//
+DECLARE_NATIVE(keep_internal_p)
+//
+// Note: This prototype is used by all COLLECT keepers.  (It steals the
+// paramlist from this native.)
+{
+    INCLUDE_PARAMS_OF_KEEP_INTERNAL_P;
+
+    UNUSED(ARG(value));
+    UNUSED(ARG(part));
+    UNUSED(ARG(dup));
+    UNUSED(ARG(line));
+    panic (nullptr);
+}
+
+
+//
+//  Keeper_Dispatcher: C
+//
+// Dispatcher for the KEEP function that COLLECT binds into its body.
+//
+Bounce Keeper_Dispatcher(Frame(*) frame_)
+{
+    Frame(*) f = frame_;
+
+    Array(*) details = ACT_DETAILS(FRM_PHASE(f));
+    assert(ARR_LEN(details) == IDX_KEEPER_MAX);
+
+    assert(KEY_SYM(ACT_KEY(FRM_PHASE(f), 1)) == SYM_RETURN);  // skip arg 1
+
+    Value(*) v = FRM_ARG(f, 2);  // value
+    Value(*) part = FRM_ARG(f, 3);
+    Value(*) dup = FRM_ARG(f, 4);
+    Value(*) line = FRM_ARG(f, 5);
+
+    if (Is_Void(v))
+        return nullptr;  // void in, null out...doesn't make the out block
+
+    Value(*) out_slot = DETAILS_AT(details, IDX_KEEPER_OUT);
+    if (Is_Nulled(out_slot))
+        Init_Block(out_slot, Make_Array_Core(16, NODE_FLAG_MANAGED));
+
+    Copy_Cell(OUT, v);  // result is the kept value, as the caller passed it
+
+    Flags flags = 0;
+    REBLEN limit = Part_Limit_Append_Insert(part);
+
+    if (Is_Splice(v)) {
+        flags |= AM_SPLICE;
+        mutable_QUOTE_BYTE(v) = UNQUOTED_1;  // make plain group
+    }
+    else if (Is_Isotope(v))  // only SPLICE! in typecheck
+        fail (Error_Bad_Isotope(v));  // ...but that doesn't filter yet
+
+    if (not Is_Nulled(part))
+        flags |= AM_PART;
+    if (not Is_Nulled(line))
+        flags |= AM_LINE;
+
+    Array(*) arr = VAL_ARRAY_KNOWN_MUTABLE(out_slot);
+    Modify_Array(
+        arr,
+        ARR_LEN(arr),
+        SYM_APPEND,
+        v,
+        flags,
+        limit,
+        Is_Nulled(dup) ? 1 : Int32(dup)
+    );
+
+    return OUT;
+}
+
+
+//
+//  collect*: native [
+//
+//  {Evaluate body, and return block of values collected via KEEP function}
+//
+//      return: "Result block, or null if no KEEPs (prevent nulls with KEEP [])"
+//          [<opt> block!]
+//      body "Block to evaluate"
+//          [<maybe> block!]
+//  ]
+//
+DECLARE_NATIVE(collect_p)
+{
+    INCLUDE_PARAMS_OF_COLLECT_P;
+
+    Value(*) body = ARG(body);
+
+    DECLARE_LOCAL (keep_word);
+    Init_Word(keep_word, Canon(KEEP));
+
+    Context(*) context = Virtual_Bind_Deep_To_New_Context(
+        body,  // may be replaced with rebound copy, or left the same
+        keep_word
+    );
+
+    Action(*) keeper = Make_Action(
+        ACT_PARAMLIST(VAL_ACTION(Lib(KEEP_INTERNAL_P))),
+        nullptr,  // no partials
+        &Keeper_Dispatcher,
+        IDX_KEEPER_MAX  // details array capacity
+    );
+    Init_Nulled(DETAILS_AT(ACT_DETAILS(keeper), IDX_KEEPER_OUT));
+
+    Init_Activation(CTX_VAR(context, 1), keeper, Canon(KEEP), UNBOUND);
+
+    if (Do_Any_Array_At_Throws(SPARE, body, SPECIFIED))
+        return THROWN;
+
+    Value(*) out_slot = DETAILS_AT(ACT_DETAILS(keeper), IDX_KEEPER_OUT);
+    if (Is_Nulled(out_slot))
+        return nullptr;
+
+    return COPY(out_slot);
+}
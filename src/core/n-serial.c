@@ -0,0 +1,847 @@
+//
+//  File: %n-serial.c
+//  Summary: "Binary serialization of source arrays and structured values"
+//  Section: natives
+//  Project: "Ren-C Language Interpreter and Run-time Environment"
+//  Homepage: https://github.com/metaeducation/ren-c/
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Copyright 2023 Ren-C Open Source Contributors
+//
+// See README.md and CREDITS.md for more information
+//
+// Licensed under the Lesser GPL, Version 3.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// https://www.gnu.org/licenses/lgpl-3.0.html
+//
+//=////////////////////////////////////////////////////////////////////////=//
+//
+// Scanning UTF-8 source with Scan_UTF8_Managed() is a per-byte process, and
+// it gets paid on every startup for every mezzanine and user module.  The
+// SERIALIZE and DESERIALIZE natives offer a binary container format for
+// already-scanned arrays: an interned symbol table up front, followed by a
+// flat stream of value records that can be loaded with bulk reads.
+//
+// The format is a cache format, not an interchange format.  A version byte
+// guards it, and the encoding of datatype bytes is only promised to be
+// readable by the same build that wrote it.  Bindings are not captured--the
+// decoded array is unbound source, just as the scanner would produce.
+//
+// Only types that appear in source are supported by SERIALIZE (arrays,
+// words, strings, integers, decimals, blanks, and quoted forms of those).
+// Attempting to serialize anything else is an error, so callers can fall
+// back on saving plain source text for exotic content.
+//
+// FLATTEN and UNFLATTEN share the container format but take a single value
+// instead of a block of source, and extend the record set to the structured
+// types used for data snapshots: MAP! and OBJECT!, plus the isotopic word
+// states (logic and null) their slots routinely hold.  MOLD and LOAD round
+// trips of large snapshots pay scanning and molding costs per byte; the
+// flattened form decodes with bulk reads into pre-sized series.
+//
+
+#include "sys-core.h"
+
+#define SERIAL_MAGIC  "REBIN"  // 5 bytes, followed by the version byte
+#define SERIAL_MAGIC_SIZE  5
+#define SERIAL_VERSION  2
+
+enum Serial_Payload {
+    SERIAL_PAYLOAD_STREAM = 0,  // u32 count, then that many records
+    SERIAL_PAYLOAD_VALUE = 1  // a single record
+};
+
+enum Serial_Record {
+    SERIAL_ARRAY = 1,  // heart byte, u32 count, then records for each item
+    SERIAL_WORD,  // heart byte, u32 index into symbol table
+    SERIAL_STRING,  // heart byte, u32 size, UTF-8 bytes
+    SERIAL_INTEGER,  // i64, little endian
+    SERIAL_DECIMAL,  // IEEE-754 double bits, little endian
+    SERIAL_BINARY,  // u32 size, raw bytes
+    SERIAL_BLANK,  // no payload
+    SERIAL_QUOTED,  // u8 quote byte (quoted/quasi/isotope), then the record
+    SERIAL_MAP,  // u32 pair count, then key and value records for each pair
+    SERIAL_OBJECT,  // u32 field count, then u32 symbol index + value record
+    SERIAL_VOID  // no payload (only legal as the ~ isotope, e.g. "none")
+};
+
+
+//=//// EMITTERS (ENDIAN-AGNOSTIC, ALWAYS LITTLE ENDIAN ON DISK) //////////=//
+
+static void Emit_Bytes(Binary(*) bin, const void *data, Size size) {
+    REBLEN used = BIN_LEN(bin);
+    EXPAND_SERIES_TAIL(bin, size);
+    memcpy(BIN_AT(bin, used), data, size);
+}
+
+static void Emit_Byte(Binary(*) bin, Byte b) {
+    Emit_Bytes(bin, &b, 1);
+}
+
+static void Emit_U32(Binary(*) bin, uint32_t u) {
+    Byte buf[4];
+    buf[0] = u & 0xFF;
+    buf[1] = (u >> 8) & 0xFF;
+    buf[2] = (u >> 16) & 0xFF;
+    buf[3] = (u >> 24) & 0xFF;
+    Emit_Bytes(bin, buf, 4);
+}
+
+static void Emit_U64(Binary(*) bin, uint64_t u) {
+    Byte buf[8];
+    REBLEN i;
+    for (i = 0; i < 8; ++i)
+        buf[i] = (u >> (8 * i)) & 0xFF;
+    Emit_Bytes(bin, buf, 8);
+}
+
+
+//=//// READERS (BOUNDS-CHECKED AGAINST THE INPUT BINARY) /////////////////=//
+
+struct Serial_Reader {
+    const Byte* at;
+    const Byte* tail;
+};
+
+static void Read_Bytes(struct Serial_Reader *r, void *out, Size size) {
+    if (size > cast(Size, r->tail - r->at))
+        fail ("Truncated serialized data");
+    memcpy(out, r->at, size);
+    r->at += size;
+}
+
+static Byte Read_Byte(struct Serial_Reader *r) {
+    Byte b;
+    Read_Bytes(r, &b, 1);
+    return b;
+}
+
+static uint32_t Read_U32(struct Serial_Reader *r) {
+    Byte buf[4];
+    Read_Bytes(r, buf, 4);
+    return cast(uint32_t, buf[0])
+        | (cast(uint32_t, buf[1]) << 8)
+        | (cast(uint32_t, buf[2]) << 16)
+        | (cast(uint32_t, buf[3]) << 24);
+}
+
+static uint64_t Read_U64(struct Serial_Reader *r) {
+    Byte buf[8];
+    Read_Bytes(r, buf, 8);
+    uint64_t u = 0;
+    REBLEN i;
+    for (i = 0; i < 8; ++i)
+        u |= cast(uint64_t, buf[i]) << (8 * i);
+    return u;
+}
+
+
+//=//// SYMBOL TABLE COLLECTION ///////////////////////////////////////////=//
+
+// First pass over the tree: assign each distinct spelling a 0-based index in
+// order of first appearance, using the binder for the symbol -> index map.
+// The symbols series remembers the order (and is what's used to clean the
+// binder back out, since the binder can't enumerate).
+//
+// Returns an error context instead of failing directly, because the caller
+// has binder state to unwind.  (See Make_Paramlist_Managed_May_Fail() for
+// this same pattern.)
+//
+static void Collect_Symbol(
+    REBSER *symbols,
+    struct Reb_Binder *binder,
+    Symbol(const*) symbol
+){
+    if (Get_Binder_Index_Else_0(binder, symbol) != 0)
+        return;  // already collected
+    Add_Binder_Index(binder, symbol, SER_USED(symbols) + 1);
+    EXPAND_SERIES_TAIL(symbols, 1);
+    *SER_AT(const void*, symbols, SER_USED(symbols) - 1) = symbol;
+}
+
+static Context(*) Try_Collect_Symbols(
+    REBSER *symbols,  // FLAVOR_POINTER series of Symbol(const*)
+    struct Reb_Binder *binder,
+    Cell(const*) head,
+    Cell(const*) tail
+){
+    Cell(const*) v = head;
+    for (; v != tail; ++v) {
+        enum Reb_Kind heart = CELL_HEART(v);
+
+        // Isotopes can't be in blocks, but map values and object variables
+        // hold isotopic words (logic and null) and isotopic voids (the ~
+        // unset state) all the time.  Those (plus isotopic blanks) are the
+        // only isotopes supported.
+        //
+        if (QUOTE_BYTE(v) == ISOTOPE_0) {
+            if (heart == REB_VOID)
+                continue;  // none, nothing to collect
+            if (heart != REB_WORD and heart != REB_BLANK)
+                goto unsupported;
+        }
+
+        if (ANY_WORD_KIND(heart)) {
+            Collect_Symbol(symbols, binder, VAL_WORD_SYMBOL(v));
+            continue;
+        }
+
+        if (ANY_ARRAY_KIND(heart)) {
+            Cell(const*) sub_tail;
+            Cell(const*) sub = VAL_ARRAY_AT(&sub_tail, v);
+            Context(*) error = Try_Collect_Symbols(
+                symbols, binder, sub, sub_tail
+            );
+            if (error)
+                return error;
+            continue;
+        }
+
+        if (heart == REB_MAP) {
+            const REBMAP *map = VAL_MAP(v);
+            Cell(const*) mval_tail = ARR_TAIL(MAP_PAIRLIST(map));
+            Cell(const*) mval = ARR_HEAD(MAP_PAIRLIST(map));
+            for (; mval != mval_tail; mval += 2) {
+                if (Is_Void(mval + 1))
+                    continue;  // zombie key, e.g. not actually in map
+                Context(*) error = Try_Collect_Symbols(
+                    symbols, binder, mval, mval + 2  // key and value cells
+                );
+                if (error)
+                    return error;
+            }
+            continue;
+        }
+
+        if (heart == REB_OBJECT) {
+            Context(*) ctx = VAL_CONTEXT(v);
+            REBLEN len = CTX_LEN(ctx);
+            REBLEN n;
+            for (n = 1; n <= len; ++n) {
+                Collect_Symbol(symbols, binder, KEY_SYMBOL(CTX_KEY(ctx, n)));
+                REBVAL *var = CTX_VAR(ctx, n);
+                Context(*) error = Try_Collect_Symbols(
+                    symbols, binder, var, var + 1
+                );
+                if (error)
+                    return error;
+            }
+            continue;
+        }
+
+        switch (heart) {
+          case REB_TEXT:
+          case REB_FILE:
+          case REB_EMAIL:
+          case REB_URL:
+          case REB_TAG:
+          case REB_BINARY:
+          case REB_INTEGER:
+          case REB_DECIMAL:
+          case REB_BLANK:
+          case REB_VOID:  // quasiform ~ in blocks, or the unset state
+            continue;  // supported, no symbols involved
+
+          default:
+            break;
+        }
+
+      unsupported: {
+        DECLARE_LOCAL (specific);
+        Derelativize(specific, v, SPECIFIED);
+        return Error_Bad_Value(specific);
+      }
+    }
+
+    return nullptr;
+}
+
+
+static void Serialize_Value(
+    Binary(*) bin,
+    struct Reb_Binder *binder,
+    Cell(const*) v
+){
+    // The raw quote byte captures quoting depth, quasiforms, and isotopes
+    // all in a single prefix.  (Which states are actually allowed was vetted
+    // by the collection pass; the decoder checks again, since it can't trust
+    // its input.)
+    //
+    Byte quote_byte = QUOTE_BYTE(v);
+    if (quote_byte != UNQUOTED_1) {
+        Emit_Byte(bin, SERIAL_QUOTED);
+        Emit_Byte(bin, quote_byte);
+    }
+
+    enum Reb_Kind heart = CELL_HEART(v);
+
+    if (ANY_WORD_KIND(heart)) {
+        Emit_Byte(bin, SERIAL_WORD);
+        Emit_Byte(bin, cast(Byte, heart));
+        REBINT index = Get_Binder_Index_Else_0(
+            binder, VAL_WORD_SYMBOL(v)
+        );
+        assert(index != 0);  // collection pass saw every word
+        Emit_U32(bin, cast(uint32_t, index - 1));
+        return;
+    }
+
+    if (ANY_ARRAY_KIND(heart)) {
+        Cell(const*) sub_tail;
+        Cell(const*) sub = VAL_ARRAY_AT(&sub_tail, v);
+        Emit_Byte(bin, SERIAL_ARRAY);
+        Emit_Byte(bin, cast(Byte, heart));
+        Emit_U32(bin, cast(uint32_t, sub_tail - sub));
+
+        Cell(const*) item = sub;
+        for (; item != sub_tail; ++item)
+            Serialize_Value(bin, binder, item);
+        return;
+    }
+
+    if (heart == REB_MAP) {
+        const REBMAP *map = VAL_MAP(v);
+        Cell(const*) mval_tail = ARR_TAIL(MAP_PAIRLIST(map));
+        Cell(const*) mval = ARR_HEAD(MAP_PAIRLIST(map));
+
+        uint32_t num_pairs = 0;  // count with same test the emit loop uses
+        for (; mval != mval_tail; mval += 2) {
+            if (not Is_Void(mval + 1))
+                ++num_pairs;
+        }
+
+        Emit_Byte(bin, SERIAL_MAP);
+        Emit_U32(bin, num_pairs);
+
+        for (mval = ARR_HEAD(MAP_PAIRLIST(map)); mval != mval_tail; mval += 2) {
+            if (Is_Void(mval + 1))
+                continue;  // zombie key, e.g. not actually in map
+            Serialize_Value(bin, binder, mval);
+            Serialize_Value(bin, binder, mval + 1);
+        }
+        return;
+    }
+
+    if (heart == REB_OBJECT) {
+        Context(*) ctx = VAL_CONTEXT(v);
+        REBLEN len = CTX_LEN(ctx);
+        Emit_Byte(bin, SERIAL_OBJECT);
+        Emit_U32(bin, cast(uint32_t, len));
+
+        REBLEN n;
+        for (n = 1; n <= len; ++n) {
+            REBINT index = Get_Binder_Index_Else_0(
+                binder, KEY_SYMBOL(CTX_KEY(ctx, n))
+            );
+            assert(index != 0);  // collection pass saw every key
+            Emit_U32(bin, cast(uint32_t, index - 1));
+            Serialize_Value(bin, binder, CTX_VAR(ctx, n));
+        }
+        return;
+    }
+
+    switch (heart) {
+      case REB_TEXT:
+      case REB_FILE:
+      case REB_EMAIL:
+      case REB_URL:
+      case REB_TAG: {
+        Size size;
+        Utf8(const*) utf8 = VAL_UTF8_SIZE_AT(&size, v);
+        Emit_Byte(bin, SERIAL_STRING);
+        Emit_Byte(bin, cast(Byte, heart));
+        Emit_U32(bin, cast(uint32_t, size));
+        Emit_Bytes(bin, utf8, size);
+        break; }
+
+      case REB_BINARY: {
+        Size size;
+        const Byte* data = VAL_BINARY_SIZE_AT(&size, v);
+        Emit_Byte(bin, SERIAL_BINARY);
+        Emit_U32(bin, cast(uint32_t, size));
+        Emit_Bytes(bin, data, size);
+        break; }
+
+      case REB_INTEGER:
+        Emit_Byte(bin, SERIAL_INTEGER);
+        Emit_U64(bin, cast(uint64_t, VAL_INT64(v)));
+        break;
+
+      case REB_DECIMAL: {
+        REBDEC d = VAL_DECIMAL(v);
+        uint64_t bits;
+        memcpy(&bits, &d, 8);
+        Emit_Byte(bin, SERIAL_DECIMAL);
+        Emit_U64(bin, bits);
+        break; }
+
+      case REB_BLANK:
+        Emit_Byte(bin, SERIAL_BLANK);
+        break;
+
+      case REB_VOID:
+        Emit_Byte(bin, SERIAL_VOID);
+        break;
+
+      default:
+        panic (v);  // collection pass should have rejected it
+    }
+}
+
+static void Serialize_Array(
+    Binary(*) bin,
+    struct Reb_Binder *binder,
+    Cell(const*) head,
+    Cell(const*) tail
+){
+    Cell(const*) v = head;
+    for (; v != tail; ++v)
+        Serialize_Value(bin, binder, v);
+}
+
+
+static void Deserialize_Value(
+    struct Serial_Reader *r,
+    Array(*) symbols,
+    Cell(*) out,
+    bool isotopes_ok  // map values, object variables, and the top level
+);
+
+static Array(*) Deserialize_Array(
+    struct Serial_Reader *r,
+    Array(*) symbols,  // decoded table, as WORD!s so the GC sees them
+    REBLEN count,
+    enum Reb_Kind heart
+){
+    if (not ANY_ARRAY_KIND(heart))
+        fail ("Invalid array datatype byte in serialized data");
+
+    if (count > cast(REBLEN, r->tail - r->at))
+        fail ("Truncated serialized data");  // each record is >= 1 byte
+
+    Array(*) a = Make_Array_Core(count, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(a);
+
+    REBLEN i;
+    for (i = 0; i < count; ++i)
+        Deserialize_Value(r, symbols, Alloc_Tail_Array(a), false);
+
+    DROP_GC_GUARD(a);
+    return a;
+}
+
+static void Deserialize_Value(
+    struct Serial_Reader *r,
+    Array(*) symbols,  // decoded table, as WORD!s so the GC sees them
+    Cell(*) out,
+    bool isotopes_ok
+){
+    Byte quote_byte = UNQUOTED_1;
+    Byte tag = Read_Byte(r);
+    if (tag == SERIAL_QUOTED) {
+        quote_byte = Read_Byte(r);
+        if (quote_byte == UNQUOTED_1)
+            fail ("Redundant quote record in serialized data");
+        tag = Read_Byte(r);
+        if (tag == SERIAL_QUOTED)
+            fail ("Nested quote records in serialized data");
+    }
+
+    if (quote_byte == ISOTOPE_0) {
+        if (not isotopes_ok)
+            fail ("Isotope in array position of serialized data");
+        if (tag != SERIAL_WORD and tag != SERIAL_BLANK and tag != SERIAL_VOID)
+            fail ("Unsupported isotope record in serialized data");
+    }
+
+    switch (tag) {
+      case SERIAL_ARRAY: {
+        enum Reb_Kind sub_heart = cast(enum Reb_Kind, Read_Byte(r));
+        REBLEN sub_count = Read_U32(r);
+        Array(*) sub = Deserialize_Array(r, symbols, sub_count, sub_heart);
+        Init_Any_Array(out, sub_heart, sub);
+        break; }
+
+      case SERIAL_WORD: {
+        enum Reb_Kind word_heart = cast(enum Reb_Kind, Read_Byte(r));
+        if (not ANY_WORD_KIND(word_heart))
+            fail ("Invalid word datatype byte in serialized data");
+        uint32_t index = Read_U32(r);
+        if (index >= ARR_LEN(symbols))
+            fail ("Symbol index out of range in serialized data");
+        Init_Any_Word(
+            out, word_heart, VAL_WORD_SYMBOL(ARR_AT(symbols, index))
+        );
+        break; }
+
+      case SERIAL_STRING: {
+        enum Reb_Kind str_heart = cast(enum Reb_Kind, Read_Byte(r));
+        if (not ANY_STRING_KIND(str_heart))
+            fail ("Invalid string datatype byte in serialized data");
+        uint32_t size = Read_U32(r);
+        if (size > cast(Size, r->tail - r->at))
+            fail ("Truncated serialized data");
+        String(*) s = Make_Sized_String_UTF8(cs_cast(r->at), size);
+        r->at += size;
+        Init_Any_String(out, str_heart, s);
+        break; }
+
+      case SERIAL_INTEGER:
+        Init_Integer(out, cast(REBI64, Read_U64(r)));
+        break;
+
+      case SERIAL_DECIMAL: {
+        uint64_t bits = Read_U64(r);
+        REBDEC d;
+        memcpy(&d, &bits, 8);
+        Init_Decimal(out, d);
+        break; }
+
+      case SERIAL_BINARY: {
+        uint32_t size = Read_U32(r);
+        if (size > cast(Size, r->tail - r->at))
+            fail ("Truncated serialized data");
+        Binary(*) b = Make_Binary(size);
+        memcpy(BIN_HEAD(b), r->at, size);
+        TERM_BIN_LEN(b, size);
+        r->at += size;
+        Init_Binary(out, b);
+        break; }
+
+      case SERIAL_BLANK:
+        Init_Blank(out);
+        break;
+
+      case SERIAL_VOID:
+        if (quote_byte == UNQUOTED_1)
+            fail ("Unquoted void record in serialized data");
+        Init_None(out);  // quote byte fixup below handles quasi/quoted forms
+        break;
+
+      case SERIAL_MAP: {
+        uint32_t num_pairs = Read_U32(r);
+        if (num_pairs > cast(Size, r->tail - r->at) / 2)
+            fail ("Truncated serialized data");  // each pair is >= 2 bytes
+
+        // Manage the pairlist (and hashlist) up front, the way Init_Map()
+        // will, so the guard makes decoded keys and values visible to any
+        // garbage collection the pair decoding triggers.
+        //
+        REBMAP *map = Make_Map(num_pairs);
+        if (MAP_HASHLIST(map))
+            Force_Series_Managed(MAP_HASHLIST(map));
+        Force_Series_Managed(MAP_PAIRLIST(map));
+        PUSH_GC_GUARD(MAP_PAIRLIST(map));
+
+        // Decode each pair into data stack cells so the keys and values are
+        // visible to the GC before they make it into the pairlist.
+        //
+        uint32_t i;
+        for (i = 0; i < num_pairs; ++i) {
+            StackValue(*) key = PUSH();
+            Deserialize_Value(r, symbols, key, false);
+            StackValue(*) val = PUSH();
+            Deserialize_Value(r, symbols, val, true);
+            Find_Map_Entry(map, key, SPECIFIED, val, SPECIFIED, true);
+            DROP();
+            DROP();
+        }
+
+        DROP_GC_GUARD(MAP_PAIRLIST(map));
+        Init_Map(out, map);
+        break; }
+
+      case SERIAL_OBJECT: {
+        uint32_t num_fields = Read_U32(r);
+        if (num_fields > cast(Size, r->tail - r->at) / 5)
+            fail ("Truncated serialized data");  // each field is >= 5 bytes
+
+        Context(*) ctx = Alloc_Context_Core(
+            REB_OBJECT, num_fields, NODE_FLAG_MANAGED
+        );
+        PUSH_GC_GUARD(ctx);
+
+        uint32_t i;
+        for (i = 0; i < num_fields; ++i) {
+            uint32_t index = Read_U32(r);
+            if (index >= ARR_LEN(symbols))
+                fail ("Symbol index out of range in serialized data");
+
+            // Decode into a data stack cell first--the variable's slot is
+            // not initialized by Append_Context(), and the decode of the
+            // value may trigger a garbage collection.
+            //
+            StackValue(*) var = PUSH();
+            Deserialize_Value(r, symbols, var, true);
+            Copy_Cell(
+                Append_Context(
+                    ctx, VAL_WORD_SYMBOL(ARR_AT(symbols, index))
+                ),
+                var
+            );
+            DROP();
+        }
+
+        DROP_GC_GUARD(ctx);
+        Init_Object(out, ctx);
+        break; }
+
+      default:
+        fail ("Invalid record tag in serialized data");
+    }
+
+    if (quote_byte != UNQUOTED_1)
+        mutable_QUOTE_BYTE(out) = quote_byte;
+}
+
+
+// Write out the container prologue shared by SERIALIZE and FLATTEN: the
+// magic, the version, the payload kind, and the symbol table.
+//
+static void Emit_Container_Prologue(
+    Binary(*) bin,
+    enum Serial_Payload payload,
+    REBSER *symbols
+){
+    Emit_Bytes(bin, SERIAL_MAGIC, SERIAL_MAGIC_SIZE);
+    Emit_Byte(bin, SERIAL_VERSION);
+    Emit_Byte(bin, cast(Byte, payload));
+
+    Emit_U32(bin, cast(uint32_t, SER_USED(symbols)));
+    REBLEN i;
+    for (i = 0; i < SER_USED(symbols); ++i) {
+        Symbol(const*) symbol = cast(Symbol(const*),
+            *SER_AT(const void*, symbols, i)
+        );
+        Emit_U32(bin, cast(uint32_t, STR_SIZE(symbol)));
+        Emit_Bytes(bin, STR_UTF8(symbol), STR_SIZE(symbol));
+    }
+}
+
+// Binder must be cleaned out whether serialization succeeded or not.
+//
+static void Remove_Collected_Symbols(
+    REBSER *symbols,
+    struct Reb_Binder *binder
+){
+    REBLEN i;
+    for (i = 0; i < SER_USED(symbols); ++i) {
+        Symbol(const*) symbol = cast(Symbol(const*),
+            *SER_AT(const void*, symbols, i)
+        );
+        Remove_Binder_Index(binder, symbol);
+    }
+    SHUTDOWN_BINDER(binder);
+}
+
+
+//
+//  serialize: native [
+//
+//  {Encode an already-scanned BLOCK! in a binary form DESERIALIZE can load}
+//
+//      return: [binary!]
+//      value "Source-level material only (no binding is captured)"
+//          [block!]
+//  ]
+//
+DECLARE_NATIVE(serialize)
+{
+    INCLUDE_PARAMS_OF_SERIALIZE;
+
+    REBVAL *value = ARG(value);
+
+    Cell(const*) tail;
+    Cell(const*) head = VAL_ARRAY_AT(&tail, value);
+
+    Set_Frame_Flag(FRAME, MANUALS_SCOPED);  // symbols series freed on drop
+
+    // The symbols series holds each distinct spelling in first-appearance
+    // order; the binder maps spellings back to their position in it.
+    //
+    REBSER *symbols = Make_Series_Core(15, FLAG_FLAVOR(POINTER));
+
+    struct Reb_Binder binder;
+    INIT_BINDER(&binder);
+
+    Context(*) error = Try_Collect_Symbols(symbols, &binder, head, tail);
+
+    Binary(*) bin = nullptr;
+    if (not error) {
+        bin = Make_Binary(SER_USED(symbols) * 8 + (tail - head) * 8);
+        Emit_Container_Prologue(bin, SERIAL_PAYLOAD_STREAM, symbols);
+
+        Emit_U32(bin, cast(uint32_t, tail - head));
+        Serialize_Array(bin, &binder, head, tail);
+        TERM_BIN(bin);
+    }
+
+    Remove_Collected_Symbols(symbols, &binder);
+
+    if (error)
+        fail (error);
+
+    return Init_Binary(OUT, bin);
+}
+
+
+//
+//  flatten: native [
+//
+//  {Encode a structured value in a binary form UNFLATTEN can load}
+//
+//      return: [binary!]
+//      value "Block, map, object, string, etc. (no binding is captured)"
+//          [any-value! logic!]
+//  ]
+//
+DECLARE_NATIVE(flatten)
+{
+    INCLUDE_PARAMS_OF_FLATTEN;
+
+    REBVAL *value = ARG(value);
+
+    Set_Frame_Flag(FRAME, MANUALS_SCOPED);  // symbols series freed on drop
+
+    REBSER *symbols = Make_Series_Core(15, FLAG_FLAVOR(POINTER));
+
+    struct Reb_Binder binder;
+    INIT_BINDER(&binder);
+
+    Context(*) error = Try_Collect_Symbols(
+        symbols, &binder, value, value + 1
+    );
+
+    Binary(*) bin = nullptr;
+    if (not error) {
+        bin = Make_Binary(SER_USED(symbols) * 8 + 64);
+        Emit_Container_Prologue(bin, SERIAL_PAYLOAD_VALUE, symbols);
+
+        Serialize_Value(bin, &binder, value);
+        TERM_BIN(bin);
+    }
+
+    Remove_Collected_Symbols(symbols, &binder);
+
+    if (error)
+        fail (error);
+
+    return Init_Binary(OUT, bin);
+}
+
+
+// Check the container prologue and intern the symbol table up front, so
+// every word record decode is just an index into the returned array.  It's
+// held as WORD! cells in an array (not raw pointers) so a recycle during
+// decoding marks the symbols.
+//
+// The returned array is pushed as a GC guard; the caller must balance with
+// a DROP_GC_GUARD() when the decode is finished.
+//
+static Array(*) Read_Container_Prologue(
+    struct Serial_Reader *r,
+    enum Serial_Payload payload
+){
+    Byte magic[SERIAL_MAGIC_SIZE];
+    Read_Bytes(r, magic, SERIAL_MAGIC_SIZE);
+    if (memcmp(magic, SERIAL_MAGIC, SERIAL_MAGIC_SIZE) != 0)
+        fail ("Not a serialized binary (bad magic)");
+    if (Read_Byte(r) != SERIAL_VERSION)
+        fail ("Serialized binary has an unsupported version");
+
+    Byte kind = Read_Byte(r);
+    if (kind != cast(Byte, payload)) {
+        if (kind == SERIAL_PAYLOAD_STREAM)
+            fail ("Binary was made by SERIALIZE, use DESERIALIZE");
+        if (kind == SERIAL_PAYLOAD_VALUE)
+            fail ("Binary was made by FLATTEN, use UNFLATTEN");
+        fail ("Serialized binary has an invalid payload kind");
+    }
+
+    uint32_t num_symbols = Read_U32(r);
+    if (num_symbols > cast(Size, r->tail - r->at) / 4)
+        fail ("Truncated serialized data");  // each entry is >= 4 bytes
+
+    Array(*) symbols = Make_Array_Core(num_symbols + 1, NODE_FLAG_MANAGED);
+    PUSH_GC_GUARD(symbols);
+
+    uint32_t i;
+    for (i = 0; i < num_symbols; ++i) {
+        uint32_t spelling_size = Read_U32(r);
+        if (spelling_size > cast(Size, r->tail - r->at))
+            fail ("Truncated serialized data");
+        Init_Word(
+            Alloc_Tail_Array(symbols),
+            Intern_UTF8_Managed(r->at, spelling_size)
+        );
+        r->at += spelling_size;
+    }
+
+    return symbols;
+}
+
+
+//
+//  deserialize: native [
+//
+//  {Load a BINARY! made by SERIALIZE without rescanning the source}
+//
+//      return: [block!]
+//      binary [binary!]
+//  ]
+//
+DECLARE_NATIVE(deserialize)
+{
+    INCLUDE_PARAMS_OF_DESERIALIZE;
+
+    struct Serial_Reader r;
+    Size size;
+    r.at = VAL_BINARY_SIZE_AT(&size, ARG(binary));
+    r.tail = r.at + size;
+
+    Array(*) symbols = Read_Container_Prologue(&r, SERIAL_PAYLOAD_STREAM);
+
+    REBLEN count = Read_U32(&r);
+    Array(*) a = Deserialize_Array(&r, symbols, count, REB_BLOCK);
+
+    DROP_GC_GUARD(symbols);
+
+    if (r.at != r.tail)
+        fail ("Extra bytes at end of serialized data");
+
+    return Init_Block(OUT, a);
+}
+
+
+//
+//  unflatten: native [
+//
+//  {Load a BINARY! made by FLATTEN back into a structured value}
+//
+//      return: [any-value! logic!]
+//      binary [binary!]
+//  ]
+//
+DECLARE_NATIVE(unflatten)
+{
+    INCLUDE_PARAMS_OF_UNFLATTEN;
+
+    struct Serial_Reader r;
+    Size size;
+    r.at = VAL_BINARY_SIZE_AT(&size, ARG(binary));
+    r.tail = r.at + size;
+
+    Array(*) symbols = Read_Container_Prologue(&r, SERIAL_PAYLOAD_VALUE);
+
+    Deserialize_Value(&r, symbols, OUT, true);
+
+    DROP_GC_GUARD(symbols);
+
+    if (r.at != r.tail)
+        fail ("Extra bytes at end of serialized data");
+
+    return OUT;
+}
@@ -47,6 +47,68 @@
 #include "sys-core.h"
 
 
+// The string and binary set operations check membership (and de-duplicate
+// against the output built so far) with Find_Binstr_In_Binstr(), a linear
+// rescan per element that makes long inputs quadratic.  Above this length
+// it's worth building transient lookup tables for those probes instead.
+// (Arrays don't need this--they already hash via Hash_Block().)
+//
+#define SET_OP_HASH_THRESHOLD 256
+
+
+// Transient open-addressed set of codepoints for the string operations.
+// Codepoints are stored biased by 1 so zero can mark an empty slot; the
+// table is kept under half full so probe chains stay short.
+//
+struct Codepoint_Set {
+    uint32_t *slots;
+    uint32_t mask;  // number of slots (a power of 2) minus 1
+};
+
+static void Codepoint_Set_Init(struct Codepoint_Set *set, REBLEN capacity)
+{
+    if (capacity > 0x110000)
+        capacity = 0x110000;  // there are only so many codepoints
+
+    REBLEN num_slots = 64;
+    while (num_slots < capacity * 2)  // load factor under 50%
+        num_slots <<= 1;
+
+    set->slots = rebAllocN(uint32_t, num_slots);  // fail() auto-frees
+    memset(set->slots, 0, num_slots * sizeof(uint32_t));
+    set->mask = num_slots - 1;
+}
+
+static void Codepoint_Set_Free(struct Codepoint_Set *set)
+{
+    rebFree(set->slots);
+}
+
+static bool Codepoint_Set_Find(struct Codepoint_Set *set, Codepoint c)
+{
+    uint32_t key = c + 1;
+    uint32_t slot = (key * 2654435761u) & set->mask;  // Knuth multiplicative
+    while (set->slots[slot] != 0) {
+        if (set->slots[slot] == key)
+            return true;
+        slot = (slot + 1) & set->mask;
+    }
+    return false;
+}
+
+static void Codepoint_Set_Insert(struct Codepoint_Set *set, Codepoint c)
+{
+    uint32_t key = c + 1;
+    uint32_t slot = (key * 2654435761u) & set->mask;
+    while (set->slots[slot] != 0) {
+        if (set->slots[slot] == key)
+            return;  // already present
+        slot = (slot + 1) & set->mask;
+    }
+    set->slots[slot] = key;
+}
+
+
 //
 //  Make_Set_Operation_Series: C
 //
@@ -205,11 +267,64 @@ REBSER *Make_Set_Operation_Series(
         mo->reserve = i;
         Push_Mold(mo);
 
+        // Matching is per-codepoint when skip is 1, so codepoint sets can
+        // stand in for the linear Find_Binstr_In_Binstr() probes once the
+        // input is long enough for those rescans to dominate.  Uncased
+        // operation folds through LO_CASE, as the finds do.
+        //
+        bool hashed = (skip == 1 and i >= SET_OP_HASH_THRESHOLD);
+
+        struct Codepoint_Set out_set;  // codepoints already in the output
+        if (hashed)
+            Codepoint_Set_Init(&out_set, i);
+
         do {
             // Note: val1 and val2 swapped 2nd pass!
             //
             String(const*) str = VAL_STRING(val1);
 
+            if (hashed) {
+                struct Codepoint_Set other_set;
+                if (flags & SOP_FLAG_CHECK) {
+                    Codepoint_Set_Init(&other_set, VAL_LEN_AT(val2));
+                    Utf8(const*) other = VAL_STRING_AT(val2);
+                    REBLEN n = VAL_LEN_AT(val2);
+                    for (; n > 0; --n) {
+                        Codepoint c;
+                        other = NEXT_CHR(&c, other);
+                        Codepoint_Set_Insert(
+                            &other_set,
+                            cased ? c : LO_CASE(c)
+                        );
+                    }
+                }
+
+                Utf8(const*) cp = VAL_STRING_AT(val1);
+                REBLEN n = VAL_LEN_AT(val1);
+                for (; n > 0; --n) {
+                    Codepoint c;
+                    cp = NEXT_CHR(&c, cp);
+                    Codepoint key = cased ? c : LO_CASE(c);
+
+                    if (flags & SOP_FLAG_CHECK) {
+                        h = Codepoint_Set_Find(&other_set, key);
+                        if (flags & SOP_FLAG_INVERT) h = !h;
+                    }
+                    if (!h) continue;
+
+                    if (not Codepoint_Set_Find(&out_set, key)) {
+                        Codepoint_Set_Insert(&out_set, key);
+                        Append_Codepoint(mo->series, c);
+                    }
+                }
+
+                if (flags & SOP_FLAG_CHECK)
+                    Codepoint_Set_Free(&other_set);
+
+                goto next_string_pass;
+            }
+
+          blockscope {
             DECLARE_LOCAL (iter);
             Copy_Cell(iter, val1);
 
@@ -257,6 +372,9 @@ REBSER *Make_Set_Operation_Series(
                     Append_String_Limit(mo->series, iter, skip);
                 }
             }
+          }
+
+          next_string_pass:
 
             if (not first_pass)
                 break;
@@ -270,6 +388,9 @@ REBSER *Make_Set_Operation_Series(
             val2 = temp;
         } while (true);
 
+        if (hashed)
+            Codepoint_Set_Free(&out_set);
+
         out_ser = Pop_Molded_String(mo);
     }
     else {
@@ -280,11 +401,55 @@ REBSER *Make_Set_Operation_Series(
         EXPAND_SERIES_TAIL(buf, i);  // ask for at least `i` capacity
         REBLEN buf_at = buf_start_len;
 
+        // With a skip of 1 all the probing is per-byte, so plain 256-entry
+        // membership tables replace the linear rescans.  No case folding:
+        // binary patterns never fold (see Find_Binstr_In_Binstr()).
+        //
+        bool hashed = (skip == 1 and i >= SET_OP_HASH_THRESHOLD);
+
+        Byte seen_table[256];  // bytes already in the output
+        if (hashed)
+            memset(seen_table, 0, sizeof(seen_table));
+
         do {
             // Note: val1 and val2 swapped 2nd pass!
             //
             Binary(const*) bin = VAL_BINARY(val1);
 
+            if (hashed) {
+                Byte other_table[256];
+                if (flags & SOP_FLAG_CHECK) {
+                    memset(other_table, 0, sizeof(other_table));
+                    Size size2;
+                    const Byte* bp2 = VAL_BINARY_SIZE_AT(&size2, val2);
+                    Size n;
+                    for (n = 0; n < size2; ++n)
+                        other_table[bp2[n]] = 1;
+                }
+
+                Size size1;
+                const Byte* bp1 = VAL_BINARY_SIZE_AT(&size1, val1);
+                Size n;
+                for (n = 0; n < size1; ++n) {
+                    Byte b = bp1[n];
+                    if (flags & SOP_FLAG_CHECK) {
+                        h = other_table[b];
+                        if (flags & SOP_FLAG_INVERT) h = !h;
+                    }
+                    if (!h) continue;
+
+                    if (not seen_table[b]) {
+                        seen_table[b] = 1;
+                        EXPAND_SERIES_TAIL(buf, 1);
+                        *BIN_AT(buf, buf_at) = b;
+                        ++buf_at;
+                    }
+                }
+
+                goto next_binary_pass;
+            }
+
+          blockscope {
             // Iterate over first series
             //
             DECLARE_LOCAL (iter);
@@ -340,6 +505,9 @@ REBSER *Make_Set_Operation_Series(
                     buf_at += min;
                 }
             }
+          }
+
+          next_binary_pass:
 
             if (not first_pass)
                 break;
@@ -1012,3 +1012,87 @@ DECLARE_NATIVE(invalid_utf8_q)
 
     return nullptr;  // no invalid byte found
 }
+
+
+// Walks the data deeply; see DEDUPLICATE-STRINGS for the interning rules.
+//
+static void Deduplicate_Strings_Core(
+    Cell(*) head,
+    Cell(const*) tail,
+    Size limit
+){
+    Cell(*) item = head;
+    for (; item != tail; ++item) {
+        if (ANY_ARRAY(item)) {
+            Cell(const*) sub_tail;
+            Cell(*) sub = VAL_ARRAY_AT_ENSURE_MUTABLE(&sub_tail, item);
+            Deduplicate_Strings_Core(sub, sub_tail, limit);
+            continue;
+        }
+
+        if (not IS_TEXT(item))
+            continue;  // quoted/decorated forms are left alone
+
+        if (VAL_INDEX(item) != 0)
+            continue;  // positioned value; head data still matters to it
+
+        String(const*) s = VAL_STRING(item);
+        if (not IS_NONSYMBOL_STRING(s))
+            continue;  // already aliasing an interned symbol
+
+        Size size = STR_SIZE(s);
+        if (size == 0 or size > limit)
+            continue;
+
+        bool newline = Get_Cell_Flag(item, NEWLINE_BEFORE);
+
+        Init_Any_String(
+            item,
+            REB_TEXT,
+            Intern_UTF8_Managed(STR_HEAD(s), size)
+        );
+
+        if (newline)
+            Set_Cell_Flag(item, NEWLINE_BEFORE);
+    }
+}
+
+
+//
+//  deduplicate-strings: native [
+//
+//  {Replace duplicate TEXT!s in a block with shared immutable instances}
+//
+//      return: "The same block (modified deeply)"
+//          [block!]
+//      block "Loaded data with repeated strings (e.g. record fields)"
+//          [block!]
+//      /limit "Longest string to share, in bytes (default 64)"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(deduplicate_strings)
+//
+// Datasets tend to repeat the same small strings over and over ("ACTIVE",
+// "US", ...), and LOAD gives each occurrence its own series.  This routes
+// them through the same interning table that WORD! spellings use--so all
+// equal instances (case-sensitively) share one frozen stub, and repeated
+// calls share with strings interned by previous loads as well.
+//
+// The shared instances are immutable, like the result of AS TEXT! of a
+// WORD!...hence this is opt-in (see LOAD/DEDUP): attempts to mutate a
+// deduplicated string will error rather than corrupt its siblings.
+//
+// Long strings are rarely duplicates, and interning them would bloat the
+// symbol table for no savings--hence the length threshold.
+{
+    INCLUDE_PARAMS_OF_DEDUPLICATE_STRINGS;
+
+    Size limit = REF(limit) ? Int32s(ARG(limit), 1) : 64;
+
+    Cell(const*) tail;
+    Cell(*) at = VAL_ARRAY_AT_ENSURE_MUTABLE(&tail, ARG(block));
+    Deduplicate_Strings_Core(at, tail, limit);
+
+    return COPY(ARG(block));
+}
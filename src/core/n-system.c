@@ -114,6 +114,15 @@ DECLARE_NATIVE(exit_rebol)
 //      /on "Enable auto-recycling"
 //      /ballast "Trigger for auto-recycle (memory used)"
 //          [integer!]
+//      /adaptive "Percent the live heap may grow between recycles (0 = fixed)"
+//          [integer!]
+//      /max-heap "Soft heap ceiling in bytes, collects eagerly above it"
+//          [integer!]
+//      /incremental "Sweep N pool segments per signal checkpoint (0 = atomic)"
+//          [integer!]
+//      /deferred "Decay N dead stubs per signal checkpoint (0 = free in sweep)"
+//          [integer!]
+//      /compact "Migrate series data off nearly-empty pool segments, releasing them"
 //      /torture "Constant recycle (for internal debugging)"
 //      /watch "Monitor recycling (debug only)"
 //      /verbose "Dump information about series being recycled (debug only)"
@@ -138,6 +147,44 @@ DECLARE_NATIVE(recycle)
         TG_Ballast = TG_Max_Ballast;
     }
 
+    if (REF(adaptive)) {
+        //
+        // Scales the allocation budget to the heap that survives each
+        // recycle, instead of the fixed ballast.  See Update_GC_Pacing().
+        //
+        if (VAL_INT32(ARG(adaptive)) < 0)
+            fail (PARAM(adaptive));
+        TG_GC_Growth_Pct = VAL_INT32(ARG(adaptive));
+    }
+
+    if (REF(max_heap)) {
+        if (VAL_INT64(ARG(max_heap)) < 0)
+            fail (PARAM(max_heap));
+        TG_GC_Max_Heap = VAL_INT64(ARG(max_heap));
+    }
+
+    if (REF(incremental)) {
+        //
+        // Bounds the sweep pause: marking still happens atomically, but the
+        // sweep resumes in slices at signal checkpoints.  See %m-gc.c.
+        //
+        if (VAL_INT32(ARG(incremental)) < 0)
+            fail (PARAM(incremental));
+        PG_GC_Sweep_Slice = VAL_INT32(ARG(incremental));
+    }
+
+    if (REF(deferred)) {
+        //
+        // Splits the other half of the sweep pause off: dead stubs are only
+        // unlinked onto a pending chain during the sweep, with the data
+        // freeing done in checkpoint batches.  See Maintain_Pending_Decay()
+        // in %m-pools.c.
+        //
+        if (VAL_INT32(ARG(deferred)) < 0)
+            fail (PARAM(deferred));
+        PG_GC_Decay_Batch = VAL_INT32(ARG(deferred));
+    }
+
     if (REF(torture)) {
         GC_Disabled = false;
         TG_Ballast = 0;
@@ -173,6 +220,20 @@ DECLARE_NATIVE(recycle)
         count = Recycle();
     }
 
+    if (REF(compact)) {
+        //
+        // Dead series must have given their data back before segments can
+        // be judged nearly-empty, so drain any sweep slices the recycle
+        // above left outstanding (see RECYCLE/INCREMENTAL).
+        //
+        if (GC_Sweep_Pending)
+            Sweep_Series_Slice(0);
+        if (GC_Decay_Pending != nullptr)
+            Maintain_Pending_Decay(0);  // ...same for deferred decay batches
+
+        Compact_Data_Pools();  // see %m-pools.c
+    }
+
     if (REF(watch)) {
       #if defined(NDEBUG)
         fail (Error_Debug_Only_Raw());
@@ -189,6 +250,404 @@ DECLARE_NATIVE(recycle)
 }
 
 
+//
+//  reserve-symbols: native [
+//
+//  "Pre-size the symbol table for an expected number of distinct words"
+//
+//      return: "Number of hash slots now allocated"
+//          [integer!]
+//      count "Anticipated new symbols (e.g. before a symbol-rich LOAD)"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(reserve_symbols)
+//
+// Interning grows the symbol hash table on demand, rehashing every canon
+// symbol each time it steps up a size.  Loaders that know roughly how many
+// unique words they are about to create can declare the count and take one
+// rehash up front instead of a sequence of stalls mid-LOAD.
+{
+    INCLUDE_PARAMS_OF_RESERVE_SYMBOLS;
+
+    REBI64 count = VAL_INT64(ARG(count));
+    if (count < 0)
+        fail (PARAM(count));
+
+    Reserve_Symbol_Table(cast(REBLEN, count));
+
+    return Init_Integer(OUT, SER_USED(PG_Symbols_By_Hash));
+}
+
+
+//=//// ACTION INVOCATION PROFILING ///////////////////////////////////////=//
+//
+// Knowing which functions run the most is the first step of any tiered
+// execution strategy: the counts say which bodies are worth hand-compiling
+// to C (the TCC extension's "user natives" can then take over dispatch of
+// the top offenders).  Counting is off by default; Begin_Action_Core()
+// checks a single global flag, so the cost when disabled is one branch.
+//
+// The counts live in a BLOCK! of alternating ACTION! and INTEGER! cells,
+// referenced by an API handle of indefinite lifetime--which both protects
+// the block from garbage collection and keeps the counted actions alive so
+// their identities stay valid.  A small open-addressed table on the side
+// maps action identities to block positions, since bumping a count on every
+// invocation can't afford a linear search.
+//
+
+typedef struct {
+    Action(*) action;
+    REBLEN index;  // position of the action's cell in the counts block
+} ActionCountSlot;
+
+static ActionCountSlot *Action_Count_Slots = nullptr;
+static REBLEN Action_Count_Capacity = 0;  // always a power of two
+static REBLEN Action_Count_Used = 0;
+
+static Array(*) Action_Count_Array = nullptr;
+static REBVAL *Action_Count_Block = nullptr;  // root handle marking the array
+
+static ActionCountSlot *Probe_Action_Count_Slot(Action(*) a) {
+    uintptr_t hash = cast(uintptr_t, cast(void*, a)) >> 4;  // pool-aligned
+    REBLEN n = hash & (Action_Count_Capacity - 1);
+    while (
+        Action_Count_Slots[n].action != nullptr
+        and Action_Count_Slots[n].action != a
+    ){
+        n = (n + 1) & (Action_Count_Capacity - 1);
+    }
+    return &Action_Count_Slots[n];
+}
+
+static void Expand_Action_Count_Slots(void) {
+    ActionCountSlot *old_slots = Action_Count_Slots;
+    REBLEN old_capacity = Action_Count_Capacity;
+
+    Action_Count_Capacity = (old_capacity == 0) ? 256 : old_capacity * 2;
+    Action_Count_Slots = TRY_ALLOC_N_ZEROFILL(
+        ActionCountSlot, Action_Count_Capacity
+    );
+    if (Action_Count_Slots == nullptr)
+        fail (Error_No_Memory(
+            Action_Count_Capacity * sizeof(ActionCountSlot)
+        ));
+
+    REBLEN n;
+    for (n = 0; n < old_capacity; ++n) {
+        if (old_slots[n].action == nullptr)
+            continue;
+        *Probe_Action_Count_Slot(old_slots[n].action) = old_slots[n];
+    }
+    if (old_slots != nullptr)
+        FREE_N(ActionCountSlot, old_capacity, old_slots);
+}
+
+//
+//  Discard_Action_Counts: C
+//
+// Stops any counting and frees the gathered data.  Also called by
+// Shutdown_Core(), since the counts block is a GC root that would otherwise
+// be reported as a leak.
+//
+void Discard_Action_Counts(void)
+{
+    PG_Counting_Actions = false;
+
+    if (Action_Count_Slots != nullptr) {
+        FREE_N(ActionCountSlot, Action_Count_Capacity, Action_Count_Slots);
+        Action_Count_Slots = nullptr;
+    }
+    Action_Count_Capacity = 0;
+    Action_Count_Used = 0;
+
+    if (Action_Count_Block != nullptr) {
+        rebRelease(Action_Count_Block);
+        Action_Count_Block = nullptr;
+        Action_Count_Array = nullptr;
+    }
+}
+
+
+//
+//  Count_Action_Invocation: C
+//
+// Called by Begin_Action_Core() when PG_Counting_Actions is enabled.
+//
+void Count_Action_Invocation(Action(*) a)
+{
+    if (Action_Count_Used * 2 >= Action_Count_Capacity)
+        Expand_Action_Count_Slots();
+
+    ActionCountSlot *slot = Probe_Action_Count_Slot(a);
+    if (slot->action == nullptr) {
+        slot->action = a;
+        slot->index = ARR_LEN(Action_Count_Array);
+        ++Action_Count_Used;
+
+        Append_Value(Action_Count_Array, ACT_ARCHETYPE(a));
+        Init_Integer(Alloc_Tail_Array(Action_Count_Array), 1);
+    }
+    else
+        ++VAL_INT64(ARR_AT(Action_Count_Array, slot->index + 1));
+}
+
+
+//
+//  profile-actions: native [
+//
+//  "Count action invocations, to find hot spots worth compiling to C"
+//
+//      return: "Block of [action count ...] pairs gathered so far"
+//          [<opt> block!]
+//      /on "Discard any previous counts and start gathering"
+//      /off "Stop gathering and free the counts (after returning them)"
+//  ]
+//
+DECLARE_NATIVE(profile_actions)
+//
+// A typical profiling session brackets a workload:
+//
+//     profile-actions/on
+//     ...workload...
+//     counts: profile-actions/off
+//     sort/skip/compare/reverse counts 2 2
+//
+// Calling with no refinement peeks at the counts without stopping.  The top
+// offenders are candidates for rewriting as TCC user natives (or ordinary
+// C natives), which swaps their dispatcher for compiled code.
+{
+    INCLUDE_PARAMS_OF_PROFILE_ACTIONS;
+
+    if (REF(on)) {
+        if (REF(off))
+            fail ("PROFILE-ACTIONS asked to turn /ON and /OFF at once");
+
+        Discard_Action_Counts();
+
+        Action_Count_Array = Make_Array_Core(64 * 2, NODE_FLAG_MANAGED);
+        Action_Count_Block = Init_Block(Alloc_Value(), Action_Count_Array);
+
+        Array(*) single = Singular_From_Cell(Action_Count_Block);
+        CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+        Unlink_Api_Handle_From_Frame(single);  // this frame (a GC root)
+
+        PG_Counting_Actions = true;
+        return nullptr;  // no counts yet
+    }
+
+    if (Action_Count_Block == nullptr) {
+        if (REF(off))
+            fail ("PROFILE-ACTIONS/OFF without a prior PROFILE-ACTIONS/ON");
+        return nullptr;  // never started, nothing to report
+    }
+
+    Init_Block(OUT, Copy_Array_Shallow_Flags(
+        Action_Count_Array, SPECIFIED, NODE_FLAG_MANAGED
+    ));
+
+    if (REF(off))
+        Discard_Action_Counts();
+
+    return OUT;
+}
+
+
+//=//// BRANCH HIT PROFILING //////////////////////////////////////////////=//
+//
+// Branch order in hot CASE and SWITCH blocks tends to be tuned by guesswork.
+// Counting which branches actually run lets the common clauses be moved to
+// the front on evidence instead--see REORDER-BY-PROFILE in %mezz-debug.r
+// for turning a gathered profile into a reordered clause block.
+//
+// The machinery mirrors the action counting above: one global flag checked
+// at each match (so the disabled cost is a single branch), counts kept as
+// alternating pairs in a GC-rooted BLOCK!, and a side table for finding a
+// count's cell without a linear search.  Each pair's first element is the
+// cases block *positioned at the branch that ran*, so a report shows both
+// which block it was and which clause within it (INDEX OF recovers the
+// offset).
+//
+
+typedef struct {
+    Array(const*) array;
+    REBLEN branch;  // offset of the branch cell in the cases array
+    REBLEN index;  // position of this branch's pair in the counts block
+} BranchCountSlot;
+
+static BranchCountSlot *Branch_Count_Slots = nullptr;
+static REBLEN Branch_Count_Capacity = 0;  // always a power of two
+static REBLEN Branch_Count_Used = 0;
+
+static Array(*) Branch_Count_Array = nullptr;
+static REBVAL *Branch_Count_Block = nullptr;  // root handle marking the array
+
+static BranchCountSlot *Probe_Branch_Count_Slot(
+    Array(const*) a,
+    REBLEN branch
+){
+    uintptr_t hash = (cast(uintptr_t, cast(const void*, a)) >> 4) + branch;
+    REBLEN n = hash & (Branch_Count_Capacity - 1);
+    while (
+        Branch_Count_Slots[n].array != nullptr
+        and not (
+            Branch_Count_Slots[n].array == a
+            and Branch_Count_Slots[n].branch == branch
+        )
+    ){
+        n = (n + 1) & (Branch_Count_Capacity - 1);
+    }
+    return &Branch_Count_Slots[n];
+}
+
+static void Expand_Branch_Count_Slots(void) {
+    BranchCountSlot *old_slots = Branch_Count_Slots;
+    REBLEN old_capacity = Branch_Count_Capacity;
+
+    Branch_Count_Capacity = (old_capacity == 0) ? 256 : old_capacity * 2;
+    Branch_Count_Slots = TRY_ALLOC_N_ZEROFILL(
+        BranchCountSlot, Branch_Count_Capacity
+    );
+    if (Branch_Count_Slots == nullptr)
+        fail (Error_No_Memory(
+            Branch_Count_Capacity * sizeof(BranchCountSlot)
+        ));
+
+    REBLEN n;
+    for (n = 0; n < old_capacity; ++n) {
+        if (old_slots[n].array == nullptr)
+            continue;
+        *Probe_Branch_Count_Slot(
+            old_slots[n].array, old_slots[n].branch
+        ) = old_slots[n];
+    }
+    if (old_slots != nullptr)
+        FREE_N(BranchCountSlot, old_capacity, old_slots);
+}
+
+//
+//  Discard_Branch_Counts: C
+//
+// Stops any counting and frees the gathered data.  Also called by
+// Shutdown_Core(), since the counts block is a GC root that would otherwise
+// be reported as a leak.
+//
+void Discard_Branch_Counts(void)
+{
+    PG_Counting_Branches = false;
+
+    if (Branch_Count_Slots != nullptr) {
+        FREE_N(BranchCountSlot, Branch_Count_Capacity, Branch_Count_Slots);
+        Branch_Count_Slots = nullptr;
+    }
+    Branch_Count_Capacity = 0;
+    Branch_Count_Used = 0;
+
+    if (Branch_Count_Block != nullptr) {
+        rebRelease(Branch_Count_Block);
+        Branch_Count_Block = nullptr;
+        Branch_Count_Array = nullptr;
+    }
+}
+
+//
+//  Count_Branch_Hit: C
+//
+// Called by CASE and SWITCH when PG_Counting_Branches is enabled, with the
+// cell of the branch about to run.  Only branches whose cells live in the
+// cases array itself get counted: feeds over blocks serve cells straight
+// from the array, so that covers ordinary use, and anything else (e.g. an
+// API va_list feed) can't be attributed to a clause position anyway.
+//
+void Count_Branch_Hit(Array(const*) a, Cell(const*) branch_cell)
+{
+    Array(*) arr = m_cast(Array(*), a);  // only needed for cell positioning
+
+    if (branch_cell < ARR_HEAD(arr) or branch_cell >= ARR_TAIL(arr))
+        return;  // can't attribute the hit to a position
+
+    REBLEN branch = branch_cell - ARR_HEAD(arr);
+
+    if (Branch_Count_Used * 2 >= Branch_Count_Capacity)
+        Expand_Branch_Count_Slots();
+
+    BranchCountSlot *slot = Probe_Branch_Count_Slot(a, branch);
+    if (slot->array == nullptr) {
+        slot->array = a;
+        slot->branch = branch;
+        slot->index = ARR_LEN(Branch_Count_Array);
+        ++Branch_Count_Used;
+
+        Init_Array_Cell_At(
+            Alloc_Tail_Array(Branch_Count_Array), REB_BLOCK, arr, branch
+        );
+        Init_Integer(Alloc_Tail_Array(Branch_Count_Array), 1);
+    }
+    else
+        ++VAL_INT64(ARR_AT(Branch_Count_Array, slot->index + 1));
+}
+
+
+//
+//  profile-branches: native [
+//
+//  "Count CASE/SWITCH branch hits, to order hot clauses first on evidence"
+//
+//      return: "Block of [branch count ...] pairs gathered so far"
+//          [<opt> block!]
+//      /on "Discard any previous counts and start gathering"
+//      /off "Stop gathering and free the counts (after returning them)"
+//  ]
+//
+DECLARE_NATIVE(profile_branches)
+//
+// A session brackets a workload the same way PROFILE-ACTIONS does:
+//
+//     profile-branches/on
+//     ...workload...
+//     counts: profile-branches/off
+//
+// Each "branch" in the result is the cases block positioned at the branch
+// that ran, so SAME? HEAD OF identifies the block and INDEX OF the clause.
+// REORDER-BY-PROFILE consumes the pairs to produce a reordered copy of a
+// cases block with its hottest clauses first.
+{
+    INCLUDE_PARAMS_OF_PROFILE_BRANCHES;
+
+    if (REF(on)) {
+        if (REF(off))
+            fail ("PROFILE-BRANCHES asked to turn /ON and /OFF at once");
+
+        Discard_Branch_Counts();
+
+        Branch_Count_Array = Make_Array_Core(64 * 2, NODE_FLAG_MANAGED);
+        Branch_Count_Block = Init_Block(Alloc_Value(), Branch_Count_Array);
+
+        Array(*) single = Singular_From_Cell(Branch_Count_Block);
+        CLEAR_SERIES_FLAG(single, MANAGED);  // indefinite lifetime, outlives
+        Unlink_Api_Handle_From_Frame(single);  // this frame (a GC root)
+
+        PG_Counting_Branches = true;
+        return nullptr;  // no counts yet
+    }
+
+    if (Branch_Count_Block == nullptr) {
+        if (REF(off))
+            fail ("PROFILE-BRANCHES/OFF without a prior PROFILE-BRANCHES/ON");
+        return nullptr;  // never started, nothing to report
+    }
+
+    Init_Block(OUT, Copy_Array_Shallow_Flags(
+        Branch_Count_Array, SPECIFIED, NODE_FLAG_MANAGED
+    ));
+
+    if (REF(off))
+        Discard_Branch_Counts();
+
+    return OUT;
+}
+
+
 //
 //  limit-usage: native [
 //
@@ -223,6 +682,357 @@ DECLARE_NATIVE(limit_usage)
 }
 
 
+//
+//  memory-limit: native [
+//
+//  {Query or set memory limits: a hard cap, and a soft watermark with a hook}
+//
+//      return: "Current allocator usage in bytes"
+//          [integer!]
+//      /hard "Bytes at which allocations start failing (0 removes the cap)"
+//          [integer!]
+//      /soft "Watermark whose crossing triggers the hook (0 turns it off)"
+//          [integer!]
+//      /hook "Run with the usage when crossed (BLANK! reverts to recycling)"
+//          [<unrun> action! blank!]
+//  ]
+//
+DECLARE_NATIVE(memory_limit)
+//
+// Under a container memory limit, the first sign of trouble is usually the
+// OOM killer--which gives no chance to react.  The soft watermark moves the
+// warning inside the interpreter: the allocator raises a signal when usage
+// first crosses it (see Did_Trap_Alloc_Limit() in %m-pools.c), and the hook
+// runs at the next evaluator checkpoint--in time to shed caches or log
+// diagnostics before the hard cap (or the container's) is reached.  With no
+// hook configured, the crossing just triggers a recycle.
+//
+// Unlike LIMIT-USAGE--which is part of SECURE and deliberately write-once--
+// these limits are operational tuning, and may be adjusted or removed at
+// any time.
+{
+    INCLUDE_PARAMS_OF_MEMORY_LIMIT;
+
+    if (REF(hard)) {
+        if (VAL_INT64(ARG(hard)) < 0)
+            fail (PARAM(hard));
+        PG_Mem_Limit = VAL_INT64(ARG(hard));
+    }
+
+    if (REF(soft)) {
+        if (VAL_INT64(ARG(soft)) < 0)
+            fail (PARAM(soft));
+        PG_Mem_Soft_Limit = VAL_INT64(ARG(soft));
+
+        // Arm even if usage is already over the new line--a watermark set
+        // below current usage should say so at the next allocation, not
+        // wait for usage to dip under and come back up.
+        //
+        PG_Mem_Watermark_Armed = (PG_Mem_Soft_Limit != 0);
+        Update_Signal_Timer_Demand();  // clearing the soft limit stops ticks
+    }
+
+    if (REF(hook)) {
+        if (PG_Mem_Watermark_Hook) {
+            rebRelease(PG_Mem_Watermark_Hook);
+            PG_Mem_Watermark_Hook = nullptr;
+        }
+        if (IS_ACTION(ARG(hook)))  // root handle protects it from GC
+            PG_Mem_Watermark_Hook = Copy_Cell(Alloc_Value(), ARG(hook));
+    }
+
+    return Init_Integer(OUT, cast(REBI64, PG_Mem_Usage));
+}
+
+
+//
+//  with-eval-budget: native [
+//
+//  {Evaluate a block, failing with a trappable error if a budget runs out}
+//
+//      return: [<opt> <void> any-value!]
+//      budget "Milliseconds of evaluation (rounded up to the signal period)"
+//          [integer!]
+//      body [block!]
+//      /ticks "Budget counts evaluator steps instead of milliseconds"
+//      /memory "Also fail if the body allocates more than this many bytes"
+//          [integer!]
+//  ]
+//
+DECLARE_NATIVE(with_eval_budget)
+//
+// The signal timer in %c-signal.c counts its arms in Eval_Timer_Ticks, so a
+// budget is just a deadline tick recorded in Eval_Slice_Deadline...examined
+// at the same evaluator checkpoint that handles recycles and Ctrl-C.  That
+// keeps enforcement completely out of the evaluator's hot loop, at the cost
+// of granularity (Eval_Signal_Period msec) and of not being able to cut off
+// a native that blocks in C without returning to the trampoline--tradeoffs
+// the sampling profiler in %d-stats.c accepts for the same reason.
+//
+// Budgets nest: an inner budget is clipped so it cannot outlive the outer
+// one.  RUN-TASKS in %mezz-control.r builds a round-robin task scheduler on
+// top of this, trapping the EVAL-BUDGET error to move on to the next task.
+//
+// The /TICKS and /MEMORY variants trade the wall clock for the monotonic
+// counters that METRICS exposes (Total_Eval_Cycles, Total_Alloc_Bytes),
+// which gives deterministic budgets--the same script gets the same answer
+// every run, regardless of machine load.  Expiry is still only noticed at
+// the checkpoint, so the overshoot past the deadline varies; only whether
+// a budget expires is deterministic, not where the script stops.
+//
+// The refinement argument slots double as save locations for the outer
+// deadlines across the continuation (the same trick TRANSCODE uses for its
+// scan state), which is why the restore code below re-tests REF()s that
+// initial entry overwrote with integers.
+{
+    INCLUDE_PARAMS_OF_WITH_EVAL_BUDGET;
+
+    enum {
+        ST_BUDGET_INITIAL_ENTRY = STATE_0,
+        ST_BUDGET_EVALUATING
+    };
+
+    switch (STATE) {
+      case ST_BUDGET_INITIAL_ENTRY: goto initial_entry;
+      case ST_BUDGET_EVALUATING: goto evaluation_finished;
+      default: assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
+    REBI64 amount = VAL_INT64(ARG(budget));
+    if (amount <= 0)
+        fail (PARAM(budget));
+
+    if (REF(ticks)) {
+        REBI64 deadline = Total_Eval_Cycles + amount;
+        if (Eval_Cycles_Deadline != 0 and Eval_Cycles_Deadline < deadline)
+            deadline = Eval_Cycles_Deadline;  // can't outlive outer budget
+
+        Init_Integer(ARG(ticks), Eval_Cycles_Deadline);  // save to restore
+        Eval_Cycles_Deadline = deadline;
+    }
+    else {
+        int_fast32_t ticks = cast(int_fast32_t,
+            (amount + Eval_Signal_Period - 1) / Eval_Signal_Period
+        );
+
+        int_fast32_t deadline = Eval_Timer_Ticks + ticks;
+        if (Eval_Slice_Deadline != 0 and Eval_Slice_Deadline < deadline)
+            deadline = Eval_Slice_Deadline;  // can't outlive outer budget
+
+        Init_Integer(ARG(budget), Eval_Slice_Deadline);  // save to restore
+
+        Eval_Slice_Deadline = deadline;
+    }
+
+    if (REF(memory)) {
+        REBI64 bytes = VAL_INT64(ARG(memory));
+        if (bytes <= 0)
+            fail (PARAM(memory));
+
+        REBI64 deadline = Total_Alloc_Bytes + bytes;
+        if (Alloc_Bytes_Deadline != 0 and Alloc_Bytes_Deadline < deadline)
+            deadline = Alloc_Bytes_Deadline;  // can't outlive outer budget
+
+        Init_Integer(ARG(memory), Alloc_Bytes_Deadline);  // save to restore
+        Alloc_Bytes_Deadline = deadline;
+    }
+
+    Update_Signal_Timer_Demand();  // deadlines need the checkpoint running
+
+    STATE = ST_BUDGET_EVALUATING;
+    return CATCH_CONTINUE(OUT, ARG(body));
+
+} evaluation_finished: {  ////////////////////////////////////////////////////
+
+    // The expiration fail() zeroed the deadline that fired before raising;
+    // on ordinary completion (or an unrelated failure) the armed deadlines
+    // are still this frame's.  Either way the outer frame's saved deadlines
+    // go back.  (The refinement slots hold integer saves now, so the REF()
+    // tests answer "did initial entry arm this dimension".)
+    //
+    if (REF(ticks))
+        Eval_Cycles_Deadline = VAL_INT64(ARG(ticks));
+    else
+        Eval_Slice_Deadline = cast(int_fast32_t, VAL_INT64(ARG(budget)));
+
+    if (REF(memory))
+        Alloc_Bytes_Deadline = VAL_INT64(ARG(memory));
+
+    Update_Signal_Timer_Demand();  // stops the tick if no outer budget
+
+    if (THROWING)
+        return BOUNCE_THROWN;  // includes the budget error itself
+
+    return OUT;
+  }
+}
+
+
+// The malloc'd flag a CANCELLATION-TOKEN handle wraps is freed when the
+// HANDLE! is garbage collected.  Frames never outlive the handle that put
+// the token pointer in their scope: WITH-CANCELLATION keeps the handle in
+// its argument slot for the body's whole evaluation, and Unplug_Stack()
+// strips the pointers from any fragment a YIELD detaches.
+//
+static void Cleanup_Cancel_Token(const REBVAL *v)
+{
+    free(VAL_HANDLE_POINTER(struct Reb_Cancel_Token, v));
+}
+
+// Tokens are plain HANDLE!s, so CANCEL could be handed a handle to anything;
+// the cleaner doubles as a brand to catch mixups.
+//
+static struct Reb_Cancel_Token *Cancel_Token_From_Handle(const REBVAL *v)
+{
+    if (VAL_HANDLE_CLEANER(v) != &Cleanup_Cancel_Token)
+        fail ("HANDLE! is not a CANCELLATION-TOKEN");
+
+    return VAL_HANDLE_POINTER(struct Reb_Cancel_Token, v);
+}
+
+
+//
+//  cancellation-token: native [
+//
+//  {Make a token for cancelling evaluations (see WITH-CANCELLATION, CANCEL)}
+//
+//      return: [handle!]
+//  ]
+//
+DECLARE_NATIVE(cancellation_token)
+{
+    INCLUDE_PARAMS_OF_CANCELLATION_TOKEN;
+
+    struct Reb_Cancel_Token *token = cast(struct Reb_Cancel_Token*,
+        malloc(sizeof(struct Reb_Cancel_Token))
+    );
+    if (token == nullptr)
+        fail (Error_No_Memory(sizeof(struct Reb_Cancel_Token)));
+
+    token->requested = false;
+
+    return Init_Handle_Cdata_Managed(
+        OUT,
+        token,
+        sizeof(struct Reb_Cancel_Token),
+        &Cleanup_Cancel_Token
+    );
+}
+
+
+//
+//  cancel: native [
+//
+//  {Ask evaluations under a token's scope to stop at their next eval step}
+//
+//      return: <none>
+//      token [handle!]
+//  ]
+//
+DECLARE_NATIVE(cancel)
+//
+// Setting the flag is all there is to it--the trampoline tests it on each
+// bounce for frames inside the token's scope, and raises the trappable
+// CANCELLED error there.  Safe to call from outside the interpreter (e.g.
+// another thread's timeout watchdog holding the handle), and idempotent:
+// cancelling an already-cancelled or never-scoped token just leaves the
+// flag set for whoever scopes it next.
+{
+    INCLUDE_PARAMS_OF_CANCEL;
+
+    struct Reb_Cancel_Token *token = Cancel_Token_From_Handle(ARG(token));
+    token->requested = true;
+
+    return NONE;
+}
+
+
+//
+//  cancelled?: native [
+//
+//  {Has CANCEL been called on a token?}
+//
+//      return: [logic!]
+//      token [handle!]
+//  ]
+//
+DECLARE_NATIVE(cancelled_q)
+//
+// Lets cooperative code inside a scope poll without tripping the trampoline
+// check (useful for cleanup stretches wrapped in SYS.UTIL.RESCUE), and lets
+// the scope's creator distinguish a cancellation from ordinary completion.
+{
+    INCLUDE_PARAMS_OF_CANCELLED_Q;
+
+    struct Reb_Cancel_Token *token = Cancel_Token_From_Handle(ARG(token));
+
+    return Init_Logic(OUT, token->requested);
+}
+
+
+//
+//  with-cancellation: native [
+//
+//  {Evaluate a block which CANCEL of the given token can interrupt}
+//
+//      return: [<opt> <void> any-value!]
+//      token [handle!]
+//      body [block!]
+//  ]
+//
+DECLARE_NATIVE(with_cancellation)
+//
+// WITH-EVAL-BUDGET bounds how *much* a workload may run; this bounds *who
+// may stop it*.  A multi-tenant host gives each request a token, runs the
+// request under it, and can then abandon one request--from a watchdog, an
+// admin console, or the client hanging up--without HALT's collateral damage
+// to every other request in the interpreter.
+//
+// The native points its own frame at the token; every frame pushed while the
+// body runs inherits the pointer (see Push_Frame()), so the scope is the
+// dynamic extent of the body--including code reached through API calls made
+// by natives within it.  Cancellation raises the CANCELLED error at the next
+// trampoline bounce: sub-millisecond latency, and the steady-state cost on
+// unscoped code is one pointer test per bounce.
+//
+// The error is trappable, but not suppressible from inside its own scope: a
+// SYS.UTIL.RESCUE within the body catches one raise only for the still-set
+// token to raise again on the following bounce.  Only unwinding past this
+// frame escapes the token's reach.
+{
+    INCLUDE_PARAMS_OF_WITH_CANCELLATION;
+
+    enum {
+        ST_CANCELLATION_INITIAL_ENTRY = STATE_0,
+        ST_CANCELLATION_EVALUATING
+    };
+
+    switch (STATE) {
+      case ST_CANCELLATION_INITIAL_ENTRY: goto initial_entry;
+      case ST_CANCELLATION_EVALUATING: goto evaluation_finished;
+      default: assert(false);
+    }
+
+  initial_entry: {  //////////////////////////////////////////////////////////
+
+    // Not DELEGATE: delegation reclaims this frame's argument storage, but
+    // the ARG(token) slot is what keeps the token's HANDLE! live (and the
+    // malloc'd flag unfreed) for the whole evaluation.
+    //
+    frame_->cancel_token = Cancel_Token_From_Handle(ARG(token));
+
+    STATE = ST_CANCELLATION_EVALUATING;
+    return CONTINUE(OUT, ARG(body));
+
+} evaluation_finished: {  ////////////////////////////////////////////////////
+
+    return OUT;  // frame drop ends the scope (throws never call back here)
+  }
+}
+
+
 //
 //  check: native [
 //
@@ -22,6 +22,8 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 
+#include <time.h>  // time() and clock() stirred into PG_Hash_Seed at startup
+
 #include "sys-core.h"
 
 #include "datatypes/sys-money.h" // !!! Needed for hash (should be a method?)
@@ -31,6 +33,77 @@
 const z_crc_t *crc32_table; // pointer to the zlib CRC32 table
 
 
+//=//// MULTIPLICATIVE HASH MIXING ////////////////////////////////////////=//
+//
+// Internal hashes (symbol interning, MAP! hashlists) used to be computed
+// with a byte-at-a-time walk of the zlib CRC32 table: four dependent table
+// loads per byte...and the caseless hashers fed all four bytes of each
+// codepoint through it, mostly zeros for ASCII.  Nothing outside the process
+// ever sees these hash values, so there's no compatibility reason to pay
+// for CRC--any mixing with good distribution will do.
+//
+// These are the multiplicative constants and the finalizing avalanche from
+// xxHash32 (public domain), which needs only a multiply and a rotate per
+// lane and is measurably faster on hash-heavy map building.
+//
+// Note CRC is still used where the actual CRC32 function matters (e.g.
+// CHECKSUM goes through zlib's crc32_z()), and the table still seasons the
+// type byte in Hash_Value().
+//
+
+#define HASH_PRIME_1  0x9E3779B1u
+#define HASH_PRIME_2  0x85EBCA77u
+#define HASH_PRIME_3  0xC2B2AE3Du
+#define HASH_PRIME_4  0x27D4EB2Fu
+#define HASH_PRIME_5  0x165667B1u
+
+inline static uint32_t Hash_Mix(uint32_t hash, uint32_t lane) {
+    hash += lane * HASH_PRIME_3;
+    hash = ((hash << 17) | (hash >> 15)) * HASH_PRIME_4;  // rotate left 17
+    return hash;
+}
+
+inline static uint32_t Hash_Final(uint32_t hash) {
+    hash ^= hash >> 15;
+    hash *= HASH_PRIME_2;
+    hash ^= hash >> 13;
+    hash *= HASH_PRIME_3;
+    hash ^= hash >> 16;
+    return hash;
+}
+
+
+// The byte-walking hashers take their starting basis as a parameter.  The
+// interning hashes must start from the fixed HASH_PRIME_5 basis, because
+// %make-boot.r precomputes symbol hashes at build time with that basis (and
+// Intern_UTF8_Managed_Core() asserts the runtime agrees).  MAP! keys instead
+// start from a basis folded with the per-process PG_Hash_Seed, so keys that
+// collide can't be computed before the process exists--see Hash_Value().
+//
+static uint32_t Hash_Bytes_Core(const Byte* data, REBLEN len, uint32_t basis)
+{
+    uint32_t hash = cast(uint32_t, len) + basis;
+
+    // Process a 32-bit lane at a time.  memcpy() handles alignment and
+    // optimizes to a plain load; native byte order is fine since these
+    // hashes never leave the process.
+    //
+    REBLEN n = 0;
+    for (; n + 4 <= len; n += 4) {
+        uint32_t lane;
+        memcpy(&lane, data + n, 4);
+        hash = Hash_Mix(hash, lane);
+    }
+
+    for (; n != len; ++n) {  // 0-3 remaining bytes
+        hash += data[n] * HASH_PRIME_5;
+        hash = ((hash << 11) | (hash >> 21)) * HASH_PRIME_1;
+    }
+
+    return Hash_Final(hash);
+}
+
+
 //
 //  Hash_UTF8: C
 //
@@ -42,7 +115,36 @@ const z_crc_t *crc32_table; // pointer to the zlib CRC32 table
 //
 uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const Byte* utf8, Size size)
 {
-    uint32_t crc = 0x00000000;
+    uint32_t hash = HASH_PRIME_5;
+
+    // One mixing round per lowercased codepoint.  This must agree with
+    // Hash_UTF8_Len_Caseless() so synonyms hash identically no matter which
+    // entry point computed the hash.
+    //
+    while (size >= UTF8_SWAR_CHUNK) {
+        //
+        // ASCII runs dominate typical keys; folding a machine word at a
+        // time skips both the decode and the per-codepoint table lookup.
+        // The mixing order stays byte-for-byte the same as the loop below,
+        // so the hash value is unaffected.
+        //
+        uintptr_t chunk;
+        memcpy(&chunk, utf8, sizeof(chunk));
+        if (chunk & SWAR_HIGHS)
+            break;  // non-ASCII (or invalid) byte, take the checked path
+
+        chunk = Ascii_Chunk_Lowercase(chunk);
+
+        Byte folded[UTF8_SWAR_CHUNK];  // memory order, endian-agnostic
+        memcpy(folded, &chunk, sizeof(chunk));
+
+        REBLEN i;
+        for (i = 0; i < UTF8_SWAR_CHUNK; ++i)
+            hash = Hash_Mix(hash, folded[i]);
+
+        utf8 += UTF8_SWAR_CHUNK;
+        size -= UTF8_SWAR_CHUNK;
+    }
 
     for (; size != 0; ++utf8, --size) {
         Codepoint c = *utf8;
@@ -53,19 +155,53 @@ uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const Byte* utf8, Size size)
                 fail (Error_Bad_Utf8_Raw());
         }
 
-        c = LO_CASE(c);
+        hash = Hash_Mix(hash, LO_CASE(c));
+    }
+
+    return Hash_Final(hash);
+}
+
+
+static uint32_t Hash_UTF8_Len_Caseless_Core(
+    Utf8(const*) cp,
+    REBLEN len,
+    uint32_t basis  // fixed for interning, seeded for MAP! keys (see above)
+){
+    uint32_t hash = basis;
 
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
+    while (len >= UTF8_SWAR_CHUNK) {
         //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
+        // An ASCII chunk is one codepoint per byte, so a machine word's
+        // worth can be folded and mixed without decoding.  Must mix in the
+        // same byte order as the loop below (and as the scanning version).
+        //
+        uintptr_t chunk;
+        memcpy(&chunk, cp, sizeof(chunk));
+        if (chunk & SWAR_HIGHS)
+            break;  // non-ASCII byte somewhere in the chunk, decode instead
+
+        chunk = Ascii_Chunk_Lowercase(chunk);
+
+        Byte folded[UTF8_SWAR_CHUNK];  // memory order, endian-agnostic
+        memcpy(folded, &chunk, sizeof(chunk));
+
+        REBLEN i;
+        for (i = 0; i < UTF8_SWAR_CHUNK; ++i)
+            hash = Hash_Mix(hash, folded[i]);
+
+        cp = cast(Utf8(const*), cast(const Byte*, cp) + UTF8_SWAR_CHUNK);
+        len -= UTF8_SWAR_CHUNK;
     }
 
-    return ~crc;
+    REBLEN n;
+    for (n = 0; n < len; n++) {
+        Codepoint c;
+        cp = NEXT_CHR(&c, cp);
+
+        hash = Hash_Mix(hash, LO_CASE(c));  // consistent w/scanning version
+    }
+
+    return Hash_Final(hash);
 }
 
 
@@ -82,26 +218,7 @@ uint32_t Hash_Scan_UTF8_Caseless_May_Fail(const Byte* utf8, Size size)
 // codepoint for the lowercase operation.
 //
 uint32_t Hash_UTF8_Len_Caseless(Utf8(const*) cp, REBLEN len) {
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n < len; n++) {
-        Codepoint c;
-        cp = NEXT_CHR(&c, cp);
-
-        c = LO_CASE(c);
-
-        // !!! This takes into account all 4 bytes of the lowercase codepoint
-        // for the CRC calculation.  In ASCII strings this will involve a lot
-        // of zeros.  Review if there's a better way.
-        //
-        crc = (crc >> 8) ^ crc32_table[(crc ^ c) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 8)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 16)) & 0xff];
-        crc = (crc >> 8) ^ crc32_table[(crc ^ (c >> 24)) & 0xff];
-    }
-
-    return ~crc;
+    return Hash_UTF8_Len_Caseless_Core(cp, len, HASH_PRIME_5);
 }
 
 
@@ -113,6 +230,13 @@ uint32_t Hash_UTF8_Len_Caseless(Utf8(const*) cp, REBLEN len) {
 // Fails if datatype cannot be hashed.  Note that the specifier is not used
 // in hashing, because it is not used in comparisons either.
 //
+// Key types whose bit patterns can be chosen wholesale by external input
+// (numbers, strings, binaries) fold in the per-process PG_Hash_Seed, so an
+// adversary can't precompute MAP! keys that collide and mail them in to
+// degrade a service's maps to linear scans.  Types hashed by identity can't
+// be forged from input, and words hash by their interning hash--which must
+// stay deterministic, since %make-boot.r bakes it into the build.
+//
 uint32_t Hash_Value(Cell(const*) cell)
 {
     enum Reb_Kind heart = CELL_HEART(cell);
@@ -133,13 +257,22 @@ uint32_t Hash_Value(Cell(const*) cell)
         // bits collapses -1 with 0 etc.  (If your key k is |k| < 2^32 high
         // bits are 0-informative." -Giulio
         //
-        hash = cast(uint32_t, VAL_INT64(cell));
+        // Mixing the halves as separate seeded lanes keeps both informative
+        // while making collisions depend on the per-process key.
+        //
+        hash = Hash_Final(Hash_Mix(
+            Hash_Mix(PG_Hash_Seed, cast(uint32_t, VAL_INT64(cell))),
+            cast(uint32_t, cast(uint64_t, VAL_INT64(cell)) >> 32)
+        ));
         break;
 
       case REB_DECIMAL:
       case REB_PERCENT:
         // depends on INT64 sharing the DEC64 bits
-        hash = (VAL_INT64(cell) >> 32) ^ (VAL_INT64(cell));
+        hash = Hash_Final(Hash_Mix(
+            Hash_Mix(PG_Hash_Seed, cast(uint32_t, VAL_INT64(cell))),
+            cast(uint32_t, cast(uint64_t, VAL_INT64(cell)) >> 32)
+        ));
         break;
 
       case REB_MONEY: {
@@ -178,7 +311,7 @@ uint32_t Hash_Value(Cell(const*) cell)
       case REB_BINARY: {
         Size size;
         const Byte* data = VAL_BINARY_SIZE_AT(&size, cell);
-        hash = Hash_Bytes(data, size);
+        hash = Hash_Bytes_Core(data, size, HASH_PRIME_5 + PG_Hash_Seed);
         break; }
 
       case REB_TEXT:
@@ -189,7 +322,9 @@ uint32_t Hash_Value(Cell(const*) cell)
       case REB_ISSUE: {  // ISSUE! may or may not have CELL_FLAG_ISSUE_HAS_NODE
         REBLEN len;
         Utf8(const*) utf8 = VAL_UTF8_LEN_SIZE_AT(&len, nullptr, cell);
-        hash = Hash_UTF8_Len_Caseless(utf8, len);
+        hash = Hash_UTF8_Len_Caseless_Core(
+            utf8, len, HASH_PRIME_5 + PG_Hash_Seed
+        );
         break; }
 
       case REB_TUPLE:
@@ -206,9 +341,10 @@ uint32_t Hash_Value(Cell(const*) cell)
       case REB_META_PATH:
       case REB_TYPE_PATH: {
         if (Not_Cell_Flag(cell, SEQUENCE_HAS_NODE)) {
-            hash = Hash_Bytes(
+            hash = Hash_Bytes_Core(
                 PAYLOAD(Bytes, cell).at_least_8 + 1,
-                PAYLOAD(Bytes, cell).at_least_8[IDX_SEQUENCE_USED]
+                PAYLOAD(Bytes, cell).at_least_8[IDX_SEQUENCE_USED],
+                HASH_PRIME_5 + PG_Hash_Seed
             );
             break;
         }
@@ -285,6 +421,11 @@ uint32_t Hash_Value(Cell(const*) cell)
         // !!! Should this hash be cached on the words somehow, e.g. in the
         // data payload before the actual string?
         //
+        // (This is the interning hash, which can't be seeded.  Degrading a
+        // map with colliding words would mean interning every one of them,
+        // which strains the symbol table long before the map suffers--and
+        // the probe monitoring in Find_Key_Hashed() flags it regardless.)
+        //
         hash = Hash_String(VAL_WORD_SYMBOL(cell));
         break; }
 
@@ -349,8 +490,9 @@ uint32_t Hash_Value(Cell(const*) cell)
 // or intersection operation.  However, if Init_Map() is used they will be
 // forced managed along with the pairlist they are attached to.
 //
-// (Review making them non-managed, and freed in Decay_Series(), since they
-// are not shared in maps.  Consider impacts on the set operations.)
+// (Note that hashlists *can* be shared between maps: Copy_Map() reuses the
+// original's hashlist under HASHLIST_FLAG_COPY_ON_WRITE, so any lifetime
+// rethink would have to account for multiple pairlists pointing at one.)
 //
 REBSER *Make_Hash_Series(REBLEN len)
 {
@@ -403,7 +545,8 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
     if (value == tail)
         return hashlist;
 
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
+    struct Reb_Hashlist_Entry *entries
+        = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
 
     Array(const*) array = VAL_ARRAY(block);
     REBLEN n = VAL_INDEX(block);
@@ -411,7 +554,7 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
     while (true) {
         REBLEN skip_index = skip;
 
-        REBLEN hash = Find_Key_Hashed(
+        REBLEN slot = Find_Key_Hashed(
             m_cast(Array(*), array),  // mode == 0, no modification, cast ok
             hashlist,
             value,
@@ -420,7 +563,7 @@ REBSER *Hash_Block(const REBVAL *block, REBLEN skip, bool cased)
             cased,
             0  // mode
         );
-        hashes[hash] = (n / skip) + 1;
+        entries[slot].index = (n / skip) + 1;  // hash is cached by the find
 
         while (skip_index != 0) {
             value++;
@@ -490,13 +633,7 @@ REBINT Compute_IPC(const Byte* data, Size size)
 // Return a 32-bit hash value for the bytes.
 //
 REBINT Hash_Bytes(const Byte* data, REBLEN len) {
-    uint32_t crc = 0x00000000;
-
-    REBLEN n;
-    for (n = 0; n != len; ++n)
-        crc = (crc >> 8) ^ crc32_table[(crc ^ data[n]) & 0xff];
-
-    return cast(REBINT, ~crc);
+    return cast(REBINT, Hash_Bytes_Core(data, len, HASH_PRIME_5));
 }
 
 
@@ -510,6 +647,20 @@ void Startup_CRC(void)
     // table is precompiled-in.
     //
     crc32_table = get_crc_table();
+
+    // Draw the per-process key that Hash_Value() folds into MAP! key hashes.
+    // The core has no entropy source in its dependency set, so this stirs
+    // the clock together with ASLR'd addresses from the stack and static
+    // storage--not cryptographic randomness, but enough that colliding keys
+    // can't be chosen before the process exists.  Must run before any
+    // hashlist is made and never again: hashlists cache Hash_Value() output.
+    //
+    uint32_t seed = Hash_Mix(HASH_PRIME_5, cast(uint32_t, time(nullptr)));
+    seed = Hash_Mix(seed, cast(uint32_t, clock()));
+    seed = Hash_Mix(seed, cast(uint32_t, cast(uintptr_t, &seed)));
+    seed = Hash_Mix(seed, cast(uint32_t, cast(uintptr_t, &crc32_table)));
+    seed = Hash_Mix(seed, cast(uint32_t, cast(uintptr_t, crc32_table)));
+    PG_Hash_Seed = Hash_Final(seed);
 }
 
 
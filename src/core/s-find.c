@@ -57,6 +57,32 @@ REBINT Compare_Ascii_Uncased(
 // Compare two binary strings case insensitively, stopping at '\0' terminator.
 // Return where the first differed.
 //
+//
+//  Ascii_Equal_Uncased: C
+//
+// Case-insensitive equality for regions already known to be pure ASCII,
+// folding a machine word at a time instead of a codepoint at a time.
+//
+bool Ascii_Equal_Uncased(const Byte* a, const Byte* b, Size size)
+{
+    while (size >= UTF8_SWAR_CHUNK) {
+        uintptr_t ca;
+        uintptr_t cb;
+        memcpy(&ca, a, sizeof(ca));
+        memcpy(&cb, b, sizeof(cb));
+        if (Ascii_Chunk_Lowercase(ca) != Ascii_Chunk_Lowercase(cb))
+            return false;
+        a += UTF8_SWAR_CHUNK;
+        b += UTF8_SWAR_CHUNK;
+        size -= UTF8_SWAR_CHUNK;
+    }
+    for (; size > 0; ++a, ++b, --size)
+        if (LO_CASE(*a) != LO_CASE(*b))
+            return false;
+    return true;
+}
+
+
 const Byte* Try_Diff_Bytes_Uncased(const Byte* src, const Byte* pat)
 {
     while (*src != '\0' and *pat != '\0') {
@@ -97,6 +123,13 @@ REBINT Compare_UTF8(const Byte* s1, const Byte* s2, Size l2)
     Size l1 = strsize(s1);
     REBINT result = 0;
 
+    // Equal byte sequences are an exact match no matter what they encode,
+    // and exact matches dominate (e.g. canon symbol lookups).  memcmp() gets
+    // that answer without decoding any codepoints.
+    //
+    if (l1 == l2 and memcmp(s1, s2, l2) == 0)
+        return 0;
+
     for (; l1 > 0 && l2 > 0; s1++, s2++, l1--, l2--) {
         c1 = *s1;
         c2 = *s2;
@@ -252,6 +285,100 @@ REBINT Find_Binstr_In_Binstr(
     if (not is_2_str)
         caseless = false;  //
 
+    // Forward case-sensitive searches can run at the byte level: a cased
+    // match of the pattern's UTF-8 bytes is exactly a match of its encoded
+    // codepoints, and since a pattern never starts with a continuation
+    // byte, a byte-level hit in valid UTF-8 lies on a codepoint boundary.
+    // Use memchr() on the first byte (which C runtimes vectorize) plus a
+    // last-byte filter before paying for the memcmp()...much faster than
+    // the decode-per-position loop below on large haystacks.
+    //
+    // Strings take this path only when no /PART limits the search, since
+    // the byte offset of a codepoint-based limit isn't known up front.
+    //
+    if (
+        skip1 == 1
+        and not caseless
+        and not (flags & AM_FIND_MATCH)
+        and (not is_1_str or end1_unsigned == cast(REBLEN, len_head1))
+    ){
+        Size span;  // how many bytes of binstr1 the search may examine
+        if (is_1_str)
+            span = size_at1;
+        else {
+            if (end1 < index1)
+                return NOT_FOUND;
+            span = (end1 - index1) + size2;  // end1 is last valid start
+        }
+
+        const Byte* at = cp1;
+        const Byte* region_tail = cp1 + span;
+        Byte first = head2[0];
+        Byte last = head2[size2 - 1];
+
+        while (true) {
+            Size remaining = region_tail - at;
+            if (remaining < size2)
+                return NOT_FOUND;
+
+            const Byte* hit = cast(const Byte*,
+                memchr(at, first, remaining - (size2 - 1))
+            );
+            if (hit == nullptr)
+                return NOT_FOUND;
+
+            if (hit[size2 - 1] == last and memcmp(hit, head2, size2) == 0) {
+                if (not is_1_str) {
+                    *len_out = window1;  // bytes (size2)
+                    return index1 + (hit - cp1);
+                }
+
+                // String match index and length are in codepoints; count
+                // the non-continuation bytes up to the hit.
+                //
+                Length count = 0;
+                const Byte* bp = cp1;
+                for (; bp != hit; ++bp)
+                    if ((*bp & 0xC0) != 0x80)
+                        ++count;
+                *len_out = len2;
+                return index1 + count;
+            }
+
+            at = hit + 1;
+        }
+    }
+
+    // Caseless forward searches get a byte-level path too, when both the
+    // pattern and the searched region are pure ASCII (codepoint count equals
+    // byte count).  ASCII indexes *are* byte offsets, so /PART limits
+    // translate directly.  Requiring an ASCII pattern is also what makes
+    // this exact: no ASCII byte case-folds to match a non-ASCII codepoint,
+    // so a match the decoding loop would find can't be missed here.
+    //
+    if (
+        skip1 == 1
+        and caseless
+        and is_1_str  // for binaries the size test below proves nothing
+        and not (flags & AM_FIND_MATCH)
+        and size_at1 == cast(Size, len_head1 - index1)  // ASCII from index1
+        and size2 == cast(Size, len2)  // all-ASCII pattern
+    ){
+        const Byte* at = cp1;
+        const Byte* region_tail = cp1 + (end1_unsigned - index1);
+        Byte first = LO_CASE(head2[0]);  // TEXT! can't contain NUL
+
+        for (; at + size2 <= region_tail; ++at) {
+            if (LO_CASE(*at) != first)
+                continue;
+            if (Ascii_Equal_Uncased(at, head2, size2)) {
+                *len_out = len2;
+                return index1 + (at - cp1);
+            }
+        }
+        return NOT_FOUND;
+    }
+
     // Binary-compatible to: [next2 = NEXT_CHR(&c2_canon, head2)]
     Codepoint c2_canon;  // calculate first char lowercase once, vs. each step
     const Byte* next2;
@@ -462,6 +589,43 @@ REBINT Find_Bitset_In_Binstr(
     bool is_str = (CELL_HEART(binstr) != REB_BINARY);
 
     const Byte* cp1 = is_str ? VAL_STRING_AT(binstr) : VAL_BINARY_AT(binstr);
+
+    // Forward scans over a long span precompute per-byte membership, so the
+    // loop pays one table load per (ASCII) byte instead of a Check_Bit()
+    // call.  AM_FIND_MATCH only probes one unit, so it gains nothing.
+    //
+    if (
+        skip == 1
+        and not (flags & AM_FIND_MATCH)
+        and end - index >= BITSET_BYTE_TABLE_THRESHOLD
+    ){
+        Byte table[256];
+        Fill_Bitset_Byte_Table(table, bset, uncase);
+
+        const Byte* bp = cp1;
+        while (index < end) {
+            Byte b = *bp;
+            if (not is_str or b < 0x80) {
+                if (table[b]) {
+                    *len_out = 1;
+                    return index;
+                }
+                ++bp;
+            }
+            else {
+                Codepoint c;
+                Utf8(const*) next = NEXT_CHR(&c, cast(Utf8(const*), bp));
+                if (Check_Bit(bset, c, uncase)) {
+                    *len_out = 1;
+                    return index;
+                }
+                bp = cast(const Byte*, next);
+            }
+            ++index;
+        }
+        return NOT_FOUND;
+    }
+
     Codepoint c1;
     if (skip > 0) {  // skip 1 will pass over cp1, so leave as is
         if (is_str)
@@ -66,6 +66,155 @@ Binary(*) Copy_Bytes(const Byte* src, REBINT len)
 }
 
 
+//
+//  Make_Binary_View: C
+//
+// Make a "view": a binary series whose data is a window into another binary's
+// allocation, so extracting a segment doesn't have to copy the bytes.  The
+// caller must have frozen the owner--so its data can never relocate, mutate,
+// or be freed--and the view holds the owner live through its LINK() slot.
+//
+// The view is frozen as well.  Permitting mutation would either write through
+// to the owner (which just promised never to change) or require materializing
+// a copy on demand...and the cell model has no way to redirect all the extant
+// references to such a copy.
+//
+// Note the owner's stub may be FLAVOR_STRING if the binary was aliasing a
+// string via AS; that's fine, as views only borrow the byte storage.
+//
+Binary(*) Make_Binary_View(Binary(*) owner, Size offset, Size size)
+{
+    assert(Is_Series_Frozen(owner));
+    assert(GET_SERIES_FLAG(owner, MANAGED));
+    assert(offset + size <= BIN_LEN(owner));
+
+    Binary(*) view = BIN(Prep_Stub(
+        Alloc_Pooled(STUB_POOL),
+        FLAG_FLAVOR(BINARY)
+            | NODE_FLAG_MANAGED
+            | SERIES_FLAG_DYNAMIC
+            | SERIES_FLAG_DATA_NOT_OWNED
+            | SERIES_FLAG_FIXED_SIZE
+            | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    ));
+    SER_INFO(view) = SERIES_INFO_MASK_NONE;
+
+    view->content.dynamic.data = cast(char*, BIN_AT(owner, offset));
+    view->content.dynamic.used = size;
+    view->content.dynamic.rest = size;  // FIXED_SIZE, so no expansion
+    view->content.dynamic.bonus.bias = 0;
+
+    mutable_LINK(ViewOwner, view) = owner;
+
+    Freeze_Series(view);
+    return view;
+}
+
+
+//
+//  Make_Binary_View_Foreign: C
+//
+// Variant of Make_Binary_View() for byte ranges whose storage the GC does
+// not manage at all--such as a memory-mapped file.  The holder is whatever
+// managed stub stands in for the foreign resource's lifetime (commonly the
+// singular array of a managed HANDLE!, whose cleanup function releases the
+// resource when it is collected).  Keeping the holder in the LINK() slot
+// means the bytes stay valid for as long as the view can be seen.
+//
+// The caller is responsible for the range actually being immutable for the
+// holder's lifetime; the view is frozen so Rebol code can't write to it.
+//
+Binary(*) Make_Binary_View_Foreign(REBSER *holder, const Byte* data, Size size)
+{
+    assert(GET_SERIES_FLAG(holder, MANAGED));
+
+    Binary(*) view = BIN(Prep_Stub(
+        Alloc_Pooled(STUB_POOL),
+        FLAG_FLAVOR(BINARY)
+            | NODE_FLAG_MANAGED
+            | SERIES_FLAG_DYNAMIC
+            | SERIES_FLAG_DATA_NOT_OWNED
+            | SERIES_FLAG_FIXED_SIZE
+            | SERIES_FLAG_LINK_NODE_NEEDS_MARK
+    ));
+    SER_INFO(view) = SERIES_INFO_MASK_NONE;
+
+    view->content.dynamic.data = cast(char*, m_cast(Byte*, data));
+    view->content.dynamic.used = size;
+    view->content.dynamic.rest = size;  // FIXED_SIZE, so no expansion
+    view->content.dynamic.bonus.bias = 0;
+
+    mutable_LINK(ViewOwner, view) = holder;
+
+    Freeze_Series(view);
+    return view;
+}
+
+
+//
+//  Build_Frozen_String_Index: C
+//
+// A frozen string can never be modified, which makes it a candidate for a
+// denser position cache than the single floating bookmark mutable strings
+// get: one index/offset entry per STR_INDEX_INTERVAL codepoints, built in
+// one pass over the lead bytes (no decoding).  STR_AT() then reaches any
+// codepoint with a table read plus a forward scan of less than an interval,
+// instead of scanning from the nearest of head, tail, or last access.
+//
+// The table reuses the bookmark list flavor and hangs off the same LINK()
+// slot; STR_AT() tells the two apart by the entry count.  The cost is one
+// Reb_Bookmark per interval--a few percent of the UTF-8 payload--so short
+// strings aren't worth indexing, nor are all-ASCII ones (which have O(1)
+// access with no cache at all).
+//
+void Build_Frozen_String_Index(String(*) s)
+{
+    assert(Is_Series_Frozen(s));
+
+    if (not IS_NONSYMBOL_STRING(s))
+        return;  // symbols have no LINK(Bookmarks) slot for a table
+    if (Is_Definitely_Ascii(s))
+        return;  // byte offsets are codepoint indexes already
+    if (STR_LEN(s) < 2 * STR_INDEX_INTERVAL)
+        return;  // bounded scans this short don't merit the memory
+    if (LINK(Bookmarks, s) and SER_USED(LINK(Bookmarks, s)) > 1)
+        return;  // already indexed (e.g. frozen again through another cell)
+
+    Free_Bookmarks_Maybe_Null(s);  // single bookmark is superseded
+
+    REBLEN len = STR_LEN(s);
+    REBLEN num = (len + STR_INDEX_INTERVAL - 1) / STR_INDEX_INTERVAL;
+
+    REBSER *table = Make_Series_Core(
+        num,
+        FLAG_FLAVOR(BOOKMARKLIST) | SERIES_FLAG_MANAGED
+    );
+    SET_SERIES_LEN(table, num);
+    CLEAR_SERIES_FLAG(table, MANAGED);  // manual but untracked (no leak error)
+
+    struct Reb_Bookmark *entry = SER_HEAD(struct Reb_Bookmark, table);
+
+    const Byte* head = cast(const Byte*, STR_HEAD(s));
+    const Byte* tail = cast(const Byte*, STR_TAIL(s));
+    const Byte* bp = head;
+    REBLEN i = 0;  // codepoints before `bp`
+    for (; bp != tail; ++bp) {
+        if (Is_Continuation_Byte_If_Utf8(*bp))
+            continue;
+        if (i % STR_INDEX_INTERVAL == 0) {
+            entry->index = i;
+            entry->offset = bp - head;
+            ++entry;
+        }
+        ++i;
+    }
+    assert(i == len);
+    assert(entry == SER_HEAD(struct Reb_Bookmark, table) + num);
+
+    mutable_LINK(Bookmarks, s) = cast(REBBMK*, table);
+}
+
+
 //
 //  Copy_String_At_Limit: C
 //
@@ -305,6 +454,20 @@ String(*) Append_UTF8_May_Fail(
 
     Size bytes_left = size;  // see remarks on Back_Scan_UTF8_Char's 3rd arg
     for (; bytes_left > 0; --bytes_left, ++bp) {
+        //
+        // Bulk-process runs of plain ASCII a machine word at a time.  A
+        // "clean" chunk has no high bits, no NUL, and no CR--so it needs
+        // no strmode treatment and every byte is one codepoint.
+        //
+        while (bytes_left >= UTF8_SWAR_CHUNK and Ascii_Chunk_Clean(bp)) {
+            Append_Ascii_Len(mo->series, cs_cast(bp), UTF8_SWAR_CHUNK);
+            num_codepoints += UTF8_SWAR_CHUNK;
+            bp += UTF8_SWAR_CHUNK;
+            bytes_left -= UTF8_SWAR_CHUNK;
+        }
+        if (bytes_left == 0)
+            break;
+
         Codepoint c = *bp;
         if (c >= 0x80) {
             bp = Back_Scan_UTF8_Char(&c, bp, &bytes_left);
@@ -99,6 +99,113 @@ Byte* Prep_Mold_Overestimated(REB_MOLD *mo, REBLEN num_bytes)
 }
 
 
+// Estimation pre-passes walk nested arrays, so the depth has to be capped
+// somewhere--both to bound the cost of the walk and because arrays can be
+// cyclic.  Past the cap a flat per-element figure is assumed.
+//
+#define MOLD_GUESS_MAX_DEPTH 8
+
+
+//
+//  Guess_Mold_Size_Core: C
+//
+static Size Guess_Mold_Size_Core(noquote(Cell(const*)) v, REBLEN depth)
+{
+    enum Reb_Kind heart = CELL_HEART(v);
+
+    if (ANY_WORD_KIND(heart))
+        return STR_SIZE(VAL_WORD_SYMBOL(v)) + 2;  // room for sigil or colon
+
+    if (ANY_STRING_KIND(heart)) {
+        Size size = STR_SIZE(VAL_STRING(v));
+        return size + (size >> 3) + 8;  // delimiters, plus escaping slack
+    }
+
+    if (heart == REB_BINARY) {
+        Size size;
+        VAL_BINARY_SIZE_AT(&size, v);
+        return (size * 2) + 8;  // hex digits (default base), plus #{}
+    }
+
+    if (ANY_ARRAY_KIND(heart)) {
+        if (depth == 0)  // too deep to walk; assume smallish elements
+            return (VAL_LEN_HEAD(v) * 8) + 16;
+
+        Size guess = 16;  // delimiters, index adornment if MOLD_FLAG_ALL
+        Cell(const*) tail = ARR_TAIL(VAL_ARRAY(v));
+        Cell(const*) item = ARR_AT(VAL_ARRAY(v), VAL_INDEX(v));
+        for (; item != tail; ++item)
+            guess += Guess_Mold_Size(item, depth - 1) + 1;  // +1 delimiter
+        return guess;
+    }
+
+    if (heart == REB_MAP) {
+        if (depth == 0)
+            return (ARR_LEN(MAP_PAIRLIST(VAL_MAP(v))) * 8) + 16;
+
+        Size guess = 16;
+        Cell(const*) tail = ARR_TAIL(MAP_PAIRLIST(VAL_MAP(v)));
+        Cell(const*) key = ARR_HEAD(MAP_PAIRLIST(VAL_MAP(v)));
+        for (; key != tail; ++key)
+            guess += Guess_Mold_Size(key, depth - 1) + 1;
+        return guess;
+    }
+
+    return MAX_NUMCHR;  // scalars; covers digits and -.e+000%
+}
+
+
+//
+//  Guess_Mold_Size: C
+//
+// Cheap per-type byte bound for what molding a value will produce, used to
+// size the mold buffer up front in one allocation instead of discovering the
+// size through a cascade of Expand_Series() doublings mid-mold.
+//
+// The guess does not have to be exact in either direction: underestimates
+// just mean a few expansions happen as before, and overestimates waste some
+// buffer space that the next Push_Mold() shrinks back if it is excessive.
+// So the walk stays deliberately crude--string sizes don't account for all
+// escaping, and scalars get a flat figure.
+//
+Size Guess_Mold_Size(Cell(const*) v, REBLEN depth)
+{
+  #if DEBUG_UNREADABLE_TRASH
+    if (IS_TRASH(v))
+        return 8;  // "~trash~"
+  #endif
+
+    if (Is_Isotope(v))
+        return 0;  // the mold itself will fail; nothing to estimate
+
+    Size guess = VAL_NUM_QUOTES(v);  // one apostrophe per quoting level
+    if (not (QUOTE_BYTE(v) & NONQUASI_BIT))
+        guess += 2;  // tildes for quasiform
+
+    return guess + Guess_Mold_Size_Core(VAL_UNESCAPED(v), depth);
+}
+
+
+//
+//  Reserve_Mold_Estimated_Size: C
+//
+// Run the size estimation pre-pass on a value about to be molded, and ask
+// the upcoming Push_Mold() to reserve that much capacity in one step.  Small
+// estimates are ignored--the buffer's resting capacity covers them already.
+//
+void Reserve_Mold_Estimated_Size(REB_MOLD *mo, Cell(const*) v)
+{
+    assert(mo->series == nullptr);  // must precede Push_Mold()
+
+    Size guess = Guess_Mold_Size(v, MOLD_GUESS_MAX_DEPTH);
+    if (guess <= MIN_COMMON)
+        return;
+
+    SET_MOLD_FLAG(mo, MOLD_FLAG_RESERVE);
+    mo->reserve = guess;
+}
+
+
 //
 //  Pre_Mold_Core: C
 //
@@ -188,16 +295,113 @@ void New_Indented_Line(REB_MOLD *mo)
 // is robust to their existence.  These helper functions can be used to
 // maintain a stack of series.
 //
+// The stack alone made the visited check a linear scan per series molded,
+// which went quadratic on deep structures (every nesting level is on the
+// stack while its children mold).  So membership is mirrored in an
+// open-addressing hash set, making the check O(1) amortized: the stack keeps
+// the LIFO bookkeeping, and the set answers "have we seen this pointer".
+//
 // !!! TBD: Unify this with the PUSH_GC_GUARD and DROP_GC_GUARD implementation
 // so that improvements in one will improve the other?
 //
 //=////////////////////////////////////////////////////////////////////////=//
 
+static const void **TG_Mold_Visits = nullptr;  // linear probe, power-of-2
+static REBLEN Mold_Visits_Capacity;
+static REBLEN Mold_Visits_Count;
+
+inline static REBLEN Mold_Visit_Home(const void *p) {
+    uintptr_t h = cast(uintptr_t, p) >> 4;  // low bits alias on pool nodes
+    return (h * 2654435761u) & (Mold_Visits_Capacity - 1);  // Knuth multiply
+}
+
+static bool In_Mold_Visits(const void *p)
+{
+    REBLEN mask = Mold_Visits_Capacity - 1;
+    REBLEN slot = Mold_Visit_Home(p);
+    while (TG_Mold_Visits[slot] != nullptr) {
+        if (TG_Mold_Visits[slot] == p)
+            return true;
+        slot = (slot + 1) & mask;
+    }
+    return false;
+}
+
+static void Add_Mold_Visit(const void *p)
+{
+    if (Mold_Visits_Count * 2 >= Mold_Visits_Capacity) {  // keep load < 50%
+        const void **old = TG_Mold_Visits;
+        REBLEN old_capacity = Mold_Visits_Capacity;
+
+        Mold_Visits_Capacity = old_capacity * 2;
+        TG_Mold_Visits = TRY_ALLOC_N_ZEROFILL(
+            const void*, Mold_Visits_Capacity
+        );
+        if (TG_Mold_Visits == nullptr) {
+            TG_Mold_Visits = old;  // leave the set consistent before failing
+            Mold_Visits_Capacity = old_capacity;
+            fail (Error_No_Memory(
+                old_capacity * 2 * sizeof(const void*)
+            ));
+        }
+
+        REBLEN i;
+        for (i = 0; i < old_capacity; ++i) {
+            if (old[i] == nullptr)
+                continue;
+            REBLEN slot = Mold_Visit_Home(old[i]);
+            while (TG_Mold_Visits[slot] != nullptr)
+                slot = (slot + 1) & (Mold_Visits_Capacity - 1);
+            TG_Mold_Visits[slot] = old[i];
+        }
+        FREE_N(const void*, old_capacity, old);
+    }
+
+    REBLEN mask = Mold_Visits_Capacity - 1;
+    REBLEN slot = Mold_Visit_Home(p);
+    while (TG_Mold_Visits[slot] != nullptr) {
+        assert(TG_Mold_Visits[slot] != p);  // callers check before pushing
+        slot = (slot + 1) & mask;
+    }
+    TG_Mold_Visits[slot] = p;
+    ++Mold_Visits_Count;
+}
+
+// Standard linear-probing deletion: shift later entries of the probe chain
+// back over the vacated slot, so no tombstones accumulate.
+//
+static void Remove_Mold_Visit(const void *p)
+{
+    REBLEN mask = Mold_Visits_Capacity - 1;
+    REBLEN slot = Mold_Visit_Home(p);
+    while (TG_Mold_Visits[slot] != p) {
+        assert(TG_Mold_Visits[slot] != nullptr);  // must be in the set
+        slot = (slot + 1) & mask;
+    }
+
+    REBLEN probe = slot;
+    while (true) {
+        probe = (probe + 1) & mask;
+        if (TG_Mold_Visits[probe] == nullptr)
+            break;
+        REBLEN home = Mold_Visit_Home(TG_Mold_Visits[probe]);
+        if (((probe - home) & mask) >= ((probe - slot) & mask)) {
+            TG_Mold_Visits[slot] = TG_Mold_Visits[probe];  // reachable there
+            slot = probe;
+        }
+    }
+    TG_Mold_Visits[slot] = nullptr;
+    --Mold_Visits_Count;
+}
+
 //
 //  Find_Pointer_In_Series: C
 //
 REBINT Find_Pointer_In_Series(REBSER *s, const void *p)
 {
+    if (s == TG_Mold_Stack and not In_Mold_Visits(p))
+        return NOT_FOUND;  // O(1) rejection; only actual cycles scan below
+
     REBLEN index = 0;
     for (; index < SER_USED(s); ++index) {
         if (*SER_AT(void*, s, index) == p)
@@ -213,6 +417,10 @@ void Push_Pointer_To_Series(REBSER *s, const void *p)
 {
     if (SER_FULL(s))
         Extend_Series_If_Necessary(s, 8);
+
+    if (s == TG_Mold_Stack)
+        Add_Mold_Visit(p);  // fallible when growing, so before the commit
+
     *SER_AT(const void*, s, SER_USED(s)) = p;
     SET_SERIES_USED(s, SER_USED(s) + 1);
 }
@@ -223,13 +431,33 @@ void Push_Pointer_To_Series(REBSER *s, const void *p)
 void Drop_Pointer_From_Series(REBSER *s, const void *p)
 {
     assert(p == *SER_AT(void*, s, SER_USED(s) - 1));
-    UNUSED(p);
     SET_SERIES_USED(s, SER_USED(s) - 1);
 
+    if (s == TG_Mold_Stack)
+        Remove_Mold_Visit(p);
+    else
+        UNUSED(p);
+
     // !!! Could optimize so mold stack is always dynamic, and just use
     // s->content.dynamic.len--
 }
 
+//
+//  Rollback_Mold_Stack: C
+//
+// Abrupt failures longjmp out of in-progress molds without running their
+// unwinding Drop_Pointer_From_Series() calls, so a plain truncation of the
+// stack would leave stale pointers in the visit set.  Pop entry by entry.
+//
+void Rollback_Mold_Stack(REBLEN tail)
+{
+    while (SER_USED(TG_Mold_Stack) > tail)
+        Drop_Pointer_From_Series(
+            TG_Mold_Stack,
+            *SER_AT(const void*, TG_Mold_Stack, SER_USED(TG_Mold_Stack) - 1)
+        );
+}
+
 
 //=/// ARRAY MOLDING //////////////////////////////////////////////////////=//
 
@@ -264,6 +492,65 @@ void Mold_Array_At(
     Cell(const*) item_tail = ARR_TAIL(a);
     Cell(const*) item = ARR_AT(a, index);
     assert(item <= item_tail);
+
+    // If the scanner captured the source's whitespace (TRANSCODE/FORMATTED)
+    // then replay it, instead of re-deriving a layout from the per-cell
+    // newline flags.  Indents are absolute byte columns from the source, so
+    // no mo->indent bookkeeping happens on this path.  The table is
+    // advisory: only a mold from the head uses it, and if the array grew
+    // after scanning the leftover cells drop through to the flag-driven
+    // loop below.
+    //
+    if (index == 0 and Has_Format_Table(a)) {
+        Binary(const*) format = Array_Format_Table(a);
+        const Byte* head = BIN_HEAD(format);
+        const Byte* fmt = head + FORMAT_TABLE_HEADER_SIZE;
+        const Byte* fmt_tail = BIN_TAIL(format);
+
+        while (item != item_tail and fmt != fmt_tail) {
+            Byte run = fmt[0];
+            Byte newlines = fmt[1];
+            Byte indent = fmt[2];
+            fmt += 3;
+
+            for (; run != 0 and item != item_tail; --run, ++item) {
+                if (newlines != 0) {
+                    Byte n;
+                    for (n = 0; n < newlines; ++n)
+                        Append_Codepoint(mo->series, LF);
+                    for (n = 0; n < indent; ++n)
+                        Append_Codepoint(mo->series, ' ');
+                }
+                else if (not first_item)
+                    Append_Codepoint(mo->series, ' ');
+                first_item = false;
+
+                Mold_Value(mo, item);
+
+                if (mo->port != nullptr)
+                    Maybe_Flush_Mold_To_Port(mo);
+            }
+        }
+
+        if (item == item_tail) {  // all cells covered, emit closing layout
+            Byte n;
+            for (n = 0; n < head[4]; ++n)  // newlines before delimiter
+                Append_Codepoint(mo->series, LF);
+            if (head[4] != 0) {
+                for (n = 0; n < head[5]; ++n)  // delimiter's indent column
+                    Append_Codepoint(mo->series, ' ');
+            }
+            if (sep[1] != '\0')
+                Append_Codepoint(mo->series, sep[1]);
+
+            Drop_Pointer_From_Series(TG_Mold_Stack, a);
+            return;
+        }
+
+        if (not first_item and Not_Cell_Flag(item, NEWLINE_BEFORE))
+            Append_Codepoint(mo->series, ' ');  // separate replayed part
+    }
+
     while (item != item_tail) {
         if (Get_Cell_Flag(item, NEWLINE_BEFORE)) {
            if (not indented and (sep[1] != '\0')) {
@@ -283,6 +570,15 @@ void Mold_Array_At(
 
         Mold_Value(mo, item);
 
+        // Between items no one holds pointers into the buffer and nothing
+        // looks back past the tail, so it's a safe point to stream out the
+        // accumulated bytes if this mold is going to a port.  (The pending
+        // separator space hasn't been added yet, so the newline-marker logic
+        // above still finds it in the buffer, not in a flushed chunk.)
+        //
+        if (mo->port != nullptr)
+            Maybe_Flush_Mold_To_Port(mo);
+
         ++item;
         if (item == item_tail)
             break;
@@ -467,6 +763,8 @@ String(*) Copy_Mold_Or_Form_Value(Cell(const*) v, Flags opts, bool form)
     DECLARE_MOLD (mo);
     mo->opts = opts;
 
+    Reserve_Mold_Estimated_Size(mo, v);
+
     Push_Mold(mo);
     Mold_Or_Form_Value(mo, v, form);
     return Pop_Molded_String(mo);
@@ -617,6 +915,24 @@ String(*) Pop_Molded_String_Core(String(*) buf, Size offset, Index index)
     Size size = STR_SIZE(buf) - offset;
     Length len = STR_LEN(buf) - index;
 
+    if (offset == 0 and size > MAX_COMMON) {
+        //
+        // An output this large would trip the next Push_Mold()'s shrink of
+        // the buffer anyway.  Rather than copy the bytes out and then throw
+        // the allocation away, steal it wholesale: hand the buffer a fresh
+        // resting-size allocation and swap the contents into the result.
+        // (Only possible for an outermost mold--a nested mold has to leave
+        // the data behind its base offset in place.)
+        //
+        assert(index == 0);  // no bytes before offset means no codepoints
+
+        String(*) stolen = Make_String(MIN_COMMON);
+        Swap_Series_Content(buf, stolen);
+        TERM_STR_LEN_SIZE(stolen, len, size);
+        TERM_STR_LEN_SIZE(buf, 0, 0);
+        return stolen;
+    }
+
     String(*) popped = Make_String(size);
     memcpy(BIN_HEAD(popped), BIN_AT(buf, offset), size);
     TERM_STR_LEN_SIZE(popped, len, size);
@@ -694,6 +1010,57 @@ Binary(*) Pop_Molded_Binary(REB_MOLD *mo)
 }
 
 
+//
+//  Flush_Mold_To_Port: C
+//
+// In streaming mode (MOLD/INTO) the accumulated portion of the mold buffer
+// is copied out as a TEXT! chunk, the buffer is reset to where this mold
+// pushed, and the chunk is handed to the port's WRITE actor.  The flush can
+// only happen between appends--never mid-codepoint--so each chunk is valid
+// UTF-8 on its own.
+//
+// Note the reset happens *before* the WRITE dispatch: port actors are
+// arbitrary code that may run nested molds, and those need to see the buffer
+// in a balanced state.
+//
+void Flush_Mold_To_Port(REB_MOLD *mo)
+{
+    assert(mo->port != nullptr);
+
+    Size size = STR_SIZE(mo->series) - mo->base.size;
+    Length len = STR_LEN(mo->series) - mo->base.index;
+    if (size == 0)
+        return;  // e.g. final flush when chunk flushes left nothing behind
+
+    String(*) chunk = Make_String(size);
+    memcpy(BIN_HEAD(chunk), BIN_AT(mo->series, mo->base.size), size);
+    TERM_STR_LEN_SIZE(chunk, len, size);
+
+    TERM_STR_LEN_SIZE(mo->series, mo->base.index, mo->base.size);
+
+    REBVAL *text = Init_Text(Alloc_Value(), chunk);
+    rebElide("write", mo->port, text);
+    rebRelease(text);
+}
+
+
+//
+//  Maybe_Flush_Mold_To_Port: C
+//
+// Hook for the molding code to call at points where flushing is safe (i.e.
+// no pointers into the buffer are held, and nothing will look back at bytes
+// before the current tail).  Does nothing until a chunk's worth of output
+// has accrued, so the WRITE overhead amortizes.
+//
+void Maybe_Flush_Mold_To_Port(REB_MOLD *mo)
+{
+    assert(mo->port != nullptr);
+
+    if (STR_SIZE(mo->series) - mo->base.size >= mo->flush_size)
+        Flush_Mold_To_Port(mo);
+}
+
+
 //
 //  Drop_Mold_Core: C
 //
@@ -736,6 +1103,12 @@ void Startup_Mold(REBLEN size)
 {
     TG_Mold_Stack = Make_Series_Core(10, FLAG_FLAVOR(MOLDSTACK));
 
+    Mold_Visits_Capacity = 64;  // power of 2, grows at 50% load
+    Mold_Visits_Count = 0;
+    TG_Mold_Visits = TRY_ALLOC_N_ZEROFILL(const void*, Mold_Visits_Capacity);
+    if (TG_Mold_Visits == nullptr)
+        panic ("Couldn't allocate mold visit set");
+
     // Most string code tries to optimize "bookmarks" that help map indices
     // to encoded codepoint positions in such a way that when the string
     // gets short, the bookmarks are discarded.  The mold buffer does not
@@ -757,4 +1130,8 @@ void Shutdown_Mold(void)
 
     Free_Unmanaged_Series(TG_Mold_Stack);
     TG_Mold_Stack = nullptr;
+
+    assert(Mold_Visits_Count == 0);
+    FREE_N(const void*, Mold_Visits_Capacity, TG_Mold_Visits);
+    TG_Mold_Visits = nullptr;
 }
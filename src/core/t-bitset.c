@@ -36,6 +36,9 @@
 //
 REBINT CT_Bitset(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
 {
+    Densify_Bitset(VAL_BITSET(a));  // byte comparison needs both dense
+    Densify_Bitset(VAL_BITSET(b));
+
     DECLARE_LOCAL (atemp);
     DECLARE_LOCAL (btemp);
     Init_Binary(atemp, VAL_BITSET(a));
@@ -71,6 +74,8 @@ void MF_Bitset(REB_MOLD *mo, noquote(Cell(const*)) v, bool form)
 
     Pre_Mold(mo, v); // #[bitset! or make bitset!
 
+    Densify_Bitset(VAL_BITSET(v));  // mold shows raw bytes, for reloading
+
     Binary(const*) s = VAL_BITSET(v);
 
     if (BITS_NOT(s))
@@ -119,6 +124,7 @@ Bounce MAKE_Bitset(
     }
 
     Set_Bits(bin, arg, true);
+    Compactify_Bitset(bin);  // sparse high-codepoint sets switch in place
     return OUT;
 }
 
@@ -193,6 +199,38 @@ REBINT Find_Max_Bit(Cell(const*) val)
 }
 
 
+//
+//  Check_Bit_Raw: C
+//
+// Probe a single bit, ignoring case folding and the NOT annotation--those
+// are layered on by Check_Bit().  Dispatches on the representation: dense
+// bit bytes, or the sorted toggle boundaries of an inversion list (in which
+// a codepoint is a member when an odd number of boundaries lie at or below
+// it).  See BINARY_FLAG_BITSET_INVERSION_LIST in %sys-bitset.h
+//
+static bool Check_Bit_Raw(Binary(const*) bset, REBLEN n)
+{
+    if (Get_Subclass_Flag(BINARY, bset, BITSET_INVERSION_LIST)) {
+        const uint32_t *bounds = cast(const uint32_t*, BIN_HEAD(bset));
+        REBLEN lo = 0;
+        REBLEN hi = BIN_LEN(bset) / sizeof(uint32_t);
+        while (lo < hi) {  // find how many boundaries are <= n
+            REBLEN mid = (lo + hi) / 2;
+            if (bounds[mid] <= n)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        return did (lo & 1);
+    }
+
+    REBLEN i = n >> 3;
+    if (i >= BIN_LEN(bset))
+        return false;
+    return did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
+}
+
+
 //
 //  Check_Bit: C
 //
@@ -201,9 +239,7 @@ REBINT Find_Max_Bit(Cell(const*) val)
 //
 bool Check_Bit(Binary(const*) bset, REBLEN c, bool uncased)
 {
-    REBLEN i, n = c;
-    REBLEN tail = BIN_LEN(bset);
-    bool flag = false;
+    REBLEN n = c;
 
     if (uncased) {
         if (n >= UNICODE_CASES)
@@ -213,17 +249,11 @@ bool Check_Bit(Binary(const*) bset, REBLEN c, bool uncased)
     }
 
     // Check lowercase char:
-retry:
-    i = n >> 3;
-    if (i < tail)
-        flag = did (BIN_HEAD(bset)[i] & (1 << (7 - (n & 7))));
+    bool flag = Check_Bit_Raw(bset, n);
 
     // Check uppercase if needed:
-    if (uncased && !flag) {
-        n = UP_CASE(c);
-        uncased = false;
-        goto retry;
-    }
+    if (uncased && !flag)
+        flag = Check_Bit_Raw(bset, UP_CASE(c));
 
     if (BITS_NOT(bset))
         return not flag;
@@ -232,6 +262,172 @@ retry:
 }
 
 
+//
+//  Fill_Bitset_Byte_Table: C
+//
+// Precompute per-byte membership for scanning kernels.  Each entry holds
+// what Check_Bit() would return for that byte value--with case-insensitivity
+// and complemented bitsets folded in--so a scan loop pays one table load per
+// byte instead of a full bit-test call.  Building the table does 256 probes,
+// hence callers gate on BITSET_BYTE_TABLE_THRESHOLD worth of input.
+//
+// Bytes 128 and up only describe BINARY! input; in UTF-8 text those values
+// are lead or continuation bytes, and the scanner has to decode the
+// codepoint and ask Check_Bit() directly for non-ASCII characters.
+//
+void Fill_Bitset_Byte_Table(Byte table[256], Binary(const*) bset, bool uncased)
+{
+    REBLEN b;
+    for (b = 0; b < 256; ++b)
+        table[b] = Check_Bit(bset, b, uncased) ? 1 : 0;
+}
+
+
+//
+//  Scan_Bitset_Boundaries: C
+//
+// Walk a dense bitset's bytes and find each position where membership
+// toggles--the boundaries of its inversion-list form.  Returns how many
+// there are (always even, since every run that starts also ends); writes
+// them to `out` unless it is nullptr, so one routine serves both the
+// counting pass and the filling pass.  All-zero and all-one bytes inside a
+// run are skipped without per-bit work.
+//
+static REBLEN Scan_Bitset_Boundaries(uint32_t *out, Binary(const*) bset)
+{
+    const Byte* bp = BIN_HEAD(bset);
+    REBLEN used = BIN_LEN(bset);
+
+    REBLEN count = 0;
+    bool in_run = false;
+
+    REBLEN i;
+    for (i = 0; i < used; ++i) {
+        Byte b = bp[i];
+        if (b == (in_run ? 0xFF : 0x00))
+            continue;  // no toggle inside this byte
+
+        REBLEN bit;
+        for (bit = 0; bit < 8; ++bit) {
+            bool set = did (b & (1 << (7 - bit)));
+            if (set != in_run) {
+                if (out)
+                    out[count] = i * 8 + bit;
+                ++count;
+                in_run = set;
+            }
+        }
+    }
+
+    if (in_run) {  // run extends to the last allocated bit; close it
+        if (out)
+            out[count] = used * 8;
+        ++count;
+    }
+
+    return count;
+}
+
+
+//
+//  Compactify_Bitset: C
+//
+// Switch a dense bitset to its inversion-list form in place, if it is big
+// enough for the memory to matter and sparse enough (few runs) that the
+// boundaries undercut the bit bytes by at least 4x.  Otherwise leave it
+// alone.  Called once when MAKE BITSET! finishes building from a spec; the
+// representation then persists through membership tests (PARSE, FIND, PICK)
+// and only reverts if something needs the raw bytes--see Densify_Bitset().
+//
+void Compactify_Bitset(Binary(*) bset)
+{
+    if (Get_Subclass_Flag(BINARY, bset, BITSET_INVERSION_LIST))
+        return;  // already compact
+
+    REBLEN used = BIN_LEN(bset);
+    if (used < BITSET_COMPACT_THRESHOLD)
+        return;
+
+    REBLEN count = Scan_Bitset_Boundaries(nullptr, bset);
+    if (count == 0 or count * sizeof(uint32_t) > used / 4)
+        return;  // empty, or too many runs to pay for binary searches
+
+    uint32_t *bounds = TRY_ALLOC_N(uint32_t, count);
+    if (bounds == nullptr)
+        fail (Error_No_Memory(count * sizeof(uint32_t)));
+    Scan_Bitset_Boundaries(bounds, bset);
+
+    Remake_Series(
+        bset,
+        count * sizeof(uint32_t) + 1,
+        SERIES_FLAGS_NONE  // not(NODE_FLAG_NODE) => don't keep data
+    );
+    memcpy(BIN_HEAD(bset), bounds, count * sizeof(uint32_t));
+    TERM_BIN_LEN(bset, count * sizeof(uint32_t));
+
+    FREE_N(uint32_t, count, bounds);
+
+    Set_Subclass_Flag(BINARY, bset, BITSET_INVERSION_LIST);
+}
+
+
+//
+//  Densify_Bitset: C
+//
+// Expand an inversion-list bitset back to dense bit bytes in place, for
+// code that works on the raw bytes: mutation through Set_Bits(), molding,
+// TO BINARY!, and the set operations (which alias the bitset as a BINARY!
+// and run the bitwise natives on it).  A no-op for dense bitsets, so call
+// sites don't need to test the representation first.
+//
+void Densify_Bitset(Binary(*) bset)
+{
+    if (Not_Subclass_Flag(BINARY, bset, BITSET_INVERSION_LIST))
+        return;
+
+    REBLEN count = BIN_LEN(bset) / sizeof(uint32_t);
+    assert(count != 0 and count % 2 == 0);
+
+    uint32_t *bounds = TRY_ALLOC_N(uint32_t, count);
+    if (bounds == nullptr)
+        fail (Error_No_Memory(count * sizeof(uint32_t)));
+    memcpy(bounds, BIN_HEAD(bset), count * sizeof(uint32_t));
+
+    REBLEN num_bytes = ((bounds[count - 1] - 1) >> 3) + 1;
+    Remake_Series(
+        bset,
+        num_bytes + 1,
+        SERIES_FLAGS_NONE  // not(NODE_FLAG_NODE) => don't keep data
+    );
+    Clear_Series(bset);
+    TERM_BIN_LEN(bset, num_bytes);
+    Clear_Subclass_Flag(BINARY, bset, BITSET_INVERSION_LIST);
+
+    Byte* bp = BIN_HEAD(bset);
+    REBLEN i;
+    for (i = 0; i < count; i += 2) {  // each pair is a run of set bits
+        REBLEN start = bounds[i];
+        REBLEN last = bounds[i + 1] - 1;  // boundary is first bit *not* set
+
+        REBLEN first_byte = start >> 3;
+        REBLEN last_byte = last >> 3;
+        Byte head_mask = 0xFF >> (start & 7);  // bits at/after start
+        Byte tail_mask = cast(Byte, ~(0xFF >> ((last & 7) + 1)));  // <= last
+
+        if (first_byte == last_byte)
+            bp[first_byte] |= head_mask & tail_mask;
+        else {
+            bp[first_byte] |= head_mask;
+            if (last_byte > first_byte + 1)
+                memset(bp + first_byte + 1, 0xFF, last_byte - first_byte - 1);
+            bp[last_byte] |= tail_mask;
+        }
+    }
+
+    FREE_N(uint32_t, count, bounds);
+}
+
+
 //
 //  Set_Bit: C
 //
@@ -576,6 +772,7 @@ REBTYPE(Bitset)
         REBVAL *setval = ARG(value);
 
         Binary(*) bset = BIN(VAL_BITSET_ENSURE_MUTABLE(v));
+        Densify_Bitset(bset);
         if (not Set_Bits(
             bset,
             picker,
@@ -593,6 +790,7 @@ REBTYPE(Bitset)
         option(SymId) property = VAL_WORD_ID(ARG(property));
         switch (property) {
           case SYM_LENGTH:
+            Densify_Bitset(VAL_BITSET(v));  // length is the dense bit count
             return Init_Integer(v, BIN_LEN(VAL_BITSET(v)) * 8);
 
           case SYM_TAIL_Q:
@@ -625,6 +823,8 @@ REBTYPE(Bitset)
       case SYM_COMPLEMENT: {
         Binary(*) copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
         INIT_BITS_NOT(copy, not BITS_NOT(VAL_BITSET(v)));
+        if (Get_Subclass_Flag(BINARY, VAL_BITSET(v), BITSET_INVERSION_LIST))
+            Set_Subclass_Flag(BINARY, copy, BITSET_INVERSION_LIST);
         return Init_Bitset(OUT, copy); }
 
       case SYM_APPEND:  // Accepts: #"a" "abc" [1 - 10] [#"a" - #"z"] etc.
@@ -637,6 +837,7 @@ REBTYPE(Bitset)
             fail (arg);
 
         Binary(*) bin = VAL_BITSET_ENSURE_MUTABLE(v);
+        Densify_Bitset(bin);
 
         bool diff;
         if (BITS_NOT(VAL_BITSET(v)))
@@ -653,6 +854,7 @@ REBTYPE(Bitset)
         UNUSED(PARAM(series));  // covered by `v`
 
         Binary(*) bin = VAL_BITSET_ENSURE_MUTABLE(v);
+        Densify_Bitset(bin);
 
         if (not REF(part))
             fail (Error_Missing_Arg_Raw());
@@ -671,11 +873,14 @@ REBTYPE(Bitset)
 
         Binary(*) copy = BIN(Copy_Series_Core(VAL_BITSET(v), NODE_FLAG_MANAGED));
         INIT_BITS_NOT(copy, BITS_NOT(VAL_BITSET(v)));
+        if (Get_Subclass_Flag(BINARY, VAL_BITSET(v), BITSET_INVERSION_LIST))
+            Set_Subclass_Flag(BINARY, copy, BITSET_INVERSION_LIST);
         return Init_Bitset(OUT, copy); }
 
       case SYM_CLEAR: {
         Binary(*) bin = VAL_BITSET_ENSURE_MUTABLE(v);
         INIT_BITS_NOT(bin, false);
+        Clear_Subclass_Flag(BINARY, bin, BITSET_INVERSION_LIST);
         Clear_Series(bin);
         return COPY(v); }
 
@@ -688,6 +893,7 @@ REBTYPE(Bitset)
             if (BITS_NOT(VAL_BITSET(arg))) {  // !!! see #2365
                 fail ("Bitset negation not handled by set operations");
             }
+            Densify_Bitset(VAL_BITSET(arg));  // bitwise natives need bytes
             Binary(const*) bin = VAL_BITSET(arg);
             Init_Binary(arg, bin);
         }
@@ -710,6 +916,7 @@ REBTYPE(Bitset)
                 fail ("Bitset negation not handled by (most) set operations");
         }
 
+        Densify_Bitset(VAL_BITSET(v));  // bitwise natives need bytes
         Binary(const*) bin = VAL_BITSET(v);
         Init_Binary(v, bin);
 
@@ -545,6 +545,43 @@ static int Compare_Val(void *arg, const void *v1, const void *v2)
 }
 
 
+//
+//  Compare_Val_Integer: C
+//
+// Specialized comparator for when a pre-scan found every sorted cell to be
+// an INTEGER!.  Cmp_Value() re-dispatches on both cells' types for every
+// single comparison, which is pure overhead on a homogeneous block--and
+// sorting tens of millions of elements makes that overhead dominate.
+//
+static int Compare_Val_Integer(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+
+    REBI64 i1 = VAL_INT64(cast(Cell(const*), v1));
+    REBI64 i2 = VAL_INT64(cast(Cell(const*), v2));
+
+    int tristate = i1 > i2 ? 1 : i1 < i2 ? -1 : 0;
+    return flags->reverse ? -tristate : tristate;
+}
+
+
+//
+//  Compare_Val_Decimal: C
+//
+// As with Compare_Val_Integer, but for all-DECIMAL! data.
+//
+static int Compare_Val_Decimal(void *arg, const void *v1, const void *v2)
+{
+    struct sort_flags *flags = cast(struct sort_flags*, arg);
+
+    REBDEC d1 = VAL_DECIMAL(cast(Cell(const*), v1));
+    REBDEC d2 = VAL_DECIMAL(cast(Cell(const*), v2));
+
+    int tristate = d1 > d2 ? 1 : d1 < d2 ? -1 : 0;
+    return flags->reverse ? -tristate : tristate;
+}
+
+
 //
 //  Compare_Val_Custom: C
 //
@@ -596,26 +633,15 @@ void Shuffle_Array(Array(*) arr, REBLEN idx, bool secure)
     REBLEN k;
     Cell(*) data = ARR_HEAD(arr);
 
-    // Rare case where Cell bit copying is okay...between spots in the
-    // same array.
-    //
-    Reb_Cell swap;
-
     for (n = ARR_LEN(arr) - idx; n > 1;) {
         k = idx + (REBLEN)Random_Int(secure) % n;
         n--;
 
-        // Only do the following block when an actual swap occurs.
-        // Otherwise an assertion will fail when trying to Copy_Cell() a
-        // value to itself.
+        // Cell bit copying is okay between spots in the same array, but
+        // only do it when an actual swap occurs (no self-swaps).
         //
-        if (k != (n + idx)) {
-            swap.header = data[k].header;
-            swap.payload = data[k].payload;
-            swap.extra = data[k].extra;
-            Copy_Cell(&data[k], &data[n + idx]);
-            Copy_Cell(&data[n + idx], &swap);
-        }
+        if (k != (n + idx))
+            Swap_Cells(&data[k], &data[n + idx], 1);
     }
 }
 
@@ -1097,26 +1123,55 @@ REBTYPE(Array)
     //-- Special actions:
 
       case SYM_SWAP: {
-        REBVAL *arg = D_ARG(2);
+        INCLUDE_PARAMS_OF_SWAP;
+        UNUSED(ARG(series1));  // covered by `array`
+
+        REBVAL *arg = ARG(series2);
         if (not ANY_ARRAY(arg))
             fail (arg);
 
-        REBLEN index = VAL_INDEX(array);
+        // /PART swaps a run of elements instead of just one.  The run is
+        // measured against series1 (like REVERSE and SORT measure theirs),
+        // then clamped to what both series have on hand.
+        //
+        REBLEN len;
+        if (REF(part))
+            len = Part_Len_May_Modify_Index(array, ARG(part));
+        else
+            len = 1;
 
-        if (
-            index < VAL_LEN_HEAD(array)
-            and VAL_INDEX(arg) < VAL_LEN_HEAD(arg)
-        ){
-            // Cell bits can be copied within the same array
+        if (len > VAL_LEN_AT(array))  // may be at (or past) the tail
+            len = VAL_LEN_AT(array);
+        if (len > VAL_LEN_AT(arg))
+            len = VAL_LEN_AT(arg);
+        if (len == 0)
+            return COPY(array);
+
+        Cell(*) a = VAL_ARRAY_AT_ENSURE_MUTABLE(nullptr, array);
+        Cell(*) b = VAL_ARRAY_AT_ENSURE_MUTABLE(nullptr, arg);
+        if (a == b)
+            return COPY(array);  // same positions, swap is a no-op
+
+        if (VAL_ARRAY(array) == VAL_ARRAY(arg)) {
             //
-            Cell(*) a = VAL_ARRAY_AT_ENSURE_MUTABLE(nullptr, array);
-            Cell(*) b = VAL_ARRAY_AT_ENSURE_MUTABLE(nullptr, arg);
-            Reb_Cell temp;
-            temp.header = a->header;
-            temp.payload = a->payload;
-            temp.extra = a->extra;
-            Copy_Cell(a, b);
-            Copy_Cell(b, &temp);
+            // Cell bits can be swapped within the same array, but the two
+            // runs must be distinct for a swap to make sense.
+            //
+            if (a < b ? a + len > b : b + len > a)
+                fail (Error_Invalid_Part_Raw(ARG(part)));
+            Swap_Cells(a, b, len);
+        }
+        else {
+            // Between different arrays, Copy_Cell() must mediate so that
+            // bindings get managed relative to their new home.
+            //
+            REBLEN n;
+            for (n = 0; n < len; ++n, ++a, ++b) {
+                Reb_Cell temp;
+                Blit_Cell(&temp, a);
+                Copy_Cell(a, b);
+                Copy_Cell(b, &temp);
+            }
         }
         return COPY(array); }
 
@@ -1149,28 +1204,12 @@ REBTYPE(Array)
             bool line_front = Get_Cell_Flag(front + 1, NEWLINE_BEFORE);
 
             Reb_Cell temp;
-            temp.header = front->header;
-            temp.extra = front->extra;
-            temp.payload = front->payload;
-          #if DEBUG_TRACK_EXTEND_CELLS
-            temp.file = front->file;
-            temp.line = front->line;
-            temp.tick = front->tick;
-            temp.touch = front->touch;
-          #endif
+            Blit_Cell(&temp, front);
 
             // When we move the back cell to the front position, it gets the
             // newline flag based on the flag state that was *after* it.
             //
-            front->header = back->header;
-            front->extra = back->extra;
-            front->payload = back->payload;
-          #if DEBUG_TRACK_EXTEND_CELLS
-            front->file = back->file;
-            front->line = back->line;
-            front->tick = back->tick;
-            front->touch = back->touch;
-          #endif
+            Blit_Cell(front, back);
             if (line_back)
                 Set_Cell_Flag(front, NEWLINE_BEFORE);
             else
@@ -1180,15 +1219,7 @@ REBTYPE(Array)
             // that was on the back will be the after for the next blit.
             //
             line_back = Get_Cell_Flag(back, NEWLINE_BEFORE);
-            back->header = temp.header;
-            back->extra = temp.extra;
-            back->payload = temp.payload;
-          #if DEBUG_TRACK_EXTEND_CELLS
-            back->file = temp.file;
-            back->line = temp.line;
-            back->tick = temp.tick;
-            back->touch = temp.touch;
-          #endif
+            Blit_Cell(back, &temp);
 
             if (line_front)
                 Set_Cell_Flag(back, NEWLINE_BEFORE);
@@ -1241,12 +1272,41 @@ REBTYPE(Array)
                 fail (Error_Out_Of_Range(ARG(skip)));
         }
 
+        // If there's no custom comparator, a quick pre-scan can notice the
+        // common case of homogeneous numeric data and pick a comparator
+        // with the comparison inlined, rather than paying Cmp_Value()'s
+        // type re-dispatch on every one of the O(n log n) comparisons.
+        // (The scan is a single linear pass--noise next to the sort.)
+        //
+        cmp_t *compare;
+        if (flags.comparator != nullptr)
+            compare = &Compare_Val_Custom;
+        else
+            compare = &Compare_Val;
+
+        if (compare == &Compare_Val and skip == 1 and flags.offset == 0) {
+            enum Reb_Kind kind = VAL_TYPE(ARR_AT(arr, index));
+            if (kind == REB_INTEGER or kind == REB_DECIMAL) {
+                REBLEN n;
+                for (n = 1; n < len; ++n) {
+                    if (VAL_TYPE(ARR_AT(arr, index + n)) != kind) {
+                        kind = REB_NULL;  // mixed, use the generic path
+                        break;
+                    }
+                }
+                if (kind == REB_INTEGER)
+                    compare = &Compare_Val_Integer;
+                else if (kind == REB_DECIMAL)
+                    compare = &Compare_Val_Decimal;
+            }
+        }
+
         reb_qsort_r(
             ARR_AT(arr, index),
             len / skip,
             sizeof(REBVAL) * skip,
             &flags,
-            flags.comparator != nullptr ? &Compare_Val_Custom : &Compare_Val
+            compare
         );
 
         return OUT; }
@@ -199,6 +199,58 @@ static REBLEN Month_Length(REBLEN month, REBLEN year)
 }
 
 
+// Date differences and comparisons show up in tight loops, and iterating
+// month-by-month (or day-by-day, as normalization once did) makes their cost
+// proportional to the span involved.  These closed-form conversions between
+// a calendar date and a serial day number (after Howard Hinnant's civil
+// calendar algorithms) make both directions O(1), so a difference is just an
+// integer subtraction.  Day 0 is 1-Jan-1970; the choice cancels out of any
+// difference, and both directions agree on it for round-tripping.
+//
+static REBINT Epoch_Days_From_Civil(REBINT year, REBINT month, REBINT day)
+{
+    assert(month >= 1 and month <= 12);
+
+    REBINT y = year;
+    if (month <= 2)
+        --y;  // civil years run Mar..Feb so leap day is the last day
+    REBINT era = (y >= 0 ? y : y - 399) / 400;
+    REBINT yoe = y - era * 400;  // [0, 399]
+    REBINT doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5
+        + day - 1;  // [0, 365]
+    REBINT doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;  // [0, 146096]
+    return era * 146097 + doe - 719468;
+}
+
+static REBINT Epoch_Days_From_Ymd(REBYMD date)
+  { return Epoch_Days_From_Civil(date.year, date.month, date.day); }
+
+static REBYMD Ymd_From_Epoch_Days(REBINT days, REBINT tz)
+{
+    days += 719468;
+    REBINT era = (days >= 0 ? days : days - 146096) / 146097;
+    REBINT doe = days - era * 146097;  // [0, 146096]
+    REBINT yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    REBINT y = yoe + era * 400;
+    REBINT doy = doe - (365 * yoe + yoe / 4 - yoe / 100);  // [0, 365]
+    REBINT mp = (5 * doy + 2) / 153;  // [0, 11], counted from March
+    REBINT day = doy - (153 * mp + 2) / 5 + 1;  // [1, 31]
+    REBINT month = mp + (mp < 10 ? 3 : -9);  // [1, 12]
+    if (month <= 2)
+        ++y;
+
+    if (y < 0 or y > MAX_YEAR)
+        fail (Error_Type_Limit_Raw(Datatype_From_Kind(REB_DATE)));
+
+    REBYMD dr;
+    dr.year = y;
+    dr.month = month;
+    dr.day = day;
+    dr.zone = tz;
+    return dr;
+}
+
+
 //
 //  Julian_Date: C
 //
@@ -246,51 +298,7 @@ REBINT Days_Between_Dates(const REBVAL *a, const REBVAL *b)
         b = utc_b;
     }
 
-    REBYMD d1 = VAL_DATE(a);
-    REBYMD d2 = VAL_DATE(b);
-
-    REBINT sign = 1;
-
-    if (d1.year < d2.year)
-        sign = -1;
-    else if (d1.year == d2.year) {
-        if (d1.month < d2.month)
-            sign = -1;
-        else if (d1.month == d2.month) {
-            if (d1.day < d2.day)
-                sign = -1;
-            else if (d1.day == d2.day)
-                return 0;
-        }
-    }
-
-    if (sign == -1) {
-        REBYMD tmp = d1;
-        d1 = d2;
-        d2 = tmp;
-    }
-
-    // if not same year, calculate days to end of month, year and
-    // days in between years plus days in end year
-    //
-    if (d1.year > d2.year) {
-        REBLEN days = Month_Length(d2.month-1, d2.year) - d2.day;
-
-        REBLEN m;
-        for (m = d2.month; m < 12; m++)
-            days += Month_Length(m, d2.year);
-
-        REBLEN y;
-        for (y = d2.year + 1; y < d1.year; y++) {
-            days += (((y % 4) == 0) and  // divisible by four is a leap year
-                (((y % 100) != 0) or  // except when divisible by 100
-                ((y % 400) == 0)))  // but not when divisible by 400
-                ? 366u : 365u;
-        }
-        return sign * (REBINT)(days + Julian_Date(d1));
-    }
-
-    return sign * (REBINT)(Julian_Date(d1) - Julian_Date(d2));
+    return Epoch_Days_From_Ymd(VAL_DATE(a)) - Epoch_Days_From_Ymd(VAL_DATE(b));
 }
 
 
@@ -355,35 +363,15 @@ static REBYMD Normalize_Date(REBINT day, REBINT month, REBINT year, REBINT tz)
         month %= 12;
     }
 
-    // Now adjust the days by stepping through each month
-
-    REBINT d;
-    while (day >= (d = cast(REBINT, Month_Length(month, year)))) {
-        day -= d;
-        if (++month >= 12) {
-            month = 0;
-            year++;
-        }
-    }
-    while (day < 0) {
-        if (month == 0) {
-            month = 11;
-            year--;
-        }
-        else
-            month--;
-        day += cast(REBINT, Month_Length(month, year));
-    }
-
-    if (year < 0 or year > MAX_YEAR)
-        fail (Error_Type_Limit_Raw(Datatype_From_Kind(REB_DATE)));
-
-    REBYMD dr;
-    dr.year = year;
-    dr.month = month + 1;
-    dr.day = day + 1;
-    dr.zone = tz;
-    return dr;
+    // `day` comes in 0-based and unconstrained (adding a big time or integer
+    // to a date can carry any number of days).  Rather than stepping a month
+    // at a time, convert to a serial day number and back in O(1).  The
+    // conversion back does the year range check.
+    //
+    return Ymd_From_Epoch_Days(
+        Epoch_Days_From_Civil(year, month + 1, 1) + day,
+        tz
+    );
 }
 
 
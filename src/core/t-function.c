@@ -298,7 +298,7 @@ REBTYPE(Action)
         Array(*) details = ACT_DETAILS(proxy);
         Init_Quasi_Word(ARR_AT(details, 1), Canon(COPY));  // dummy ~copy~
 
-        Context(*) meta = ACT_META(act);
+        Context(*) meta = Force_Action_Meta(act);  // materialize if deferred
         assert(ACT_META(proxy) == nullptr);
         mutable_ACT_META(proxy) = meta;  // !!! Note: not a copy of meta
 
@@ -386,7 +386,7 @@ REBTYPE(Action)
             if (VAL_WORD_ID(property) == SYM_FILE)
                 Init_File(OUT, LINK(Filename, a));
             else
-                Init_Integer(OUT, a->misc.line);
+                Init_Integer(OUT, Array_Line(a));
 
             return OUT; }
 
@@ -89,6 +89,17 @@ DECLARE_NATIVE(nand_q)
 }
 
 
+//
+//  Intrinsic_To_Logic: C
+//
+// Body of TO-LOGIC, callable without a frame (DETAILS_FLAG_IS_INTRINSIC).
+//
+void Intrinsic_To_Logic(REBVAL *out, REBVAL *arg)
+{
+    Init_Logic(out, Is_Truthy(arg));
+}
+
+
 //
 //  to-logic: native [
 //
@@ -102,7 +113,8 @@ DECLARE_NATIVE(to_logic)
 {
     INCLUDE_PARAMS_OF_TO_LOGIC;
 
-    return Init_Logic(OUT, Is_Truthy(ARG(value)));
+    Intrinsic_To_Logic(OUT, ARG(value));
+    return OUT;
 }
 
 
@@ -123,6 +135,17 @@ DECLARE_NATIVE(false_if_zero)
 }
 
 
+//
+//  Intrinsic_Not: C
+//
+// Body of NOT, callable without a frame (DETAILS_FLAG_IS_INTRINSIC).
+//
+void Intrinsic_Not(REBVAL *out, REBVAL *arg)
+{
+    Init_Logic(out, Is_Falsey(arg));
+}
+
+
 //
 //  not: native [
 //
@@ -137,7 +160,8 @@ DECLARE_NATIVE(not_1)  // see TO-C-NAME
 {
     INCLUDE_PARAMS_OF_NOT_1;
 
-    return Init_Logic(OUT, Is_Falsey(ARG(optional)));
+    Intrinsic_Not(OUT, ARG(optional));
+    return OUT;
 }
 
 
@@ -51,7 +51,12 @@ REBINT CT_Map(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
 REBMAP *Make_Map(REBLEN capacity)
 {
     Array(*) pairlist = Make_Array_Core(capacity * 2, SERIES_MASK_PAIRLIST);
-    mutable_LINK(Hashlist, pairlist) = Make_Hash_Series(capacity);
+    pairlist->misc.length = 0;  // live entry count (see Length_Map())
+
+    if (capacity < MIN_DICT)
+        mutable_LINK(Hashlist, pairlist) = nullptr;  // linear scan, no hash
+    else
+        mutable_LINK(Hashlist, pairlist) = Make_Hash_Series(capacity);
 
     return MAP(pairlist);
 }
@@ -67,6 +72,25 @@ static Context(*) Error_Conflicting_Key(
 }
 
 
+// Linear probing degrades gracefully as a hashlist fills, but degenerates
+// badly if many keys share a hash--which is what a collision-flooding attack
+// engineers (seeding in Hash_Value() makes that hard to do on purpose, but
+// monitoring catches bad luck and unforeseen weaknesses too).  Lookups
+// account the occupied slots they step over in the METRICS counters; a
+// single run past this length is far outside anything a healthy map
+// produces, so it bumps the alarm count.
+//
+#define MAP_PROBE_ALARM_LENGTH 64
+
+static void Update_Map_Probe_Stats(REBLEN probes) {
+    Total_Map_Probes += probes;
+    if (probes > Map_Probe_Longest)
+        Map_Probe_Longest = probes;
+    if (probes >= MAP_PROBE_ALARM_LENGTH)
+        ++Map_Probe_Alarms;
+}
+
+
 //
 //  Find_Key_Hashed: C
 //
@@ -89,23 +113,23 @@ REBINT Find_Key_Hashed(
     bool strict,
     Byte mode
 ){
-    // Hashlists store a indexes into the actual data array, of where the
-    // first key corresponding to that hash is.  There may be more keys
-    // indicated by that hash, vying for the same slot.  So the collisions
-    // add a skip amount and keep trying:
+    // Hashlist entries store an index into the actual data array of where
+    // the first key corresponding to that hash is, plus a cached copy of
+    // that key's hash.  There may be more keys vying for the same slot, so
+    // collisions probe to the adjacent slot and keep trying:
     //
     // https://en.wikipedia.org/wiki/Linear_probing
     //
-    // Used and skip are co-primes, so is guaranteed that repeatedly
-    // adding skip (and subtracting len when needed) all positions are
-    // visited.  1 <= skip < len, and len is prime, so this is guaranteed.
+    // Linear probing keeps collision runs contiguous in memory, and the
+    // cached hash lets most non-matching slots be rejected with an integer
+    // compare instead of a full Cmp_Value() on the stored key.
     //
     REBLEN used = SER_USED(hashlist);
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
+    struct Reb_Hashlist_Entry *entries
+        = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
 
     uint32_t hash = Hash_Value(key);
     REBLEN slot = hash % used;  // first slot to try for this hash
-    REBLEN skip = hash % (used - 1) + 1;  // skip by how much each collision
 
     // Zombie slots are those which are left behind by removing items, with
     // void values that are illegal in maps, and indicate they can be reused.
@@ -119,12 +143,28 @@ REBINT Find_Key_Hashed(
     //
     REBINT synonym_slot = -1; // no synonyms seen yet...
 
+    REBLEN probes = 0;  // occupied slots examined (see Update_Map_Probe_Stats)
+
     REBLEN n;
-    while ((n = indexes[slot]) != 0) {
+    while ((n = entries[slot].index) != 0) {
+        ++probes;
+
         Cell(*) k = ARR_AT(array, (n - 1) * wide); // stored key
+
+        if (entries[slot].hash != hash) {
+            //
+            // Hashing is compatible with comparison (e.g. strings hash
+            // case-insensitively), so a differing cached hash means this
+            // slot can't hold a match or a synonym...skip the Cmp_Value().
+            //
+            goto next_slot;
+        }
+
         if (0 == Cmp_Value(k, key, true)) {
-            if (strict)
+            if (strict) {
+                Update_Map_Probe_Stats(probes);
                 return slot; // don't need to check synonyms, stop looking
+            }
             goto found_synonym; // confirm exact match is the only match
         }
 
@@ -139,14 +179,18 @@ REBINT Find_Key_Hashed(
             }
         }
 
+      next_slot:;
+
         if (wide > 1 && Is_Void(k + 1) && zombie_slot == -1)
             zombie_slot = slot;
 
-        slot += skip;
-        if (slot >= used)
-            slot -= used;
+        ++slot;
+        if (slot == used)
+            slot = 0;
     }
 
+    Update_Map_Probe_Stats(probes);
+
     if (synonym_slot != -1) {
         assert(not strict);
         return synonym_slot; // there weren't other spellings of the same key
@@ -156,15 +200,17 @@ REBINT Find_Key_Hashed(
         assert(mode == 0);
         slot = zombie_slot;
         Derelativize(
-            ARR_AT(array, (indexes[slot] - 1) * wide),
+            ARR_AT(array, (entries[slot].index - 1) * wide),
             key,
             specifier
         );
     }
 
+    entries[slot].hash = hash;  // cache even if empty; caller may fill index
+
     if (mode > 1) { // append new value to the target series
         Cell(const*) src = key;
-        indexes[slot] = (ARR_LEN(array) / wide) + 1;
+        entries[slot].index = (ARR_LEN(array) / wide) + 1;
 
         REBLEN index;
         for (index = 0; index < wide; ++src, ++index)
@@ -186,7 +232,8 @@ static void Rehash_Map(REBMAP *map)
 
     if (!hashlist) return;
 
-    REBLEN *hashes = SER_HEAD(REBLEN, hashlist);
+    struct Reb_Hashlist_Entry *entries
+        = SER_HEAD(struct Reb_Hashlist_Entry, hashlist);
     Array(*) pairlist = MAP_PAIRLIST(map);
 
     REBVAL *key = SPECIFIC(ARR_HEAD(pairlist));
@@ -208,10 +255,10 @@ static void Rehash_Map(REBMAP *map)
             SET_SERIES_LEN(pairlist, ARR_LEN(pairlist) - 2);
         }
 
-        REBLEN hash = Find_Key_Hashed(
+        REBLEN slot = Find_Key_Hashed(
             pairlist, hashlist, key, SPECIFIED, 2, cased, 0
         );
-        hashes[hash] = n / 2 + 1;
+        entries[slot].index = n / 2 + 1;  // Find_Key_Hashed caches the hash
 
         // discard zombies at end of pairlist
         //
@@ -243,6 +290,157 @@ void Expand_Hash(REBSER *ser)
 }
 
 
+//
+//  Hashify_Map: C
+//
+// When a small map outgrows MIN_DICT pairs (or gets a large reservation),
+// build it a hashlist and move it to the hashed representation.
+//
+static void Hashify_Map(REBMAP *map, REBLEN capacity)
+{
+    assert(MAP_HASHLIST(map) == nullptr);
+
+    REBSER *hashlist = Make_Hash_Series(capacity);
+    if (GET_SERIES_FLAG(MAP_PAIRLIST(map), MANAGED))
+        Force_Series_Managed(hashlist);  // Init_Map() manages both or neither
+    mutable_LINK(Hashlist, MAP_PAIRLIST(map)) = hashlist;
+
+    Rehash_Map(map);
+}
+
+
+//
+//  Ensure_Private_Hashlist: C
+//
+// A hashlist with HASHLIST_FLAG_COPY_ON_WRITE may be shared with maps this
+// one was copied from (or to).  Lookups can run against a shared hashlist,
+// but before a new entry's index is written the map needs its own copy.
+// The relinquished hashlist keeps its flag--other maps may still share it.
+//
+static REBSER *Ensure_Private_Hashlist(REBMAP *map)
+{
+    REBSER *hashlist = MAP_HASHLIST(map);
+    assert(hashlist != nullptr);
+
+    if (Not_Subclass_Flag(HASHLIST, hashlist, COPY_ON_WRITE))
+        return hashlist;
+
+    REBSER *copy = Copy_Series_Core(
+        hashlist,
+        SERIES_FLAGS_NONE | FLAG_FLAVOR(HASHLIST)
+    );
+    if (GET_SERIES_FLAG(MAP_PAIRLIST(map), MANAGED))
+        Force_Series_Managed(copy);  // Init_Map() manages both or neither
+    mutable_LINK(Hashlist, MAP_PAIRLIST(map)) = copy;
+    return copy;
+}
+
+
+//
+//  Find_Map_Entry_Linear: C
+//
+// Linear-scan counterpart to Find_Key_Hashed() for small maps that have no
+// hashlist.  Returns the 1-based pair index of the match (or of the one
+// case-insensitive synonym, if not strict), and 0 if the key isn't present.
+// The first reusable "zombie" pair--one whose value was removed--is written
+// to *zombie_out (also 1-based, 0 if none).
+//
+static REBLEN Find_Map_Entry_Linear(
+    REBMAP *map,
+    Cell(const*) key,
+    REBSPC *key_specifier,
+    bool strict,
+    REBLEN *zombie_out
+){
+    Array(*) pairlist = MAP_PAIRLIST(map);
+
+    *zombie_out = 0;
+    REBLEN synonym = 0;
+
+    REBLEN i = 0;
+    Cell(const*) tail = ARR_TAIL(pairlist);
+    Cell(const*) k = ARR_HEAD(pairlist);
+    for (; k != tail; k += 2) {
+        ++i;
+
+        if (0 == Cmp_Value(k, key, true)) {
+            if (strict)
+                return i;
+            if (synonym != 0)  // another equivalent key already matched
+                fail (Error_Conflicting_Key(key, key_specifier));
+            synonym = i;
+            continue;
+        }
+
+        if (not strict and 0 == Cmp_Value(k, key, false)) {
+            if (synonym != 0)
+                fail (Error_Conflicting_Key(key, key_specifier));
+            synonym = i;
+            continue;
+        }
+
+        if (Is_Void(k + 1) and *zombie_out == 0)
+            *zombie_out = i;
+    }
+
+    return synonym;  // 0 if no match at all
+}
+
+
+//
+//  Reserve_Map: C
+//
+// Pre-size a map for `extra` additional key/value pairs beyond what it
+// currently holds.  The pairlist gets its capacity in one expansion, and the
+// hashlist is remade large enough that Find_Map_Entry() won't hit its
+// expand-and-rehash threshold until the reservation is used up...so a
+// known-size ingest can run with zero reallocation.
+//
+void Reserve_Map(REBMAP *map, REBLEN extra)
+{
+    Array(*) pairlist = MAP_PAIRLIST(map);
+    if (extra > 0)
+        Extend_Series_If_Necessary(pairlist, extra * 2);
+
+    REBLEN pairs = (ARR_LEN(pairlist) / 2) + extra;
+
+    REBSER *hashlist = MAP_HASHLIST(map);
+    if (
+        hashlist != nullptr
+        and Get_Subclass_Flag(HASHLIST, hashlist, COPY_ON_WRITE)
+    ){
+        // A shared hashlist can't be remade in place; leave it to the other
+        // sharers and let the logic below build a private right-sized one.
+        //
+        mutable_LINK(Hashlist, pairlist) = nullptr;
+        hashlist = nullptr;
+    }
+    if (hashlist == nullptr) {  // small map, scanned linearly
+        if (pairs < MIN_DICT)
+            return;  // reservation fits the linear representation
+        Hashify_Map(map, pairs * 2);  // four slots per reserved pair
+        return;
+    }
+
+    // Find_Map_Entry() expands when the pairlist cell count exceeds half the
+    // hashlist's slots, so the reservation needs four slots per pair.
+    //
+    if (SER_USED(hashlist) >= pairs * 4)
+        return;  // already roomy enough
+
+    REBINT prime = Get_Hash_Prime_May_Fail(pairs * 4);
+    Remake_Series(
+        hashlist,
+        prime + 1,
+        SERIES_FLAG_POWER_OF_2  // not(NODE_FLAG_NODE) => don't keep data
+    );
+    Clear_Series(hashlist);
+    SET_SERIES_LEN(hashlist, prime);
+
+    Rehash_Map(map);
+}
+
+
 //
 //  Find_Map_Entry: C
 //
@@ -261,27 +459,55 @@ REBLEN Find_Map_Entry(
 ) {
     assert(not Is_Isotope(key));
 
-    REBSER *hashlist = MAP_HASHLIST(map); // can be null
     Array(*) pairlist = MAP_PAIRLIST(map);
+    REBSER *hashlist = MAP_HASHLIST(map);  // null if small map (linear scan)
 
-    assert(hashlist);
-
-    // Get hash table, expand it if needed:
-    if (ARR_LEN(pairlist) > SER_USED(hashlist) / 2) {
-        Expand_Hash(hashlist); // modifies size value
-        Rehash_Map(map);
+    if (hashlist == nullptr and ARR_LEN(pairlist) >= MIN_DICT * 2) {
+        //
+        // The map has outgrown linear scanning; upgrade it transparently.
+        // (Make_Hash_Series() doubles internally, so sizing by the cell
+        // count gives the usual four hash slots per pair.)
+        //
+        Hashify_Map(map, ARR_LEN(pairlist));
+        hashlist = MAP_HASHLIST(map);
     }
 
-    const REBLEN wide = 2;
-    const Byte mode = 0; // just search for key, don't add it
-    REBLEN slot = Find_Key_Hashed(
-        pairlist, hashlist, key, key_specifier, wide, strict, mode
-    );
+    REBLEN n;
+    REBLEN slot = 0;  // hash slot for a new entry's index (hashed form only)
+    REBLEN zombie = 0;  // reusable removed pair (1-based), if insert needed
 
-    REBLEN *indexes = SER_HEAD(REBLEN, hashlist);
-    REBLEN n = indexes[slot];
+    if (hashlist == nullptr)
+        n = Find_Map_Entry_Linear(map, key, key_specifier, strict, &zombie);
+    else {
+        // Get hash table, expand it if needed:
+        if (ARR_LEN(pairlist) > SER_USED(hashlist) / 2) {
+            if (Get_Subclass_Flag(HASHLIST, hashlist, COPY_ON_WRITE)) {
+                //
+                // Can't remake a hashlist other maps may share--and copying
+                // it first would be wasted work since it's about to be
+                // rebuilt.  Leave it to the sharers; build a right-sized
+                // private one.
+                //
+                mutable_LINK(Hashlist, pairlist) = nullptr;
+                Hashify_Map(map, ARR_LEN(pairlist));
+            }
+            else {
+                Expand_Hash(hashlist); // modifies size value
+                Rehash_Map(map);
+            }
+            hashlist = MAP_HASHLIST(map);
+        }
 
-    // n==0 or pairlist[(n-1)*]=~key
+        const REBLEN wide = 2;
+        const Byte mode = 0; // just search for key, don't add it
+        slot = Find_Key_Hashed(
+            pairlist, hashlist, key, key_specifier, wide, strict, mode
+        );
+
+        n = SER_HEAD(struct Reb_Hashlist_Entry, hashlist)[slot].index;
+
+        // n==0 or pairlist[(n-1)*]=~key
+    }
 
     if (val == NULL)
         return n; // was just fetching the value
@@ -295,23 +521,45 @@ REBLEN Find_Map_Entry(
 
     // Must set the value:
     if (n) {  // re-set it:
+        Cell(*) slot_val = ARR_AT(pairlist, ((n - 1) * 2) + 1);
+        if (Is_Void(slot_val)) {
+            if (not Is_Void(val))
+                ++pairlist->misc.length;  // zombie brought back to life
+        }
+        else {
+            if (Is_Void(val))
+                --pairlist->misc.length;  // void value removes the key
+        }
+        Derelativize(slot_val, val, val_specifier);
+        return n;
+    }
+
+    if (Is_Void(val)) return 0; // trying to remove non-existing key
+
+    if (zombie != 0) {  // linear scan found a removed pair to reuse
+        Derelativize(ARR_AT(pairlist, (zombie - 1) * 2), key, key_specifier);
         Derelativize(
-            ARR_AT(pairlist, ((n - 1) * 2) + 1),
+            ARR_AT(pairlist, ((zombie - 1) * 2) + 1),
             val,
             val_specifier
         );
-        return n;
+        ++pairlist->misc.length;
+        return zombie;
     }
 
-    if (Is_Void(val)) return 0; // trying to remove non-existing key
-
     // Create new entry.  Note that it does not copy underlying series (e.g.
     // the data of a string), which is why the immutability test is necessary
     //
     Append_Value_Core(pairlist, key, key_specifier);
     Append_Value_Core(pairlist, val, val_specifier);
+    ++pairlist->misc.length;
 
-    return (indexes[slot] = (ARR_LEN(pairlist) / 2));
+    n = ARR_LEN(pairlist) / 2;
+    if (hashlist) {
+        hashlist = Ensure_Private_Hashlist(map);  // slot valid in the clone
+        SER_HEAD(struct Reb_Hashlist_Entry, hashlist)[slot].index = n;
+    }
+    return n;
 }
 
 
@@ -382,17 +630,23 @@ inline static REBMAP *Copy_Map(const REBMAP *map, REBU64 types) {
         SPECIFIED,
         SERIES_MASK_PAIRLIST
     );
-
-    // So long as the copied pairlist is the same array size as the original,
-    // a literal copy of the hashlist can still be used, as a start (needs
-    // its own copy so new map's hashes will reflect its own mutations)
+    copy->misc.length = MAP_PAIRLIST(map)->misc.length;  // same live entries
+
+    // Since the copied pairlist is the same array size as the original, the
+    // original's hashlist describes it exactly--so share it instead of
+    // duplicating it.  Overwriting values never touches the hash table, so
+    // versioning patterns (copy a map, poke some changes) keep sharing one
+    // hashlist across all the versions.  Whichever map makes a structural
+    // change first (add/remove a key, expand) clones a private copy at that
+    // point--see HASHLIST_FLAG_COPY_ON_WRITE in %sys-map.h.
     //
-    REBSER *hashlist = Copy_Series_Core(
-        MAP_HASHLIST(map),
-        SERIES_FLAGS_NONE | FLAG_FLAVOR(HASHLIST)
-            // ^-- !!! No NODE_FLAG_MANAGED?
-    );
-    mutable_LINK(Hashlist, copy) = hashlist;
+    if (MAP_HASHLIST(map) == nullptr)
+        mutable_LINK(Hashlist, copy) = nullptr;  // small map, linear scan
+    else {
+        REBSER *hashlist = MAP_HASHLIST(map);  // LINK() gives mutable access
+        Set_Subclass_Flag(HASHLIST, hashlist, COPY_ON_WRITE);
+        mutable_LINK(Hashlist, copy) = hashlist;
+    }
 
     if (types == 0)
         return MAP(copy); // no types have deep copy requested, shallow is OK
@@ -713,11 +967,23 @@ REBTYPE(Map)
         REBMAP *m = VAL_MAP_ENSURE_MUTABLE(map);
 
         Reset_Array(MAP_PAIRLIST(m));
+        MAP_PAIRLIST(m)->misc.length = 0;
 
         // !!! Review: should the space for the hashlist be reclaimed?  This
         // clears all the indices but doesn't scale back the size.
         //
-        Clear_Series(MAP_HASHLIST(m));
+        if (MAP_HASHLIST(m)) {  // small maps have no hashlist
+            if (Get_Subclass_Flag(HASHLIST, MAP_HASHLIST(m), COPY_ON_WRITE)) {
+                //
+                // Can't wipe a hashlist other maps may share; just drop it.
+                // The map reverts to linear form and regrows a hashlist if it
+                // passes MIN_DICT again (small maps have none at all).
+                //
+                mutable_LINK(Hashlist, MAP_PAIRLIST(m)) = nullptr;
+            }
+            else
+                Clear_Series(MAP_HASHLIST(m));
+        }
 
         return Init_Map(OUT, m); }
 
@@ -617,13 +617,9 @@ Bounce MAKE_Context(
         : cast(Context(*), nullptr);  // C++98 ambiguous w/o cast
 
     if (IS_BLOCK(arg)) {
-        Cell(const*) tail;
-        Cell(const*) at = VAL_ARRAY_AT(&tail, arg);
-
-        Context(*) ctx = Make_Context_Detect_Managed(
+        Context(*) ctx = Make_Context_For_Spec_Managed(
             kind,
-            at,
-            tail,
+            arg,  // frozen specs get their keylist cached by identity
             parent_ctx
         );
         Init_Context_Cell(OUT, kind, ctx); // GC guards it
@@ -709,7 +705,7 @@ DECLARE_NATIVE(meta_of)  // see notes on MISC_META()
 
     Context(*) meta;
     if (IS_ACTION(v))
-        meta = ACT_META(VAL_ACTION(v));
+        meta = Force_Action_Meta(VAL_ACTION(v));  // may be a deferred build
     else {
         assert(ANY_CONTEXT(v));
         meta = CTX_META(VAL_CONTEXT(v));
@@ -1465,3 +1461,29 @@ DECLARE_NATIVE(construct)
 
     return OUT;
 }
+
+
+//
+//  derive: native [
+//
+//  {Make an instance of a prototype object, sharing its field values}
+//
+//      return: [object!]
+//      prototype "Fields start out shared (and const), not deep-copied"
+//          [object!]
+//  ]
+//
+DECLARE_NATIVE(derive)
+//
+// CONSTRUCT/WITH deep-copies every field of the prototype, which is wasteful
+// when mass-producing instances that override only a few fields.  DERIVE
+// starts each field as a const alias of the prototype's value; SET a field
+// and the slot takes the new value like any other.  See the notes on
+// Derive_Context_Shared_Managed() for what sharing implies about bindings.
+{
+    INCLUDE_PARAMS_OF_DERIVE;
+
+    Context(*) parent = VAL_CONTEXT(ARG(prototype));
+
+    return Init_Object(OUT, Derive_Context_Shared_Managed(parent));
+}
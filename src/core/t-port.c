@@ -188,6 +188,7 @@ REBTYPE(Port)
         UNUSED(PARAM(source));
         UNUSED(PARAM(part));
         UNUSED(PARAM(seek));
+        UNUSED(PARAM(mmap));  // actors supporting it return the view directly
 
         if (Is_Nulled(OUT))
             return nullptr;  // !!! `read dns://` returns nullptr on failure
@@ -66,13 +66,54 @@ REBINT CT_String(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
     );
 
     REBLEN l1;
-    Utf8(const*) cp1 = VAL_UTF8_LEN_SIZE_AT(&l1, nullptr, a);
+    Size s1;
+    Utf8(const*) cp1 = VAL_UTF8_LEN_SIZE_AT(&l1, &s1, a);
 
     REBLEN l2;
-    Utf8(const*) cp2 = VAL_UTF8_LEN_SIZE_AT(&l2, nullptr, b);
+    Size s2;
+    Utf8(const*) cp2 = VAL_UTF8_LEN_SIZE_AT(&l2, &s2, b);
+
+    if (strict) {
+        //
+        // UTF-8 was designed so that comparing encoded bytes sorts in the
+        // same order as comparing the decoded codepoints.  So the strict
+        // case needs no decoding at all...which matters most for short
+        // strings (e.g. in-cell issues) where the decode loop would cost
+        // more than everything done to reach this point.
+        //
+        REBINT d = memcmp(cp1, cp2, MIN(s1, s2));
+        if (d != 0)
+            return d > 0 ? 1 : -1;
+        if (s1 == s2)
+            return 0;
+        return s1 > s2 ? 1 : -1;
+    }
 
     REBLEN len = MIN(l1, l2);
 
+    Size smin = MIN(s1, s2);
+    while (smin >= UTF8_SWAR_CHUNK) {
+        //
+        // An ASCII chunk is one codepoint per byte, so machine words of
+        // the two strings can be case-folded and compared without any
+        // decoding.  (See Hash_UTF8_Len_Caseless for the hashing analogue.)
+        //
+        uintptr_t chunk1;
+        uintptr_t chunk2;
+        memcpy(&chunk1, cp1, sizeof(chunk1));
+        memcpy(&chunk2, cp2, sizeof(chunk2));
+        if ((chunk1 | chunk2) & SWAR_HIGHS)
+            break;  // non-ASCII byte somewhere, decode codepoints instead
+
+        if (Ascii_Chunk_Lowercase(chunk1) != Ascii_Chunk_Lowercase(chunk2))
+            break;  // difference in chunk; locate it codepoint by codepoint
+
+        cp1 = cast(Utf8(const*), cast(const Byte*, cp1) + UTF8_SWAR_CHUNK);
+        cp2 = cast(Utf8(const*), cast(const Byte*, cp2) + UTF8_SWAR_CHUNK);
+        smin -= UTF8_SWAR_CHUNK;
+        len -= UTF8_SWAR_CHUNK;
+    }
+
     for (; len > 0; len--) {
         Codepoint c1;
         Codepoint c2;
@@ -80,12 +121,7 @@ REBINT CT_String(noquote(Cell(const*)) a, noquote(Cell(const*)) b, bool strict)
         cp1 = NEXT_CHR(&c1, cp1);
         cp2 = NEXT_CHR(&c2, cp2);
 
-        REBINT d;
-        if (strict)
-            d = c1 - c2;
-        else
-            d = LO_CASE(c1) - LO_CASE(c2);
-
+        REBINT d = LO_CASE(c1) - LO_CASE(c2);
         if (d != 0)
             return d > 0 ? 1 : -1;
     }
@@ -848,7 +884,7 @@ REBTYPE(String)
         Size size_old = STR_SIZE(s);
 
         Remove_Series_Units(s, offset, size);  // !!! at one time, kept term
-        Free_Bookmarks_Maybe_Null(s);
+        Adjust_Bookmarks_On_Remove(s, index, offset, len, size);
         TERM_STR_LEN_SIZE(s, tail - len, size_old - size);
 
         return COPY(v); }
@@ -1042,9 +1078,14 @@ REBTYPE(String)
         if (index == 0 and GET_SERIES_FLAG(s, DYNAMIC))
             Unbias_Series(s, false);
 
-        Free_Bookmarks_Maybe_Null(s);  // review!
-        Size offset = VAL_BYTEOFFSET_FOR_INDEX(v, index);
-        Free_Bookmarks_Maybe_Null(s);
+        Size offset = VAL_BYTEOFFSET_FOR_INDEX(v, index);  // may use bookmark
+
+        // Clearing is a removal of everything from `index` to the tail, so
+        // the bookmark survives by clamping rather than being thrown away.
+        //
+        Adjust_Bookmarks_On_Remove(
+            s, index, offset, tail - index, STR_SIZE(s) - offset
+        );
 
         TERM_STR_LEN_SIZE(s, cast(REBLEN, index), offset);
         return COPY(v); }
@@ -1068,7 +1109,13 @@ REBTYPE(String)
     //-- Special actions:
 
       case SYM_SWAP: {
-        REBVAL *arg = D_ARG(2);
+        INCLUDE_PARAMS_OF_SWAP;
+        UNUSED(ARG(series1));  // covered by `v`
+
+        REBVAL *arg = ARG(series2);
+
+        if (REF(part))
+            fail (Error_Bad_Refines_Raw());  // only arrays swap runs
 
         if (VAL_TYPE(v) != VAL_TYPE(arg))
             fail (Error_Not_Same_Type_Raw());
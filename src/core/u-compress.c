@@ -134,7 +134,10 @@ Byte* Compress_Alloc_Core(
     option(Size*) size_out,
     const void* input,
     Size size_in,
-    enum Reb_Symbol_Id envelope  // SYM_NONE, SYM_ZLIB, or SYM_GZIP
+    enum Reb_Symbol_Id envelope,  // SYM_NONE, SYM_ZLIB, or SYM_GZIP
+    int level,  // Z_DEFAULT_COMPRESSION (-1), or 0 (none) to 9 (best)
+    const Byte* dict,  // optional preset dictionary (gzip can't store one)
+    Size dict_size
 ){
     z_stream strm;
     strm.zalloc = &zalloc;  // fail() cleans up automatically, see notes
@@ -165,7 +168,7 @@ Byte* Compress_Alloc_Core(
     //
     int ret_init = deflateInit2(
         &strm,
-        Z_DEFAULT_COMPRESSION,
+        level,
         Z_DEFLATED,
         window_bits,
         8,
@@ -174,6 +177,21 @@ Byte* Compress_Alloc_Core(
     if (ret_init != Z_OK)
         fail (Error_Compression(&strm, ret_init));
 
+    if (dict) {
+        //
+        // A preset dictionary primes the compression window, so common
+        // substrings in small payloads don't have to be emitted literally.
+        // The gzip header has no dictionary id field, so the format can't
+        // express that one was used.
+        //
+        if (envelope == SYM_GZIP)
+            fail ("GZIP envelope cannot store a preset dictionary");
+
+        int ret_setdict = deflateSetDictionary(&strm, dict, dict_size);
+        if (ret_setdict != Z_OK)
+            fail (Error_Compression(&strm, ret_setdict));
+    }
+
     // http://stackoverflow.com/a/4938401
     //
     REBLEN buf_size = deflateBound(&strm, size_in);
@@ -228,7 +246,9 @@ Byte* Decompress_Alloc_Core(
     const void *input,
     Size size_in,
     int max,
-    enum Reb_Symbol_Id envelope  // SYM_NONE, SYM_ZLIB, SYM_GZIP, or SYM_DETECT
+    enum Reb_Symbol_Id envelope,  // SYM_NONE, SYM_ZLIB, SYM_GZIP, SYM_DETECT
+    const Byte* dict,  // preset dictionary, required if compression used one
+    Size dict_size
 ){
     z_stream strm;
     strm.zalloc = &zalloc;  // fail() cleans up automatically, see notes
@@ -265,6 +285,17 @@ Byte* Decompress_Alloc_Core(
     if (ret_init != Z_OK)
         fail (Error_Compression(&strm, ret_init));
 
+    if (dict and envelope == SYM_NONE) {
+        //
+        // Raw deflate has no way to signal Z_NEED_DICT, so the dictionary
+        // has to be set before any input is processed.  (Zlib envelopes
+        // announce the need mid-stream; that's handled in the loop below.)
+        //
+        int ret_setdict = inflateSetDictionary(&strm, dict, dict_size);
+        if (ret_setdict != Z_OK)
+            fail (Error_Compression(&strm, ret_setdict));
+    }
+
     REBLEN buf_size;
     if (
         envelope == SYM_GZIP  // not DETECT, trust stored size
@@ -327,6 +358,16 @@ Byte* Decompress_Alloc_Core(
         if (ret_inflate == Z_STREAM_END)
             break;  // Finished. (and buffer was big enough)
 
+        if (ret_inflate == Z_NEED_DICT) {
+            if (not dict)
+                fail ("Data was compressed with a dictionary, none given");
+
+            int ret_setdict = inflateSetDictionary(&strm, dict, dict_size);
+            if (ret_setdict != Z_OK)
+                fail (Error_Compression(&strm, ret_setdict));
+            continue;
+        }
+
         if (ret_inflate != Z_OK)
             fail (Error_Compression(&strm, ret_inflate));
 
@@ -374,6 +415,126 @@ Byte* Decompress_Alloc_Core(
 }
 
 
+//=//// RAW NO-FAIL DEFLATE ///////////////////////////////////////////////=//
+//
+// The Alloc_Core routines above use rebMalloc()-backed memory and fail() on
+// errors, which makes them unusable from contexts that cannot unwind--most
+// notably the garbage collector, which deflates cold function bodies during
+// a recycle (see %m-gc.c).  These variants work on caller-provided buffers,
+// use plain malloc() for zlib's internal state (zlib treats an allocation
+// failure as Z_MEM_ERROR), and report problems by returning false.
+
+static void *zalloc_raw(void *opaque, unsigned nr, unsigned size)
+{
+    UNUSED(opaque);
+    return malloc(cast(size_t, nr) * size);  // null is Z_MEM_ERROR to zlib
+}
+
+static void zfree_raw(void *opaque, void *addr)
+{
+    UNUSED(opaque);
+    free(addr);
+}
+
+
+//
+//  Deflate_Raw_Bound: C
+//
+// Worst-case size of a raw deflate of SIZE_IN bytes; how much buffer
+// Try_Deflate_Raw() needs to be guaranteed not to run out of output room.
+//
+Size Deflate_Raw_Bound(Size size_in)
+{
+    return deflateBound(nullptr, size_in);  // null strm: conservative bound
+}
+
+
+//
+//  Try_Deflate_Raw: C
+//
+// Compress SIZE_IN bytes of INPUT into OUT as a raw deflate stream (no zlib
+// or gzip envelope).  On entry *SIZE_INOUT is the capacity of OUT; on a true
+// return it holds the compressed size.  Returns false on any error, without
+// failing--the caller decides what to do about incompressible data.
+//
+bool Try_Deflate_Raw(
+    Byte* out,
+    Size* size_inout,
+    const void* input,
+    Size size_in
+){
+    z_stream strm;
+    strm.zalloc = &zalloc_raw;
+    strm.zfree = &zfree_raw;
+    strm.opaque = nullptr;
+
+    int ret_init = deflateInit2(
+        &strm,
+        Z_DEFAULT_COMPRESSION,
+        Z_DEFLATED,
+        window_bits_zlib_raw,
+        8,
+        Z_DEFAULT_STRATEGY
+    );
+    if (ret_init != Z_OK)
+        return false;
+
+    strm.avail_in = size_in;
+    strm.next_in = cast(const z_Bytef*, input);
+    strm.avail_out = *size_inout;
+    strm.next_out = out;
+
+    int ret_deflate = deflate(&strm, Z_FINISH);
+    if (ret_deflate != Z_STREAM_END) {
+        deflateEnd(&strm);
+        return false;
+    }
+
+    *size_inout = strm.total_out;
+    deflateEnd(&strm);
+    return true;
+}
+
+
+//
+//  Try_Inflate_Raw: C
+//
+// Decompress a raw deflate stream whose original size is known exactly (the
+// cold body code stores it alongside the blob).  Returns false if the data
+// does not inflate to precisely OUT_SIZE bytes.
+//
+bool Try_Inflate_Raw(
+    void* out,
+    Size out_size,
+    const Byte* input,
+    Size size_in
+){
+    z_stream strm;
+    strm.zalloc = &zalloc_raw;
+    strm.zfree = &zfree_raw;
+    strm.opaque = nullptr;
+
+    strm.avail_in = size_in;
+    strm.next_in = cast(const z_Bytef*, input);
+
+    int ret_init = inflateInit2(&strm, window_bits_zlib_raw);
+    if (ret_init != Z_OK)
+        return false;
+
+    strm.avail_out = out_size;
+    strm.next_out = cast(z_Bytef*, out);
+
+    int ret_inflate = inflate(&strm, Z_FINISH);
+    if (ret_inflate != Z_STREAM_END or strm.total_out != cast(uLong, out_size)) {
+        inflateEnd(&strm);
+        return false;
+    }
+
+    inflateEnd(&strm);
+    return true;
+}
+
+
 //
 //  checksum-core: native [
 //
@@ -461,6 +622,10 @@ DECLARE_NATIVE(checksum_core)
 //          [any-value!]
 //      /envelope "ZLIB (adler32, no size) or GZIP (crc32, uncompressed size)"
 //          [word!]
+//      /level "Compression level: 0 (store) to 9 (best), default is 6"
+//          [integer!]
+//      /dict "Preset compression dictionary (can't be used with GZIP)"
+//          [binary!]
 //  ]
 //
 DECLARE_NATIVE(deflate)
@@ -487,12 +652,27 @@ DECLARE_NATIVE(deflate)
         }
     }
 
+    int level = Z_DEFAULT_COMPRESSION;
+    if (REF(level)) {
+        level = VAL_INT32(ARG(level));
+        if (level < 0 or level > 9)
+            fail (PARAM(level));
+    }
+
+    const Byte* dict = nullptr;
+    Size dict_size = 0;
+    if (REF(dict))
+        dict = VAL_BINARY_SIZE_AT(&dict_size, ARG(dict));
+
     size_t compressed_size;
     void *compressed = Compress_Alloc_Core(
         &compressed_size,
         bp,
         size,
-        envelope
+        envelope,
+        level,
+        dict,
+        dict_size
     );
 
     return rebRepossess(compressed, compressed_size);
@@ -512,6 +692,8 @@ DECLARE_NATIVE(deflate)
 //          [integer!]
 //      /envelope "ZLIB, GZIP, or DETECT (http://stackoverflow.com/a/9213826)"
 //          [word!]
+//      /dict "Preset dictionary matching the one given at compression time"
+//          [binary!]
 //  ]
 //
 DECLARE_NATIVE(inflate)
@@ -564,13 +746,20 @@ DECLARE_NATIVE(inflate)
         }
     }
 
+    const Byte* dict = nullptr;
+    Size dict_size = 0;
+    if (REF(dict))
+        dict = VAL_BINARY_SIZE_AT(&dict_size, ARG(dict));
+
     size_t decompressed_size;
     void *decompressed = Decompress_Alloc_Core(
         &decompressed_size,
         data,
         size,
         max,
-        envelope
+        envelope,
+        dict,
+        dict_size
     );
 
     return rebRepossess(decompressed, decompressed_size);
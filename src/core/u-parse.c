@@ -307,8 +307,35 @@ static bool Subparse_Throws(
     //
     Set_Executor_Flag(ACTION, f, IN_DISPATCH);
 
+    // While the grammar profiler is on, count this recursion against the
+    // rule block's row.  The table can move (or be torn down and restarted
+    // by PARSE-PROFILE running in a GROUP!) during the recursion, so hold
+    // an index--and re-check validity--rather than keeping a pointer.
+    //
+    REBLEN tally_index = 0;
+    bool tallying = TG_Parse_Profiling and not FEED_IS_VARIADIC(f->feed);
+    if (tallying) {
+        REB_PARSE_TALLY *tally = Tally_Parse_Rule(FEED_ARRAY(f->feed));
+        ++tally->entries;
+        tally_index = tally - TG_Parse_Tallies;
+    }
+
     Bounce b = N_subparse(f);
 
+    if (
+        tallying
+        and TG_Parse_Profiling
+        and tally_index < TG_Parse_Tallies_Used
+    ){
+        REB_PARSE_TALLY *tally = &TG_Parse_Tallies[tally_index];
+        if (b != BOUNCE_THROWN) {  // a throw is neither match nor miss
+            if (Is_Nulled(out))
+                ++tally->misses;
+            else
+                ++tally->matches;
+        }
+    }
+
     Drop_Action(f);
 
     if ((b == BOUNCE_THROWN or Is_Nulled(out)) and collection)
@@ -722,6 +749,99 @@ static REBIXO Parse_One_Rule(
 }
 
 
+//
+//  Parse_Bitset_Run: C
+//
+// Iterated single-character BITSET! rules (`some digit`, `opt some space`)
+// are the workhorse of scanning grammars.  Going through the full iterated
+// rule dispatch once per character--with its per-iteration re-examination of
+// the rule cell--costs far more than the actual bit test.  This consumes a
+// whole run in a tight loop; the caller folds the result back into the
+// iteration logic so all of the exit paths stay shared.
+//
+// Returns how many units (codepoints for strings, bytes for binaries)
+// matched starting at P_POS, up to `limit`.  Must behave exactly as if
+// Parse_One_Rule() had been called once per unit.
+//
+static REBLEN Parse_Bitset_Run(
+    Frame(*) frame_,
+    Cell(const*) rule,
+    REBLEN limit
+){
+    USE_PARAMS_OF_SUBPARSE;
+
+    assert(not IS_SER_ARRAY(P_INPUT));
+
+    Binary(const*) bset = VAL_BITSET(rule);
+    REBLEN len = P_INPUT_LEN;
+    REBLEN run = 0;
+
+    REBLEN most;  // units between the position and the end of input
+    if (P_POS >= cast(REBIDX, len))
+        most = 0;
+    else
+        most = len - P_POS;
+    if (most > limit)
+        most = limit;
+
+    if (P_TYPE == REB_BINARY) {
+        const Byte* bp = BIN_AT(BIN(P_INPUT), P_POS);
+        if (most >= BITSET_BYTE_TABLE_THRESHOLD) {
+            Byte table[256];
+            Fill_Bitset_Byte_Table(table, bset, false);  // binary is cased
+            while (run != most and table[bp[run]])
+                ++run;
+        }
+        else {
+            while (run != most and Check_Bit(bset, bp[run], false))
+                ++run;
+        }
+    }
+    else {
+        bool uncased = not (P_FLAGS & AM_FIND_CASE);
+        Utf8(const*) cp = STR_AT(STR(P_INPUT), P_POS);
+        if (most >= BITSET_BYTE_TABLE_THRESHOLD) {
+            //
+            // ASCII characters are a single byte in UTF-8, so they can be
+            // tested straight out of the table without decoding (and each
+            // one advances the codepoint count by exactly one).  Anything
+            // with the high bit set gets the full decode-and-Check_Bit.
+            //
+            Byte table[256];
+            Fill_Bitset_Byte_Table(table, bset, uncased);
+            while (run != most) {
+                Byte b = *cast(const Byte*, cp);
+                if (b < 0x80) {
+                    if (not table[b])
+                        break;
+                    cp = cast(Utf8(const*), cast(const Byte*, cp) + 1);
+                }
+                else {
+                    Codepoint c;
+                    Utf8(const*) next = NEXT_CHR(&c, cp);
+                    if (not Check_Bit(bset, c, uncased))
+                        break;
+                    cp = next;
+                }
+                ++run;
+            }
+        }
+        else {
+            while (run != most) {
+                Codepoint c;
+                Utf8(const*) next = NEXT_CHR(&c, cp);
+                if (not Check_Bit(bset, c, uncased))
+                    break;
+                cp = next;
+                ++run;
+            }
+        }
+    }
+
+    return run;
+}
+
+
 //
 //  To_Thru_Block_Rule: C
 //
@@ -1418,11 +1538,9 @@ DECLARE_NATIVE(subparse)
 
       do_signals:
 
-      #if !defined(NDEBUG)  // Total_Eval_Cycles is periodically reconciled
-        ++Total_Eval_Cycles_Doublecheck;
-      #endif
+        ++Total_Eval_Cycles;  // monotonic; backs METRICS and /TICKS budgets
 
-        if (--Eval_Countdown <= 0) {
+        if (Eval_Signal_Pending) {
             if (Do_Signals_Throws(FRAME))
                 return THROWN;
         }
@@ -2316,6 +2434,28 @@ DECLARE_NATIVE(subparse)
                 ? END_FLAG
                 : P_INPUT_LEN;
         }
+        else if (
+            IS_BITSET(rule)
+            and not IS_SER_ARRAY(P_INPUT)
+            and maxcount - count > 1  // batching gains nothing for one probe
+            and Trace_Level == 0  // trace wants per-match output
+        ){
+            // Hot path: consume the whole run of matching characters at
+            // once, instead of dispatching per character.  All but the last
+            // match of the run are accounted for here; the last one flows
+            // through the regular bottom-of-loop bookkeeping (count, the
+            // FURTHER check, assignment of P_POS) so the semantics cannot
+            // drift from the one-at-a-time case.
+            //
+            REBLEN run = Parse_Bitset_Run(f, rule, maxcount - count);
+            if (run == 0)
+                i = END_FLAG;  // current character (or end) didn't match
+            else {
+                count += run - 1;
+                P_POS += run - 1;
+                i = P_POS + 1;
+            }
+        }
         else {
             // Parse according to datatype
 
@@ -2630,6 +2770,9 @@ DECLARE_NATIVE(subparse)
         if (P_AT_END)  // no alternate rule
             goto return_null;
 
+        if (TG_Parse_Profiling and not FEED_IS_VARIADIC(f->feed))
+            ++Tally_Parse_Rule(FEED_ARRAY(f->feed))->backtracks;
+
         // Jump to the alternate rule and reset input
         //
         FETCH_NEXT_RULE(f);
@@ -289,6 +289,13 @@ inline static void INIT_VAL_ACTION_BINDING(
 #define Is_Action_Native(a) \
     Get_Action_Flag(VAL_ACTION(ACT_ARCHETYPE(a)), IS_NATIVE)
 
+// As with nativeness, leafness is a property of the archetype (a HIJACK
+// swaps in the hijacker's archetype, so a hijacked comparison correctly
+// stops claiming to be a leaf).  See CELL_FLAG_LEAF_NATIVE.
+//
+#define Is_Action_Leaf(a) \
+    Get_Cell_Flag(ACT_ARCHETYPE(a), LEAF_NATIVE)
+
 
 //=//// PARAMLIST, EXEMPLAR, AND PARTIALS /////////////////////////////////=//
 //
@@ -358,9 +365,18 @@ enum {
 
     IDX_NATIVE_CONTEXT,  // libRebol binds strings here (and lib)
 
+    IDX_NATIVE_INTRINSIC,  // HANDLE! of Intrinsic C function, or BLANK!
+
     IDX_NATIVE_MAX
 };
 
+// Only call on actions with DETAILS_FLAG_IS_INTRINSIC (set by Make_Native
+// when the dispatcher has a registered Intrinsic counterpart).
+//
+#define ACT_INTRINSIC(a) \
+    cast(Intrinsic*, VAL_HANDLE_CFUNC( \
+        DETAILS_AT(ACT_DETAILS(a), IDX_NATIVE_INTRINSIC)))
+
 
 #define KEY_SLOT(dsp)       Data_Stack_At((dsp) - 3)
 #define PARAM_SLOT(dsp)     Data_Stack_At((dsp) - 2)
@@ -580,7 +596,13 @@ enum {
     //
     ST_ACTION_DOING_PICKUPS,
 
-    ST_ACTION_TYPECHECKING
+    ST_ACTION_TYPECHECKING,
+
+    // RUN-FRAME uses this entry state for a FRAME! whose arguments were
+    // already vetted by a previous invocation ("armed").  The executor goes
+    // straight to dispatch, skipping the typechecking walk of the params.
+    //
+    ST_ACTION_PRECHECKED
 
     // Note: There is no ST_ACTION_DISPATCHING, because if an action is
     // dispatching, the STATE byte belongs to the dispatcher.  Detecting the
@@ -77,6 +77,60 @@ inline static bool Has_File_Line(Array(const*) a) {
 }
 
 
+//=//// SOURCE FORMAT TABLES (see ARRAY_FLAG_HAS_FORMAT_TABLE) ////////////=//
+//
+// Byte layout of the run-length-encoded whitespace table that the scanner
+// attaches to an array's ->misc when TRANSCODE/FORMATTED is used:
+//
+//     [0..3]  uint32_t line number of the array's opening position
+//     [4]     newlines before the closing delimiter
+//     [5]     indent column of the closing delimiter
+//     [6...]  triplets of (run length, newlines, indent): `run length`
+//             consecutive values are each preceded by `newlines` line
+//             breaks and start at byte column `indent`
+//
+// All byte fields saturate at 255.  The table is advisory--if the array is
+// modified after scanning, molding falls back to the per-cell newline flags
+// once the recorded runs are exhausted (see Mold_Array_At()).
+
+#define FORMAT_TABLE_HEADER_SIZE 6
+
+#define MISC_FORMAT_HACK(a) \
+    cast(Binary(*), m_cast(Node*, (a)->misc.any.node))  // BIN() not defined yet
+
+inline static bool Has_Format_Table(Array(const*) a) {
+    if (SER_FLAVOR(a) != FLAVOR_ARRAY)
+        return false;  // only plain arrays are scanner products
+
+    return did (a->leader.bits & ARRAY_FLAG_HAS_FORMAT_TABLE);
+}
+
+inline static Binary(const*) Array_Format_Table(Array(const*) a) {
+    assert(Has_Format_Table(a));
+    return MISC_FORMAT_HACK(a);
+}
+
+// The format table displaces the line number from ->misc (the line moves
+// into the table's header), so reads and writes must go through these.
+//
+inline static LineNumber Array_Line(Array(const*) a) {
+    if (not (a->leader.bits & ARRAY_FLAG_HAS_FORMAT_TABLE))
+        return a->misc.line;
+    uint32_t line;
+    memcpy(&line, SER_DATA(MISC_FORMAT_HACK(a)), sizeof(line));
+    return line;
+}
+
+inline static void Set_Array_Line(Array(*) a, LineNumber line) {
+    if (not (a->leader.bits & ARRAY_FLAG_HAS_FORMAT_TABLE)) {
+        a->misc.line = line;
+        return;
+    }
+    uint32_t line32 = cast(uint32_t, line);
+    memcpy(SER_DATA(MISC_FORMAT_HACK(a)), &line32, sizeof(line32));
+}
+
+
 // HEAD, TAIL, and LAST refer to specific value pointers in the array.  Since
 // empty arrays have no "last" value then ARR_LAST should not be called on it.
 
@@ -218,7 +272,7 @@ inline static Array(*) Make_Array_Core_Into(
             Get_Subclass_Flag(ARRAY, FRM_ARRAY(TOP_FRAME), HAS_FILE_LINE_UNMASKED)
         ){
             mutable_LINK(Filename, s) = LINK_FILENAME_HACK(FRM_ARRAY(TOP_FRAME));
-            s->misc.line = FRM_ARRAY(TOP_FRAME)->misc.line;
+            s->misc.line = Array_Line(FRM_ARRAY(TOP_FRAME));
         }
         else {
             Clear_Subclass_Flag(ARRAY, s, HAS_FILE_LINE_UNMASKED);
@@ -270,7 +324,7 @@ inline static Array(*) Make_Array_For_Copy(
             flags & ~ARRAY_FLAG_HAS_FILE_LINE_UNMASKED
         );
         mutable_LINK(Filename, a) = LINK_FILENAME_HACK(original);
-        a->misc.line = original->misc.line;
+        a->misc.line = Array_Line(original);
         Set_Subclass_Flag(ARRAY, a, HAS_FILE_LINE_UNMASKED);
         return a;
     }
@@ -36,6 +36,26 @@
 //   binary series can't use MISC() and LINK() for its own purposes.  (For
 //   the moment, typesets cannot be aliased, so you can't get into a situation
 //   like `as text! as binary! make bitset! [...]`)
+//
+//   The exception is stubs that were *created* as FLAVOR_BINARY, which a
+//   string can never masquerade as.  Bitsets use MISC() for their negated
+//   bit on this basis, and zero-copy views made by Make_Binary_View() use
+//   LINK() to keep the series whose data they borrow alive.
+
+
+// A view's data pointer aims into storage the view does not own, so whatever
+// does own that storage can't be garbage collected while the view is extant.
+// Usually the owner is another (frozen) binary whose allocation the view
+// windows into...but it may be any managed stub standing in for a foreign
+// resource's lifetime, e.g. the HANDLE! holding a memory-mapped file (see
+// Make_Binary_View_Foreign()).  Hence the type here is just REBSER; code
+// wanting the flattening optimization for view-of-view chains has to check
+// the owner's flavor.  (Flavor checking on the view side means only
+// SERIES_FLAG_DATA_NOT_OWNED stubs should use this.)
+//
+#define LINK_ViewOwner_TYPE     REBSER*
+#define LINK_ViewOwner_CAST     SER
+#define HAS_LINK_ViewOwner      FLAVOR_BINARY
 
 
 #if CPLUSPLUS_11  // !!! Make fancier checks, as with SER() and ARR()
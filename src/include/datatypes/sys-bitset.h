@@ -40,6 +40,36 @@
 
 #define MAX_BITSET 0x7fffffff
 
+//=//// BINARY_FLAG_BITSET_INVERSION_LIST /////////////////////////////////=//
+//
+// A charset holding a few high codepoints (e.g. emoji for a tokenizer) would
+// materialize bit bytes up to its highest member--tens of kilobytes that a
+// scan loop then drags through cache.  So when MAKE BITSET! finishes building
+// a large-but-sparse set, the binary is switched in place to an "inversion
+// list": sorted uint32 boundaries at which membership toggles, tested by
+// binary search in Check_Bit().
+//
+// The compact form is an encoding of the raw bits only--the NOT annotation
+// stays in misc.negated, exactly as for the dense form.  Code that touches
+// the bytes directly (mutation via Set_Bits(), molding, aliasing as BINARY!
+// for the set operations) calls Densify_Bitset() to expand the series in
+// place first; membership-only clients never pay that cost.
+//
+#define BINARY_FLAG_BITSET_INVERSION_LIST \
+    SERIES_FLAG_24
+
+// Dense bitsets below this byte count are left alone: the savings can't be
+// worth a representation that costs a binary search per probe.
+//
+#define BITSET_COMPACT_THRESHOLD 512
+
+// Scanning kernels (PARSE runs, FIND) can precompute the answer Check_Bit()
+// would give for every byte value into a 256-entry table, then test one
+// table load per input byte.  Building the table costs 256 bit probes, so
+// callers only do it when the span to be covered is at least this long.
+//
+#define BITSET_BYTE_TABLE_THRESHOLD 64
+
 inline static bool BITS_NOT(const REBSER *s)
   { return s->misc.negated; }
 
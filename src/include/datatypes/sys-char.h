@@ -182,6 +182,99 @@ enum {
     DEL = 127
 };
 
+//=//// WORD-AT-A-TIME ASCII CHUNK SCANNING ///////////////////////////////=//
+//
+// Most strings that pass through UTF-8 validation are dominated by runs of
+// plain ASCII.  Rather than testing a byte at a time, a machine word of
+// input can be checked at once with "SIMD within a register" bit tricks
+// (the same masks vector units use, without requiring intrinsics or build
+// flags--compilers turn the loads into single instructions).
+//
+// The "clean" test also rejects NUL and CR in the same pass, since those are
+// the bytes Should_Skip_Ascii_Byte_May_Fail() has to give special treatment
+// regardless of string mode.  A chunk that passes can be appended in bulk.
+//
+// The zero-byte detection mask trick is the famous one from Mycroft:
+//
+// https://graphics.stanford.edu/~seander/bithacks.html#ZeroInWord
+//
+
+#define UTF8_SWAR_CHUNK  sizeof(uintptr_t)
+
+#define SWAR_ONES  (cast(uintptr_t, -1) / 0xFF)  // 0x0101...01
+#define SWAR_HIGHS  (SWAR_ONES << 7)  // 0x8080...80
+
+inline static bool Ascii_Chunk_Clean(const Byte* bp) {
+    uintptr_t chunk;
+    memcpy(&chunk, bp, sizeof(chunk));  // alignment-legal, compiles to load
+
+    if (chunk & SWAR_HIGHS)
+        return false;  // some byte has its high bit set (non-ASCII)
+
+    if ((chunk - SWAR_ONES) & ~chunk & SWAR_HIGHS)
+        return false;  // some byte is NUL
+
+    uintptr_t xcr = chunk ^ (SWAR_ONES * CR);  // CR bytes become zero
+    if ((xcr - SWAR_ONES) & ~xcr & SWAR_HIGHS)
+        return false;  // some byte is CR
+
+    return true;
+}
+
+// Lowercase every byte of an all-ASCII machine word at once.  A byte is in
+// 'A'..'Z' exactly when adding (0x80 - 'A') sets its high bit but adding
+// (0x7F - 'Z') does not--neither addition can carry into the next byte when
+// the input has no high bits set.  Shifting the resulting 0x80 markers right
+// by 2 gives the 0x20 ('a' - 'A') to add per capital letter.
+//
+// Callers must have already established the chunk is pure ASCII, e.g. with
+// Ascii_Chunk_Clean() or a (chunk & SWAR_HIGHS) test.
+//
+inline static uintptr_t Ascii_Chunk_Lowercase(uintptr_t chunk) {
+    assert(not (chunk & SWAR_HIGHS));
+
+    uintptr_t past_z = chunk + (SWAR_ONES * (0x7F - 'Z'));  // high: > 'Z'
+    uintptr_t from_a = chunk + (SWAR_ONES * (0x80 - 'A'));  // high: >= 'A'
+    uintptr_t caps = from_a & ~past_z & SWAR_HIGHS;  // 0x80 per capital
+
+    return chunk + (caps >> 2);  // 0x80 >> 2 is 0x20, the case offset
+}
+
+// Count how many codepoints start in a span of UTF-8 bytes, without decoding
+// them: every byte begins a codepoint except 10xxxxxx continuations.  Those
+// have the high bit set and the next bit clear, so `bit7 & ~bit6` marks one
+// per continuation in a whole machine word, and the usual SWAR horizontal
+// byte-sum tallies the marks (at most 8 per word, so no byte overflow).
+//
+// The span does not need to start or end on a codepoint boundary; partial
+// sequences count by their lead byte (or not at all, if it isn't included).
+//
+inline static REBLEN Count_Codepoints(const Byte* bp, Size size)
+{
+    REBLEN continuations = 0;
+    Size remaining = size;
+
+    while (remaining >= UTF8_SWAR_CHUNK) {
+        uintptr_t chunk;
+        memcpy(&chunk, bp, sizeof(chunk));  // alignment-legal, single load
+
+        uintptr_t marks = chunk & ~(chunk << 1) & SWAR_HIGHS;
+        continuations += cast(REBLEN,
+            ((marks >> 7) * SWAR_ONES) >> (8 * (UTF8_SWAR_CHUNK - 1))
+        );
+
+        bp += UTF8_SWAR_CHUNK;
+        remaining -= UTF8_SWAR_CHUNK;
+    }
+
+    for (; remaining > 0; --remaining, ++bp)
+        if (Is_Continuation_Byte_If_Utf8(*bp))
+            ++continuations;
+
+    return size - continuations;
+}
+
+
 #define UNICODE_CASES 0x2E00  // size of unicode folding table
 
 // !!! Cases present a lot of problems.  Technically speaking the upper and
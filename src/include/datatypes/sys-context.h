@@ -325,8 +325,6 @@ inline static REBVAR *MOD_VAR(Context(*) c, Symbol(const*) sym, bool strict) {
     Symbol(const*) synonym = sym;
     do {
         REBSER *patch = MISC(Hitch, sym);
-        while (GET_SERIES_FLAG(patch, BLACK))  // binding temps
-            patch = SER(node_MISC(Hitch, patch));
 
         for (; patch != sym; patch = SER(node_MISC(Hitch, patch))) {
             if (INODE(PatchContext, patch) == c)
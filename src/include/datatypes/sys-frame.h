@@ -118,7 +118,7 @@ inline static LineNumber FRM_LINE(Frame(*) f) {
         return 0;
     if (Not_Subclass_Flag(ARRAY, FRM_ARRAY(f), HAS_FILE_LINE_UNMASKED))
         return 0;
-    return FRM_ARRAY(f)->misc.line;
+    return Array_Line(FRM_ARRAY(f));
 }
 
 #define FRM_OUT(f) \
@@ -266,6 +266,28 @@ inline static const char* Frame_Label_Or_Anonymous_UTF8(Frame(*) f) {
 // This privileged level of access can be used by natives that feel they can
 // optimize performance by working with the evaluator directly.
 
+// Frames are allocated and freed at function call frequency, which is too
+// often to pay for the general Mem_Pools accounting each time.  A bounded
+// LIFO cache of shells is kept threaded through the PoolUnit next pointer,
+// in the same way the pool's own freelist would thread them.  Shells in the
+// cache are marked with FREED_SERIES_BYTE just as Free_Pooled() would mark
+// them, so any code enumerating nodes sees them as free.
+//
+// The cap keeps a deep recursion from holding a large number of shells
+// hostage after it unwinds; past the cap, shells go back to the pool.
+//
+#define FRAME_SHELL_CACHE_MAX 128
+
+inline static Frame(*) Alloc_Frame_Shell(void) {
+    PoolUnit* unit = TG_Frame_Shell_Cache;
+    if (unit == nullptr)
+        return cast(Frame(*), Alloc_Pooled(FRAME_POOL));
+
+    TG_Frame_Shell_Cache = unit->next_if_free;
+    --TG_Frame_Shell_Cache_Used;
+    return cast(Frame(*), unit);
+}
+
 inline static void Free_Frame_Internal(Frame(*) f) {
     if (Get_Frame_Flag(f, ALLOCATED_FEED))
         Free_Feed(f->feed);  // didn't inherit from parent, and not END_FRAME
@@ -276,7 +298,16 @@ inline static void Free_Frame_Internal(Frame(*) f) {
 
     assert(IS_POINTER_TRASH_DEBUG(f->alloc_value_list));
 
-    Free_Pooled(FRAME_POOL, f);
+    if (TG_Frame_Shell_Cache_Used >= FRAME_SHELL_CACHE_MAX) {
+        Free_Pooled(FRAME_POOL, f);
+        return;
+    }
+
+    PoolUnit* unit = cast(PoolUnit*, cast(void*, f));
+    mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
+    unit->next_if_free = TG_Frame_Shell_Cache;
+    TG_Frame_Shell_Cache = unit;
+    ++TG_Frame_Shell_Cache_Used;
 }
 
 
@@ -354,6 +385,13 @@ inline static void Push_Frame(
     f->prior = TG_Top_Frame;
     TG_Top_Frame = f;
 
+    // A pushed frame runs under the same cancellation scope as its parent
+    // (nullptr outside any WITH-CANCELLATION).  Inheritance happens at push
+    // time--not prep time--so a frame built early and pushed later still
+    // joins the scope it actually runs under.  BOTTOM_FRAME has no parent.
+    //
+    f->cancel_token = (f->prior != nullptr) ? f->prior->cancel_token : nullptr;
+
     assert(IS_POINTER_TRASH_DEBUG(f->alloc_value_list));
     f->alloc_value_list = f;  // doubly link list, terminates in `f`
 }
@@ -369,6 +407,21 @@ inline static void UPDATE_EXPRESSION_START(Frame(*) f) {
     Literal_Next_In_Feed((out), (f)->feed)
 
 
+// See FRAME_FLAG_MANUALS_SCOPED: frees any manually-managed series made
+// since the frame's baseline was snapped.  Uses the same watermark scheme
+// as the failure path's Rollback_Globals_To_State(), so calling it when
+// nothing is outstanding is harmless.
+//
+inline static void Free_Frame_Scoped_Manuals(Frame(*) f) {
+    assert(SER_USED(GC_Manuals) >= f->baseline.manuals_len);
+    while (SER_USED(GC_Manuals) != f->baseline.manuals_len) {
+        Free_Unmanaged_Series(
+            *SER_AT(REBSER*, GC_Manuals, SER_USED(GC_Manuals) - 1)
+        );  // ^-- Free_Unmanaged_Series will decrement SER_USED(GC_Manuals)
+    }
+}
+
+
 inline static void Drop_Frame_Core(Frame(*) f) {
   #if DEBUG_EXPIRED_LOOKBACK
     free(f->stress);
@@ -376,6 +429,9 @@ inline static void Drop_Frame_Core(Frame(*) f) {
 
     assert(TG_Top_Frame == f);
 
+    if (Get_Frame_Flag(f, MANUALS_SCOPED))
+        Free_Frame_Scoped_Manuals(f);
+
     if (Is_Throwing(f) or (f->out and Is_Raised(f->out))) {
         //
         // On normal completion with a return result, we do not allow API
@@ -426,6 +482,9 @@ inline static void Drop_Frame(Frame(*) f)
         not Is_Throwing(f)
         and not (f->out and Is_Raised(f->out))
     ){
+        if (Get_Frame_Flag(f, MANUALS_SCOPED))
+            Free_Frame_Scoped_Manuals(f);  // before the balance check
+
       #if DEBUG_BALANCE_STATE
         //
         // To avoid slowing down the debug build a lot, Eval_Core() doesn't
@@ -491,7 +550,7 @@ inline static Frame(*) Prep_Frame_Core(
 }
 
 #define Make_Frame(feed,flags) \
-    Prep_Frame_Core(cast(Frame(*), Alloc_Pooled(FRAME_POOL)), (feed), (flags))
+    Prep_Frame_Core(Alloc_Frame_Shell(), (feed), (flags))
 
 #define Make_Frame_At_Core(any_array,specifier,frame_flags) \
     Make_Frame( \
@@ -703,6 +762,13 @@ enum {
 //             ; nulls that triggered the branch would have been isotopic?
 //         ]
 //
+// 5. Intrinsic natives (NULL?, NOT...) run directly on the argument without
+//    materializing a frame, which is a sizable win for predicate-heavy code.
+//    This is only done when the argument is in hand and no frame flags were
+//    requested--and it must mirror the argument prep that Action_Executor()
+//    would do (decay, <maybe> noop, activation retry).  A failed typecheck
+//    falls through to the frame path so the canonical error is reported.
+//
 inline static bool Pushed_Continuation(
     REBVAL *out,
     Flags flags,  // FRAME_FLAG_BRANCH, etc. for pushed frames
@@ -785,6 +851,36 @@ inline static bool Pushed_Continuation(
 
     handle_action:
       case REB_ACTION : {
+        if (
+            with
+            and flags == FRAME_MASK_NONE
+            and Get_Action_Flag(VAL_ACTION(branch), IS_INTRINSIC)
+        ){
+            Action(*) action = VAL_ACTION(branch);  // frameless, see [5]
+            const REBPAR *param = First_Unspecialized_Param(nullptr, action);
+
+            DECLARE_LOCAL (arg);
+            Copy_Cell(arg, unwrap(with));
+            if (NOT_PARAM_FLAG(param, WANT_PACKS))
+                Decay_If_Unstable(arg);
+
+            if (Is_Void(arg) and GET_PARAM_FLAG(param, NOOP_IF_VOID)) {
+                Init_Nulled(out);  // <maybe> noop, as with a frame
+                goto just_use_out;
+            }
+
+          intrinsic_typecheck:
+            if (Typecheck_Including_Constraints(param, arg)) {
+                (*ACT_INTRINSIC(action))(out, arg);
+                goto just_use_out;
+            }
+            if (Is_Activation(arg)) {
+                Deactivate_If_Activation(arg);
+                goto intrinsic_typecheck;
+            }
+            // fall through: frame path reports the canonical type error
+        }
+
         Frame(*) f = Make_End_Frame(
             FLAG_STATE_BYTE(ST_ACTION_TYPECHECKING) | flags
         );
@@ -929,10 +1025,10 @@ inline static Bounce Continue_Subframe_Helper(
 // for an optimization to not go through with a continuation at all and just
 // use the output if it is simple to do.
 //
-// !!! Delegation doesn't want to use the frame that's pushed.  It leaves it
-// on the stack for sanity of debug tracing, but it could be more optimal
-// if the delegating frame were freed before running what's underneath it...
-// at least it could be collapsed into a more primordial state.  Review.
+// Delegation doesn't want to use the frame that's pushed.  It leaves it on
+// the stack for sanity of debug tracing, but the delegating frame's argument
+// storage is freed eagerly when nothing can reference it--bounding memory by
+// the active delegation depth.  See Reclaim_Delegating_Frame_Storage().
 
 #define DELEGATE_CORE_3(o,sub_flags,...) ( \
     assert((o) == frame_->out), \
@@ -21,8 +21,8 @@
 //=////////////////////////////////////////////////////////////////////////=//
 //
 // Maps are implemented as a light hashing layer on top of an array.  The
-// hash indices are stored in the series node's "misc", while the values are
-// retained in pairs as `[key val key val key val ...]`.
+// hash indices are stored in a separate series linked from the pairlist's
+// node, while the values are retained in pairs as `[key val key val ...]`.
 //
 // When there are too few values to warrant hashing, no hash indices are
 // made and the array is searched linearly.  This is indicated by the hashlist
@@ -32,9 +32,9 @@
 // they are implemented using series--and hence are in %sys-series.h, at least
 // until a better location for the definition is found.
 //
-// !!! Should there be a MAP_LEN()?  Current implementation has VOID in
-// slots that are unused, so can give a deceptive number.  But so can
-// objects with hidden fields, locals in paramlists, etc.
+// Unused slots have VOID in them, so the pairlist's array length overstates
+// how many entries a map holds.  The live count is cached in the pairlist's
+// `misc.length` (see Length_Map() below).
 //
 
 #define SERIES_MASK_PAIRLIST \
@@ -42,6 +42,30 @@
         | SERIES_FLAG_LINK_NODE_NEEDS_MARK  /* hashlist */)
 
 
+//=//// HASHLIST_FLAG_COPY_ON_WRITE ///////////////////////////////////////=//
+//
+// Copying a map shares the original's hashlist rather than duplicating it,
+// since overwriting values never touches the hash table--only structural
+// changes do (adding or removing keys, expansion).  This flag marks a
+// hashlist as possibly shared: any map about to write one clones a private
+// copy first (see Ensure_Private_Hashlist() in %t-map.c).
+//
+// There is no reference count; the flag stays set once a hashlist has been
+// shared.  The cost of that conservatism is at most one superfluous clone
+// by the last map still holding a formerly-shared hashlist.
+//
+#define HASHLIST_FLAG_COPY_ON_WRITE \
+    SERIES_FLAG_24
+
+// Below this many key/value pairs, maps don't allocate a hashlist at all and
+// Find_Map_Entry() scans the pairlist linearly.  A handful of comparisons is
+// cheaper than hashing the key, and it halves the memory for the common case
+// of many tiny maps.  Crossing the threshold transparently upgrades to the
+// hashed form.
+//
+#define MIN_DICT 8
+
+
 
 // See LINK() macro for how this is used.
 //
@@ -80,16 +104,26 @@ inline static const REBMAP *VAL_MAP(noquote(Cell(const*)) v) {
 #define VAL_MAP_KNOWN_MUTABLE(v) \
     m_cast(REBMAP*, VAL_MAP(KNOWN_MUTABLE(v)))
 
+// The number of live (non-zombie) entries is cached in the pairlist's
+// `misc.length`--the same slot strings use for their codepoint count, which
+// is otherwise unused by pairlists.  Find_Map_Entry() is the funnel for all
+// map mutations and bumps the cache as value slots transition between void
+// ("zombie") and live...so LENGTH OF doesn't have to scan a 10-million-entry
+// pairlist skipping removals every time it is asked.
+//
 inline static REBLEN Length_Map(const REBMAP *map)
 {
+  #if !defined(NDEBUG)
     Cell(const*) tail = ARR_TAIL(MAP_PAIRLIST(map));
-    const REBVAL *v = SPECIFIC(ARR_HEAD(MAP_PAIRLIST(map)));
+    Cell(const*) v = ARR_HEAD(MAP_PAIRLIST(map));
 
     REBLEN count = 0;
     for (; v != tail; v += 2) {
-        if (not Is_Nulled(v + 1))
+        if (not Is_Void(v + 1))  // void value means key was removed
             ++count;
     }
+    assert(count == MAP_PAIRLIST(map)->misc.length);
+  #endif
 
-    return count;
+    return MAP_PAIRLIST(map)->misc.length;
 }
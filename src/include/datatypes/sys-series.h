@@ -787,6 +787,13 @@ inline static REBSER *Manage_Series(REBSER *s)  // give manual series to GC
 
     s->leader.bits |= NODE_FLAG_MANAGED;
     Untrack_Manual_Series(s);
+
+    // A series managed while incremental sweep slices are outstanding was
+    // not seen by the mark phase as managed...a pending slice would free it.
+    //
+    if (GC_Sweep_Pending and NOT_SERIES_FLAG(s, MARKED))
+        Blacken_Node_During_Sweep(s);
+
     return s;
 }
 
@@ -895,7 +902,8 @@ inline static bool Is_Series_Frozen(const REBSER *s) {
 inline static bool Is_Series_Read_Only(const REBSER *s) {  // may be temporary
     return 0 != (SER_INFO(s) &
         (SERIES_INFO_HOLD | SERIES_INFO_PROTECTED
-        | SERIES_INFO_FROZEN_SHALLOW | SERIES_INFO_FROZEN_DEEP)
+        | SERIES_INFO_FROZEN_SHALLOW | SERIES_INFO_FROZEN_DEEP
+        | PG_Epoch_Protect_Mask)  // 0 unless a protection epoch is engaged
     );
 }
 
@@ -923,6 +931,11 @@ inline static void FAIL_IF_READ_ONLY_SER(REBSER *s) {
 
     assert(NOT_SERIES_INFO(s, FROZEN_DEEP));  // implies FROZEN_SHALLOW
 
+    if (GET_SERIES_INFO(s, EPOCH_PROTECTED)) {
+        assert(PG_Protect_Epochs != 0);  // else wasn't counted as read-only
+        fail (Error_Series_Protected_Raw());
+    }
+
     assert(GET_SERIES_INFO(s, PROTECTED));
     fail (Error_Series_Protected_Raw());
 }
@@ -1186,6 +1199,9 @@ inline static Stub* Prep_Stub(void *preallocated, Flags flags) {
 
     s->leader.bits = NODE_FLAG_NODE | flags;  // #1
 
+    if (GC_Sweep_Pending)  // sweep slices outstanding: allocate "black"
+        Blacken_Node_During_Sweep(s);
+
   #if !defined(NDEBUG)
     SAFETRASH_POINTER_IF_DEBUG(s->link.trash);  // #2
     memset(  // https://stackoverflow.com/q/57721104/
@@ -1287,9 +1303,23 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
                 CLEAR_SERIES_FLAG(s, POWER_OF_2);
         }
 
-        s->content.dynamic.data = TRY_ALLOC_N(char, size);
-        if (not s->content.dynamic.data)
-            return false;
+        // Multi-megabyte data may be backed by an anonymous memory mapping
+        // rather than malloc()--growth can then relink pages instead of
+        // copying, and frees return the memory to the OS immediately.  The
+        // routine decides eligibility itself (see %m-pools.c); nullptr just
+        // means to use the ordinary allocation path.
+        //
+        char *mapped = cast(char*, Try_Alloc_Series_Data_Mapped(&size, wide));
+        if (mapped) {
+            s->content.dynamic.data = mapped;  // size now page-rounded
+            if (size % wide == 0)
+                CLEAR_SERIES_FLAG(s, POWER_OF_2);
+        }
+        else {
+            s->content.dynamic.data = TRY_ALLOC_N(char, size);
+            if (not s->content.dynamic.data)
+                return false;
+        }
 
         Mem_Pools[SYSTEM_POOL].has += size;
         Mem_Pools[SYSTEM_POOL].free++;
@@ -1321,6 +1351,11 @@ inline static bool Did_Series_Data_Alloc(REBSER *s, REBLEN capacity) {
     if ((GC_Ballast -= size) <= 0)
         SET_SIGNAL(SIG_RECYCLE);
 
+    if (PG_Mem_Tally) {  // allocation accounting, see MEMORY-TALLY
+        ++PG_Mem_Tally->Data_Allocs[pool_id];
+        PG_Mem_Tally->Series_Bytes[SER_FLAVOR(s)] += size;
+    }
+
     assert(SER_TOTAL(s) <= size);  // irregular sizes won't use all the space
     return true;
 }
@@ -1373,6 +1408,9 @@ inline static REBSER *Make_Series_Into(
       #endif
     }
 
+    if (PG_Mem_Tally)  // allocation accounting, see MEMORY-TALLY
+        ++PG_Mem_Tally->Series_Made[FLAVOR_BYTE(flags)];
+
     // It is more efficient if you know a series is going to become managed to
     // create it in the managed state.  But be sure no evaluations are called
     // before it's made reachable by the GC, or use PUSH_GC_GUARD().
@@ -179,29 +179,37 @@ inline static Utf8(*) WRITE_CHR(Utf8(*) cp, Codepoint c) {
 }
 
 
-//=//// STRING ALL-ASCII FLAG /////////////////////////////////////////////=//
+//=//// STRING ALL-ASCII DETECTION ////////////////////////////////////////=//
 //
 // One of the best optimizations that can be done on strings is to keep track
-// of if they contain only ASCII codepoints.  Such a flag would likely have
-// false negatives, unless all removals checked the removed portion for if
-// the ASCII flag is true.  It could be then refreshed by any routine that
-// walks an entire string for some other reason (like molding or printing).
-//
-// For the moment, we punt on this optimization.  The main reason is that it
-// means the non-ASCII code is exercised on every code path, which is a good
-// substitute for finding high-codepoint data to pass through to places that
-// would not receive it otherwise.
-//
-// But ultimately this optimization will be necessary, and decisions on how
-// up-to-date the flag should be kept would need to be made.
-
-#define Is_Definitely_Ascii(s) false
+// of if they contain only ASCII codepoints.  That unlocks O(1) indexing in
+// STR_AT() and STR_INDEX_AT() with no bookmark bookkeeping, since byte
+// offsets and codepoint indexes coincide.
+//
+// It turns out no dedicated flag is needed: non-symbol strings already cache
+// their codepoint count in `misc.length`, and every codepoint takes at least
+// one byte--with equality precisely when all the codepoints are ASCII.  So
+// (length == size) is an exact test, with no false positives *or* false
+// negatives, and it is maintained transactionally for free by the same
+// mutations in %f-modify.c and %s-make.c that keep the length cache valid.
+//
+// Symbols don't cache a length (their misc field is used for other things),
+// so they always report false and take the decoding paths.  They tend to be
+// short, and are immutable once interned--so the cost is bounded.
+//
+// (Historically this was hardwired to `false`, on the theory that exercising
+// the non-ASCII code on every path was a good substitute for finding
+// high-codepoint data to test with.  DEBUG_UTF8_EVERYWHERE still validates
+// the length cache that the test depends on.)
 
 inline static bool Is_String_Definitely_ASCII(String(const*) str) {
-    UNUSED(str);
-    return false;
+    if (not IS_NONSYMBOL_STRING(str))
+        return false;  // no length cache to compare against byte count
+    return str->misc.length == SER_USED(str);
 }
 
+#define Is_Definitely_Ascii Is_String_Definitely_ASCII
+
 #define STR_UTF8(s) \
     SER_HEAD(const char, ensure(String(const*), s))
 
@@ -235,17 +243,11 @@ inline static Length STR_LEN(String(const*) s) {
         return s->misc.length;
     }
 
-    // Have to do it the slow way if it's a symbol series...but hopefully
-    // they're not too long (since spaces and newlines are illegal.)
+    // Symbol series don't cache their length (misc is used for synonyms),
+    // but counting lead bytes doesn't need to decode...and symbols are short
+    // anyway (spaces and newlines are illegal).
     //
-    REBLEN len = 0;
-    Utf8(const*) ep = STR_TAIL(s);
-    Utf8(const*) cp = STR_HEAD(s);
-    while (cp != ep) {
-        cp = NEXT_STR(cp);
-        ++len;
-    }
-    return len;
+    return Count_Codepoints(cast(const Byte*, STR_HEAD(s)), STR_SIZE(s));
 }
 
 inline static REBLEN STR_INDEX_AT(String(const*) s, Size byteoffset) {
@@ -262,21 +264,25 @@ inline static REBLEN STR_INDEX_AT(String(const*) s, Size byteoffset) {
             panic(s);
       #endif
 
-        // We have length and bookmarks.  We should build STR_AT() based on
-        // this routine.  For now, fall through and do it slowly.
+        // Knowing the total length means the codepoints between the offset
+        // and whichever end is nearer can be counted--without decoding--and
+        // subtracted if that end was the tail.
+        //
+        Size used = SER_USED(s);
+        if (byteoffset == used)
+            return s->misc.length;  // tail index, no counting needed
+
+        if (byteoffset > used / 2)
+            return s->misc.length
+                - Count_Codepoints(BIN_AT(s, byteoffset), used - byteoffset);
+
+        return Count_Codepoints(cast(const Byte*, STR_HEAD(s)), byteoffset);
     }
 
-    // Have to do it the slow way if it's a symbol series...but hopefully
-    // they're not too long (since spaces and newlines are illegal.)
+    // Symbol series are short (spaces and newlines are illegal), and lead
+    // bytes can be counted without decoding.
     //
-    REBLEN index = 0;
-    Utf8(const*) ep = cast(Utf8(const*), BIN_AT(s, byteoffset));
-    Utf8(const*) cp = STR_HEAD(s);
-    while (cp != ep) {
-        cp = NEXT_STR(cp);
-        ++index;
-    }
-    return index;
+    return Count_Codepoints(cast(const Byte*, STR_HEAD(s)), byteoffset);
 }
 
 inline static void SET_STR_LEN_SIZE(Raw_String* s, REBLEN len, Size used) {
@@ -308,6 +314,13 @@ inline static void TERM_STR_LEN_SIZE(Raw_String* s, REBLEN len, Size used) {
 // it's just two numbers, there's only one pointer's worth of space in the
 // series node otherwise.  Bookmarks aren't generated for strings that are
 // very short, or that are never enumerated.
+//
+// FROZEN strings are the exception: they can never change, so FREEZE swaps
+// the floating bookmark for a full table with one entry per fixed interval
+// of codepoints (see Build_Frozen_String_Index()).  The table hangs off the
+// same LINK() slot, and is distinguished by holding more than one entry.
+
+#define STR_INDEX_INTERVAL 256  // codepoints between frozen index entries
 
 #define BMK_INDEX(b) \
     SER_HEAD(struct Reb_Bookmark, c_cast(REBBMK*, (b)))->index
@@ -333,6 +346,38 @@ inline static void Free_Bookmarks_Maybe_Null(String(*) str) {
     }
 }
 
+// A removal does not have to invalidate the index/offset cache: positions
+// before the removed region are untouched, positions after it just slide by
+// the removed amount, and a position inside it can snap to where the removal
+// started.  Keeping the bookmark alive this way means iterating patterns
+// like `while [not tail? s] [take s]` stay O(1) per access instead of
+// re-scanning from the head after every edit.
+//
+inline static void Adjust_Bookmarks_On_Remove(
+    String(*) str,
+    REBLEN index,  // codepoint index where the removal started
+    Size offset,  // byte offset corresponding to `index`
+    REBLEN len,  // codepoints removed
+    Size size  // bytes removed
+){
+    assert(IS_NONSYMBOL_STRING(str));
+    REBBMK *bookmark = LINK(Bookmarks, str);
+    if (not bookmark)
+        return;
+
+    if (BMK_INDEX(bookmark) <= index)
+        return;  // cache points at or before the removal; still valid
+
+    if (BMK_INDEX(bookmark) >= index + len) {  // past removal, slide back
+        BMK_INDEX(bookmark) -= len;
+        BMK_OFFSET(bookmark) -= size;
+    }
+    else {  // cache pointed into removed region; snap to removal start
+        BMK_INDEX(bookmark) = index;
+        BMK_OFFSET(bookmark) = offset;
+    }
+}
+
 #if !defined(NDEBUG)
     inline static void Check_Bookmarks_Debug(String(*) s) {
         REBBMK *bookmark = LINK(Bookmarks, s);
@@ -374,7 +419,14 @@ inline static Utf8(*) STR_AT(const_if_c Raw_String* s, REBLEN at) {
     assert(at <= STR_LEN(s));
 
     if (Is_Definitely_Ascii(s)) {  // can't have any false positives
-        assert(not LINK(Bookmarks, s));  // mutations must ensure this
+        if (LINK(Bookmarks, s)) {
+            //
+            // Removing the non-ASCII portion of a string can make it become
+            // all-ASCII with a bookmark left over.  It's still consistent,
+            // but it's useless now--free it rather than let it linger.
+            //
+            Free_Bookmarks_Maybe_Null(m_cast(Raw_String*, s));
+        }
         return cast(Utf8(*), cast(Byte*, STR_HEAD(s)) + at);
     }
 
@@ -385,6 +437,24 @@ inline static Utf8(*) STR_AT(const_if_c Raw_String* s, REBLEN at) {
     if (IS_NONSYMBOL_STRING(s))
         bookmark = LINK(Bookmarks, s);
 
+    if (bookmark and SER_USED(bookmark) > 1) {
+        //
+        // Frozen strings trade the floating bookmark for a table with one
+        // entry per STR_INDEX_INTERVAL codepoints, making random access
+        // O(1): one table read plus a forward scan of less than an interval.
+        // The table never needs updating (the string can't change).
+        //
+        assert(Is_Series_Frozen(s));
+        struct Reb_Bookmark *entries = SER_HEAD(struct Reb_Bookmark, bookmark);
+        REBLEN n = at / STR_INDEX_INTERVAL;
+        if (n >= SER_USED(bookmark))
+            n = SER_USED(bookmark) - 1;  // `at` may be the tail index
+        cp = cast(Utf8(*), SER_DATA(s) + entries[n].offset);
+        for (index = entries[n].index; index != at; ++index)
+            cp = NEXT_STR(cp);
+        return cp;
+    }
+
   #if DEBUG_SPORADICALLY_DROP_BOOKMARKS
     if (bookmark and SPORADICALLY(100)) {
         Free_Bookmarks_Maybe_Null(s);
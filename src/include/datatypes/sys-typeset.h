@@ -59,6 +59,14 @@ inline static option(Array(const*)) VAL_PARAMETER_ARRAY(
 #define INIT_VAL_PARAMETER_ARRAY(v, a) \
     INIT_VAL_NODE1((v), (a))
 
+// Compiled bitmask of FLAGIT_KIND() bits for pure-datatype-union parameters,
+// only meaningful when PARAM_FLAG_KIND_MASK_CACHED is set.  The slot is a
+// platform pointer in size--on 32-bit builds a union involving kinds of 32
+// or higher simply doesn't get cached, and takes the general walk.
+//
+#define VAL_PARAM_KIND_MASK(v) \
+    PAYLOAD(Any, (v)).second.u
+
 
 inline static bool TYPE_CHECK(Cell(const*) typeset, Value(const*) v) {
     return Typecheck_Value(typeset, SPECIFIED, v, SPECIFIED);
@@ -152,7 +160,15 @@ inline static bool Matcher_Matches(
 #define PARAM_FLAG_NOOP_IF_VOID \
     FLAG_LEFT_BIT(13)
 
-#define PARAM_FLAG_14 \
+// If a parameter's type spec turns out to be a pure union of built-in
+// datatypes (e.g. `[integer! block!]` or `[any-series!]`) then it can be
+// checked with a single bitmask test against the argument's kind byte,
+// instead of walking the spec array doing word lookups on every call.  The
+// mask is compiled by Try_Cache_Param_Kind_Mask() when the paramlist is
+// made, and stored in the parameter cell's otherwise-unused second payload
+// slot--see VAL_PARAM_KIND_MASK().
+//
+#define PARAM_FLAG_KIND_MASK_CACHED \
     FLAG_LEFT_BIT(14)
 
 #define PARAM_FLAG_CONST \
@@ -232,6 +248,7 @@ inline static REBVAL *Init_Parameter_Core(Cell(*) out, Array(const*) array)
     if (array)
         ASSERT_SERIES_MANAGED(array);
     INIT_VAL_PARAMETER_ARRAY(out, array);
+    VAL_PARAM_KIND_MASK(out) = 0;  // no KIND_MASK_CACHED flag set
     VAL_PARAM_FLAGS(out) = FLAG_PARAM_CLASS_BYTE(PARAM_CLASS_0);
     return cast(REBVAL*, out);
 }
@@ -251,6 +268,7 @@ inline static REBPAR *Init_Param_Core(
 
     VAL_PARAM_FLAGS(out) = param_flags;
     INIT_VAL_PARAMETER_ARRAY(out, array);
+    VAL_PARAM_KIND_MASK(out) = 0;  // Finalize_Param() may cache a mask
 
     REBPAR *param = cast(REBPAR*, cast(REBVAL*, out));
     assert(VAL_PARAM_CLASS(param) != PARAM_CLASS_0);  // must set
@@ -297,7 +297,7 @@ inline static Cell(const*) CELL_TO_VAL(noquote(Cell(const*)) cell)
 
 inline static option(SymId) VAL_WORD_ID(noquote(Cell(const*)) v);
 
-inline static enum Reb_Kind VAL_TYPE_UNCHECKED(Cell(const*) v) {
+INLINE_HOT static enum Reb_Kind VAL_TYPE_UNCHECKED(Cell(const*) v) {
     switch (QUOTE_BYTE_UNCHECKED(v)) {
       case ISOTOPE_0:
         return REB_ISOTOPE;
@@ -321,6 +321,23 @@ inline static enum Reb_Kind VAL_TYPE_UNCHECKED(Cell(const*) v) {
 #endif
 
 
+// Branch-free form of `VAL_TYPE(v) == kind` for kinds that are actual cell
+// hearts.  The switch() in VAL_TYPE_UNCHECKED() has to branch on the quote
+// byte before the heart can be looked at, but folding both bytes into one
+// masked compare of the header answers the question in a single test.  The
+// IS_XXX() macros in %tmp-kinds.h are generated in terms of this--except
+// for QUOTED!, QUASI!, and ISOTOPE!, whose kinds never appear in a
+// HEART_BYTE() and are synthesized from the quote byte by VAL_TYPE().
+//
+// Note the repetition of the macro argument, vs. using an inline function:
+// this is as hot as code gets, and debug builds don't inline.  (The same
+// reasoning applies to Get_Cell_Flag(), see below.)
+//
+#define Is_Unquoted_Kind(v,k) \
+    ((READABLE(v)->header.bits & CELL_MASK_HEART_AND_QUOTE) \
+        == FLAG_HEART_AND_QUOTE((k), UNQUOTED_1))
+
+
 //=//// GETTING, SETTING, and CLEARING VALUE FLAGS ////////////////////////=//
 //
 // The header of a cell contains information about what kind of cell it is,
@@ -661,7 +678,7 @@ inline static void Copy_Cell_Header(
 //
 // Interface designed to line up with Derelativize()
 //
-inline static Cell(*) Copy_Cell_Untracked(
+INLINE_HOT static Cell(*) Copy_Cell_Untracked(
     Cell(*) out,
     Cell(const*) v,
     Flags copy_mask  // typically you don't copy UNEVALUATED, PROTECTED, etc
@@ -703,7 +720,7 @@ inline static Cell(*) Copy_Cell_Untracked(
 }
 
 #if CPLUSPLUS_11  // REBVAL and Cell are checked distinctly
-    inline static REBVAL *Copy_Cell_Untracked(
+    INLINE_HOT static REBVAL *Copy_Cell_Untracked(
         Cell(*) out,
         const REBVAL *v,
         Flags copy_mask
@@ -715,7 +732,7 @@ inline static Cell(*) Copy_Cell_Untracked(
         ));
     }
 
-    inline static REBVAL *Copy_Cell_Untracked(
+    INLINE_HOT static REBVAL *Copy_Cell_Untracked(
         REBVAL *out,
         const REBVAL *v,
         Flags copy_mask
@@ -776,6 +793,55 @@ inline static REBVAL *Move_Cell_Untracked(
     TRACK(Move_Cell_Untracked((out), (v), (cell_mask)))
 
 
+//=//// BULK CELL BLITTING ////////////////////////////////////////////////=//
+//
+// Cell bits are position-independent so long as the cell stays inside the
+// array whose lifetime guarantees its binding: a relative binding is only
+// meaningful underneath the action that owns the array, and sliding the
+// cell to a different slot of that same array doesn't change that.  The GC
+// marks cells by walking arrays, not by remembering cell addresses.  So
+// cells may be rearranged *within one array* by plain memory moves, skipping
+// Copy_Cell()'s per-cell flag masking and binding management.  (This is the
+// same reasoning that lets Expand_Series() and Remove_Series_Units() open
+// and close gaps in arrays with memmove().)
+//
+// The reasoning does not extend to copying cells into a *different* array
+// (a relative binding could escape its owning action) nor into API handles.
+// The routines only see naked cell pointers, so callers take responsibility:
+// each use should be able to say why source and destination live in the same
+// array...or why the source bits were just written fully specified into the
+// target (e.g. replicating a /DUP insertion that was derelativized into the
+// destination moments before).
+//
+// The byte copies cover the whole cell--including the tracking fields in
+// DEBUG_TRACK_EXTEND_CELLS builds, which is what you want: a moved cell is
+// the "same" cell, just in a new slot.
+
+inline static void Blit_Cell(Cell(*) dst, Cell(const*) src) {
+    assert(dst != src);
+    ASSERT_CELL_READABLE_EVIL_MACRO(src);
+    memcpy(dst, src, sizeof(Reb_Cell));
+}
+
+inline static void Blit_Cells(Cell(*) dst, Cell(const*) src, REBLEN count) {
+    if (count == 0)
+        return;
+    ASSERT_CELL_READABLE_EVIL_MACRO(src);  // spot-check the head cell
+    memmove(dst, src, count * sizeof(Reb_Cell));  // regions may overlap
+}
+
+inline static void Swap_Cells(Cell(*) a, Cell(*) b, REBLEN count) {
+    assert(a + count <= b or b + count <= a);  // swap can't untangle overlap
+    REBLEN n;
+    for (n = 0; n < count; ++n, ++a, ++b) {
+        Reb_Cell temp;
+        Blit_Cell(&temp, a);
+        Blit_Cell(a, b);
+        Blit_Cell(b, &temp);
+    }
+}
+
+
 // !!! Super primordial experimental `const` feature.  Concept is that various
 // operations have to be complicit (e.g. SELECT or FIND) in propagating the
 // constness from the input series to the output value.  const input always
@@ -151,4 +151,22 @@ typedef struct rebol_scan_level {  // each array scan corresponds to a level
     enum Reb_Token prefix_pending;
     bool quasi_pending;
 
+    // TRANSCODE/INDEX asks a top-level scan to collect the byte span of
+    // each value it pushes, enabling incremental re-scans of edited
+    // sources (see RELOAD).  Child levels always leave this nullptr, as
+    // nested values are covered by their top-level value's span.
+    //
+    Array(*) index;  // pairs of 1-based [start end) offsets (or nullptr)
+    const Byte* index_head;  // offsets are relative to this input head
+    const Byte* value_start;  // first byte of value in progress (or nullptr)
+
+    // TRANSCODE/FORMATTED asks every level to collect the whitespace run
+    // that precedes each value it pushes, so MOLD can reproduce the source
+    // layout (see ARRAY_FLAG_HAS_FORMAT_TABLE).  Unlike the offset index,
+    // child levels collect too--each popped array gets its own table.
+    //
+    Binary(*) format;  // RLE table under construction (or nullptr)
+    REBLEN format_newlines;  // newlines seen since the last pushed value
+    REBLEN format_indent;  // byte column where the pending value started
+
 } SCAN_LEVEL;
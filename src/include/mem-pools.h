@@ -68,6 +68,13 @@ struct rebol_mem_pool {
 
 #define MEM_BALLAST 3000000
 
+// Series data at least this size bypasses malloc() for a direct anonymous
+// memory mapping, where supported.  See "LARGE SERIES DATA IN ANONYMOUS
+// MEMORY MAPPINGS" in %m-pools.c; the threshold can't be changed at runtime
+// because frees re-derive the routing from the allocation size alone.
+//
+#define MEM_MMAP_THRESHOLD (2 * 1024 * 1024)
+
 enum Mem_Pool_Specs {
     MEM_TINY_POOL = 0,
     MEM_SMALL_POOLS = MEM_TINY_POOL + 16,
@@ -268,6 +268,29 @@
 #endif
 
 
+//=//// FORCED INLINING OF HOT ACCESSORS //////////////////////////////////=//
+//
+// A handful of inline functions are on the evaluator's per-step path, and
+// are written assuming they vanish into their callers.  INLINE_HOT is used
+// in place of `inline` on those, and expands to the compiler's forced
+// inlining attribute when FORCE_HOT_INLINES is enabled in the build config
+// (see %reb-config.h).  Otherwise--including all debug builds--it is just
+// `inline`, so the flag can't change behavior...only code layout.
+//
+
+#if FORCE_HOT_INLINES && defined(NDEBUG)
+    #if defined(__GNUC__)  // Clang defines __GNUC__ too
+        #define INLINE_HOT __attribute__((always_inline)) inline
+    #elif defined(_MSC_VER)
+        #define INLINE_HOT __forceinline
+    #else
+        #define INLINE_HOT inline
+    #endif
+#else
+    #define INLINE_HOT inline
+#endif
+
+
 //=//// UNREACHABLE CODE ANNOTATIONS //////////////////////////////////////=//
 //
 // Because Rebol uses `longjmp` and `exit` there are cases where a function
@@ -622,6 +645,21 @@
 #define blockscope NOOP;
 
 
+//=//// PREFETCH HINT /////////////////////////////////////////////////////=//
+//
+// Advisory hint that memory at an address is about to be read, so hardware
+// can start pulling the cache line in early.  Used on hot paths that walk
+// arrays of cells (e.g. the evaluator feed).  Harmless if the address is
+// invalid or the compiler lacks the intrinsic--it's only a hint.
+//
+#if defined(__GNUC__) || defined(__clang__)
+    #define PREFETCH_READ(p) \
+        __builtin_prefetch((p), 0)  // 0 means "for read"
+#else
+    #define PREFETCH_READ(p) NOOP
+#endif
+
+
 //=//// ALIGNMENT SIZE ////////////////////////////////////////////////////=//
 //
 // Data alignment is a complex topic, which has to do with the fact that the
@@ -763,6 +763,35 @@ Special internal defines used by RT, not Host-Kit developers:
     #define DEBUG_DTOA 0
 #endif
 
+// The main switch() in Evaluator_Executor() compiles to a bounds-checked
+// jump table.  GCC and Clang offer "labels as values", which lets the
+// dispatch skip the range check and branch through a table built once at
+// first use.  Kinds not covered by the table fall back on the plain switch,
+// so the table doesn't have to be exhaustive to be correct.
+//
+// This is opt-in (`computed-goto: yes` in the build config) because the
+// win is workload-dependent and the extension is compiler-specific.
+//
+#if !defined(EVALUATOR_COMPUTED_GOTO)
+    #define EVALUATOR_COMPUTED_GOTO 0
+#elif EVALUATOR_COMPUTED_GOTO && !defined(__GNUC__)  // Clang defines __GNUC__
+    #error "EVALUATOR_COMPUTED_GOTO requires GCC/Clang labels-as-values"
+#endif
+
+// The hottest cell and feed accessors (VAL_TYPE_UNCHECKED(), Copy_Cell(),
+// advancing the frame's feed) are inline functions that optimizers usually
+// flatten into the evaluator's per-type case bodies...but "usually" is at
+// the compiler's discretion, and inlining heuristics have been seen to
+// give them out-of-line calls on some toolchains.  This opt-in flag
+// (`force-hot-inlines: yes` in the build config) marks them with the
+// compiler's always-inline attribute so each case compiles to straight-line
+// code.  See INLINE_HOT in %reb-c.h--it degrades to plain `inline` in
+// debug builds, where forced inlining would only bloat and slow things.
+//
+#if !defined(FORCE_HOT_INLINES)
+    #define FORCE_HOT_INLINES 0
+#endif
+
 // It would seem that cells like REB_BLANK which don't use their payloads
 // could just leave them uninitialized...saving time on the assignments.
 //
@@ -151,6 +151,17 @@ struct Reb_Bookmark {
     Size offset;
 };
 
+// Hashlists (used by MAP! and the set operations) are open-addressed tables
+// whose slots hold a 1-based index into the keyed array, plus a cached copy
+// of the key's hash.  The cache means probe collisions are resolved with an
+// integer compare instead of a full Cmp_Value() on the stored key, and the
+// table walks with linear probing so collision chains stay in cache lines.
+//
+struct Reb_Hashlist_Entry {
+    REBLEN index;  // 1-based index of the key in its array (0 = unused)
+    uint32_t hash;  // cached Hash_Value() of that key
+};
+
 //=//// BINDING ///////////////////////////////////////////////////////////=//
 
 struct Reb_Binder;
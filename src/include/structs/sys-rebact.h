@@ -56,9 +56,18 @@
     SERIES_FLAG_24
 
 
-//=//// DETAILS_FLAG_25 ///////////////////////////////////////////////////=//
+//=//// DETAILS_FLAG_SIMPLE_ARGS //////////////////////////////////////////=//
 //
-#define DETAILS_FLAG_25 \
+// This is a calculated property, which is cached by Make_Action().
+//
+// It is set when every unspecialized parameter is an ordinary evaluated
+// positional argument--no quoting conventions, no refinements, no variadics,
+// and nothing skippable.  (RETURN and OUTPUT parameters don't disqualify it,
+// as they never consume anything from the callsite.)  This describes nearly
+// all natives, and lets argument fulfillment bypass the refinement reordering
+// scan and the parameter convention switch for each argument.
+//
+#define DETAILS_FLAG_SIMPLE_ARGS \
     SERIES_FLAG_25
 
 
@@ -128,16 +137,27 @@
     SERIES_FLAG_30
 
 
-//=//// DETAILS_FLAG_31 ///////////////////////////////////////////////////=//
+//=//// DETAILS_FLAG_IS_INTRINSIC /////////////////////////////////////////=//
+//
+// Some arity-1 natives (NULL?, NOT, TO-LOGIC...) are simple enough that the
+// cost of materializing a FRAME! dwarfs the actual work they do.  Natives
+// which register an Intrinsic function alongside their dispatcher get this
+// flag, and callsites which already have the single evaluated argument in
+// hand (e.g. predicate invocations) can call that C function directly.  The
+// full frame path remains for APPLY, SPECIALIZE, reflection, etc.
+//
+// See IDX_NATIVE_INTRINSIC for where the C function pointer is stored.
 //
-#define DETAILS_FLAG_31 \
+#define DETAILS_FLAG_IS_INTRINSIC \
     SERIES_FLAG_31
 
 
 // These are the flags which are scanned for and set during Make_Action
 //
 #define DETAILS_MASK_CACHED \
-    (DETAILS_FLAG_QUOTES_FIRST | DETAILS_FLAG_SKIPPABLE_FIRST)
+    (DETAILS_FLAG_QUOTES_FIRST \
+        | DETAILS_FLAG_SKIPPABLE_FIRST \
+        | DETAILS_FLAG_SIMPLE_ARGS)
 
 // These flags should be copied when specializing or adapting.  They may not
 // be derivable from the paramlist (e.g. a native with no RETURN does not
@@ -94,21 +94,53 @@ enum Reb_Type_Hook_Index {
     (ARRAY_FLAG_HAS_FILE_LINE_UNMASKED | SERIES_FLAG_LINK_NODE_NEEDS_MARK)
 
 
-//=//// ARRAY_FLAG_25 /////////////////////////////////////////////////////=//
+//=//// ARRAY_FLAG_HAS_FORMAT_TABLE ///////////////////////////////////////=//
 //
-#define ARRAY_FLAG_25 \
+// TRANSCODE/FORMATTED captures the vertical and horizontal whitespace that
+// preceded each scanned value into a run-length-encoded "format table" (a
+// byte-sized BINARY!), so MOLD can reproduce the source layout instead of
+// re-deriving it cell by cell from CELL_FLAG_NEWLINE_BEFORE.
+//
+// The table is hung off the array's ->misc slot, which ordinarily holds the
+// source line number when ARRAY_FLAG_HAS_FILE_LINE_UNMASKED is set.  So when
+// this flag is set the line number lives inside the table's header instead,
+// and SERIES_FLAG_MISC_NODE_NEEDS_MARK keeps the table alive.  Use the
+// Array_Line()/Set_Array_Line() accessors rather than touching ->misc.line.
+//
+// (See FORMAT_TABLE_XXX in %sys-array.h for the table's byte layout.)
+//
+#define ARRAY_FLAG_HAS_FORMAT_TABLE \
     SERIES_FLAG_25
 
 
-//=//// ARRAY_FLAG_26 /////////////////////////////////////////////////////=//
+//=//// ARRAY_FLAG_COLD_SOURCE ////////////////////////////////////////////=//
+//
+// Set on the relativized body copy of an interpreted function at creation
+// time, while it is reachable only through the action's details array.  It
+// means the GC is allowed to track how many collections the body survives
+// without being executed, and to deflate the cell data of bodies that stay
+// cold (loaded-but-never-called code is a large share of resident memory in
+// long-lived processes).  See the "COLD SOURCE COMPRESSION" section of
+// %m-gc.c for the mechanics.
 //
-#define ARRAY_FLAG_26 \
+// The first dispatch--or anything else that exposes the body, like BODY-OF--
+// goes through Thaw_Cold_Source(), which reinflates the tree if needed and
+// clears this flag permanently.
+//
+#define ARRAY_FLAG_COLD_SOURCE \
     SERIES_FLAG_26
 
 
-//=//// ARRAY_FLAG_27 /////////////////////////////////////////////////////=//
+//=//// ARRAY_FLAG_COLD_COMPRESSED ////////////////////////////////////////=//
+//
+// The array's cell data is currently a raw deflate blob, not cells.  Only
+// arrays inside an ARRAY_FLAG_COLD_SOURCE body tree can be in this state,
+// and nothing besides the GC and Thaw_Cold_Source() may look at the content
+// while the flag is set.  (The stub keeps SERIES_FLAG_DYNAMIC, but `used` is
+// zero and the data pointer holds a Reb_Cold_Source_Compressed allocation;
+// see %m-gc.c for the layout.)
 //
-#define ARRAY_FLAG_27 \
+#define ARRAY_FLAG_COLD_COMPRESSED \
     SERIES_FLAG_27
 
 
@@ -157,3 +189,11 @@ STATIC_ASSERT(ARRAY_FLAG_CONST_SHALLOW == CELL_FLAG_CONST);
 #define LINK_Filename_TYPE          String(const*)
 #define LINK_Filename_CAST          (String(const*))STR
 #define HAS_LINK_Filename           FLAVOR_ARRAY
+
+// When ARRAY_FLAG_HAS_FORMAT_TABLE is set, the ->misc slot which would
+// usually hold the line number holds the format table binary instead (and
+// the line number is stored in the table's header bytes).
+//
+#define MISC_Format_TYPE            Binary(*)
+#define MISC_Format_CAST            BIN
+#define HAS_MISC_Format             FLAVOR_ARRAY
@@ -28,6 +28,16 @@
 #define MISC_VarlistMeta_CAST      CTX
 #define HAS_MISC_VarlistMeta       FLAVOR_VARLIST
 
+// Keylists with enough keys lazily build a hash index over their symbols,
+// to give O(1) field lookup in large objects instead of a linear scan (see
+// Find_Symbol_In_Context()).  SERIES_FLAG_MISC_NODE_NEEDS_MARK doubles as
+// the "has an index" test--it's not part of SERIES_MASK_KEYLIST--so the
+// MISC slot needs no initialization in keylists that never build one.
+//
+#define MISC_Hashlist_TYPE         REBSER*
+#define MISC_Hashlist_CAST         SER
+#define HAS_MISC_Hashlist          FLAVOR_KEYLIST
+
 
 //=//// PARAMLIST_HAS_RETURN //////////////////////////////////////////////=//
 //
@@ -64,6 +74,20 @@
     SERIES_FLAG_24
 
 
+//=//// FRAME_TYPECHECK_DONE //////////////////////////////////////////////=//
+//
+// RUN-FRAME sets this on a frame varlist once an invocation has made it
+// through the typechecking pass.  Later runs through RUN-FRAME can then
+// enter Action_Executor() at the dispatch point directly (the caller's
+// contract is that only argument cells of already-checked types were
+// overwritten between runs).  This is what lets a dispatch layer apply the
+// same function with mostly-same arguments at high rates, amortizing the
+// parameter walk across calls.
+//
+#define VARLIST_FLAG_FRAME_TYPECHECK_DONE \
+    SERIES_FLAG_25
+
+
 #define CELL_MASK_ANY_CONTEXT \
     (CELL_FLAG_FIRST_IS_NODE  /* varlist */ \
         | CELL_FLAG_SECOND_IS_NODE  /* phase (for FRAME!) */)
@@ -199,8 +199,21 @@ struct Reb_Feed_Struct {
     const void *p;  // nullptr if feed is finished (Is_Feed_At_End())
     // Note: The specifier comes from FEED_SPECIFIER()
 
+    // For feeds enumerating a plain array (the overwhelmingly common case)
+    // the array is under SERIES_INFO_HOLD for the whole enumeration, so its
+    // data pointer and tail can't move.  These cache the position and tail
+    // so the hot fetch path doesn't re-derive them from the singular cell
+    // or branch on variadic/pending modes at every step...they're only
+    // recomputed when the backing array changes (splices, reified va_lists).
+    // A nullptr cursor means the cache is invalid and the general fetch
+    // logic must run.  See Fetch_Next_In_Feed() and Update_Feed_Cursor().
+    //
+    const Reb_Cell *cursor;
+    const Reb_Cell *cursor_tail;
+
     //=//// ^-- be sure above fields align cells below to 64-bits --v /////=//
-    // (two intptr_t sized things should take care of it on both 32/64-bit) //
+    // (an even number of intptr_t sized things takes care of it on both
+    // 32-bit and 64-bit platforms) //
 
     // Sometimes the frame can be advanced without keeping track of the
     // last cell.  And sometimes the last cell lives in an array that is
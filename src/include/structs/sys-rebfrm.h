@@ -201,9 +201,23 @@ STATIC_ASSERT(FRAME_FLAG_7_IS_TRUE == NODE_FLAG_CELL);
     FLAG_LEFT_BIT(21)
 
 
-//=//// FRAME_FLAG_22 /////////////////////////////////////////////////////=//
+//=//// FRAME_FLAG_MANUALS_SCOPED /////////////////////////////////////////=//
 //
-#define FRAME_FLAG_22 \
+// The frame's `baseline` captures how many manually-managed series existed
+// when the frame was prepped.  This flag says any manual series made while
+// the frame runs are scoped to it, arena-style...they get freed wholesale
+// when the frame drops, rather than needing a Free_Unmanaged_Series() call
+// on every code path out of a native.
+//
+// A native whose unmanaged allocations are all transient can set this on
+// its own frame at entry.  It must not be used if an unmanaged series gets
+// handed to the caller (either manage such series, or free the rest by
+// hand and leave this flag off).
+//
+// (Abrupt failure frees manuals past the baseline regardless of this flag,
+// as part of Rollback_Globals_To_State().)
+//
+#define FRAME_FLAG_MANUALS_SCOPED \
     FLAG_LEFT_BIT(22)
 
 
@@ -296,6 +310,14 @@ STATIC_ASSERT(31 < 32);  // otherwise FRAME_FLAG_XXX too high
 typedef Bounce (Executor)(Frame(*) frame_);
 typedef Executor Dispatcher;  // sub-dispatched in Action_Executor()
 
+// C function implementing the body of an arity-1 native that opted in to
+// the "intrinsic" calling convention (see DETAILS_FLAG_IS_INTRINSIC).  It
+// receives a single already-typechecked argument and writes the result
+// without a FRAME! being materialized.  It may fail(), but it cannot push
+// continuations or perform evaluations.
+//
+typedef void (Intrinsic)(REBVAL *out, REBVAL *arg);
+
 // This is for working around pedantic C and C++ errors, when an extension
 // that doesn't use %sys-core.h tries to redefine dispatcher in terms of
 // taking a void* and returning a REBVAL*.
@@ -313,6 +335,26 @@ typedef Executor Dispatcher;  // sub-dispatched in Action_Executor()
 #include "executors/exec-scan.h"
 
 
+//=//// COOPERATIVE CANCELLATION TOKEN ////////////////////////////////////=//
+//
+// HALT is global--it aborts everything back to the top level.  A host that
+// multiplexes many requests through one interpreter needs something finer:
+// a way to stop just one request's evaluation.  A cancellation token is a
+// heap-allocated flag wrapped in a HANDLE! by CANCELLATION-TOKEN, set by the
+// CANCEL native (or by foreign code that holds the pointer, possibly from
+// another thread--hence volatile, like Eval_Signal_Pending).
+//
+// Frames evaluated under WITH-CANCELLATION carry a pointer to the token, and
+// the trampoline tests the flag once per bounce...so a requested cancel is
+// noticed at the next executor callback, without waiting for the signal
+// timer's period.  The malloc'd struct is freed by the HANDLE!'s cleaner
+// when it is garbage collected.
+//
+struct Reb_Cancel_Token {
+    volatile bool requested;
+};
+
+
 // NOTE: The ordering of the fields in `Reb_Frame` are specifically done so
 // as to accomplish correct 64-bit alignment of pointers on 64-bit systems.
 //
@@ -394,6 +436,14 @@ typedef Executor Dispatcher;  // sub-dispatched in Action_Executor()
     //
     struct Reb_Frame *prior;
 
+    // The cancellation scope this frame runs under, or nullptr (the common
+    // case).  WITH-CANCELLATION points its own frame at a token; since
+    // Push_Frame() makes every new frame inherit from the frame below, the
+    // token covers the whole subtree pushed during the body's evaluation.
+    // Checked once per trampoline bounce--a single pointer test when unset.
+    //
+    struct Reb_Cancel_Token *cancel_token;
+
     // This is where to write the result of the evaluation.  It should not be
     // in "movable" memory, hence not in a series data array.  Often it is
     // used as an intermediate free location to do calculations en route to
@@ -75,6 +75,8 @@ struct Reb_State {
     Size mold_buf_size;
     REBLEN mold_loop_tail;
 
+    REBLEN protect_epochs;  // engagement depth of WITH-EPOCH-PROTECTION
+
     // Some operations disable the ability to halt, e.g. remove SIG_HALT
     // from Eval_Sigmask...and then restore it when they are done.  If one of
     // these operations is running and then there is a longjmp past the place
@@ -227,8 +227,38 @@ inline static uintptr_t FLAG_SECOND_UINT16(uint16_t u)
   { return FLAG_THIRD_BYTE(u / 256) | FLAG_FOURTH_BYTE(u % 256); }
 
 
-// !!! SECOND_UINT32 should be defined on 64-bit platforms, for any enhanced
-// features that might be taken advantage of when that storage is available.
+// On 64-bit platforms, a header-sized word has a second 32 bits available
+// for enhanced features.  Nothing the core *requires* may live there--only
+// optimizations (e.g. the dialect keyword cache on symbol stubs, which just
+// makes 32-bit builds take the lookup slow path).  Built from bytes for the
+// same strict-aliasing reasons as the uint16_t variants above.
+
+#if defined(UINTPTR_MAX) && (UINTPTR_MAX > 0xFFFFFFFFu)
+    #define HAS_SECOND_UINT32 1
+
+    inline static uint32_t SECOND_UINT32_helper(const unsigned char *flags) {
+        return ((uint32_t)flags[4] << 24) | ((uint32_t)flags[5] << 16)
+            | ((uint32_t)flags[6] << 8) | flags[7];
+    }
+
+    #define SECOND_UINT32(flags) \
+        SECOND_UINT32_helper((const unsigned char*)&flags)
+
+    inline static void SET_SECOND_UINT32_helper(
+        unsigned char *flags,
+        uint32_t u
+    ){
+        flags[4] = u >> 24;
+        flags[5] = (u >> 16) % 256;
+        flags[6] = (u >> 8) % 256;
+        flags[7] = u % 256;
+    }
+
+    #define SET_SECOND_UINT32(flags,u) \
+        SET_SECOND_UINT32_helper((unsigned char*)&(flags), (u))
+#else
+    #define HAS_SECOND_UINT32 0
+#endif
 
 
 //=////////////////////////////////////////////////////////////////////=///=//
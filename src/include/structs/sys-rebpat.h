@@ -107,3 +107,62 @@
 //
 #define NextVirtual(let_or_use) \
     ARR(node_LINK(NextLet, let_or_use))
+
+
+//=//// VIRTUAL BIND LOOKUP CACHE /////////////////////////////////////////=//
+//
+// Words which live at a stable array position and are looked up under a
+// virtual binding chain would otherwise walk that chain of LETs on every
+// single evaluation.  Loop bodies mean the same positions get re-resolved
+// over and over.  This is a small direct-mapped "monomorphic inline cache":
+// each slot remembers one (cell, symbol, specifier) triple along with the
+// patch it resolved to, so a repeat visit of the same array position under
+// the same specifier is a few compares instead of a chain walk.
+//
+// Only hits against immutable LET patches are cached--module variables and
+// object overloads can have variables added after the fact, so hardening a
+// resolution for them could hide an override that comes into existence.
+//
+// The cache is swept at garbage collection time (see Recycle_Core()), since
+// that is the only point at which the managed nodes used as keys can have
+// their addresses recycled for new identities.
+//
+#define VIRTUAL_BIND_CACHE_SLOTS 64  // must be a power of two
+
+struct Reb_Virtual_Bind_Cache_Entry {
+    const void *cell;  // array position of the word (key)
+    const void *symbol;  // guards against cell address reuse (key)
+    REBSPC *specifier;  // specifier the resolution was made under (key)
+    Array(*) patch;  // LET patch the word resolved to
+    REBLEN index;  // index in the patch (always INDEX_PATCHED for LETs)
+};
+
+
+//=//// MODULE INHERITANCE LOOKUP CACHE ///////////////////////////////////=//
+//
+// Words attached to a module which resolve through inheritance (e.g. user
+// code calling Lib functions) deliberately don't burn the inherited patch
+// into the word's cell--if the module later defined its own variable of
+// that name, the hardened cell would never see the override.  The price is
+// that every access walks the symbol's "hitch" list of patches twice (once
+// for the module, once for Lib).
+//
+// This direct-mapped cache parallels the virtual bind one above: each slot
+// remembers one (cell, symbol, module) triple with the inherited patch it
+// resolved to.  A hit is only trusted if the entry's epoch matches
+// PG_Module_Inherit_Epoch: any module gaining a variable "publishes" a new
+// epoch (see Append_Context_Core()), instantly retiring every cached
+// resolution so an inheritance can never mask an override--and the garbage
+// collector publishes one too, since its sweep can recycle the node
+// addresses used as keys.  The epoch bump is the whole invalidation; no
+// slot is ever written on that path.
+//
+#define MODULE_INHERIT_CACHE_SLOTS 64  // must be a power of two
+
+struct Reb_Module_Inherit_Cache_Entry {
+    const void *cell;  // array position of the word (key)
+    const void *symbol;  // guards against cell address reuse (key)
+    const void *module;  // varlist of the module the word is attached to
+    REBSER *patch;  // inherited patch (in Lib) the word resolved to
+    uintptr_t epoch;  // PG_Module_Inherit_Epoch when the entry was filled
+};
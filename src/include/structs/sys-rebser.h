@@ -252,9 +252,18 @@
     FLAG_LEFT_BIT(12)
 
 
-//=//// SERIES_FLAG_13 ////////////////////////////////////////////////////=//
+//=//// SERIES_FLAG_DATA_NOT_OWNED ////////////////////////////////////////=//
 //
-#define SERIES_FLAG_13 \
+// A "view" series has its `content.dynamic.data` pointing into the middle of
+// another series' allocation, rather than owning an allocation of its own.
+// See Make_Binary_View() for how these are created.  Decay_Series() must not
+// try to free the data--the owning series will do that when it goes away.
+//
+// Views hold the owner live for the GC through their LINK() node (and hence
+// also have SERIES_FLAG_LINK_NODE_NEEDS_MARK).  The owner must be frozen so
+// the data can never be relocated or freed out from under the view.
+//
+#define SERIES_FLAG_DATA_NOT_OWNED \
     FLAG_LEFT_BIT(13)
 
 
@@ -273,9 +282,22 @@
     FLAG_LEFT_BIT(14)
 
 
-//=//// SERIES_FLAG_15 ////////////////////////////////////////////////////=//
+//=//// SERIES_FLAG_SHARED ////////////////////////////////////////////////=//
+//
+// A deeply-frozen series can be "blessed" as shared via the SHARE native,
+// which stamps this flag on everything reachable from it.  Shared series are
+// exempt from garbage collection: marking prunes its traversal when it
+// reaches one (nothing inside can change, and everything it references is
+// itself shared) and sweeping treats unmarked shared stubs as survivors.
+// That means a multi-gigabyte loaded dataset costs the GC nothing per
+// recycle...and if evaluators ever run concurrently, a shared graph is
+// exactly the kind of thing they could reference without copying.
+//
+// Blessing is refcounted at the root by the SHARE/UNSHARE natives (see
+// %n-protect.c), since overlapping graphs mean a per-series count would be
+// needed to clear the flags incrementally.  See Try_Bless_Value_Shared().
 //
-#define SERIES_FLAG_15 \
+#define SERIES_FLAG_SHARED \
     FLAG_LEFT_BIT(15)
 
 
@@ -352,9 +374,17 @@ inline static Byte FLAVOR_BYTE(uintptr_t flags)
 STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
 
 
-//=//// SERIES_INFO_1 /////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_EPOCH_PROTECTED ///////////////////////////////////////=//
 //
-#define SERIES_INFO_1 \
+// Marks a series as a member of the "protection epoch" group.  The bit on
+// its own does not make the series read-only--it only counts against writes
+// while a protection epoch is engaged (see PG_Epoch_Protect_Mask).  That
+// split is what lets a large marked dataset be protected and unprotected
+// around an untrusted call in O(1), instead of PROTECT/DEEP's O(n) walk
+// each way: the walk happens once to stamp membership, and thereafter
+// engagement is a global toggle that the mutation checks fold in.
+//
+#define SERIES_INFO_EPOCH_PROTECTED \
     FLAG_LEFT_BIT(1)
 
 
@@ -433,9 +463,14 @@ STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
     FLAG_LEFT_BIT(6)
 
 
-//=//// SERIES_INFO_7 //////////////////////////////////////////////////////=//
+//=//// SERIES_INFO_JOURNALED /////////////////////////////////////////////=//
+//
+// Set by SNAPSHOT to request that mutations to this series going through the
+// Modify choke points in %f-modify.c record compact inverse operations into
+// the mutation journal, so ROLLBACK can undo them without the series ever
+// having been deep copied.  See the journaling section of %n-protect.c.
 //
-#define SERIES_INFO_7 \
+#define SERIES_INFO_JOURNALED \
     FLAG_LEFT_BIT(7)
 
 
@@ -475,6 +510,10 @@ STATIC_ASSERT(SERIES_INFO_0_IS_FALSE == NODE_FLAG_NODE);
 // them is the concept that the INFO slot will be used to hold locking info
 // for series, which would require a full pointer.
 //
+// Exception: plain arrays with ARRAY_FLAG_COLD_SOURCE borrow the third byte
+// (bits 16-23) as a count of garbage collections survived without the body
+// being executed.  See COLD_SOURCE_AGE() in %m-gc.c.
+//
 
 
 
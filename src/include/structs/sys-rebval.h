@@ -165,6 +165,23 @@
 #define QUASI_2             2
 #define ONEQUOTE_3          3  // non-QUASI state of having one quote level
 
+
+//=//// COMBINED HEART+QUOTE TESTING //////////////////////////////////////=//
+//
+// Since the HEART_BYTE() and QUOTE_BYTE() are adjacent in the header, the
+// common question "is this an unquoted cell of heart X?" can be answered by
+// masking both bytes out of the header at once and comparing against a
+// compile-time constant--one load, one AND, one compare--instead of a
+// switch() on the quote byte followed by a test of the heart.  Cell type
+// tests are the most executed code in the system, so the generated IS_XXX()
+// macros are built on this.  (See Is_Unquoted_Kind() in %sys-value.h)
+
+#define CELL_MASK_HEART_AND_QUOTE \
+    (FLAG_HEART_BYTE(255) | FLAG_QUOTE_BYTE(255))
+
+#define FLAG_HEART_AND_QUOTE(heart,quote) \
+    (FLAG_HEART_BYTE(heart) | FLAG_QUOTE_BYTE(quote))
+
 #define AddQuote(byte)           ((byte) + 2)
 #define SubtractQuote(byte)      ((byte) - 2)
 
@@ -202,6 +219,13 @@
 // a single cell.  It assumes that if the node flavor is FLAVOR_SYMBOL then
 // the nonblank thing is a WORD!.
 //
+// CELL_FLAG_LEAF_NATIVE (for ACTION!)
+//
+// Set on the archetype cell of "leaf" natives, whose dispatchers promise to
+// run no arbitrary code (see Native_Leaves in %c-native.c).  It lives on the
+// archetype--and is part of the copied mask--so that HIJACK swapping a new
+// archetype into an identity updates the answer automatically.
+//
 // !!! Thought: Could FRAME! use this bit to encode when the frame is actually
 // a frame for the IDENTITY, and the value is just something that came from
 // `make frame! ^ 10` or similar?  It would weave a bit of a tangled web for
@@ -213,6 +237,7 @@
     FLAG_LEFT_BIT(25)
 
 #define CELL_FLAG_REFINEMENT_LIKE   CELL_FLAG_TYPE_SPECIFIC  // ANY-SEQUENCE!
+#define CELL_FLAG_LEAF_NATIVE       CELL_FLAG_TYPE_SPECIFIC  // ACTION!
 
 
 //=//// CELL_FLAG_26 ///////////////////////////////////////////////////////=//
@@ -22,23 +22,19 @@
 //
 // R3-Alpha had a per-thread "bind table"; a large and sparsely populated hash
 // into which index numbers would be placed, for what index those words would
-// have as keys or parameters.  Ren-C's strategy is that binding information
-// is wedged into REBSER nodes that represent the canon words themselves.
-//
-// This would create problems if multiple threads were trying to bind at the
-// same time.  While threading was never realized in R3-Alpha, Ren-C doesn't
-// want to have any "less of a plan".  So the Reb_Binder is used by binding
-// clients as a placeholder for whatever actual state would be used to augment
-// the information in the canon word series about which client is making a
-// request.  This could be coupled with some kind of lockfree adjustment
-// strategy whereby a word that was contentious would cause a structure to
-// "pop out" and be pointed to by some atomic thing inside the word.
-//
-// For the moment, a binder has some influence by saying whether the high 16
-// bits or low 16 bits of the canon's misc.index are used.  If the index
-// were atomic this would--for instance--allow two clients to bind at once.
-// It's just a demonstration of where more general logic using atomics
-// that could work for N clients would be.
+// have as keys or parameters.  Ren-C for a time wedged binding information
+// into the REBSER nodes of the symbols themselves (as "hitch" singulars).
+// That made every add and remove allocate and free a series stub, and made
+// the symbol table global state shared by all binders--so two binds could
+// never run concurrently, and the GC couldn't run while a binder was live.
+//
+// The Reb_Binder now carries its own small open-addressed hash table keyed
+// by symbol stub pointer.  Adds and removes touch nothing outside the binder
+// itself, so independent binders cannot contend with each other (or with a
+// future collector).  The table starts in a fixed buffer inside the binder,
+// enough for typical function specs and object bodies, and spills to a heap
+// allocation when a large bind--like a module load--outgrows it.  Teardown
+// is a single free at most.
 //
 // The debug build also adds another feature, that makes sure the clear count
 // matches the set count.
@@ -132,7 +128,19 @@ enum {
 };
 
 
+#define BINDER_INLINE_SLOTS  32  // must be a power of two
+
+struct Reb_Binder_Slot {
+    const void *symbol;  // symbol stub pointer (key), null if never used
+    REBINT index;  // stored index, 0 if removed (probing continues past it)
+};
+
 struct Reb_Binder {
+    struct Reb_Binder_Slot *slots;  // == inline_slots until a spill
+    REBLEN capacity;  // total slots, always a power of two
+    REBLEN occupied;  // slots claimed by a symbol (including removed ones)
+    struct Reb_Binder_Slot inline_slots[BINDER_INLINE_SLOTS];
+
   #if !defined(NDEBUG)
     REBLEN count;
   #endif
@@ -146,16 +154,17 @@ struct Reb_Binder {
     bool initialized;
     Reb_Binder () { initialized = false; }
     ~Reb_Binder () { assert(not initialized); }
-  #else
-    int pedantic_warnings_dont_allow_empty_struct;
   #endif
 };
 
 
 inline static void INIT_BINDER(struct Reb_Binder *binder) {
-  #if defined(NDEBUG)
-    UNUSED(binder);
-  #else
+    binder->slots = binder->inline_slots;
+    binder->capacity = BINDER_INLINE_SLOTS;
+    binder->occupied = 0;
+    memset(binder->inline_slots, 0, sizeof(binder->inline_slots));
+
+  #if !defined(NDEBUG)
     binder->count = 0;
 
     #if CPLUSPLUS_11
@@ -174,7 +183,29 @@ inline static void SHUTDOWN_BINDER(struct Reb_Binder *binder) {
     #endif
   #endif
 
-    UNUSED(binder);
+    if (binder->slots != binder->inline_slots)
+        FREE_N(struct Reb_Binder_Slot, binder->capacity, binder->slots);
+}
+
+
+// Linear probe for a symbol's slot: lands on either its entry or the first
+// never-used slot (where it would be inserted).  Slots whose index was
+// zeroed by removal keep their symbol so probe chains stay intact; they are
+// only reclaimed when the table is rebuilt by Expand_Binder().
+//
+inline static struct Reb_Binder_Slot *Find_Binder_Slot(
+    struct Reb_Binder *binder,
+    const void *symbol
+){
+    uintptr_t hash = cast(uintptr_t, symbol) >> 4;  // stubs are aligned
+    REBLEN mask = binder->capacity - 1;
+    REBLEN n = cast(REBLEN, hash) & mask;
+    while (true) {
+        struct Reb_Binder_Slot *slot = &binder->slots[n];
+        if (slot->symbol == symbol or slot->symbol == nullptr)
+            return slot;
+        n = (n + 1) & mask;
+    }
 }
 
 
@@ -185,27 +216,22 @@ inline static bool Try_Add_Binder_Index(
     Symbol(const*) sym,
     REBINT index
 ){
-    String(*) s = m_cast(Raw_Symbol*, sym);
     assert(index != 0);
-    REBSER *old_hitch = MISC(Hitch, s);
-    if (old_hitch != s and GET_SERIES_FLAG(old_hitch, BLACK))
-        return false;  // already has a mapping
 
-    // Not actually managed...but GC doesn't run while binders are active,
-    // and we don't want to pay for putting this in the manual tracking list.
-    //
-    Array(*) new_hitch = Alloc_Singular(
-        NODE_FLAG_MANAGED | SERIES_FLAG_BLACK | FLAG_FLAVOR(HITCH)
-    );
-    CLEAR_SERIES_FLAG(new_hitch, MANAGED);
-    Init_Integer(ARR_SINGLE(new_hitch), index);
-    node_MISC(Hitch, new_hitch) = old_hitch;
+    if (binder->occupied * 2 >= binder->capacity)  // keep load under half
+        Expand_Binder(binder);
 
-    mutable_MISC(Hitch, s) = new_hitch;
+    struct Reb_Binder_Slot *slot = Find_Binder_Slot(binder, sym);
+    if (slot->symbol == nullptr) {
+        slot->symbol = sym;
+        ++binder->occupied;
+    }
+    else if (slot->index != 0)
+        return false;  // already has a mapping
+
+    slot->index = index;
 
-  #if defined(NDEBUG)
-    UNUSED(binder);
-  #else
+  #if !defined(NDEBUG)
     ++binder->count;
   #endif
     return true;
@@ -227,14 +253,10 @@ inline static REBINT Get_Binder_Index_Else_0( // 0 if not present
     struct Reb_Binder *binder,
     Symbol(const*) s
 ){
-    UNUSED(binder);
-    REBSER *hitch = MISC(Hitch, s);
-
-    // Only unmanaged hitches are used for binding.
-    //
-    if (hitch == s or NOT_SERIES_FLAG(hitch, BLACK))
+    struct Reb_Binder_Slot *slot = Find_Binder_Slot(binder, s);
+    if (slot->symbol == nullptr)
         return 0;
-    return VAL_INT32(ARR_SINGLE(ARR(hitch)));
+    return slot->index;  // 0 if the mapping was removed
 }
 
 
@@ -242,20 +264,14 @@ inline static REBINT Remove_Binder_Index_Else_0( // return old value if there
     struct Reb_Binder *binder,
     Symbol(const*) str
 ){
-    String(*) s = m_cast(Raw_Symbol*, str);
-    if (MISC(Hitch, s) == s or NOT_SERIES_FLAG(MISC(Hitch, s), BLACK))
+    struct Reb_Binder_Slot *slot = Find_Binder_Slot(binder, str);
+    if (slot->symbol == nullptr or slot->index == 0)
         return 0;
 
-    Array(*) hitch = ARR(MISC(Hitch, s));
-
-    REBINT index = VAL_INT32(ARR_SINGLE(hitch));
-    mutable_MISC(Hitch, s) = ARR(node_MISC(Hitch, hitch));
-    SET_SERIES_FLAG(hitch, MANAGED);  // we didn't manuals track it
-    GC_Kill_Series(hitch);
+    REBINT index = slot->index;
+    slot->index = 0;  // slot stays claimed, reclaimed on Expand_Binder()
 
-  #if defined(NDEBUG)
-    UNUSED(binder);
-  #else
+  #if !defined(NDEBUG)
     assert(binder->count > 0);
     --binder->count;
   #endif
@@ -331,6 +347,9 @@ inline static void INIT_BINDING_MAY_MANAGE(
     UNUSED(f);
 
     m_cast(REBSER*, binding)->leader.bits |= NODE_FLAG_MANAGED;  // GC sees...
+
+    if (GC_Sweep_Pending and NOT_SERIES_FLAG(binding, MARKED))
+        Blacken_Node_During_Sweep(m_cast(REBSER*, binding));  // see %m-gc.c
 }
 
 
@@ -424,6 +443,8 @@ inline static Context(*) VAL_WORD_CONTEXT(const REBVAL *v) {
         not Is_Action_Frame_Fulfilling(FRM(BONUS(KeySource, binding)))
     );
     binding->leader.bits |= NODE_FLAG_MANAGED;  // !!! review managing needs
+    if (GC_Sweep_Pending and NOT_SERIES_FLAG(binding, MARKED))
+        Blacken_Node_During_Sweep(binding);  // see %m-gc.c
     Context(*) c = CTX(binding);
     FAIL_IF_INACCESSIBLE_CTX(c);
     return c;
@@ -467,6 +488,39 @@ enum Reb_Attach_Mode {
     ATTACH_COPY
 };
 
+
+// Pick a slot in the virtual bind cache for a word cell.  The low bits of a
+// cell address are not interesting (cells are aligned), so shift them off
+// before taking the modulus.
+//
+inline static REBLEN Virtual_Bind_Cache_Hash(Cell(const*) any_word) {
+    uintptr_t bits = cast(uintptr_t, cast(const void*, any_word));
+    return (bits >> 4) % VIRTUAL_BIND_CACHE_SLOTS;
+}
+
+inline static REBLEN Module_Inherit_Cache_Hash(Cell(const*) any_word) {
+    uintptr_t bits = cast(uintptr_t, cast(const void*, any_word));
+    return (bits >> 4) % MODULE_INHERIT_CACHE_SLOTS;
+}
+
+// The cache keys on node addresses, which are only recycled for new node
+// identities by the garbage collector's sweep.  So the GC wipes the cache
+// on each Recycle_Core().
+//
+inline static void Invalidate_Virtual_Bind_Cache(void) {
+    memset(PG_Virtual_Bind_Cache, 0, sizeof(PG_Virtual_Bind_Cache));
+}
+
+// Cached module inheritances are only trustworthy so long as no module has
+// gained a variable that could override them; adding one retires every
+// entry at once by bumping the epoch they are stamped with.  (The GC bumps
+// it too, in lieu of the memset the virtual bind cache gets, since swept
+// node addresses can be reused for new identities.)
+//
+inline static void Invalidate_Module_Inherit_Cache(void) {
+    ++PG_Module_Inherit_Epoch;  // entries with the old stamp stop matching
+}
+
 // Find the context a word is bound into.  This must account for the various
 // binding forms: Relative Binding, Derived Binding, and Virtual Binding.
 //
@@ -504,6 +558,24 @@ inline static option(REBSER*) Get_Word_Container(
     //
     Symbol(const*) symbol = VAL_WORD_SYMBOL(VAL_UNESCAPED(any_word));
 
+    // Before walking the chain, probe the monomorphic cache...a repeat visit
+    // of this same array position under this same specifier (e.g. in a loop
+    // body) can reuse the prior resolution.  Only LET patches are put in the
+    // cache; they are immutable so the resolution cannot go stale.
+    //
+    struct Reb_Virtual_Bind_Cache_Entry *entry =
+        &PG_Virtual_Bind_Cache[Virtual_Bind_Cache_Hash(any_word)];
+    if (
+        entry->cell == cast(const void*, any_word)
+        and entry->symbol == cast(const void*, symbol)
+        and entry->specifier == specifier
+    ){
+        *index_out = entry->index;
+        return entry->patch;
+    }
+
+    REBSPC *cache_specifier = specifier;  // loop below advances `specifier`
+
     // !!! Virtual binding could use the bind table as a kind of next
     // level cache if it encounters a large enough object to make it
     // wortwhile?
@@ -511,6 +583,12 @@ inline static option(REBSER*) Get_Word_Container(
     do {
         if (IS_LET(specifier)) {
             if (INODE(LetSymbol, specifier) == symbol) {
+                entry->cell = any_word;
+                entry->symbol = symbol;
+                entry->specifier = cache_specifier;
+                entry->patch = specifier;
+                entry->index = INDEX_PATCHED;
+
                 *index_out = INDEX_PATCHED;
                 return specifier;
             }
@@ -531,6 +609,12 @@ inline static option(REBSER*) Get_Word_Container(
         overbind = ARR(BINDING(ARR_SINGLE(specifier)));
         if (not IS_VARLIST(overbind)) {  // a patch-formed LET overload
             if (INODE(LetSymbol, overbind) == symbol) {
+                entry->cell = any_word;
+                entry->symbol = symbol;
+                entry->specifier = cache_specifier;
+                entry->patch = overbind;
+                entry->index = 1;
+
                 *index_out = 1;
                 return overbind;
             }
@@ -607,9 +691,28 @@ inline static option(REBSER*) Get_Word_Container(
         //
         if (CTX_TYPE(CTX(binding)) == REB_MODULE) {
             Symbol(const*) symbol = VAL_WORD_SYMBOL(VAL_UNESCAPED(any_word));
+
+            // Probe the inheritance cache first.  A current-epoch hit can
+            // be trusted to mean there's no override in the module itself,
+            // because any module gaining any variable bumps the epoch--so
+            // both hitch list walks below are skipped.  (Reads only: a
+            // write to an attached word must get a chance to create the
+            // variable.)
+            //
+            struct Reb_Module_Inherit_Cache_Entry *mentry =
+                &PG_Module_Inherit_Cache[Module_Inherit_Cache_Hash(any_word)];
+            if (
+                mode == ATTACH_READ
+                and mentry->epoch == PG_Module_Inherit_Epoch
+                and mentry->cell == cast(const void*, any_word)
+                and mentry->symbol == cast(const void*, symbol)
+                and mentry->module == cast(const void*, binding)
+            ){
+                *index_out = 1;
+                return mentry->patch;
+            }
+
             REBSER *patch = MISC(Hitch, symbol);
-            while (GET_SERIES_FLAG(patch, BLACK))  // binding temps
-                patch = SER(node_MISC(Hitch, patch));
 
             for (; patch != symbol; patch = SER(node_MISC(Hitch, patch))) {
                 if (INODE(PatchContext, patch) != binding)
@@ -654,8 +757,6 @@ inline static option(REBSER*) Get_Word_Container(
                 return nullptr;
 
             patch = MISC(Hitch, symbol);
-            while (GET_SERIES_FLAG(patch, BLACK))  // binding temps
-                patch = SER(node_MISC(Hitch, patch));
 
             for (; patch != symbol; patch = SER(node_MISC(Hitch, patch))) {
                 if (INODE(PatchContext, patch) != Lib_Context)
@@ -664,8 +765,16 @@ inline static option(REBSER*) Get_Word_Container(
                 // We return it, but don't cache it in the cell.  Note that
                 // Derelativize() or other operations should not cache either
                 // as it would commit to the inherited version, never seeing
-                // derived overrides.
+                // derived overrides.  (The global inheritance cache *can*
+                // remember it, because overrides coming into existence
+                // retire its entries via the epoch.)
                 //
+                mentry->cell = any_word;
+                mentry->symbol = symbol;
+                mentry->module = binding;
+                mentry->patch = patch;
+                mentry->epoch = PG_Module_Inherit_Epoch;
+
                 *index_out = 1;
                 return patch;
             }
@@ -879,7 +988,7 @@ inline static REBSPC *Derive_Specifier(
     ) = delete;
 #endif
 
-inline static REBVAL *Derelativize_Untracked(
+INLINE_HOT static REBVAL *Derelativize_Untracked(
     Cell(*) out,  // relative dest overwritten w/specific value
     Cell(const*) v,
     REBSPC *specifier
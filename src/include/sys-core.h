@@ -309,6 +309,33 @@ typedef struct rebol_stats {
     REBLEN  Objects;
 } REB_STATS;
 
+//-- Allocation accounting, active while MEMORY-TALLY is on (see %d-stats.c).
+//   Unlike REB_STATS this is available in release builds: the counters are
+//   only a pointer test and an increment on the allocation paths.
+//
+typedef struct rebol_mem_tally {
+    REBI64  Series_Made[FLAVOR_MAX];  // stub creations, by series flavor
+    REBI64  Series_Bytes[FLAVOR_MAX];  // dynamic data bytes, by flavor
+    REBI64  Data_Allocs[MAX_POOLS];  // data allocations, by backing pool
+    REBI64  Recycles;  // collections that ran inside the tally window
+    REBI64  Stubs_Swept;  // managed stubs reaped by those collections
+    REBI64  Stubs_Survived;  // managed stubs that stayed live
+} REB_MEM_TALLY;
+
+//-- Per-rule-block PARSE counters, active while PARSE-PROFILE is on.  Rows
+//   are keyed by rule array identity; a label excerpt is captured when a
+//   block is first seen, so reporting doesn't depend on the array's pointer
+//   staying valid.  (See PARSE-PROFILE in %d-stats.c, tallying in %u-parse.c)
+//
+typedef struct rebol_parse_tally {
+    const Raw_Array *rules;  // key only--never dereferenced after capture
+    char *label;  // molded excerpt w/any file and line info (malloc'd)
+    REBI64  entries;  // times SUBPARSE was entered on this rule block
+    REBI64  matches;  // entries that found a match (returned a position)
+    REBI64  misses;  // entries that returned null, after any alternates
+    REBI64  backtracks;  // `|` alternates tried after a mid-block failure
+} REB_PARSE_TALLY;
+
 //-- Options of various kinds:
 typedef struct rebol_opts {
     bool  watch_recycle;
@@ -378,10 +405,16 @@ enum Boot_Phases {
     BOOT_DONE
 };
 
+// How much of the interpreted portion of the boot to run.  Startup_Core()
+// defaults to FULL, but honors the R3_BOOT_LEVEL environment variable
+// ("base", "sys", "mods") so embedders that launch many short-lived
+// interpreters can skip the mezzanine (and optionally SYS.UTIL) evaluation,
+// which dominates cold boot time.
+//
 enum Boot_Levels {
-    BOOT_LEVEL_BASE,
-    BOOT_LEVEL_SYS,
-    BOOT_LEVEL_MODS,
+    BOOT_LEVEL_BASE,  // natives, generics, and %base-*.r definitions only
+    BOOT_LEVEL_SYS,  // plus the SYS.UTIL module (LOAD, MODULE, codecs...)
+    BOOT_LEVEL_MODS,  // plus the mezzanine (currently same as FULL)
     BOOT_LEVEL_FULL
 };
 
@@ -389,7 +422,14 @@ enum Boot_Levels {
 enum {
     MKF_RETURN      = 1 << 0,   // give a return COPY(but local RETURN: overrides)
     MKF_KEYWORDS    = 1 << 1,   // respond to tags like <opt>, <with>, <local>
-    MKF_2           = 1 << 2,
+
+    // Don't build the meta object (description, parameter types and notes)
+    // now--just notice whether the spec has any of that material in it.  The
+    // caller stashes the spec so Force_Action_Meta() can analyze it again on
+    // the first META-OF request.  Most dynamically created functions never
+    // have their help asked for, so they skip the string and array copies.
+    //
+    MKF_DEFER_META  = 1 << 2,
 
     // These flags are set during the process of spec analysis.  It helps
     // avoid the inefficiency of creating documentation frames on functions
@@ -477,26 +517,36 @@ enum rebol_signals {
     // state.  Because the ability to manage such a state may not be
     // registered by the host, this could generate an error.
     //
-    SIG_INTERRUPT = 1 << 2
+    SIG_INTERRUPT = 1 << 2,
+
+    // SIG_MEM_WATERMARK is raised by the allocator when PG_Mem_Usage first
+    // crosses the soft limit configured by MEMORY-LIMIT.  The hook that
+    // responds runs Rebol code, which can't happen inside an allocation...
+    // so as with SIG_RECYCLE, the allocator only raises the flag and the
+    // checkpoint does the work.  See Did_Trap_Alloc_Limit() in %m-pools.c.
+    //
+    SIG_MEM_WATERMARK = 1 << 3
 };
 
 inline static void SET_SIGNAL(Flags f) { // used in %sys-series.h
     Eval_Signals |= f;
 
-    if (Eval_Countdown == -1)  // already set to trigger on next tick...
-        return;  // ...we already reconciled the dose
-
-    assert(Eval_Countdown > 0);  // transition to 0 triggers signals
-
-    // This forces the next step in the evaluator to count down to 0 and
-    // trigger an interrupt.  But we have to reconcile the count first.
+    // The pending flag is raised after the signal bits so that a checkpoint
+    // which notices the flag is guaranteed to see the signal that raised it.
+    // (Ctrl-C handlers call this from outside the evaluator's own thread of
+    // control--e.g. a handler thread on Windows--which is why there is no
+    // arithmetic here; just stores that are safe to interleave.)
     //
-    Total_Eval_Cycles += Eval_Dose - Eval_Countdown;
-  #if !defined(NDEBUG)
-    assert(Total_Eval_Cycles == Total_Eval_Cycles_Doublecheck);
-  #endif
+    Eval_Signal_Pending = 1;
 
-    Eval_Countdown = -1;
+    // If the evaluator is parked in a fully blocking wait (e.g. WAIT's
+    // event loop, which registers this hook backed by a uv_async_t--an
+    // eventfd/self-pipe underneath), poke it so the signal isn't stuck
+    // until some unrelated event ends the block.  The hook must be safe to
+    // call from other threads and from OS signal handlers.
+    //
+    if (PG_Signal_Wakeup_Hook)
+        (*PG_Signal_Wakeup_Hook)();
 }
 
 #define GET_SIGNAL(f) \
@@ -594,10 +644,10 @@ inline static REBVAR *Force_Lib_Var(SymId id) {
 
 #include "sys-throw.h"
 #include "sys-feed.h"
+#include "datatypes/sys-handle.h"  // ACT_INTRINSIC() in frame code reads one
 #include "datatypes/sys-frame.h"  // needs words for frame-label helpers
 
 #include "datatypes/sys-time.h"
-#include "datatypes/sys-handle.h"
 #include "datatypes/sys-map.h"
 #include "datatypes/sys-varargs.h"
 
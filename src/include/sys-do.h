@@ -104,22 +104,11 @@ inline static Bounce Run_Generic_Dispatch_Core(
     Frame(*) f,
     Symbol(const*) verb
 ){
-    GENERIC_HOOK *hook;
-    switch (QUOTE_BYTE(first_arg)) {
-      case ISOTOPE_0:
-        hook = &T_Isotope;
-        break;
-      case UNQUOTED_1:
-        hook = Generic_Hook_For_Type_Of(first_arg);
-        break;
-      case QUASI_2:
-        hook = &T_Quasi;
-        break;
-      default:
-        hook = &T_Quoted;  // a few things like COPY are supported by QUOTED!
-        break;
-    }
+    Byte quote_class = QUOTE_BYTE(first_arg);
+    if (quote_class > QUASI_2)
+        quote_class = QUASI_2 + 1;  // all quoting depths share the quoted row
 
+    GENERIC_HOOK *hook = PG_Generic_Hooks[quote_class][HEART_BYTE(first_arg)];
     return hook(f, verb);  // Note QUOTED! has its own hook & handling;
 }
 
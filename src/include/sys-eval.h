@@ -155,6 +155,13 @@ inline static REBVAL *Refinify_Pushed_Refinement(REBVAL *v) {
 // so advancing the frame past an inert item to find an enfix function means
 // you have to enter the frame specially with ST_EVALUATOR_LOOKING_AHEAD.
 //
+// The same "superinstruction" treatment extends to plain WORD!s that look up
+// to non-activation values: fetches like the `y` of `x: y` are as common in
+// assignments and argument positions as inert values are, and don't need a
+// frame either.  The wrinkle is backward quoting--an enfix function that
+// quotes its left would have seen the *token*, not the fetched value.  So
+// the literal word is kept on hand to substitute into `out` in that case.
+//
 inline static bool Did_Init_Inert_Optimize_Complete(
     REBVAL *out,
     Feed(*) feed,
@@ -164,10 +171,31 @@ inline static bool Did_Init_Inert_Optimize_Complete(
     assert(Not_Feed_At_End(feed));  // would be wasting time to call
     assert(not (*flags & FRAME_FLAG_BRANCH));  // it's a single step
 
-    if (not ANY_INERT(At_Feed(feed)))
-        return false;  // general case evaluation requires a frame
+    bool fused_word = false;  // fetched a WORD!'s value instead of a frame
+    DECLARE_LOCAL (word);  // literal token, in case enfix quotes leftward
+
+    if (ANY_INERT(At_Feed(feed))) {
+        Literal_Next_In_Feed(out, feed);
+    }
+    else if (
+        VAL_TYPE_UNCHECKED(At_Feed(feed)) == REB_WORD
+        and not (*flags & FRAME_FLAG_META_RESULT)  // ^META nulls need care
+    ){
+        feed->gotten = Lookup_Word(At_Feed(feed), FEED_SPECIFIER(feed));
+        if (
+            not feed->gotten
+            or Is_Isotope(unwrap(feed->gotten))  // activations need a frame,
+        ){                                       // isotope errors one source
+            return false;  // lookup was cached, general path won't redo it
+        }
 
-    Literal_Next_In_Feed(out, feed);
+        Derelativize(word, At_Feed(feed), FEED_SPECIFIER(feed));
+        Copy_Cell(out, unwrap(feed->gotten));  // no CELL_FLAG_UNEVALUATED
+        Fetch_Next_In_Feed(feed);
+        fused_word = true;
+    }
+    else
+        return false;  // general case evaluation requires a frame
 
     if (
         not Is_Feed_At_End(feed)
@@ -193,6 +221,10 @@ inline static bool Did_Init_Inert_Optimize_Complete(
             // Quoting defeats NO_LOOKAHEAD but only on soft quotes.
             //
             if (Not_Feed_Flag(feed, NO_LOOKAHEAD)) {
+                if (fused_word) {  // backward quote must see the token
+                    Copy_Cell(out, word);
+                    Set_Cell_Flag(out, UNEVALUATED);
+                }
                 *flags |=
                     FLAG_STATE_BYTE(ST_EVALUATOR_LOOKING_AHEAD)  // no FRESHEN()
                     | EVAL_EXECUTOR_FLAG_INERT_OPTIMIZATION;
@@ -207,6 +239,10 @@ inline static bool Did_Init_Inert_Optimize_Complete(
             if (VAL_PARAM_CLASS(first) == PARAM_CLASS_SOFT)
                 goto optimized;  // don't look back, yield the lookahead
 
+            if (fused_word) {  // backward quote must see the token
+                Copy_Cell(out, word);
+                Set_Cell_Flag(out, UNEVALUATED);
+            }
             *flags |=
                 FLAG_STATE_BYTE(ST_EVALUATOR_LOOKING_AHEAD)  // no FRESHEN()
                 | EVAL_EXECUTOR_FLAG_INERT_OPTIMIZATION;
@@ -144,6 +144,31 @@ inline static option(va_list*) FEED_VAPTR(Feed(*) feed) {
     VAL_INDEX_UNBOUNDED(FEED_SINGLE(feed))
 
 
+// Recompute the cached array cursor and tail (see remarks in %sys-rebfed.h).
+// Must be called any time the singular cell is repointed at a different
+// array or the index is changed by something other than the fetch itself:
+// splice swaps, va_list reification, etc.  While enumerating, the array is
+// under SERIES_INFO_HOLD--so between those events the pointers can't move.
+//
+inline static void Update_Feed_Cursor(Feed(*) feed) {
+    if (FEED_IS_VARIADIC(feed) or FEED_PENDING(feed) != nullptr) {
+        feed->cursor = nullptr;  // general fetch logic must sort it out
+        feed->cursor_tail = nullptr;
+    }
+    else {
+        Array(const*) a = FEED_ARRAY(feed);
+        if (FEED_INDEX(feed) >= cast(REBINT, ARR_LEN(a))) {
+            feed->cursor = ARR_TAIL(a);  // at end (index can be len + 1)
+            feed->cursor_tail = feed->cursor;  // equality forces slow path
+        }
+        else {
+            feed->cursor = ARR_AT(a, FEED_INDEX(feed));
+            feed->cursor_tail = ARR_TAIL(a);
+        }
+    }
+}
+
+
 // When we see nullptr in the valist, we make a compromise of convenience,
 // where it is replaced with a QUASI!-BLANK!.  We've told a lie, but if
 // evaluated it will produce a blank isotope, e.g. NULL.  If not evaluated it
@@ -306,6 +331,31 @@ inline static option(Value(const*)) Try_Reify_Variadic_Feed_Series(
 }
 
 
+// Peek whether the next item in a variadic feed is the END signal, without
+// disturbing the feed (va_copy for a va_list; the packed cursor can simply
+// be dereferenced).  If true, whatever is in feed->p right now is the last
+// content the feed will deliver.
+//
+inline static bool Variadic_Feed_Tail_Is_End(Feed(*) feed) {
+    assert(FEED_IS_VARIADIC(feed));
+
+    const void *next;
+    if (FEED_VAPTR(feed)) {
+        va_list peek;
+        va_copy(peek, *unwrap(FEED_VAPTR(feed)));
+        next = va_arg(peek, const void*);
+        va_end(peek);
+    }
+    else
+        next = *FEED_PACKED(feed);
+
+    if (not next)
+        return false;  // libRebol's NULL, distinct from the END signal
+
+    return Detect_Rebol_Pointer(next) == DETECTED_AS_END;
+}
+
+
 // Ordinary Rebol internals deal with REBVAL* that are resident in arrays.
 // But a va_list can contain UTF-8 string components or special instructions
 //
@@ -350,7 +400,30 @@ inline static void Force_Variadic_Feed_At_Cell_Or_End_May_Fail(Feed(*) feed)
         // !!! Scans that produce only one value (which are likely very
         // common) can go into feed->fetched and not make an array at all.
         //
-        Array(*) reified = try_unwrap(Try_Scan_Variadic_Feed_Utf8_Managed(feed));
+        // If the fragment is the feed's entire remaining content (the next
+        // item peeks as the END signal), the scan can't interleave with any
+        // spliced values...so its reified array is a pure function of the
+        // fragment text and binding context, and can be reused from cache.
+        // String literals have stable addresses, so repeated API calls with
+        // the same literal skip the scanner entirely--the byte verification
+        // is what makes recycled heap addresses safe, see %l-scan.c.
+        //
+        const void *utf8 = feed->p;
+        bool sole = Variadic_Feed_Tail_Is_End(feed);
+
+        Array(*) reified;
+        if (sole) {
+            reified = try_unwrap(
+                Try_Find_Cached_Variadic_Scan(utf8, feed->context)
+            );
+            if (reified) {
+                feed->p = &PG_Feed_At_End;  // peeked: next item was the END
+                Finalize_Variadic_Feed(feed);  // runs the va_end()
+                goto have_reified;
+            }
+        }
+
+        reified = try_unwrap(Try_Scan_Variadic_Feed_Utf8_Managed(feed));
 
         if (not reified) {  // rebValue("", ...), see [1]
             if (Is_Feed_At_End(feed))
@@ -364,8 +437,22 @@ inline static void Force_Variadic_Feed_At_Cell_Or_End_May_Fail(Feed(*) feed)
         assert(Is_Feed_At_End(feed));
         Finalize_Variadic_Feed(feed);
 
+        if (sole)
+            Maybe_Cache_Variadic_Scan(utf8, feed->context, reified);
+
+      have_reified:
         feed->p = ARR_HEAD(reified);
         Init_Array_Cell_At(FEED_SINGLE(feed), REB_BLOCK, reified, 1);
+
+        // The feed will now hold cell pointers into the reified array, so
+        // it needs the same hold an ordinary array feed takes (this also
+        // pins the data against RECYCLE/COMPACT migration).
+        //
+        assert(Not_Feed_Flag(feed, TOOK_HOLD));
+        if (NOT_SERIES_INFO(reified, HOLD)) {
+            SET_SERIES_INFO(reified, HOLD);
+            Set_Feed_Flag(feed, TOOK_HOLD);
+        }
         break; }
 
       default:
@@ -373,6 +460,7 @@ inline static void Force_Variadic_Feed_At_Cell_Or_End_May_Fail(Feed(*) feed)
     }
 
     assert(Is_Feed_At_End(feed) or READABLE(cast(const Reb_Cell*, feed->p)));
+    Update_Feed_Cursor(feed);  // UTF-8 scans reify the feed into an array
     return;
 
 } detect_again: {  ///////////////////////////////////////////////////////////
@@ -403,7 +491,7 @@ inline static void Sync_Feed_At_Cell_Or_End_May_Fail(Feed(*) feed) {
 // Once a va_list is "fetched", it cannot be "un-fetched".  Hence only one
 // unit of fetch is done at a time, into f->value.
 //
-inline static void Fetch_Next_In_Feed(Feed(*) feed) {
+INLINE_HOT static void Fetch_Next_In_Feed(Feed(*) feed) {
     assert(Not_Feed_Flag(feed, NEEDS_SYNC));
 
   #if DEBUG_PROTECT_FEED_CELLS
@@ -423,11 +511,21 @@ inline static void Fetch_Next_In_Feed(Feed(*) feed) {
     feed->gotten = nullptr;
 
   retry_splice:
-    if (FEED_PENDING(feed)) {
-        assert(FEED_PENDING(feed) != nullptr);
+    if (feed->cursor != feed->cursor_tail) {  // hot path: plain array cells
+        assert(not FEED_IS_VARIADIC(feed));
+        assert(FEED_PENDING(feed) == nullptr);
+
+        feed->p = feed->cursor;
+        ++feed->cursor;
+        ++FEED_INDEX(feed);  // FRM_INDEX() etc. still see a valid index
 
+        PREFETCH_READ(feed->cursor);  // start pulling next cell's line in
+    }
+    else if (FEED_PENDING(feed)) {
         feed->p = FEED_PENDING(feed);
         mutable_MISC(Pending, &feed->singular) = nullptr;
+
+        Update_Feed_Cursor(feed);  // pending gone, may be plain array again
     }
     else if (FEED_IS_VARIADIC(feed)) {
         //
@@ -445,12 +543,14 @@ inline static void Fetch_Next_In_Feed(Feed(*) feed) {
             //
             feed->p = *FEED_PACKED(feed)++;
         }
-        Force_Variadic_Feed_At_Cell_Or_End_May_Fail(feed);
+        Force_Variadic_Feed_At_Cell_Or_End_May_Fail(feed);  // updates cursor
     }
     else {
         if (FEED_INDEX(feed) != cast(REBINT, ARR_LEN(FEED_ARRAY(feed)))) {
             feed->p = ARR_AT(FEED_ARRAY(feed), FEED_INDEX(feed));
             ++FEED_INDEX(feed);
+
+            Update_Feed_Cursor(feed);  // heal cache if it was invalidated
         }
         else {
             feed->p = &PG_Feed_At_End;
@@ -476,6 +576,7 @@ inline static void Fetch_Next_In_Feed(Feed(*) feed) {
                     sizeof(Raw_Array)
                 );
                 GC_Kill_Series(splice);  // Array(*) would hold reference
+                Update_Feed_Cursor(feed);  // backing array just changed
                 goto retry_splice;
             }
         }
@@ -642,6 +743,9 @@ inline static Feed(*) Prep_Feed_Common(void* preallocated, Flags flags) {
     TRASH_POINTER_IF_DEBUG(feed->p);
     TRASH_POINTER_IF_DEBUG(feed->gotten);
 
+    feed->cursor = nullptr;  // cache invalid until an array is in effect
+    feed->cursor_tail = nullptr;
+
     TRASH_POINTER_IF_DEBUG(feed->context);  // experiment!
     return feed;
 }
@@ -692,6 +796,8 @@ inline static Feed(*) Prep_Array_Feed(
 
     feed->context = nullptr;  // already has binding
 
+    Update_Feed_Cursor(feed);  // hold (or END) is in effect; cache is stable
+
     return feed;
 }
 
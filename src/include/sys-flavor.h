@@ -140,7 +140,7 @@ enum Reb_Stub_Flavor {
     FLAVOR_SERIESLIST,  // e.g. manually allocated series list
     FLAVOR_MOLDSTACK,
 
-    FLAVOR_HASHLIST,  // outlier, sizeof(REBLEN)...
+    FLAVOR_HASHLIST,  // outlier, sizeof(struct Reb_Hashlist_Entry)...
     FLAVOR_BOOKMARKLIST,  // also outlier, sizeof(struct Reb_Bookmark)
 
     FLAVOR_MIN_BYTESIZE,  //=//////// EVERYTHING BELOW THIS LINE HAS WIDTH = 1
@@ -199,7 +199,7 @@ inline static size_t Wide_For_Flavor(Flavor flavor) {
     if (flavor == FLAVOR_BOOKMARKLIST)
         return sizeof(struct Reb_Bookmark);
     if (flavor == FLAVOR_HASHLIST)
-        return sizeof(REBLEN);
+        return sizeof(struct Reb_Hashlist_Entry);
     return sizeof(void*);
 }
 
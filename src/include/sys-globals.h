@@ -36,6 +36,31 @@ PVAR REBINT PG_Boot_Level;  // User specified startup level
 PVAR REBU64 PG_Mem_Usage;   // Overall memory used
 PVAR REBU64 PG_Mem_Limit;   // Memory limit set by SECURE
 
+PVAR REBU64 PG_Mem_Soft_Limit;  // Watermark signaling MEMORY-LIMIT's hook
+PVAR bool PG_Mem_Watermark_Armed;  // false after firing, until back under
+PVAR REBVAL *PG_Mem_Watermark_Hook;  // nullptr, or root handle to ACTION!
+
+PVAR REB_MEM_TALLY *PG_Mem_Tally;  // nullptr unless MEMORY-TALLY is on
+
+// An extension can register one cheap C-level "pump" to be called at the
+// evaluator's signal checkpoints--no user code, just I/O housekeeping.  The
+// stdio extension uses this to drain and echo typed-ahead keystrokes, so the
+// terminal stays live while a long computation runs.  While non-null, the
+// periodic signal timer keeps unprompted checkpoints coming; registrants
+// should clear the hook around their own blocking reads (and at shutdown)
+// so an idle interpreter goes back to making zero wakeups.
+//
+PVAR void (*PG_IO_Pump_Hook)(void);
+
+// Series stamped with SERIES_INFO_EPOCH_PROTECTED only refuse writes while
+// a protection epoch is engaged.  PG_Protect_Epochs counts engagements (they
+// nest), and PG_Epoch_Protect_Mask caches either 0 or the info bit itself,
+// so Is_Series_Read_Only() can OR it into its mask without branching.  See
+// WITH-EPOCH-PROTECTION in %n-protect.c.
+//
+PVAR REBLEN PG_Protect_Epochs;  // engagement depth
+PVAR uintptr_t PG_Epoch_Protect_Mask;  // 0 or SERIES_INFO_EPOCH_PROTECTED
+
 
 
 // This is a series that holds 8-platform-pointer Array nodes, arranged in
@@ -61,6 +86,31 @@ PVAR REBLEN PG_Num_Symbol_Slots_In_Use; // Total symbol hash slots (+deleteds)
 #endif
 PVAR Raw_Symbol PG_Deleted_Symbol;  // pointer used to indicate a deletion
 
+// Direct-mapped cache of virtual bind resolutions, so that evaluating the
+// same word position under the same LET chain doesn't re-walk the chain.
+// See definition of the entry structure in %sys-rebpat.h for the rules.
+//
+PVAR struct Reb_Virtual_Bind_Cache_Entry
+    PG_Virtual_Bind_Cache[VIRTUAL_BIND_CACHE_SLOTS];
+
+// Direct-mapped cache of module-inherited variable resolutions (e.g. user
+// context code reaching Lib definitions), wiped when any module gains a
+// variable.  See definition of the entry structure in %sys-rebpat.h.
+//
+PVAR struct Reb_Module_Inherit_Cache_Entry
+    PG_Module_Inherit_Cache[MODULE_INHERIT_CACHE_SLOTS];
+
+// Epoch of the module-inherited variable landscape.  Lib and the other
+// module contexts are mutated rarely after boot but consulted on every
+// lookup miss, so invalidation is the thing to make cheap: creating a
+// module variable just increments this counter, and cache entries stamped
+// with an older epoch stop matching.  (A threaded build sharing Lib between
+// isolates would publish mutations the same way--bump a version, let the
+// readers lazily re-resolve--rather than copying the ~2000-entry Lib into
+// each isolate.)
+//
+PVAR uintptr_t PG_Module_Inherit_Epoch;
+
 PVAR REBVAL *Lib_Context_Value;
 PVAR REBVAL *Sys_Util_Module;
 PVAR REBVAL *User_Context_Value;
@@ -74,6 +124,13 @@ PVAR Context(*) PG_Currently_Loading_Module;
 
 PVAR REBVAL Datatypes[REB_MAX];  // just the TYPE-WORD!s, like &integer
 
+// Flattened table for generic dispatch: the "quote class" of the first
+// argument (isotope, unquoted, quasi, quoted) crossed with its HEART_BYTE.
+// Filled in once by Startup_Generics() so Run_Generic_Dispatch_Core() can
+// find its hook with a single indexed load instead of a switch().
+//
+PVAR GENERIC_HOOK *PG_Generic_Hooks[4][REB_MAX];
+
 //-- Various char tables:
 PVAR Byte* White_Chars;
 PVAR Codepoint *Upper_Cases;
@@ -192,13 +249,55 @@ TVAR Frame(*) TG_Unwind_Frame;
 TVAR REBI64 TG_Ballast;
 TVAR REBI64 TG_Max_Ballast;
 
+// GC pacing policy, see Update_GC_Pacing() in %m-gc.c.  Zero growth percent
+// means the historical fixed-ballast budget; a nonzero value scales the
+// allocation budget to the surviving heap after each recycle.
+//
+TVAR REBINT TG_GC_Growth_Pct;  // % the live heap may grow between recycles
+TVAR REBU64 TG_GC_Max_Heap;  // soft heap ceiling in bytes (0 = no ceiling)
+
 //-- Memory and GC:
-TVAR Pool* Mem_Pools;     // Memory pool array
+TVAR Pool* Mem_Pools;     // Memory pool array (thread-local on purpose: see
+                          // "NUMA PLACEMENT OF POOL SEGMENTS" in %m-pools.c)
 TVAR bool GC_Recycling;    // True when the GC is in a recycle
 TVAR REBINT GC_Ballast;     // Bytes allocated to force automatic GC
 TVAR bool GC_Disabled;      // true when RECYCLE/OFF is run
 TVAR REBSER *GC_Guarded; // A stack of GC protected series and values
+TVAR Count GC_Last_Survivors;  // stubs that lived through the last sweep
+
+//=//// INCREMENTAL SWEEP STATE ///////////////////////////////////////////=//
+//
+// When PG_GC_Sweep_Slice is nonzero, Recycle_Core() marks atomically but
+// returns after sweeping only that many pool segments.  The remaining
+// segments are swept in bounded slices from the signal checkpoint in
+// Do_Signals_Throws(), so a large stable heap doesn't serialize one long
+// sweep pause.  While slices are outstanding, nodes are allocated "black"
+// (pre-marked) so a partially-swept heap can't reap them; the newborn list
+// remembers them so the stray marks are cleared when the window closes.
+//
+PVAR REBLEN PG_GC_Sweep_Slice;  // segments per slice (0 = atomic sweep)
+TVAR bool GC_Sweep_Pending;  // sweep slices outstanding, allocate black
+TVAR Segment* GC_Sweep_Segment;  // next STUB_POOL segment to sweep
+TVAR Count GC_Sweep_Survivors;  // survivor accumulator across slices
+PVAR REBSER *GC_Sweep_Newborns;  // nodes allocated black during the window
+#if !defined(NDEBUG)
+    TVAR bool GC_Mark_Balance_Unreliable;  // skip mark_count balance check
+#endif
+
+//=//// DEFERRED STUB DECAY ///////////////////////////////////////////////=//
+//
+// When PG_GC_Decay_Batch is nonzero, the sweep does not free a dead stub
+// inline: Try_Defer_Stub_Decay() threads it onto a pending chain, and the
+// actual reclamation--giving dynamic data back to the pools, running
+// HANDLE! cleaners, threading the stub into the free list--runs in bounded
+// batches from the signal checkpoint, off the collection pause.  See
+// Maintain_Pending_Decay() in %m-pools.c.
+//
+PVAR REBLEN PG_GC_Decay_Batch;  // stubs decayed per checkpoint (0 = inline)
+TVAR REBSER *GC_Decay_Pending;  // chain of dead stubs awaiting decay
+
 PVAR REBSER *GC_Mark_Stack; // Series pending to mark their reachables as live
+PVAR REBSER *GC_Cold_Queue; // cold function bodies due for deflation, %m-gc.c
 TVAR REBSER **Prior_Expand; // Track prior series expansions (acceleration)
 
 #if !defined(NDEBUG)  // Used by the FUZZ native to inject memory failures
@@ -210,6 +309,27 @@ TVAR REBSER *TG_Mold_Stack; // Used to prevent infinite loop in cyclical molds
 TVAR Binary(*) TG_Byte_Buf; // temporary byte buffer used mainly by raw print
 TVAR Raw_String* TG_Mold_Buf; // temporary UTF8 buffer - used mainly by mold
 
+// While TG_Profile_Sampling is true, the signal checkpoint in
+// Do_Signals_Throws() snapshots the frame stack into collapsed-stack lines.
+// The series are allocated at boot, not on demand, so they sit below the
+// manuals watermark of every frame (abrupt failure rollback won't free them).
+// See Sample_Profile_Stack() and the PROFILE native in %d-stats.c.
+//
+TVAR bool TG_Profile_Sampling;  // PROFILE ON ran, PROFILE OFF hasn't yet
+TVAR Raw_String* TG_Profile_Buffer;  // collapsed lines, e.g. "a;b;c 37"
+TVAR Raw_String* TG_Profile_Pending;  // current run of identical samples
+TVAR Raw_String* TG_Profile_Scratch;  // stack being built by this sample
+TVAR REBLEN TG_Profile_Pending_Count;  // how many times pending was sampled
+
+// While TG_Parse_Profiling is true, Subparse_Throws() and the alternate-rule
+// backtracking in %u-parse.c tally per-rule-block counters through
+// Tally_Parse_Rule().  See the PARSE-PROFILE native in %d-stats.c.
+//
+TVAR bool TG_Parse_Profiling;  // PARSE-PROFILE ON ran, OFF hasn't yet
+TVAR REB_PARSE_TALLY *TG_Parse_Tallies;  // malloc'd table, grown by doubling
+TVAR REBLEN TG_Parse_Tallies_Used;
+TVAR REBLEN TG_Parse_Tallies_Capacity;
+
 TVAR REBSER *GC_Manuals;    // Manually memory managed (not by GC)
 
 #if !defined(OS_STACK_GROWS_UP) && !defined(OS_STACK_GROWS_DOWN)
@@ -240,6 +360,20 @@ TVAR Frame(*) TG_Top_Frame;
 TVAR Frame(*) TG_Bottom_Frame;
 TVAR Feed(*) TG_End_Feed;
 
+// Private LIFO cache of frame shells, threaded through the PoolUnit next
+// pointer.  Function calls in tight loops push and drop a Frame(*) each
+// time; popping a shell off this list skips the Mem_Pools bookkeeping that
+// Alloc_Pooled()/Free_Pooled() do.  See Alloc_Frame_Shell().
+//
+TVAR PoolUnit* TG_Frame_Shell_Cache;
+TVAR Count TG_Frame_Shell_Cache_Used;
+
+// Companion LIFO cache for API handle stubs, which C clients of libRebol
+// allocate and release at comparable rates to frames.  See Alloc_Value().
+//
+TVAR PoolUnit* TG_Api_Stub_Cache;
+TVAR Count TG_Api_Stub_Cache_Used;
+
 
 //-- Evaluation stack:
 TVAR Array(*) DS_Array;
@@ -255,22 +389,86 @@ TVAR struct Reb_Jump *TG_Jump_List;  // Saved state for TRAP
 
 // !!! In R3-Alpha, micro-optimizations were stylized so that it would set
 // a counter for how many cycles would pass before it automatically triggered
-// garbage collection.  It would decrement that counter looking for zero, and
-// when zero was reached it would add the number of cycles it had been
-// counting down from to the total.  This avoided needing to do math on
-// multiple counters on every eval step...limiting it to a periodic
-// reconciliation when GCs occurred.  Ren-C keeps this, but the debug build
-// double checks that whatever magic is done reflects the real count.
+// garbage collection.  It would decrement that counter looking for zero on
+// every evaluator step...putting arithmetic in the hottest loop there is.
+// Ren-C reduces the per-step cost to a single flag test: SET_SIGNAL()
+// raises the flag at the moment a signal comes in, and a coarse wall-clock
+// timer raises it periodically so duties like incremental sweep slices and
+// profiler samples get their callouts even with no signal raised.  (See
+// the timer in %c-signal.c.)
 //
-#if !defined(NDEBUG)
-    TVAR REBI64 Total_Eval_Cycles_Doublecheck;
-#endif
-TVAR REBI64 Total_Eval_Cycles;      // Total evaluation counter (upward)
+// The flag is volatile because Ctrl-C handlers and the timer callback run
+// outside the evaluator's normal flow of control.  The countdown's other
+// role--knowing how many steps have run--is covered by Total_Eval_Cycles,
+// a plain thread-local increment per step that all builds now pay for: it
+// backs METRICS and the deterministic budgets of WITH-EVAL-BUDGET/TICKS.
+//
+TVAR volatile int_fast32_t Eval_Signal_Pending;  // tested on each eval step
+TVAR int_fast32_t Eval_Signal_Period;  // msec between timer arms of flag
+
+// The timer counts its arms, which gives a coarse monotonic clock with a
+// granularity of Eval_Signal_Period.  WITH-EVAL-BUDGET uses it to arm a
+// deadline for the running code: the checkpoint in Do_Signals_Throws()
+// raises a trappable error once the tick count passes the deadline.  (Only
+// the timer callback writes the tick count, so no atomics are needed; the
+// evaluator just reads a possibly slightly-stale value.)
+//
+TVAR volatile int_fast32_t Eval_Timer_Ticks;  // count of timer arms
+TVAR int_fast32_t Eval_Slice_Deadline;  // tick deadline (0 = no budget armed)
+
+// Deterministic cousins of the time deadline, also examined only at the
+// checkpoint (so overshoot is bounded by the signal period, not zero):
+// absolute values of the monotonic eval-step and allocated-byte counters
+// at which the running code gets failed.  See WITH-EVAL-BUDGET/TICKS and
+// WITH-EVAL-BUDGET/MEMORY, which arm, nest, and restore these.
+//
+TVAR REBI64 Eval_Cycles_Deadline;  // Total_Eval_Cycles cap (0 = none armed)
+TVAR REBI64 Alloc_Bytes_Deadline;  // Total_Alloc_Bytes cap (0 = none armed)
+
+// A blocking event loop (like WAIT's) can register a wakeup so SET_SIGNAL()
+// ends its block instead of the signal waiting on an unrelated event.  The
+// function must be async-signal-safe and thread-safe; it is called with no
+// locks held.  See the network extension for the uv_async_t registration.
+//
+PVAR void (*PG_Signal_Wakeup_Hook)(void);  // nullptr if nothing blocking
+
+TVAR REBI64 Total_Eval_Cycles;  // monotonic eval step count (all builds)
+TVAR REBI64 Total_Alloc_Bytes;  // monotonic allocation total (never debited)
+
+// Hash_Value() folds this per-process key into the hashes of MAP! keys whose
+// bit patterns external input can choose (numbers, strings, binaries), so
+// colliding keys can't be computed offline to degrade a service's maps to
+// linear scans.  Drawn once in Startup_CRC() and never changed afterward,
+// since hashlists cache Hash_Value() results.  (Symbol interning hashes stay
+// seedless--%make-boot.r bakes those in at build time.)
+//
+PVAR uint32_t PG_Hash_Seed;
+
+// Find_Key_Hashed() counts the occupied slots it steps over, which is the
+// work that adversarial collisions inflate.  The total is monotonic like
+// the other METRICS counters; LONGEST is the worst single probe run seen,
+// and ALARMS counts lookups whose run passed the alarm length in %t-map.c.
+// A healthy map probes in the single digits, so a nonzero alarm count means
+// some map has degenerated and its keys deserve a look.
+//
+TVAR REBI64 Total_Map_Probes;
+TVAR REBLEN Map_Probe_Longest;
+TVAR REBI64 Map_Probe_Alarms;
 TVAR REBI64 Eval_Limit;             // Evaluation limit (set by secure)
-TVAR int_fast32_t Eval_Countdown;  // Evaluation counter until Do_Signals()
-TVAR int_fast32_t Eval_Dose;        // Evaluation counter reset value
 TVAR Flags Eval_Sigmask;          // Masking out signal flags
 
+// When true, Begin_Action_Core() bumps a per-action invocation count, so
+// hot functions can be found and hand-compiled to C (e.g. via the TCC
+// extension's user natives).  See PROFILE-ACTIONS in %n-system.c.
+//
+TVAR bool PG_Counting_Actions;
+
+// When true, CASE and SWITCH count which branch of their cases block gets
+// run, so hot clauses can be put first on evidence instead of guesswork.
+// See PROFILE-BRANCHES in %n-system.c and REORDER-BY-PROFILE.
+//
+TVAR bool PG_Counting_Branches;
+
 TVAR Flags Trace_Flags;    // Trace flag
 TVAR REBINT Trace_Level;    // Trace depth desired
 TVAR REBINT Trace_Depth;    // Tracks trace indentation
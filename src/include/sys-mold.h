@@ -36,8 +36,16 @@ struct rebol_mold {
     Byte period;      // for decimal point
     Byte dash;        // for date fields
     Byte digits;      // decimal digits
+    REBVAL *port;     // if not null, flush buffer to this PORT! in chunks
+    Size flush_size;  // byte count that triggers a flush in port mode
 };
 
+// Default chunk size for MOLD/INTO's streaming flushes.  Big enough that the
+// per-chunk WRITE overhead is noise, small enough that molding a huge block
+// to disk never holds more than this much output in memory at once.
+//
+#define MOLD_FLUSH_SIZE_DEFAULT 0x8000
+
 #define Drop_Mold_If_Pushed(mo) \
     Drop_Mold_Core((mo), true)
 
@@ -95,6 +103,7 @@ enum REB_Mold_Opts {
     mold_struct.series = nullptr; /* used to tell if pushed or not */ \
     mold_struct.opts = 0; \
     mold_struct.indent = 0; \
+    mold_struct.port = nullptr; /* plain mold, no streaming flushes */ \
     REB_MOLD *name = &mold_struct; \
 
 #define SET_MOLD_FLAG(mo,f) \
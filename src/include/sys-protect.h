@@ -40,7 +40,8 @@ enum {
     PROT_DEEP = 1 << 1,
     PROT_HIDE = 1 << 2,
     PROT_WORD = 1 << 3,
-    PROT_FREEZE = 1 << 4
+    PROT_FREEZE = 1 << 4,
+    PROT_EPOCH = 1 << 5  // mark/unmark epoch membership, not PROTECTED
 };
 
 inline static bool Is_Array_Frozen_Shallow(Array(const*) a)
@@ -57,6 +57,14 @@
 #define API_FLAG_RELEASE \
     SERIES_FLAG_24
 
+// rebSpellPinned() hands out pointers directly into string series data, with
+// the API handle acting as a "pin".  This flag records that the pin was what
+// put SERIES_INFO_HOLD on the series (as opposed to finding a hold already
+// in place), so rebUnpin() only lifts holds that it took.
+//
+#define API_FLAG_TOOK_HOLD \
+    SERIES_FLAG_25
+
 
 // What distinguishes an API value is that it has both the NODE_FLAG_CELL and
 // NODE_FLAG_ROOT bits set.
@@ -118,6 +126,18 @@ inline static void Unlink_Api_Handle_From_Frame(Array(*) a)
 }
 
 
+// C clients of libRebol can allocate and release API handles at rates that
+// rival function call frequency (every rebValue() result is one).  So the
+// stubs they live in get the same treatment as frame shells: a bounded LIFO
+// cache threaded through the PoolUnit next pointer, which skips the
+// Mem_Pools accounting and the GC ballast churn of Alloc_Stub() and
+// GC_Kill_Series() in steady state.  Cached stubs carry FREED_SERIES_BYTE,
+// so anything enumerating pool nodes (including GC sweeps) sees them as
+// free.  See FRAME_SHELL_CACHE_MAX for the rationale on capping.
+//
+#define API_STUB_CACHE_MAX 256
+
+
 // We are introducing the containing node for this cell to the GC and can't
 // leave it trash.  If a pattern like `Do_Evaluation_Into(Alloc_Value(), ...)`
 // is used, then there might be a recycle during the evaluation that sees it.
@@ -126,7 +146,18 @@ inline static void Unlink_Api_Handle_From_Frame(Array(*) a)
 //
 inline static REBVAL *Alloc_Value(void)
 {
-    Array(*) a = Make_Array_Core(
+    void *preallocated;
+    PoolUnit* unit = TG_Api_Stub_Cache;
+    if (unit != nullptr) {
+        TG_Api_Stub_Cache = unit->next_if_free;
+        --TG_Api_Stub_Cache_Used;
+        preallocated = unit;
+    }
+    else
+        preallocated = Alloc_Stub();
+
+    Array(*) a = Make_Array_Core_Into(  // Prep_Stub() handles sweep-pending
+        preallocated,
         1,
         FLAG_FLAVOR(API)
             |  NODE_FLAG_ROOT | NODE_FLAG_MANAGED | SERIES_FLAG_FIXED_SIZE
@@ -160,7 +191,17 @@ inline static void Free_Value(REBVAL *v)
         Unlink_Api_Handle_From_Frame(a);
 
     Poison_Cell(ARR_SINGLE(a));  // has to be last (removes NODE_FLAG_ROOT)
-    GC_Kill_Series(a);
+
+    if (TG_Api_Stub_Cache_Used >= API_STUB_CACHE_MAX) {
+        GC_Kill_Series(a);
+        return;
+    }
+
+    PoolUnit* unit = cast(PoolUnit*, cast(void*, a));
+    mutable_FIRST_BYTE(unit->headspot) = FREED_SERIES_BYTE;
+    unit->next_if_free = TG_Api_Stub_Cache;
+    TG_Api_Stub_Cache = unit;
+    ++TG_Api_Stub_Cache_Used;
 }
 
 
@@ -223,9 +223,12 @@ inline static StackValue(*) Data_Stack_At(StackIndex i) {
 // left uninitialized).  But you must make sure that a GC can't run before
 // you have put a valid value into the slot you pushed.
 //
-// If the stack runs out of capacity then it will be expanded by the basis
-// defined below.  The number is arbitrary and should be tuned.  Note the
-// number of bytes will be sizeof(REBVAL) * STACK_EXPAND_BASIS
+// If the stack runs out of capacity it is expanded geometrically--by half
+// its current occupancy, but never less than the basis below.  Growing by a
+// proportion (vs. a fixed step) bounds the number of reallocations on deep
+// REDUCE/COMPOSE to O(log n), so the cell-moving fixup cost is amortized
+// constant per push.  (The stack must stay contiguous: StackIndex math and
+// Pop_Stack_Values() depend on it, so growth can't chain segments.)
 //
 
 #define STACK_EXPAND_BASIS 128
@@ -238,7 +241,9 @@ inline static StackValue(*) PUSH(void) {
     ++DS_Index;
     ++DS_Movable_Top;
     if (DS_Movable_Top == DS_Movable_Tail)
-        Expand_Data_Stack_May_Fail(STACK_EXPAND_BASIS);
+        Expand_Data_Stack_May_Fail(
+            MAX(STACK_EXPAND_BASIS, DS_Index / 2)  // geometric, see above
+        );
 
   #if DEBUG_POISON_DROPPED_STACK_CELLS
     assert(Is_Cell_Poisoned(DS_Movable_Top));
@@ -48,8 +48,10 @@
 #define LINK_Synonym_CAST       SYM
 #define HAS_LINK_Synonym        FLAVOR_SYMBOL
 
-// Hitches are a circularly linked list that includes transient binding info
-// for the word, as well as declared variables in "sea" contexts.
+// Hitches are a circularly linked list of the declared variables for the
+// word in "sea" contexts (modules).  Transient binding info used to live in
+// this list too, but binders now keep that in their own side tables--see
+// struct Reb_Binder in %sys-bind.h.
 //
 #define MISC_Hitch_TYPE         REBSER*
 #define MISC_Hitch_CAST         SER
@@ -114,4 +116,4 @@ inline static bool Are_Synonyms(Symbol(const*) s1, Symbol(const*) s2) {
 }
 
 #define Intern_UTF8_Managed(utf8,size) \
-    Intern_UTF8_Managed_Core(nullptr, (utf8), (size))
+    Intern_UTF8_Managed_Core(nullptr, (utf8), (size), nullptr)
@@ -963,8 +963,8 @@ raise: func [
     if bad-word? reason [
         reason: noisotope reason
     ]
-    all [error? reason, not blame, not where] then [
-        return raise* reason  ; fast shortcut
+    all [match [error! word!] reason, not blame, not where] then [
+        return raise* reason  ; fast shortcut (word is id-only failure)
     ]
     if blame [
         blame: (match [word! tuple!] unquote blame) else [
@@ -202,13 +202,37 @@ join: function [
 charset: function [
     {Makes a bitset of chars for the parse function.}
 
-    return: [bitset!]
+    return: "Frozen, and shared between equal specs (COPY it to mutate)"
+        [bitset!]
     chars [text! block! binary! char! integer!]
-    /length "Preallocate this many bits (must be > 0)"
+    /length "Preallocate this many bits (must be > 0), result not shared"
         [integer!]
+    <static> cache (make map! [])
 ][
-    init: either length [length] [[]]
-    return append make bitset! init chars
+    ; Parser-heavy code builds the same charsets from the same literal specs
+    ; over and over--at every module load, or (like TRIM) on every call.
+    ; Interpreting a spec costs far more than looking its result up, so equal
+    ; specs share one frozen bitset out of a cache.  Freezing is what makes
+    ; the sharing safe; code that wants to tailor a charset afterward should
+    ; COPY it, the same answer as for any other locked series.
+
+    if length [  ; preallocating implies the caller means to extend the result
+        return append make bitset! length chars
+    ]
+
+    if bits: select/case cache chars [
+        return bits
+    ]
+
+    bits: freeze append make bitset! [] chars
+
+    ; The caller can mutate a series spec after this returns, so the cache
+    ; key must be a deep snapshot.  (MAP! hashes a key when it is stored, so
+    ; no later mutation of the original can corrupt the lookup table.)
+    ;
+    if 512 <= length of cache [clear cache]  ; crude bound on pathological use
+    put/case cache (either any-series? chars [copy/deep chars] [chars]) bits
+    return bits
 ]
 
 
@@ -32,3 +32,57 @@ wrap: lambda [
 ][
     do bind/copy/set body make object! 0
 ]
+
+run-tasks: function [
+    {Run argumentless tasks (e.g. GENERATOR instances) round-robin until done}
+
+    return: "Last value produced by each task (the ERROR! if one failed)"
+        [block!]
+    tasks "Actions--or words referring to them--called until each gives NULL"
+        [block!]
+    /budget "Milliseconds of evaluation per task per turn (default 20, 0 = off)"
+        [integer!]
+][
+    budget: default [20]
+
+    ; Each turn resumes every live task once under WITH-EVAL-BUDGET, so one
+    ; expensive handler can only overshoot its slice by the checkpoint
+    ; granularity before being failed out--the other tasks stay responsive.
+    ; A task leaves the rotation when it returns NULL (a finished generator)
+    ; or when it fails...including failing by exceeding its budget.
+
+    results: copy []
+    running: copy []  ; alternating [index action ...] entries
+    for-each item tasks [
+        task: either match [any-word! any-path!] item [get item] [item]
+        if activation? :task [task: unrun :task]
+        if not action? :task [
+            fail ["RUN-TASKS expects tasks to be actions, got:" mold item]
+        ]
+        append results '~started~
+        append running length of results
+        append running :task
+    ]
+
+    while [not empty? running] [
+        still-running: copy []
+        for-each [index task] running [
+            value: null
+            error: sys.util.rescue [
+                value: either budget = 0 [do :task] [
+                    with-eval-budget budget [do :task]
+                ]
+            ]
+            if error [
+                poke results index error  ; dropped, incl. budget overruns
+                continue
+            ]
+            if null? :value [continue]  ; done, its last stored value stands
+            poke results index reify :value
+            append still-running index
+            append still-running :task
+        ]
+        running: still-running
+    ]
+    return results
+]
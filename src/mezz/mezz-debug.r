@@ -184,6 +184,66 @@ speed?: function [
     return result
 ]
 
+reorder-by-profile: function [
+    {Reorder CASE/SWITCH-style clauses to put profiled hot branches first}
+
+    return: "New block (the input is not modified)"
+        [block!]
+    cases "Clauses as given to CASE or SWITCH, with literal branches"
+        [block!]
+    profile "Branch positions and hit counts, from PROFILE-BRANCHES"
+        [block!]
+][
+    ; CASE stops at the first truthy condition, so moving a clause forward
+    ; changes behavior whenever conditions overlap or have side effects.
+    ; This is a tuning tool for the disjoint, pure-condition blocks where
+    ; order is a free choice--the caller vouches for that, the same way they
+    ; would when reordering by hand.
+
+    ; Pull out the hits belonging to this block, keyed by branch position.
+    ;
+    hits: make map! []
+    for-each [branch count] profile [
+        if same? (head of branch) (head of cases) [
+            hits.(index of branch): count
+        ]
+    ]
+
+    ; A clause runs from just after the previous branch through the next
+    ; literal branch.  Conditions are arbitrary expressions, so the boundary
+    ; can only be read off the source shape--which is exactly how SWITCH
+    ; skips unmatched material.  Computed branches defeat the splitting.
+    ;
+    clauses: copy []
+    start: pos: cases
+    ordinal: 0
+    while [not tail? pos] [
+        either any [block? pos.1, meta-block? pos.1, get-group? pos.1] [
+            append clauses reduce [
+                any [select hits (index of pos), 0]
+                ordinal: me + 1
+                copy/part start next pos
+            ]
+            start: pos: next pos
+        ][
+            pos: next pos
+        ]
+    ]
+
+    ; Descending by count; original order breaks ties so unprofiled clauses
+    ; keep their relative positions.
+    ;
+    sort/compare clauses func [a b] [
+        (a.1 > b.1) or ((a.1 = b.1) and (a.2 < b.2))
+    ]
+
+    result: copy []
+    for-each clause clauses [append result spread clause.3]
+    append result spread start  ; trailing fallout (if any) stays last
+    return result
+]
+
+
 net-log: lambda [txt /C /S][txt]
 
 net-trace: function [
@@ -459,3 +459,203 @@ set-net: function [
     if 6 <> length of bl [fail "Needs all 6 parameters for set-net"]
     set (words of system/user/identity) bl
 ]
+
+
+transcode-stream: func [
+    {Incrementally transcode values from a file or port, one at a time}
+
+    return: "Total count of values given to the body"
+        [integer!]
+    'var "Word to set to each transcoded value"
+        [word!]
+    source "File to read in chunks, or an already-open PORT! to pull from"
+        [file! port!]
+    body "Block to evaluate after each value is transcoded"
+        [block!]
+    /part "Bytes to read per chunk (default 32768)"
+        [integer!]
+][
+    ; Unlike LOAD, this does not need the whole source in memory at once...
+    ; only enough bytes to hold the value currently being scanned.  That
+    ; matters for data files too large to triple-buffer as bytes, scanner
+    ; overhead, and result arrays all at the same time.
+    ;
+    ; TRANSCODE raises a SCAN-MISSING error when input stops in the middle
+    ; of a value (that error exists precisely to signal "more text could
+    ; reconcile this").  On seeing it mid-stream we read another chunk and
+    ; retry; at end of input it's a genuine syntax problem and is re-raised.
+
+    let chunk: any [part, 32768]
+    let opened: file? source
+    let port: either port? source [source] [open source]
+    let buffer: make binary! chunk
+    let eof: false
+    let count: 0
+
+    let holder: make object! compose [(to set-word! var) ~]
+    body: bind copy/deep body holder
+
+    let value: ~
+    let rest: ~
+
+    cycle [
+        [value rest]: transcode/one buffer except e -> [
+            if all [not eof, e.id = 'scan-missing] [
+                let data: try read/part port chunk
+                either any [null? data, empty? data] [
+                    eof: true  ; no more bytes can come, error is real
+                ][
+                    append buffer data
+                    continue
+                ]
+            ]
+            fail e
+        ]
+
+        if null? value [  ; buffer held only whitespace/comments (or nothing)
+            let data: try read/part port chunk
+            either any [null? data, empty? data] [stop] [
+                clear head of buffer
+                buffer: head of buffer
+                append buffer data
+            ]
+            continue
+        ]
+
+        set (in holder var) :value
+        do body
+        count: me + 1
+
+        ; Advancing the index is cheap, but would keep every consumed byte
+        ; live...so slide the unconsumed tail back to the head once more
+        ; than a chunk's worth has built up.
+        ;
+        buffer: rest
+        if chunk < index of buffer [
+            remove/part (head of buffer) ((index of buffer) - 1)
+            buffer: head of buffer
+        ]
+    ]
+
+    if opened [close port]
+    return count
+]
+
+
+reload: func [
+    {Re-transcode an edited source incrementally, reusing unaffected values}
+
+    return: "The updated values block (same series that was passed in)"
+        [block!]
+    values "Top-level values from a prior TRANSCODE/INDEX of the source"
+        [block!]
+    index "Offset index from that TRANSCODE/INDEX (updated in place)"
+        [block!]
+    source "The source *after* the edit was applied"
+        [text! binary!]
+    span "The edit as [start old-size new-size] (byte offset and sizes)"
+        [block!]
+][
+    ; The index holds [start end ...] pairs of 1-based byte offsets, one
+    ; pair per top-level value.  Only values whose bytes intersect the edit
+    ; need rescanning: the span is mapped onto the index, the covering byte
+    ; range is re-transcoded, and the fresh values (with rebased offsets)
+    ; are spliced over the stale ones.  Values after the edit just have
+    ; their offsets shifted by the size delta--so the work is proportional
+    ; to the edit, not to the file.
+    ;
+    ; If the patch region doesn't transcode cleanly (an edit can unbalance
+    ; brackets, so the top-level shape changed) everything is rescanned.
+    ; Correctness never depends on the incremental path applying.
+
+    let start: span.1
+    let old-size: span.2
+    let new-size: span.3
+    let delta: new-size - old-size
+    let old-end: start + old-size  ; exclusive
+
+    let bin: as binary! source  ; offsets are bytes, not codepoints
+
+    let count: (length of index) / 2
+    let patched: false
+
+    if count > 0 [
+        ; First affected value: the last one starting at or before the edit
+        ; (an edit falling in the gap between two values conservatively
+        ; includes the value before the gap).  Last affected: the first one
+        ; ending at or after the edit.
+        ;
+        let first-n: 1
+        let last-n: count
+        let n: 1
+        while [n <= count] [
+            if start >= pick index (n * 2 - 1) [first-n: n]
+            n: n + 1
+        ]
+        n: count
+        while [n >= 1] [
+            if old-end <= pick index (n * 2) [last-n: n]
+            n: n - 1
+        ]
+
+        ; Patch region in post-edit coordinates: from the start of the
+        ; first affected value (or the edit itself, if it begins in leading
+        ; gap bytes) to the shifted end of the last affected one--or the
+        ; tail, if the edit ran past the last value.
+        ;
+        let patch-start: min start pick index (first-n * 2 - 1)
+        let patch-end: either old-end <= pick index (last-n * 2) [
+            delta + pick index (last-n * 2)
+        ][
+            1 + length of bin
+        ]
+
+        ; Splicing is only trusted when at least one untouched gap byte
+        ; separates the patch from the value after it.  Zero-gap neighbors
+        ; (as in "[a]x") could otherwise glue onto an edited last value.
+        ;
+        let safe: did any [
+            last-n = count
+            patch-end < delta + pick index (last-n * 2 + 1)
+        ]
+
+        let sub-index: ~
+        let new-values: if safe [
+            let chunk: copy/part (skip bin patch-start - 1)
+                (patch-end - patch-start)
+            transcode/index chunk 'sub-index except e -> [
+                null  ; shape changed, take the full-rescan path
+            ]
+        ]
+
+        if new-values [
+            let base: patch-start - 1
+            n: 1
+            while [n <= length of sub-index] [
+                poke sub-index n base + pick sub-index n
+                n: n + 1
+            ]
+            n: last-n * 2 + 1
+            while [n <= length of index] [
+                poke index n delta + pick index n
+                n: n + 1
+            ]
+            change/part (at values first-n)
+                (spread new-values) (last-n - first-n + 1)
+            change/part (at index first-n * 2 - 1)
+                (spread sub-index) ((last-n - first-n + 1) * 2)
+            patched: true
+        ]
+    ]
+
+    if not patched [  ; nothing reusable, or the edit changed the shape
+        let all-index: ~
+        let all-values: transcode/index bin 'all-index
+        clear values
+        append values spread all-values
+        clear index
+        append index spread all-index
+    ]
+
+    return values
+]
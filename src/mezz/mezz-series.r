@@ -386,41 +386,10 @@ alter: func [
 ]
 
 
-collect*: func [
-    {Evaluate body, and return block of values collected via keep function}
-
-    return: "Result block, or null if no KEEPs (prevent nulls with KEEP [])"
-        [<opt> block!]
-    body "Block to evaluate"
-        [<maybe> block!]
-][
-    let out: null
-    let keeper: specialize* (  ; SPECIALIZE to hide series argument
-        enclose* :append lambda [  ; Derive from APPEND for /LINE /DUP
-            f [frame!]
-            <with> out
-        ][
-            decay either voided? 'f.value [  ; DECAY, we want pure null
-                null  ; void in, null out (should it pass through the void?)
-            ][
-                f.series: out: default [make block! 16]  ; no null return now
-                get/any 'f.value  ; ELIDE leaves as result
-                elide do f  ; would invalidate f.value (hence ELIDE)
-            ]
-        ]
-    )[
-        series: <replaced>
-    ]
-
-    ; use LAMBDA for binding work of connecting KEEP with the keeper function
-    ; (Doesn't have or enforce RETURN)
-    ;
-    run lambda [keep [activation!]] body :keeper
-
-    return out  ; might be null if no KEEPs that kept anything yet
-]
-
-
+; COLLECT* is a native now, so that KEEP costs roughly an APPEND instead of
+; an interpreted frame plus an APPEND frame per kept value.  (It used to be
+; a FUNC whose keeper was a SPECIALIZE* of an ENCLOSE* of APPEND.)
+;
 ; Classic version of COLLECT which returns an empty block if nothing is
 ; collected, as opposed to the NULL that COLLECT* returns.
 ;
@@ -432,6 +401,27 @@ collect: redescribe [
     specialize :else [branch: [copy []]]
 ]
 
+; Lazy counterparts to KEYS OF and VALUES OF for big maps: FOR-EACH walks a
+; map's storage directly, so yielding from inside one materializes no
+; intermediate block (KEYS OF a 10M-entry map copies all the keys before a
+; caller sees the first one).  The generators plug into anything that knows
+; how to iterate an action, e.g. `for-each k each-key-of m [...]`.
+;
+each-key-of: lambda [
+    {Make a generator yielding the keys of a map one at a time}
+    map [map!]
+][
+    generator [for-each key map [yield key]]
+]
+
+each-value-of: lambda [
+    {Make a generator yielding the values of a map one at a time}
+    map [map!]
+][
+    generator [for-each [_ value] map [yield value]]
+]
+
+
 format: function [
     "Format a string according to the format dialect."
     rules {A block in the format dialect. E.g. [10 -10 #"-" 4]}
@@ -633,3 +623,37 @@ find-all: function [
         series: next series
     ]
 ]
+
+
+parallel-map-each: function [
+    {Collect results of a pure transform applied to each item of a block}
+
+    return: "Results stitched in input order (null/void results leave no slot)"
+        [block!]
+    transform "Applied to each item; must not care about evaluation order"
+        [<unrun> action!]
+    data "Input block (frozen deeply, so chunks can share it without copies)"
+        [block!]
+    /chunk "Items per dispatched chunk (default: split into eight chunks)"
+        [integer!]
+][
+    freeze/deep data
+    chunk: default [max 1 to integer! (length of data) / 8]
+    if chunk < 1 [fail 'chunk ["CHUNK must be at least 1, not" chunk]]
+
+    result: make block! length of data
+
+    ; Today the chunks all run on this one evaluator, in order.  But the
+    ; contract is the data-parallel one: the input is immutable, TRANSFORM
+    ; has no way to see where its item came from, and every chunk collects
+    ; into its own block before the ordered stitch here--so a worker pool
+    ; could claim the chunks without any change to callers.
+    ;
+    pos: data
+    while [not tail? pos] [
+        job: copy/part pos chunk
+        append result spread map-each item job [run transform :item]
+        pos: skip pos chunk
+    ]
+    return result
+]
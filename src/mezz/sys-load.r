@@ -229,6 +229,9 @@ load: func [
         [<maybe> file! url! tag! the-word! text! binary!]
     /type "E.g. rebol, text, markup, jpeg... (by default, auto-detected)"
         [word!]
+    /dedup "Share one immutable instance among duplicate strings in the data"
+    /pool "Share one frozen instance among duplicate small literal arrays"
+    /formatted "Preserve source whitespace so MOLD round-trips the layout"
 
     <local> file line data
 ][
@@ -287,7 +290,11 @@ load: func [
 
     if not block? data [
         assert [match [binary! text!] data]  ; UTF-8
-        data: transcode/file/line data file 'line except e -> [return raise e]
+        data: either formatted [
+            transcode/file/line/formatted data file 'line
+        ][
+            transcode/file/line data file 'line
+        ] except e -> [return raise e]
     ]
 
     ; Bind code to user context
@@ -300,6 +307,9 @@ load: func [
         data: intern* system.contexts.user data
     ]
 
+    if dedup [deduplicate-strings data]
+    if pool [pool-literals data]
+
     return data
 ]
 
@@ -389,6 +399,96 @@ adjust-url-for-raw: func [
 ]
 
 
+; R3-Alpha's module system had a notion of "delayed" modules, which sat in
+; the module list as just a header and un-run source.  IMPORT*/LAZY revives
+; that in a scoped-down form: the source is located and its header scanned
+; (so the name and Exports list are known), but execution of the body is
+; deferred until one of the exports is actually used.  Tools that import many
+; modules but only touch a few per invocation start up much faster this way.
+;
+; The mechanism is usermode: each export is seeded with a stand-in function
+; that runs the body on its first call, overwrites the importers' variables
+; with the real definitions, and then delegates.  Because the stand-in can't
+; know the real function's conventions before the body runs, that first call
+; can only forward ordinary evaluative arguments (no refinements, quoted or
+; ^META parameters).  Modules with fancier exported interfaces--or bodies
+; whose side effects matter--should be imported without /LAZY.
+
+lazy-imports: []  ; [name info ...] for modules whose body has not yet run
+
+make-lazy-proxy: func [
+    {Make a stand-in for an export of a module imported with IMPORT*/LAZY}
+
+    return: [activation?]
+    stub [module!]
+    word [word!]
+][
+    return func [
+        return: [<opt> <void> any-value!]
+        args [<opt> <end> any-value! <variadic>]
+    ][
+        materialize-lazy-module stub
+
+        let value: get/any in stub word
+        if not activation? :value [
+            return :value  ; data export; first reference just produces it
+        ]
+
+        let f: make frame! unrun :value
+        for-each param parameters of unrun :value [
+            case [
+                word? param [
+                    if tail? args [break]  ; let the frame report missing args
+                    f.(param): take args
+                ]
+                refinement? param [break]  ; unusable via a plain word call
+                true [
+                    fail [
+                        "Lazy stand-in for" word "can't forward parameter"
+                        mold param "-- use IMPORT without /LAZY"
+                    ]
+                ]
+            ]
+        ]
+        return do f
+    ]
+]
+
+materialize-lazy-module: func [
+    {Run the deferred body of a lazily imported module, fix up importers}
+
+    return: [module!]
+    stub [module!]
+][
+    let name: (meta-of stub).name
+    let info: (select/skip lazy-imports name 2) else [
+        return stub  ; body already ran
+    ]
+    remove/part (find/skip lazy-imports name 2) 2  ; guard against reentry
+
+    ; Mirrors the execution tail of MODULE.  Note the body runs with whatever
+    ; SYSTEM.SCRIPT is current at materialization time, not import time.
+    ;
+    let body: info.code
+    either block? body [
+        intern* stub body
+    ][
+        body: transcode/where/line/file body stub info.line info.file
+    ]
+
+    let original-path: what-dir
+    if info.dir [change-dir info.dir]
+    catch/quit [do body]  ; as with plain IMPORT, QUIT just ends the body
+    if original-path [change-dir original-path]
+
+    let exports: select (meta-of stub) 'exports
+    for-each site info.sites [  ; replace stand-ins with the real definitions
+        proxy-exports site stub maybe exports
+    ]
+    return stub
+]
+
+
 ; While DO can run a script any number of times with fresh variables on each
 ; run, we don't want to IMPORT the same module more than once.  This is
 ; standard in languages like Python and JavaScript:
@@ -424,6 +524,7 @@ import*: func [
         [any-value!]
     /only "Do not catch quits...propagate them"
         [logic!]
+    /lazy "Don't run the module body until one of its exports is first used"
     /into "e.g. reuse Context(*) already made for NATIVEs loading from extension"
         [module!]
     <static>
@@ -547,6 +648,11 @@ import*: func [
 
     let name: select maybe hdr 'name
     (select/skip system.modules maybe name 2) then cached -> [
+        if where [  ; if a lazy stub, record site for fix-up when body runs
+            (select/skip lazy-imports maybe name 2) then info -> [
+                append info.sites where
+            ]
+        ]
         product': ~cached~
         return cached
     ]
@@ -555,6 +661,40 @@ import*: func [
 
     let is-module: hdr and ('module = select hdr 'type)
 
+    === DEFER BODY EXECUTION IF IMPORT*/LAZY ===
+
+    ; See notes on MAKE-LAZY-PROXY for how deferral works, and its limits.
+    ; A module with no exports is imported only for its side effects--nothing
+    ; would ever trigger the body running--so such modules (and headerless or
+    ; nameless sources) fall through to a plain immediate import.
+    ;
+    all [lazy, where, not into, is-module, name] then [
+        let exports: select hdr 'exports
+        if all [exports, not empty? exports] [
+            let stub: module hdr []  ; builds meta from header, body not run
+
+            for-each word exports [
+                if not word? word [continue]  ; PROXY-EXPORTS gives the error
+                append stub word
+                stub.(word): make-lazy-proxy stub word
+            ]
+
+            let info: make object! [code: file: line: dir: sites: ~]
+            info.code: code
+            info.file: file
+            info.line: line
+            info.dir: dir
+            info.sites: reduce [where]
+
+            append system.modules spread :[name stub]
+            append lazy-imports spread reduce [name info]
+
+            importing-remotely: old-importing-remotely
+            product': ~deferred~
+            return stub  ; adapted RETURN proxies the stand-ins into WHERE
+        ]
+    ]
+
     === MAKE SCRIPT CHARACTERIZATION OBJECT AND CALL PRE-SCRIPT HOOK ===
 
     ; The header object doesn't track instance information like the args to
@@ -2277,7 +2277,7 @@ default-combinators: make map! reduce [
         /limit "Limit of how far to consider (used by ... recursion)"
             [block!]
         /thru "Keep trying rule until end of block"
-        <local> rules pos result' f sublimit subpending temp
+        <local> rules pos result' f sublimit subpending temp hit key bucket entry
     ][
         rules: value  ; alias for clarity
         limit: default [tail of rules]
@@ -2348,6 +2348,8 @@ default-combinators: make map! reduce [
             ; Do one "Parse Step".  This involves turning whatever is at the
             ; next parse position into an ACTION!, then running it.
             ;
+            hit: key: null  ; memo state for this step, if /MEMOIZE in effect
+
             if rules.1 = '... [  ; "variadic" parser, use recursion
                 rules: next rules
                 if tail? rules [  ; if at end, act like [elide to <end>]
@@ -2364,26 +2366,83 @@ default-combinators: make map! reduce [
 
                 rules: sublimit else [tail of rules]
             ] else [
-                f: make frame! unrun [@ rules]: parsify state rules
+                ; When /MEMOIZE is in effect, each step's outcome is cached by
+                ; (rule position, input position).  The PAIR! of indices only
+                ; picks a hash bucket: entries are confirmed with SAME?, since
+                ; subparses and different rule blocks reuse the same numbers.
+                ;
+                if state.memos [
+                    key: make pair! reduce [index? rules, index? pos]
+                    if bucket: select state.memos key [
+                        for-each entry bucket [
+                            all [
+                                same? entry.1 rules
+                                same? entry.2 pos
+                            ] then [
+                                hit: entry, break
+                            ]
+                        ]
+                    ]
+                    if not hit [
+                        entry: reduce [rules pos]  ; rule + input at step start
+                    ]
+                ]
+                if not hit [
+                    f: make frame! unrun [@ rules]: parsify state rules
+                ]
             ]
 
-            f.input: pos
-
-            if not error? temp: entrap f [
-                [^temp pos subpending]: unmeta temp
-                if unset? 'pos [
-                    print mold/limit rules 200
-                    fail "Combinator did not set remainder"
+            either hit [
+                ; Replay the cached step: the rules position past the consumed
+                ; elements, the combinator's result (or mismatch error), and
+                ; on a match the new input position and pending material.  The
+                ; pending block is handed out as a copy, since its items get
+                ; extracted destructively by targets like COLLECT.
+                ;
+                rules: hit.3
+                temp: hit.4
+                if not error? temp [
+                    pos: hit.5
+                    subpending: either blank? hit.6 [null] [copy hit.6]
                 ]
-                if unset? 'subpending [
-                    print mold/limit rules 200
-                    fail "Combinator did not set pending"
+            ][
+                f.input: pos
+                temp: entrap f
+            ]
+
+            if not error? temp [
+                if not hit [
+                    [^temp pos subpending]: unmeta temp
+                    if unset? 'pos [
+                        print mold/limit rules 200
+                        fail "Combinator did not set remainder"
+                    ]
+                    if unset? 'subpending [
+                        print mold/limit rules 200
+                        fail "Combinator did not set pending"
+                    ]
+                    if key [  ; record for later visits to this position
+                        append entry spread reduce [
+                            rules temp pos
+                            either subpending [copy subpending] ['_]
+                        ]
+                        either bucket [append bucket entry] [
+                            state.memos.(key): reduce [entry]
+                        ]
+                    ]
                 ]
                 if temp <> nihil' [
                     result': temp  ; overwrite if was visible
                 ]
                 pending: glom pending maybe spread subpending
             ] else [
+                if all [key, not hit] [  ; record the mismatch too
+                    append entry spread reduce [rules temp '_ '_]
+                    either bucket [append bucket entry] [
+                        state.memos.(key): reduce [entry]
+                    ]
+                ]
+
                 result': nihil'  ; reset, e.g. `[false |]`
 
                 free maybe pending  ; proactively release memory
@@ -2824,7 +2883,9 @@ parse*: func [
 
     /verbose "Print some additional debug information"
 
-    <local> loops furthest synthesized' remainder
+    /memoize "Cache rule results by position (packrat); rules must be pure"
+
+    <local> loops furthest synthesized' remainder memos
 ][
     ; PATH!s, TUPLE!s, and URL!s are read only and don't have indices.  But we
     ; want to be able to parse them, so make them read-only series aliases:
@@ -2838,6 +2899,15 @@ parse*: func [
 
     loops: copy []  ; need new loop copy each invocation
 
+    ; /MEMOIZE caches the outcome of each "parse step" by its rule position
+    ; and input position, so backtrack-heavy grammars stop re-running the same
+    ; rule at the same place ("packrat parsing", see the BLOCK! combinator).
+    ; Cached outcomes are *replayed*, not re-executed...so only use this when
+    ; the rules are free of side effects (a GROUP! that mutates a variable or
+    ; counts on running once per visit will be skipped on cache hits).
+    ;
+    memos: if memoize [make map! 64]
+
     ; We put an implicit PHASE bracketing the whole of UPARSE* so that the
     ; <delay> groups will be executed.
     ;
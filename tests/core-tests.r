@@ -91,6 +91,7 @@
 %control/all.test.reb
 %control/any.test.reb
 %control/attempt.test.reb
+%control/cancellation.test.reb
 %control/case.test.reb
 %control/catch.test.reb
 %control/compose.test.reb
@@ -105,6 +106,7 @@
 %control/match.test.reb
 %control/reduce.test.reb
 %control/reeval.test.reb
+%control/run-tasks.test.reb
 %control/switch.test.reb
 %control/throw.test.reb
 %control/try.test.reb
@@ -115,8 +117,10 @@
 
 %convert/as-binary.test.reb
 %convert/as-string.test.reb
+%convert/enbase.test.reb
 %convert/enbin.test.reb
 %convert/encode.test.reb
+%convert/flatten.test.reb
 %convert/mold.test.reb
 %convert/to.test.reb
 
@@ -130,7 +134,9 @@
 %file/make-dir.test.reb
 %file/open.test.reb
 %file/split-path.test.reb
+%file/transcode-stream.test.reb
 %file/file-typeq.test.reb
+%file/watch.test.reb
 
 %functions/adapt.test.reb
 %functions/augment.test.reb
@@ -166,7 +172,9 @@
 %loops/for-next.test.reb
 %loops/iterate.test.reb
 %loops/iterate-skip.test.reb
+%loops/make-iterator.test.reb
 %loops/map.test.reb
+%loops/parallel-map-each.test.reb
 %loops/remove-each.test.reb
 %loops/repeat.test.reb
 %loops/until.test.reb
@@ -209,6 +217,7 @@
 %math/zeroq.test.reb
 
 %network/http.test.reb
+%network/websocket.test.reb
 
 %parse/parse3.test.reb
 %parse/parse3-collect.test.reb
@@ -239,10 +248,12 @@
 %parse/parse-logic.test.reb
 %parse/parse-maybe.test.reb
 %parse/parse-measure.test.reb
+%parse/parse-memoize.test.reb
 %parse/parse-meta-xxx.test.reb
 %parse/parse-not.test.reb
 %parse/parse-path.test.reb
 %parse/parse-phase.test.reb
+%parse/parse-profile.test.reb
 %parse/parse-quoted.test.reb
 %parse/parse-remove.test.reb
 %parse/parse-repeat.test.reb
@@ -282,12 +293,15 @@
 
 %reflectors/body-of.test.reb
 
+%scanner/formatted.test.reb
 %scanner/load.test.reb
 %scanner/path-tuple.test.reb
+%scanner/reload.test.reb
 %scanner/source-comment.test.reb
 
 %secure/const.test.reb
 %secure/protect.test.reb
+%secure/share.test.reb
 %secure/unprotect.test.reb
 
 %series/append.test.reb
@@ -321,11 +335,15 @@
 %series/remove.test.reb
 %series/reverse.test.reb
 %series/replace.test.reb
+%series/reserve.test.reb
 %series/reword.test.reb
 %series/select.test.reb
 %series/skip.test.reb
+%series/slice.test.reb
+%series/snapshot.test.reb
 %series/sort.test.reb
 %series/split.test.reb
+%series/swap.test.reb
 %series/tailq.test.reb
 %series/trim.test.reb
 %series/union.test.reb
@@ -342,6 +360,11 @@
 %system/system.test.reb
 %system/file.test.reb
 %system/gc.test.reb
+%system/profile.test.reb
+%system/memory-tally.test.reb
+%system/memory-limit.test.reb
+%system/metrics.test.reb
+%system/pool-stats.test.reb
 
 
 ; !!! These tests require the named extensions to be built in.  Whether the
@@ -349,13 +372,19 @@
 
 %../extensions/process/tests/call.test.reb
 %../extensions/dns/tests/dns.test.reb
+%../extensions/csv/tests/csv.test.reb
+%../extensions/json/tests/json.test.reb
 
 
 %misc/assert.test.reb
+%misc/channel.test.reb
 %misc/fail.test.reb
+%misc/keywords.test.reb
 %misc/make-file.test.reb
 %misc/shell.test.reb
 %misc/pack-old.test.reb
+%misc/profile-actions.test.reb
+%misc/profile-branches.test.reb
 %misc/help.test.reb  ; Do this last, as it has a lot of output
 
 
@@ -0,0 +1,137 @@
+Rebol [
+    Title: "Run-benchmarks"
+    File: %run-benchmarks.r
+    Copyright: [
+        2023 "Ren-C Open Source Contributors"
+    ]
+    License: {
+        Licensed under the Apache License, Version 2.0 (the "License");
+        you may not use this file except in compliance with the License.
+        You may obtain a copy of the License at
+
+        http://www.apache.org/licenses/LICENSE-2.0
+    }
+    Description: {
+        Tracked microbenchmarks for the interpreter hot paths: evaluation,
+        PARSE, MAP! operations, scanning, and garbage collection.  Unlike
+        the correctness tests, these produce timings...written as JSON so
+        they can be diffed across commits and releases by tooling.
+
+        Each benchmark is calibrated: its body is repeated with a doubling
+        count until the run takes long enough for the clock's granularity
+        not to dominate, and the per-iteration time is reported.
+    }
+]
+
+
+=== CALIBRATED TIMING FUNCTION ===
+
+; now/precise granularity can be coarse (10ms on some systems), so a single
+; run of a fast body measures mostly noise.  Double the repetitions until
+; the total elapsed time crosses a threshold that drowns the tick size out.
+
+minimum-elapsed: 0:00:00.25
+
+time-body: func [
+    return: "Seconds per iteration"
+        [decimal!]
+    body [block!]
+][
+    let count: 1
+    cycle [
+        let start: now/precise
+        repeat count body
+        let elapsed: difference now/precise start
+        if elapsed >= minimum-elapsed [
+            return (to decimal! elapsed) / count
+        ]
+        count: count * 2
+    ]
+]
+
+
+=== BENCHMARK DEFINITIONS ===
+
+; Each entry is a name (used as the JSON key) and a body.  Bodies should
+; exercise one subsystem dominantly; keep allocation out of evaluator
+; benchmarks and evaluation out of allocation benchmarks where possible.
+
+fib: func [return: [integer!] n [integer!]] [
+    either n < 2 [n] [(fib n - 1) + (fib n - 2)]
+]
+
+scan-source: to text! collect [
+    repeat 100 [keep {word set-word: [a block "string" 1020 3.04] ()^/}]
+]
+
+parse-input: append/dup make text! 6000 "abcabc" 1000
+
+benchmarks: [
+    eval-fib [fib 15]
+
+    eval-loop [
+        let total: 0
+        count-up i 1000 [total: total + i]
+    ]
+
+    parse-rules [
+        parse3 parse-input [some ["abc" | "cba"]]
+    ]
+
+    map-insert [
+        let m: make map! 16
+        count-up i 500 [m.(i): i]
+    ]
+
+    map-lookup [
+        count-up i 500 [lookup-map.(i)]
+    ]
+
+    scan-transcode [
+        transcode scan-source
+    ]
+
+    gc-churn [
+        repeat 100 [make block! 50]
+        recycle
+    ]
+]
+
+lookup-map: make map! 512  ; shared by map-lookup, built once outside timing
+count-up i 500 [lookup-map.(i): i]
+
+
+=== RUN AND COLLECT ===
+
+results: copy []
+
+for-each [name body] benchmarks [
+    let seconds: time-body compose [((body))]
+    append results spread reduce [name seconds]
+    print [name "=>" seconds "seconds/iteration"]
+]
+
+
+=== EMIT JSON ===
+
+; Written by hand rather than using a codec, since the bootstrap set of
+; loaded modules should stay small for this script.  The format is one flat
+; object: build metadata plus a number per benchmark.
+
+entries: collect [
+    keep unspaced [{"commit": "} any [system.commit "unknown"] {"}]
+    keep unspaced [{"version": "} system.version {"}]
+    keep unspaced [{"date": "} now/utc {"}]
+    for-each [name seconds] results [
+        keep unspaced [{"} name {": } seconds]
+    ]
+]
+
+json: unspaced [
+    "^{" newline
+    "    " delimit unspaced ["," newline "    "] entries newline
+    "^}" newline
+]
+
+write %benchmarks.json json
+print "Wrote benchmarks.json"
@@ -163,6 +163,7 @@ core: [
     m-stacks.c
 
     ; (N)atives
+    n-channel.c
     n-control.c
     n-data.c
     n-do.c
@@ -172,6 +173,7 @@ core: [
     n-math.c
     n-protect.c
     n-reduce.c
+    n-serial.c
     n-sets.c
     n-strings.c
     n-system.c
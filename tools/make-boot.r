@@ -396,10 +396,22 @@ for-each-datatype t [
         e-types/emit newline
     ]
 
-    e-types/emit 't {
-        #define IS_${T/NAME}(v) \
-            (VAL_TYPE(v) == REB_${T/NAME})  /* $<T/HEART> */
-    }
+    ; QUOTED!, QUASI!, and ISOTOPE! are pseudotypes whose REB_XXX never
+    ; appears in a HEART_BYTE()--they're synthesized from the quote byte by
+    ; VAL_TYPE().  All other types can use the faster single masked compare
+    ; of the heart and quote bytes together.  (See Is_Unquoted_Kind())
+    ;
+    either find ["quoted" "quasi" "isotope"] t/name [
+        e-types/emit 't {
+            #define IS_${T/NAME}(v) \
+                (VAL_TYPE(v) == REB_${T/NAME})  /* $<T/HEART> */
+        }
+    ][
+        e-types/emit 't {
+            #define IS_${T/NAME}(v) \
+                Is_Unquoted_Kind((v), REB_${T/NAME})  /* $<T/HEART> */
+        }
+    ]
     e-types/emit newline
 ]
 
@@ -974,6 +986,72 @@ symbol-strings: to binary! reduce collect [  ; no bootstrap MAKE BINARY!
     ]
 ]
 
+; All the built-in symbol spellings are known here, so their hash values can
+; be computed now instead of making Startup_Symbols() hash every spelling on
+; each boot.  This replicates Hash_Mix()/Hash_Final() from %s-crc.c with
+; wraparound 32-bit arithmetic (the bootstrap executable's AND/OR/XOR can't
+; be counted on for bitwise integer use, hence the helper functions).  The
+; debug build asserts the C hasher agrees, so a change to the constants or
+; mixing steps there can't silently drift from this copy.
+
+u32-wrap: func [n [integer!]] [return remainder n 4294967296]
+
+u32-shift-right: func [n [integer!] divisor [integer!]] [
+    return (n - remainder n divisor) / divisor  ; divisor is a power of 2
+]
+
+u32-multiply: func [a [integer!] b [integer!] <local> b-lo b-hi] [
+    b-lo: remainder b 65536
+    b-hi: u32-shift-right b 65536
+    return u32-wrap ((a * b-lo) + (65536 * remainder (a * b-hi) 65536))
+]
+
+u32-xor: func [a [integer!] b [integer!] <local> out bit] [
+    out: 0
+    bit: 1
+    count-up i 32 [
+        if (odd? a) <> (odd? b) [out: out + bit]
+        a: u32-shift-right a 2
+        b: u32-shift-right b 2
+        bit: bit * 2
+    ]
+    return out
+]
+
+hash-prime-2: 2246822519  ; 0x85EBCA77, see HASH_PRIME_2 in %s-crc.c
+hash-prime-3: 3266489917  ; 0xC2B2AE3D
+hash-prime-4: 668265263  ; 0x27D4EB2F
+hash-prime-5: 374761393  ; 0x165667B1
+
+hash32-mix: func [hash [integer!] lane [integer!]] [
+    hash: u32-wrap (hash + u32-multiply lane hash-prime-3)
+    hash: (131072 * remainder hash 32768) + (u32-shift-right hash 32768)
+    return u32-multiply hash hash-prime-4  ; above line rotated left by 17
+]
+
+hash32-final: func [hash [integer!]] [
+    hash: u32-xor hash (u32-shift-right hash 32768)  ; shift right 15
+    hash: u32-multiply hash hash-prime-2
+    hash: u32-xor hash (u32-shift-right hash 8192)  ; shift right 13
+    hash: u32-multiply hash hash-prime-3
+    hash: u32-xor hash (u32-shift-right hash 65536)  ; shift right 16
+    return hash
+]
+
+symbol-hashes: collect [
+    for-each word syms-words [
+        spelling: lowercase to text! word  ; Hash_Mix gets LO_CASE codepoints
+        hash: hash-prime-5
+        for-each byte as binary! spelling [
+            if byte > 127 [
+                fail ["Non-ASCII symbol needs LO_CASE logic:" word]
+            ]
+            hash: hash32-mix hash byte
+        ]
+        keep hash32-final hash
+    ]
+]
+
 compressed: gzip symbol-strings
 
 e-bootblock/emit 'compressed {
@@ -990,6 +1068,17 @@ e-bootblock/emit 'compressed {
     };
 }
 
+e-bootblock/emit 'symbol-hashes {
+    /*
+     * Hash_Scan_UTF8_Caseless_May_Fail() values for the symbol strings, in
+     * the same SYM_XXX order.  Precomputing these at build time means
+     * Startup_Symbols() does not have to hash any spellings at runtime.
+     */
+    const uint32_t Symbol_Hashes_Precomputed[$<length of symbol-hashes>] = {
+        $(Symbol-Hashes),
+    };
+}
+
 print [length of nats "natives"]
 
 e-bootblock/emit 'nats {
@@ -1067,6 +1156,11 @@ e-boot/emit 'fields {
     EXTERN_C const REBLEN Symbol_Strings_Compressed_Size;
     EXTERN_C const Byte Symbol_Strings_Compressed[];
 
+    /*
+     * Build-time hashes of the symbols, same order, to skip runtime hashing.
+     */
+    EXTERN_C const uint32_t Symbol_Hashes_Precomputed[];
+
     /*
      * Compressed data of the native specifications, uncompressed during boot.
      */
@@ -93,7 +93,7 @@ systems: [
         #SGD #LEN #LLC #NSER <NCM> <NPS> <ARC> /HID /ARC /DYN %M
 
     0.2.40 osx-x64/osx _
-        #SGD #LEN #LLC #NSER <NCM> <NPS> /HID /DYN %M
+        #SGD #LEN #LLC #NSER #SPWN <NCM> <NPS> /HID /DYN %M
 
     Windows: 3
     ;-------------------------------------------------------------------------
@@ -146,10 +146,10 @@ systems: [
         #SGD #LEN #LLC #PIP2 <HID> /HID /DYN %M %DL
 
     0.4.21 linux-arm/linux _  ; for modern Android builds, see Android section
-        #SGD #LEN #LLC #PIP2 <HID> <PIE> /HID /DYN %M %DL
+        #SGD #LEN #LLC #PIP2 #SPWN <HID> <PIE> /HID /DYN %M %DL
 
     0.4.22 linux-aarch64/linux "libc6-aarch64"
-        #SGD #LEN #LLC #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #PIP2 #SPWN #LP64 <HID> /HID /DYN %M %DL
 
     0.4.30 linux-mips/linux "libc6-mips"
         #SGD #LEN #LLC #PIP2 <HID> /HID /DYN %M %DL
@@ -158,7 +158,7 @@ systems: [
         #SGD #BEN #LLC #PIP2 <HID> /HID /DYN %M %DL
 
     0.4.40 linux-x64/linux "libc-x64"
-        #SGD #LEN #LLC #PIP2 #LP64 <HID> /HID /DYN %M %DL
+        #SGD #LEN #LLC #PIP2 #SPWN #LP64 <HID> /HID /DYN %M %DL
 
     0.4.60 linux-axp/linux "dec-alpha"
         #SGD #LEN #LLC #PIP2 #LP64 <HID> /HID /DYN %M %DL
@@ -383,6 +383,13 @@ export system-definitions: make object! [
     PIP2: "USE_PIPE2_NOT_PIPE"    ; pipe2() linux only, glibc 2.9 or later
     NSER:                         ; strerror_r() in glibc 2.3.4, not 2.3.0
         "USE_STRERROR_NOT_STRERROR_R"
+
+    ; CALL spawns subprocesses with posix_spawn() instead of fork()+execvp(),
+    ; which avoids copying the interpreter's page tables for each spawn.  It
+    ; needs a libc whose posix_spawn() reports exec failures in its return
+    ; value: glibc 2.26+, musl, bionic API 28+, or Apple's syscall version.
+    ;
+    SPWN: "USE_POSIX_SPAWN_NOT_FORK"
 ]
 
 export compiler-flags: make object! [